@@ -63,10 +63,12 @@ typedef struct
 
    void*                         A;
    void*                         matvecData;
+   void*                         matMultiVecData;
    void*                         precondData;
 
    void*                         B;
    void*                         matvecDataB;
+   void*                         matMultiVecDataB;
    void*                         T;
    void*                         matvecDataT;
 
@@ -140,6 +142,16 @@ hypre_LOBPCGDestroy( void *pcg_vdata )
          (*(mv->MatvecDestroy))(pcg_data->matvecDataT);
          pcg_data->matvecDataT = NULL;
       }
+      if ( pcg_data->matMultiVecData != NULL )
+      {
+         (*(mv->MatMultiVecDestroy))(pcg_data->matMultiVecData);
+         pcg_data->matMultiVecData = NULL;
+      }
+      if ( pcg_data->matMultiVecDataB != NULL )
+      {
+         (*(mv->MatMultiVecDestroy))(pcg_data->matMultiVecDataB);
+         pcg_data->matMultiVecDataB = NULL;
+      }
 
       lobpcg_clean( &(pcg_data->lobpcgData) );
 
@@ -165,6 +177,15 @@ hypre_LOBPCGSetup( void *pcg_vdata, void *A, void *b, void *x )
    }
    (pcg_data->matvecData) = (*(mv->MatvecCreate))(A, x);
 
+   if ( mv->MatMultiVec != NULL )
+   {
+      if ( pcg_data->matMultiVecData != NULL )
+      {
+         (*(mv->MatMultiVecDestroy))(pcg_data->matMultiVecData);
+      }
+      (pcg_data->matMultiVecData) = (*(mv->MatMultiVecCreate))(A, x);
+   }
+
    if ( precond_setup != NULL )
    {
       if ( pcg_data->T == NULL )
@@ -202,6 +223,15 @@ hypre_LOBPCGSetupB( void *pcg_vdata, void *B, void *x )
       (pcg_data->matvecDataB) = NULL;
    }
 
+   if ( mv->MatMultiVec != NULL )
+   {
+      if ( pcg_data->matMultiVecDataB != NULL )
+      {
+         (*(mv->MatMultiVecDestroy))(pcg_data->matMultiVecDataB);
+      }
+      (pcg_data->matMultiVecDataB) = (B != NULL) ? (*(mv->MatMultiVecCreate))(B, x) : NULL;
+   }
+
    return hypre_error_flag;
 }
 
@@ -384,6 +414,14 @@ hypre_LOBPCGMultiOperatorA( void *data, void * x, void*  y )
 {
    hypre_LOBPCGData *pcg_data = (hypre_LOBPCGData*)data;
    mv_InterfaceInterpreter* ii = pcg_data->interpreter;
+   HYPRE_MatvecFunctions * mv = pcg_data->matvecFunctions;
+
+   /* all vectors at once if the matrix interface supports it */
+   if ( mv->MatMultiVec != NULL )
+   {
+      (*(mv->MatMultiVec))(pcg_data->matMultiVecData, 1.0, pcg_data->A, x, 0.0, y);
+      return;
+   }
 
    ii->Eval( hypre_LOBPCGOperatorA, data, x, y );
 }
@@ -393,6 +431,13 @@ hypre_LOBPCGMultiOperatorB( void *data, void * x, void*  y )
 {
    hypre_LOBPCGData *pcg_data = (hypre_LOBPCGData*)data;
    mv_InterfaceInterpreter* ii = pcg_data->interpreter;
+   HYPRE_MatvecFunctions * mv = pcg_data->matvecFunctions;
+
+   if ( mv->MatMultiVec != NULL && pcg_data->B != NULL )
+   {
+      (*(mv->MatMultiVec))(pcg_data->matMultiVecDataB, 1.0, pcg_data->B, x, 0.0, y);
+      return;
+   }
 
    ii->Eval( hypre_LOBPCGOperatorB, data, x, y );
 }
@@ -517,8 +562,10 @@ HYPRE_LOBPCGCreate( mv_InterfaceInterpreter* ii, HYPRE_MatvecFunctions* mv,
    pcg_data->matvecFunctions             = mv;
 
    (pcg_data->matvecData)           = NULL;
+   (pcg_data->matMultiVecData)      = NULL;
    (pcg_data->B)                 = NULL;
    (pcg_data->matvecDataB)          = NULL;
+   (pcg_data->matMultiVecDataB)     = NULL;
    (pcg_data->T)                 = NULL;
    (pcg_data->matvecDataT)          = NULL;
    (pcg_data->precondData)          = NULL;
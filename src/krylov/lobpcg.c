@@ -20,6 +20,9 @@
 #include "fortran_matrix.h"
 #include "multivector.h"
 
+/* maximum number of Gram matrix blocks assembled with one reduction */
+#define LOBPCG_MAX_GRAM_BLOCKS 8
+
 static HYPRE_Int
 lobpcg_chol( utilities_FortranMatrix* a,
              HYPRE_Int (*dpotrf) (const char *uplo, HYPRE_Int *n, HYPRE_Real *a, HYPRE_Int *lda,
@@ -98,6 +101,35 @@ lobpcg_MultiVectorByMultiVector(
                                 utilities_FortranMatrixValues( xy ) );
 }
 
+static void
+lobpcg_MultiVectorByMultiVectorBlocks(
+   HYPRE_Int n,
+   mv_MultiVectorPtr* x,
+   mv_MultiVectorPtr* y,
+   utilities_FortranMatrix** xy
+)
+{
+   /* xy[k] = x[k]'*y[k] with one global reduction for all the blocks */
+
+   HYPRE_Int   k;
+   HYPRE_Int   gh[LOBPCG_MAX_GRAM_BLOCKS];
+   HYPRE_Int   h[LOBPCG_MAX_GRAM_BLOCKS];
+   HYPRE_Int   w[LOBPCG_MAX_GRAM_BLOCKS];
+   HYPRE_Real* v[LOBPCG_MAX_GRAM_BLOCKS];
+
+   hypre_assert( n <= LOBPCG_MAX_GRAM_BLOCKS );
+
+   for ( k = 0; k < n; k++ )
+   {
+      gh[k] = utilities_FortranMatrixGlobalHeight( xy[k] );
+      h[k]  = utilities_FortranMatrixHeight( xy[k] );
+      w[k]  = utilities_FortranMatrixWidth( xy[k] );
+      v[k]  = utilities_FortranMatrixValues( xy[k] );
+   }
+
+   mv_MultiVectorByMultiVectorBlocks( n, x, y, gh, h, w, v );
+}
+
 static void
 lobpcg_MultiVectorByMatrix(
    mv_MultiVectorPtr x,
@@ -320,6 +352,12 @@ lobpcg_solve( mv_MultiVectorPtr blockVectorX,
 
    utilities_FortranMatrix* gramPBP; /* PP block of gramB (ref) */
 
+   /* blocks of the Gram matrices computed with a single reduction */
+   HYPRE_Int                numGramBlocks;
+   mv_MultiVectorPtr        gramBlockX[LOBPCG_MAX_GRAM_BLOCKS];
+   mv_MultiVectorPtr        gramBlockY[LOBPCG_MAX_GRAM_BLOCKS];
+   utilities_FortranMatrix* gramBlock[LOBPCG_MAX_GRAM_BLOCKS];
+
    utilities_FortranMatrix* gramYBY; /* Matrices for constraints */
    utilities_FortranMatrix* gramYBX;
    utilities_FortranMatrix* tempYBX;
@@ -600,14 +638,20 @@ lobpcg_solve( mv_MultiVectorPtr blockVectorX,
       operatorA( operatorAData, mv_MultiVectorGetData(blockVectorX),
                  mv_MultiVectorGetData(blockVectorAX) );
 
-      /* gramXAX = X'*AX */
+      /* gramXAX = X'*AX, gramXBX = X'*BX */
       utilities_FortranMatrixSelectBlock( gramA, 1, sizeX, 1, sizeX, gramXAX );
-      lobpcg_MultiVectorByMultiVector( blockVectorX, blockVectorAX, gramXAX );
-      utilities_FortranMatrixSymmetrize( gramXAX );
-
-      /* gramXBX = X'*X */
       utilities_FortranMatrixSelectBlock( gramB, 1, sizeX, 1, sizeX, gramXBX );
-      lobpcg_MultiVectorByMultiVector( blockVectorX, blockVectorBX, gramXBX );
+
+      numGramBlocks = 0;
+      gramBlockX[numGramBlocks] = blockVectorX;
+      gramBlockY[numGramBlocks] = blockVectorAX;
+      gramBlock[numGramBlocks++] = gramXAX;
+      gramBlockX[numGramBlocks] = blockVectorX;
+      gramBlockY[numGramBlocks] = blockVectorBX;
+      gramBlock[numGramBlocks++] = gramXBX;
+      lobpcg_MultiVectorByMultiVectorBlocks( numGramBlocks, gramBlockX, gramBlockY, gramBlock );
+
+      utilities_FortranMatrixSymmetrize( gramXAX );
       utilities_FortranMatrixSymmetrize( gramXBX );
       /*  utilities_FortranMatrixSetToIdentity( gramXBX );*/ /* X may be bad! */
 
@@ -823,17 +867,22 @@ lobpcg_solve( mv_MultiVectorPtr blockVectorX,
       utilities_FortranMatrixClear( gramXAX );
       utilities_FortranMatrixSetDiagonal( gramXAX, lambda );
 
-      lobpcg_MultiVectorByMultiVector( blockVectorR, blockVectorAX, gramRAX );
-
-      lobpcg_MultiVectorByMultiVector( blockVectorR, blockVectorAR, gramRAR );
-      utilities_FortranMatrixSymmetrize( gramRAR );
-
       utilities_FortranMatrixSetToIdentity( gramXBX );
 
-      lobpcg_MultiVectorByMultiVector( blockVectorR, blockVectorBX, gramRBX );
-
       utilities_FortranMatrixSetToIdentity( gramRBR );
 
+      /* all the computed blocks of the Gram matrices share one reduction */
+      numGramBlocks = 0;
+      gramBlockX[numGramBlocks] = blockVectorR;
+      gramBlockY[numGramBlocks] = blockVectorAX;
+      gramBlock[numGramBlocks++] = gramRAX;
+      gramBlockX[numGramBlocks] = blockVectorR;
+      gramBlockY[numGramBlocks] = blockVectorAR;
+      gramBlock[numGramBlocks++] = gramRAR;
+      gramBlockX[numGramBlocks] = blockVectorR;
+      gramBlockY[numGramBlocks] = blockVectorBX;
+      gramBlock[numGramBlocks++] = gramRBX;
+
       if ( *iterationNumber > 1 )
       {
 
@@ -845,16 +894,30 @@ lobpcg_solve( mv_MultiVectorPtr blockVectorX,
          utilities_FortranMatrixSelectBlock( gramB, firstP, lastP, firstR, lastR, gramPBR );
          utilities_FortranMatrixSelectBlock( gramB, firstP, lastP, firstP, lastP, gramPBP );
 
-         lobpcg_MultiVectorByMultiVector( blockVectorP, blockVectorAX, gramPAX );
-
-         lobpcg_MultiVectorByMultiVector( blockVectorP, blockVectorAR, gramPAR );
+         gramBlockX[numGramBlocks] = blockVectorP;
+         gramBlockY[numGramBlocks] = blockVectorAX;
+         gramBlock[numGramBlocks++] = gramPAX;
+         gramBlockX[numGramBlocks] = blockVectorP;
+         gramBlockY[numGramBlocks] = blockVectorAR;
+         gramBlock[numGramBlocks++] = gramPAR;
+         gramBlockX[numGramBlocks] = blockVectorP;
+         gramBlockY[numGramBlocks] = blockVectorAP;
+         gramBlock[numGramBlocks++] = gramPAP;
+         gramBlockX[numGramBlocks] = blockVectorP;
+         gramBlockY[numGramBlocks] = blockVectorBX;
+         gramBlock[numGramBlocks++] = gramPBX;
+         gramBlockX[numGramBlocks] = blockVectorP;
+         gramBlockY[numGramBlocks] = blockVectorBR;
+         gramBlock[numGramBlocks++] = gramPBR;
+      }
 
-         lobpcg_MultiVectorByMultiVector( blockVectorP, blockVectorAP, gramPAP );
-         utilities_FortranMatrixSymmetrize( gramPAP );
+      lobpcg_MultiVectorByMultiVectorBlocks( numGramBlocks, gramBlockX, gramBlockY, gramBlock );
 
-         lobpcg_MultiVectorByMultiVector( blockVectorP, blockVectorBX, gramPBX );
+      utilities_FortranMatrixSymmetrize( gramRAR );
 
-         lobpcg_MultiVectorByMultiVector( blockVectorP, blockVectorBR, gramPBR );
+      if ( *iterationNumber > 1 )
+      {
+         utilities_FortranMatrixSymmetrize( gramPAP );
 
          utilities_FortranMatrixSetToIdentity( gramPBP );
       }
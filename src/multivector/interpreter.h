@@ -48,6 +48,12 @@ typedef struct
    void   (*MultiXapy)          ( void *x, HYPRE_Int, HYPRE_Int, HYPRE_Int, HYPRE_Complex*, void *y );
    void   (*Eval)               ( void (*f)( void*, void*, void* ), void*, void *x, void *y );
 
+   /* optional (may be NULL): x'*y on the local part of the vectors only, and
+      the sum of n values over the processes sharing the vectors of x; these
+      allow several multivector products to share a single global reduction */
+   void      (*MultiInnerProdLocal) ( void *x, void *y, HYPRE_Int, HYPRE_Int, HYPRE_Int, HYPRE_Real* );
+   HYPRE_Int (*GlobalSum)           ( void *x, HYPRE_Int n, HYPRE_Real *val );
+
 } mv_InterfaceInterpreter;
 
 #endif
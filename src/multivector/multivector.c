@@ -175,6 +175,63 @@ mv_MultiVectorByMultiVector( mv_MultiVectorPtr x, mv_MultiVectorPtr y,
    ( x->data, y->data, xyGHeight, xyHeight, xyWidth, xy );
 }
 
+void
+mv_MultiVectorByMultiVectorBlocks( HYPRE_Int n, mv_MultiVectorPtr* x, mv_MultiVectorPtr* y,
+                                   HYPRE_Int* gh, HYPRE_Int* h, HYPRE_Int* w, HYPRE_Real** v )
+{
+   /* v[k] = x[k]'*y[k] */
+
+   HYPRE_Int i, j, k, size;
+   HYPRE_Real* buf;
+   HYPRE_Real* p;
+   mv_InterfaceInterpreter* ii;
+
+   if ( n < 1 )
+   {
+      return;
+   }
+
+   hypre_assert( x != NULL && y != NULL );
+   ii = x[0]->interpreter;
+
+   if ( ii->MultiInnerProdLocal == NULL || ii->GlobalSum == NULL )
+   {
+      for ( k = 0; k < n; k++ )
+      {
+         mv_MultiVectorByMultiVector( x[k], y[k], gh[k], h[k], w[k], v[k] );
+      }
+      return;
+   }
+
+   for ( k = 0, size = 0; k < n; k++ )
+   {
+      size += h[k] * w[k];
+   }
+   buf = hypre_TAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+
+   /* local products of all blocks first, then one reduction */
+   for ( k = 0, p = buf; k < n; k++ )
+   {
+      (ii->MultiInnerProdLocal)( x[k]->data, y[k]->data, h[k], h[k], w[k], p );
+      p += h[k] * w[k];
+   }
+
+   (ii->GlobalSum)( x[0]->data, size, buf );
+
+   for ( k = 0, p = buf; k < n; k++ )
+   {
+      for ( j = 0; j < w[k]; j++ )
+      {
+         for ( i = 0; i < h[k]; i++, p++ )
+         {
+            v[k][j * gh[k] + i] = *p;
+         }
+      }
+   }
+
+   hypre_TFree(buf, HYPRE_MEMORY_HOST);
+}
+
 void
 mv_MultiVectorByMultiVectorDiag( mv_MultiVectorPtr x, mv_MultiVectorPtr y,
                                  HYPRE_Int* mask, HYPRE_Int n, HYPRE_Real* d )
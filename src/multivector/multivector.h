@@ -71,6 +71,13 @@ void
 mv_MultiVectorByMultiVector( mv_MultiVectorPtr x, mv_MultiVectorPtr y,
                              HYPRE_Int gh, HYPRE_Int h, HYPRE_Int w, HYPRE_Real* v );
 
+/* computes the matrices v[k] = x[k]'*y[k], k = 0,...,n-1, stored as above;
+   the products share a single global reduction if the interpreter provides
+   MultiInnerProdLocal and GlobalSum */
+void
+mv_MultiVectorByMultiVectorBlocks( HYPRE_Int n, mv_MultiVectorPtr* x, mv_MultiVectorPtr* y,
+                                   HYPRE_Int* gh, HYPRE_Int* h, HYPRE_Int* w, HYPRE_Real** v );
+
 /*computes the diagonal of x'*y stored in diag(mask) */
 void
 mv_MultiVectorByMultiVectorDiag( mv_MultiVectorPtr, mv_MultiVectorPtr,
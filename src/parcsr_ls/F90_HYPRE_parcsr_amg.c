@@ -1541,6 +1541,38 @@ hypre_F90_IFACE(hypre_boomeramgsetaggnumlevels, HYPRE_BOOMERAMGSETAGGNUMLEVELS)
                 hypre_F90_PassInt (agg_num_levels) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSANumLevels
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetsanumlevels, HYPRE_BOOMERAMGSETSANUMLEVELS)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *sa_num_levels,
+  hypre_F90_Int *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetSANumLevels(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (sa_num_levels) ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSAJacobiWeight
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetsajacobiweight, HYPRE_BOOMERAMGSETSAJACOBIWEIGHT)
+( hypre_F90_Obj  *solver,
+  hypre_F90_Real *sa_jacobi_weight,
+  hypre_F90_Int  *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetSAJacobiWeight(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassReal (sa_jacobi_weight) ) );
+}
+
 
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetAggInterpType
@@ -1979,6 +2011,22 @@ hypre_F90_IFACE(hypre_boomeramgsetseqthrshold, HYPRE_BOOMERAMGSETSEQTHRSHOLD)
                 hypre_F90_PassInt (seq_th) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRedistThreshold
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetredistthrshold, HYPRE_BOOMERAMGSETREDISTTHRSHOLD)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *redist_th,
+  hypre_F90_Int *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetRedistThreshold(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (redist_th) ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -2047,6 +2095,38 @@ hypre_F90_IFACE(hypre_boomeramgsetlvlnongaltol, HYPRE_BOOMERAMGSETLVLNONGALTOL)
                 hypre_F90_PassInt (level) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNonGalerkinOpComplexity
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetnongaloc, HYPRE_BOOMERAMGSETNONGALOC)
+( hypre_F90_Obj *solver,
+  hypre_F90_Real *op_complexity,
+  hypre_F90_Int *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetNonGalerkinOpComplexity(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassReal (op_complexity) ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNonGalerkinStencilGrowth
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetnongalsg, HYPRE_BOOMERAMGSETNONGALSG)
+( hypre_F90_Obj *solver,
+  hypre_F90_Real *stencil_growth,
+  hypre_F90_Int *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassReal (stencil_growth) ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetGSMG
  *--------------------------------------------------------------------------*/
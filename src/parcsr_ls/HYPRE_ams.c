@@ -198,6 +198,26 @@ HYPRE_Int HYPRE_AMSSetCycleType(HYPRE_Solver solver,
    return hypre_AMSSetCycleType((void *) solver, cycle_type);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_AMSSetConcurrentSubspaces
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_AMSSetConcurrentSubspaces(HYPRE_Solver solver,
+                                          HYPRE_Int concurrent_subspaces)
+{
+   return hypre_AMSSetConcurrentSubspaces((void *) solver, concurrent_subspaces);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_AMSSetMatrixFreePi
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_AMSSetMatrixFreePi(HYPRE_Solver solver,
+                                   HYPRE_Int matrix_free_Pi)
+{
+   return hypre_AMSSetMatrixFreePi((void *) solver, matrix_free_Pi);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_AMSSetPrintLevel
  *--------------------------------------------------------------------------*/
@@ -86,6 +86,36 @@ HYPRE_BoomerAMGSolveT( HYPRE_Solver solver,
                                    (hypre_ParVector *) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGAutotune
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGAutotune( HYPRE_Solver       solver,
+                         HYPRE_ParCSRMatrix A,
+                         HYPRE_ParVector    b,
+                         HYPRE_ParVector    x,
+                         HYPRE_Int          max_trials,
+                         const char        *filename )
+{
+   return ( hypre_BoomerAMGAutotune( (void *) solver,
+                                     (hypre_ParCSRMatrix *) A,
+                                     (hypre_ParVector *) b,
+                                     (hypre_ParVector *) x,
+                                     max_trials, filename ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGReadAutotune
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGReadAutotune( HYPRE_Solver  solver,
+                             const char   *filename )
+{
+   return ( hypre_BoomerAMGReadAutotune( (void *) solver, filename ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRestriction
  *--------------------------------------------------------------------------*/
@@ -191,6 +221,24 @@ HYPRE_BoomerAMGGetSeqThreshold( HYPRE_Solver solver,
    return ( hypre_BoomerAMGGetSeqThreshold( (void *) solver, seq_threshold ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRedistThreshold, HYPRE_BoomerAMGGetRedistThreshold
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRedistThreshold( HYPRE_Solver solver,
+                                   HYPRE_Int    redist_threshold )
+{
+   return ( hypre_BoomerAMGSetRedistThreshold( (void *) solver, redist_threshold ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetRedistThreshold( HYPRE_Solver  solver,
+                                   HYPRE_Int    *redist_threshold )
+{
+   return ( hypre_BoomerAMGGetRedistThreshold( (void *) solver, redist_threshold ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRedundant, HYPRE_BoomerAMGGetRedundant
  *--------------------------------------------------------------------------*/
@@ -1434,6 +1482,28 @@ HYPRE_BoomerAMGSetAggNumLevels( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetAggNumLevels( (void *) solver, agg_num_levels ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSANumLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSANumLevels( HYPRE_Solver  solver,
+                               HYPRE_Int          sa_num_levels  )
+{
+   return ( hypre_BoomerAMGSetSANumLevels( (void *) solver, sa_num_levels ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSAJacobiWeight
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSAJacobiWeight( HYPRE_Solver  solver,
+                                  HYPRE_Real         sa_jacobi_weight  )
+{
+   return ( hypre_BoomerAMGSetSAJacobiWeight( (void *) solver, sa_jacobi_weight ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetAggInterpType
  *--------------------------------------------------------------------------*/
@@ -1929,6 +1999,28 @@ HYPRE_BoomerAMGSetLevelNonGalerkinTol (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetLevelNonGalerkinTol ( (void *) solver, nongalerkin_tol, level ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNonGalerkinOpComplexity
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNonGalerkinOpComplexity (HYPRE_Solver solver,
+                                           HYPRE_Real   op_complexity)
+{
+   return (hypre_BoomerAMGSetNonGalerkinOpComplexity ( (void *) solver, op_complexity ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNonGalerkinStencilGrowth
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNonGalerkinStencilGrowth (HYPRE_Solver solver,
+                                            HYPRE_Real   stencil_growth)
+{
+   return (hypre_BoomerAMGSetNonGalerkinStencilGrowth ( (void *) solver, stencil_growth ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetNonGalerkTol
  *--------------------------------------------------------------------------*/
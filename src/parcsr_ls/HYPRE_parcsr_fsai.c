@@ -176,6 +176,50 @@ HYPRE_FSAIGetKapTolerance( HYPRE_Solver  solver,
    return ( hypre_FSAIGetKapTolerance( (void *) solver, kap_tolerance ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_FSAISetNumLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FSAISetNumLevels( HYPRE_Solver solver,
+                        HYPRE_Int    num_levels )
+{
+   return ( hypre_FSAISetNumLevels( (void *) solver, num_levels ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_FSAIGetNumLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FSAIGetNumLevels( HYPRE_Solver  solver,
+                        HYPRE_Int    *num_levels )
+{
+   return ( hypre_FSAIGetNumLevels( (void *) solver, num_levels ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_FSAISetThreshold
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FSAISetThreshold( HYPRE_Solver solver,
+                        HYPRE_Real   threshold )
+{
+   return ( hypre_FSAISetThreshold( (void *) solver, threshold ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_FSAIGetThreshold
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FSAIGetThreshold( HYPRE_Solver  solver,
+                        HYPRE_Real   *threshold )
+{
+   return ( hypre_FSAIGetThreshold( (void *) solver, threshold ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_FSAISetTolerance
  *--------------------------------------------------------------------------*/
@@ -154,6 +154,368 @@ aux_indexFromMask( HYPRE_Int n, HYPRE_Int* mask, HYPRE_Int* index )
 }
 
 
+/* Collects the ParVectors of x selected by its mask and returns their number */
+
+HYPRE_Int
+hypre_ParCSRMultiVectorCollect( void* x_, hypre_ParVector** px )
+{
+   mv_TempMultiVector* x = (mv_TempMultiVector*) x_;
+   HYPRE_Int i, m;
+
+   for ( i = m = 0; i < x->numVectors; i++ )
+      if ( x->mask == NULL || x->mask[i] )
+      {
+         px[m++] = (hypre_ParVector*) x->vector[i];
+      }
+
+   return m;
+}
+
+/* xy = x'*y for the local rows only.  On the host, all products are
+   computed in one sweep over the rows: each thread takes a range of rows,
+   which it traverses in blocks that stay in cache while they are combined
+   with up to four vectors of y at a time. */
+
+#define HYPRE_PARCSR_MV_ROW_BLOCK 512
+
+void
+hypre_ParCSRMultiVectorInnerProdLocal( void* x_, void* y_,
+                                       HYPRE_Int xyGHeight, HYPRE_Int xyHeight,
+                                       HYPRE_Int xyWidth, HYPRE_Real* xyVal )
+{
+   mv_TempMultiVector* x = (mv_TempMultiVector*) x_;
+   mv_TempMultiVector* y = (mv_TempMultiVector*) y_;
+   hypre_ParVector**   px;
+   hypre_ParVector**   py;
+   HYPRE_Complex**     xd;
+   HYPRE_Complex**     yd;
+   HYPRE_Real*         parts;
+   HYPRE_Int           mx, my, n, ix, iy, t, num_threads;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   px = hypre_TAlloc(hypre_ParVector*, x->numVectors, HYPRE_MEMORY_HOST);
+   py = hypre_TAlloc(hypre_ParVector*, y->numVectors, HYPRE_MEMORY_HOST);
+   mx = hypre_ParCSRMultiVectorCollect( x, px );
+   my = hypre_ParCSRMultiVectorCollect( y, py );
+   hypre_assert( mx == xyHeight && my == xyWidth );
+
+   if ( mx == 0 || my == 0 )
+   {
+      hypre_TFree(px, HYPRE_MEMORY_HOST);
+      hypre_TFree(py, HYPRE_MEMORY_HOST);
+      return;
+   }
+
+   if ( hypre_GetExecPolicy1(hypre_ParVectorMemoryLocation(px[0])) == HYPRE_EXEC_DEVICE )
+   {
+      for ( iy = 0; iy < my; iy++ )
+      {
+         for ( ix = 0; ix < mx; ix++ )
+         {
+            xyVal[iy * xyGHeight + ix] =
+               hypre_SeqVectorInnerProd( hypre_ParVectorLocalVector(px[ix]),
+                                         hypre_ParVectorLocalVector(py[iy]) );
+         }
+      }
+      hypre_TFree(px, HYPRE_MEMORY_HOST);
+      hypre_TFree(py, HYPRE_MEMORY_HOST);
+      return;
+   }
+
+   n  = hypre_VectorSize(hypre_ParVectorLocalVector(px[0]));
+   xd = hypre_TAlloc(HYPRE_Complex*, mx, HYPRE_MEMORY_HOST);
+   yd = hypre_TAlloc(HYPRE_Complex*, my, HYPRE_MEMORY_HOST);
+   for ( ix = 0; ix < mx; ix++ )
+   {
+      xd[ix] = hypre_VectorData(hypre_ParVectorLocalVector(px[ix]));
+   }
+   for ( iy = 0; iy < my; iy++ )
+   {
+      yd[iy] = hypre_VectorData(hypre_ParVectorLocalVector(py[iy]));
+   }
+
+   /* partial products of each thread, summed up in a fixed order below */
+   num_threads = hypre_NumThreads();
+   parts = hypre_CTAlloc(HYPRE_Real, num_threads * mx * my, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(ix, iy)
+#endif
+   {
+      HYPRE_Real*    part = parts + hypre_GetThreadNum() * mx * my;
+      HYPRE_Complex* x0;
+      HYPRE_Complex *y0, *y1, *y2, *y3;
+      HYPRE_Real     s0, s1, s2, s3;
+      HYPRE_Int      ns, ne, k0, k1, k, jy;
+
+      hypre_partition1D(n, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      for ( k0 = ns; k0 < ne; k0 += HYPRE_PARCSR_MV_ROW_BLOCK )
+      {
+         k1 = hypre_min(k0 + HYPRE_PARCSR_MV_ROW_BLOCK, ne);
+
+         for ( iy = 0; iy + 3 < my; iy += 4 )
+         {
+            y0 = yd[iy];
+            y1 = yd[iy + 1];
+            y2 = yd[iy + 2];
+            y3 = yd[iy + 3];
+            for ( ix = 0; ix < mx; ix++ )
+            {
+               x0 = xd[ix];
+               s0 = s1 = s2 = s3 = 0.0;
+               for ( k = k0; k < k1; k++ )
+               {
+                  s0 += hypre_conj(y0[k]) * x0[k];
+                  s1 += hypre_conj(y1[k]) * x0[k];
+                  s2 += hypre_conj(y2[k]) * x0[k];
+                  s3 += hypre_conj(y3[k]) * x0[k];
+               }
+               part[iy * mx + ix]       += s0;
+               part[(iy + 1) * mx + ix] += s1;
+               part[(iy + 2) * mx + ix] += s2;
+               part[(iy + 3) * mx + ix] += s3;
+            }
+         }
+
+         for ( jy = iy; jy < my; jy++ )
+         {
+            y0 = yd[jy];
+            for ( ix = 0; ix < mx; ix++ )
+            {
+               x0 = xd[ix];
+               s0 = 0.0;
+               for ( k = k0; k < k1; k++ )
+               {
+                  s0 += hypre_conj(y0[k]) * x0[k];
+               }
+               part[jy * mx + ix] += s0;
+            }
+         }
+      }
+   }
+
+   for ( iy = 0; iy < my; iy++ )
+   {
+      for ( ix = 0; ix < mx; ix++ )
+      {
+         xyVal[iy * xyGHeight + ix] = parts[iy * mx + ix];
+         for ( t = 1; t < num_threads; t++ )
+         {
+            xyVal[iy * xyGHeight + ix] += parts[(t * my + iy) * mx + ix];
+         }
+      }
+   }
+
+   hypre_TFree(parts, HYPRE_MEMORY_HOST);
+   hypre_TFree(xd, HYPRE_MEMORY_HOST);
+   hypre_TFree(yd, HYPRE_MEMORY_HOST);
+   hypre_TFree(px, HYPRE_MEMORY_HOST);
+   hypre_TFree(py, HYPRE_MEMORY_HOST);
+}
+
+/* Sums n values over the processes of the vectors of x */
+
+HYPRE_Int
+hypre_ParCSRMultiVectorGlobalSum( void* x_, HYPRE_Int n, HYPRE_Real* val )
+{
+   mv_TempMultiVector* x = (mv_TempMultiVector*) x_;
+   HYPRE_Real*         sum;
+   HYPRE_Int           i;
+
+   hypre_assert( x != NULL && x->numVectors > 0 );
+
+   if ( n < 1 )
+   {
+      return hypre_error_flag;
+   }
+
+   sum = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allreduce(val, sum, n, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_ParVectorComm((hypre_ParVector*) x->vector[0]));
+   for ( i = 0; i < n; i++ )
+   {
+      val[i] = sum[i];
+   }
+   hypre_TFree(sum, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/* xy = x'*y with a single global reduction for all the inner products */
+
+void
+hypre_ParCSRMultiVectorInnerProd( void* x_, void* y_,
+                                  HYPRE_Int xyGHeight, HYPRE_Int xyHeight,
+                                  HYPRE_Int xyWidth, HYPRE_Real* xyVal )
+{
+   HYPRE_Real* buf;
+   HYPRE_Int   i, j;
+
+   buf = hypre_TAlloc(HYPRE_Real, xyHeight * xyWidth, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMultiVectorInnerProdLocal( x_, y_, xyHeight, xyHeight, xyWidth, buf );
+   hypre_ParCSRMultiVectorGlobalSum( x_, xyHeight * xyWidth, buf );
+
+   for ( j = 0; j < xyWidth; j++ )
+   {
+      for ( i = 0; i < xyHeight; i++ )
+      {
+         xyVal[j * xyGHeight + i] = buf[j * xyHeight + i];
+      }
+   }
+
+   hypre_TFree(buf, HYPRE_MEMORY_HOST);
+}
+
+/* diag = diag(x'*y) with a single global reduction */
+
+void
+hypre_ParCSRMultiVectorInnerProdDiag( void* x_, void* y_,
+                                      HYPRE_Int* mask, HYPRE_Int n, HYPRE_Real* diag )
+{
+   mv_TempMultiVector* x = (mv_TempMultiVector*) x_;
+   mv_TempMultiVector* y = (mv_TempMultiVector*) y_;
+   hypre_ParVector**   px;
+   hypre_ParVector**   py;
+   HYPRE_Real*         buf;
+   HYPRE_Int*          index;
+   HYPRE_Int           i, mx, my, m;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   px = hypre_TAlloc(hypre_ParVector*, x->numVectors, HYPRE_MEMORY_HOST);
+   py = hypre_TAlloc(hypre_ParVector*, y->numVectors, HYPRE_MEMORY_HOST);
+   mx = hypre_ParCSRMultiVectorCollect( x, px );
+   my = hypre_ParCSRMultiVectorCollect( y, py );
+   m  = aux_maskCount( n, mask );
+   hypre_assert( mx == my && mx == m );
+
+   buf   = hypre_TAlloc(HYPRE_Real, m, HYPRE_MEMORY_HOST);
+   index = hypre_TAlloc(HYPRE_Int, m, HYPRE_MEMORY_HOST);
+   aux_indexFromMask( n, mask, index );
+
+   for ( i = 0; i < m; i++ )
+   {
+      buf[i] = hypre_SeqVectorInnerProd( hypre_ParVectorLocalVector(px[i]),
+                                         hypre_ParVectorLocalVector(py[i]) );
+   }
+   hypre_ParCSRMultiVectorGlobalSum( x_, m, buf );
+
+   for ( i = 0; i < m; i++ )
+   {
+      diag[index[i] - 1] = buf[i];
+   }
+
+   hypre_TFree(index, HYPRE_MEMORY_HOST);
+   hypre_TFree(buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(px, HYPRE_MEMORY_HOST);
+   hypre_TFree(py, HYPRE_MEMORY_HOST);
+}
+
+/* y = alpha*A*x + beta*y for all vectors of x and y.  On the host, the
+   vectors are packed into ParVectors with num_vectors > 1, so that A is
+   traversed once for all of them. */
+
+HYPRE_Int
+hypre_ParCSRMultiVectorMatvec( void* matvec_data, HYPRE_Complex alpha, void* A_,
+                               void* x_, HYPRE_Complex beta, void* y_ )
+{
+   hypre_ParCSRMatrix* A = (hypre_ParCSRMatrix*) A_;
+   mv_TempMultiVector* x = (mv_TempMultiVector*) x_;
+   mv_TempMultiVector* y = (mv_TempMultiVector*) y_;
+   hypre_ParVector**   px;
+   hypre_ParVector**   py;
+   hypre_ParVector*    X;
+   hypre_ParVector*    Y;
+   HYPRE_Complex*      X_data;
+   HYPRE_Complex*      Y_data;
+   HYPRE_Complex*      v_data;
+   HYPRE_Int           i, j, m, my, nx, ny;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   px = hypre_TAlloc(hypre_ParVector*, x->numVectors, HYPRE_MEMORY_HOST);
+   py = hypre_TAlloc(hypre_ParVector*, y->numVectors, HYPRE_MEMORY_HOST);
+   m  = hypre_ParCSRMultiVectorCollect( x, px );
+   my = hypre_ParCSRMultiVectorCollect( y, py );
+   hypre_assert( m == my );
+
+   if ( m == 1 ||
+        hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_DEVICE )
+   {
+      for ( i = 0; i < m; i++ )
+      {
+         hypre_ParCSRMatrixMatvec( alpha, A, px[i], beta, py[i] );
+      }
+   }
+   else if ( m > 1 )
+   {
+      nx = hypre_VectorSize(hypre_ParVectorLocalVector(px[0]));
+      ny = hypre_VectorSize(hypre_ParVectorLocalVector(py[0]));
+
+      X = hypre_ParMultiVectorCreate( hypre_ParVectorComm(px[0]), hypre_ParVectorGlobalSize(px[0]),
+                                      hypre_ParVectorPartitioning(px[0]), m );
+      Y = hypre_ParMultiVectorCreate( hypre_ParVectorComm(py[0]), hypre_ParVectorGlobalSize(py[0]),
+                                      hypre_ParVectorPartitioning(py[0]), m );
+      hypre_ParVectorInitialize_v2( X, HYPRE_MEMORY_HOST );
+      hypre_ParVectorInitialize_v2( Y, HYPRE_MEMORY_HOST );
+      X_data = hypre_VectorData(hypre_ParVectorLocalVector(X));
+      Y_data = hypre_VectorData(hypre_ParVectorLocalVector(Y));
+
+      for ( j = 0; j < m; j++ )
+      {
+         v_data = hypre_VectorData(hypre_ParVectorLocalVector(px[j]));
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for ( i = 0; i < nx; i++ )
+         {
+            X_data[j * nx + i] = v_data[i];
+         }
+
+         if ( beta != 0.0 )
+         {
+            v_data = hypre_VectorData(hypre_ParVectorLocalVector(py[j]));
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+            for ( i = 0; i < ny; i++ )
+            {
+               Y_data[j * ny + i] = v_data[i];
+            }
+         }
+      }
+      if ( beta == 0.0 )
+      {
+         hypre_ParVectorSetConstantValues( Y, 0.0 );
+      }
+
+      hypre_ParCSRMatrixMatvec( alpha, A, X, beta, Y );
+
+      for ( j = 0; j < m; j++ )
+      {
+         v_data = hypre_VectorData(hypre_ParVectorLocalVector(py[j]));
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for ( i = 0; i < ny; i++ )
+         {
+            v_data[i] = Y_data[j * ny + i];
+         }
+      }
+
+      hypre_ParVectorDestroy( X );
+      hypre_ParVectorDestroy( Y );
+   }
+
+   hypre_TFree(px, HYPRE_MEMORY_HOST);
+   hypre_TFree(py, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /* The function below is a temporary one that fills the multivector
    part of the HYPRE_InterfaceInterpreter structure with pointers
    that come from the temporary implementation of the multivector
@@ -188,13 +550,15 @@ HYPRE_TempParCSRSetupInterpreter( mv_InterfaceInterpreter *i )
    i->CopyMultiVector = mv_TempMultiVectorCopy;
    i->ClearMultiVector = mv_TempMultiVectorClear;
    i->SetRandomVectors = mv_TempMultiVectorSetRandom;
-   i->MultiInnerProd = mv_TempMultiVectorByMultiVector;
-   i->MultiInnerProdDiag = mv_TempMultiVectorByMultiVectorDiag;
+   i->MultiInnerProd = hypre_ParCSRMultiVectorInnerProd;
+   i->MultiInnerProdDiag = hypre_ParCSRMultiVectorInnerProdDiag;
    i->MultiVecMat = mv_TempMultiVectorByMatrix;
    i->MultiVecMatDiag = mv_TempMultiVectorByDiagonal;
    i->MultiAxpy = mv_TempMultiVectorAxpy;
    i->MultiXapy = mv_TempMultiVectorXapy;
    i->Eval = mv_TempMultiVectorEval;
+   i->MultiInnerProdLocal = hypre_ParCSRMultiVectorInnerProdLocal;
+   i->GlobalSum = hypre_ParCSRMultiVectorGlobalSum;
 
    return 0;
 }
@@ -212,9 +576,9 @@ HYPRE_ParCSRSetupMatvec(HYPRE_MatvecFunctions * mv)
    mv->Matvec = hypre_ParKrylovMatvec;
    mv->MatvecDestroy = hypre_ParKrylovMatvecDestroy;
 
-   mv->MatMultiVecCreate = NULL;
-   mv->MatMultiVec = NULL;
-   mv->MatMultiVecDestroy = NULL;
+   mv->MatMultiVecCreate = hypre_ParKrylovMatvecCreate;
+   mv->MatMultiVec = hypre_ParCSRMultiVectorMatvec;
+   mv->MatMultiVecDestroy = hypre_ParKrylovMatvecDestroy;
 
    return 0;
 }
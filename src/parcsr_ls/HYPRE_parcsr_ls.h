@@ -136,6 +136,41 @@ HYPRE_Int HYPRE_BoomerAMGSolveT(HYPRE_Solver       solver,
                                 HYPRE_ParVector    b,
                                 HYPRE_ParVector    x);
 
+/**
+ * Searches for BoomerAMG parameters that minimize the estimated time to
+ * solve the given system.  Each trial runs the setup and a few V-cycles of
+ * AMG as a standalone solver, and the convergence factor and timings are
+ * combined into an estimate of the total solve time for the tolerance set
+ * with \e SetTol.  The strength threshold, coarsening, interpolation,
+ * interpolation truncation, aggressive coarsening levels and relaxation
+ * type are varied one at a time (coordinate descent) from the current
+ * settings.  At most max\_trials trials are run; if max\_trials is not
+ * positive, one sweep over all parameters is done.  On return, the best
+ * parameters are set in the solver, and \e Setup must be called again.
+ * If filename is not NULL, the parameters are also written to that file.
+ * The solution vector x is not changed.
+ *
+ * @param solver [IN] solver object to be tuned.
+ * @param A [IN] ParCSR matrix
+ * @param b [IN] right hand side used for the trials
+ * @param x [IN] initial guess used for the trials
+ * @param max_trials [IN] maximum number of trial setups
+ * @param filename [IN] file the parameters are written to (may be NULL)
+ **/
+HYPRE_Int HYPRE_BoomerAMGAutotune(HYPRE_Solver       solver,
+                                  HYPRE_ParCSRMatrix A,
+                                  HYPRE_ParVector    b,
+                                  HYPRE_ParVector    x,
+                                  HYPRE_Int          max_trials,
+                                  const char        *filename);
+
+/**
+ * Sets the BoomerAMG parameters stored in a file written by
+ * \e HYPRE\_BoomerAMGAutotune.  Must be called before \e Setup.
+ **/
+HYPRE_Int HYPRE_BoomerAMGReadAutotune(HYPRE_Solver  solver,
+                                      const char   *filename);
+
 /**
  * Recovers old default for coarsening and interpolation, i.e Falgout
  * coarsening and untruncated modified classical interpolation.
@@ -343,6 +378,32 @@ HYPRE_Int HYPRE_BoomerAMGSetLevelNonGalerkinTol (HYPRE_Solver solver,
                                                  HYPRE_Real   nongalerkin_tol,
                                                  HYPRE_Int  level);
 
+/**
+ * (Optional) Sparsifies the coarse grid operators automatically so that the
+ * operator complexity stays below the given value (e.g. 2.0).  On each level,
+ * a drop tolerance for the Galerkin operator is chosen such that the nonzeros
+ * of this and of the expected coarser levels fit into the remaining budget.
+ * Dropped entries are lumped into the diagonal, which preserves the row sums.
+ * The drop tolerance is limited to 0.1 relative to the largest entries of
+ * the two rows involved, so a very small target may not be reached.
+ * This option is only used for scalar problems (num_functions = 1).
+ * Levels with a drop tolerance set by HYPRE_BoomerAMGSetNonGalerkinTol or
+ * HYPRE_BoomerAMGSetLevelNonGalerkinTol are not changed.
+ * The default is 0.0, which turns this option off.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinOpComplexity (HYPRE_Solver solver,
+                                                     HYPRE_Real   op_complexity);
+
+/**
+ * (Optional) Sparsifies the coarse grid operators automatically so that
+ * their average number of nonzeros per row is at most the given multiple
+ * of that of the fine grid operator.  This can be combined with
+ * HYPRE_BoomerAMGSetNonGalerkinOpComplexity, in which case the smaller
+ * bound is used.  The default is 0.0, which turns this option off.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinStencilGrowth (HYPRE_Solver solver,
+                                                      HYPRE_Real   stencil_growth);
+
 /**
  * (Optional) Defines the non-Galerkin drop-tolerance (old version)
  **/
@@ -363,6 +424,35 @@ HYPRE_Int HYPRE_BoomerAMGSetMeasureType(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetAggNumLevels(HYPRE_Solver solver,
                                          HYPRE_Int    agg_num_levels);
 
+/**
+ * (Optional) Defines the number of levels, starting with the finest one,
+ * on which smoothed aggregation is used instead of the C/F splitting and
+ * interpolation set by HYPRE_BoomerAMGSetCoarsenType and
+ * HYPRE_BoomerAMGSetInterpType. Aggregates of strongly connected points (or
+ * nodes with HYPRE_BoomerAMGSetNodal) are formed in parallel and may cross
+ * process boundaries. The near-nullspace vectors are the constants of each
+ * function, plus the vectors set by HYPRE_BoomerAMGSetInterpVectors with
+ * nodal coarsening; they are orthonormalized on each aggregate to give the
+ * tentative prolongator, which is smoothed by one damped Jacobi step on the
+ * filtered matrix. The interpolation vectors are then not used for GM or LN
+ * interpolation. HYPRE_BoomerAMGSetTruncFactor and
+ * HYPRE_BoomerAMGSetPMaxElmts apply to the smoothed prolongator. Levels of
+ * aggressive coarsening are not aggregated. Only available on the host. The
+ * default is 0, i.e. no smoothed aggregation.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSANumLevels(HYPRE_Solver solver,
+                                        HYPRE_Int    sa_num_levels);
+
+/**
+ * (Optional) Defines the Jacobi weight used to smooth the tentative
+ * prolongator of smoothed aggregation. A weight of 0 gives plain
+ * (unsmoothed) aggregation. If negative, the weight is 4/3 divided by an
+ * estimate of the spectral radius of the diagonally scaled filtered matrix.
+ * The default is -1.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSAJacobiWeight(HYPRE_Solver solver,
+                                           HYPRE_Real   sa_jacobi_weight);
+
 /**
  * (Optional) Defines the degree of aggressive coarsening.
  * The default is 1. Larger numbers lead to less aggressive
@@ -674,6 +764,26 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetRedundant(HYPRE_Solver solver,
                                       HYPRE_Int    redundant);
 
+/**
+ * (Optional) Redistributes coarse levels onto fewer processes. When the
+ * average number of rows per active process on a coarse level drops below
+ * \e redist_threshold, groups of neighboring processes are merged and the
+ * level is owned by the first process of each group; the other processes
+ * keep no rows on that level and on all coarser levels. The interpolation
+ * (and restriction) operators absorb the redistribution, so no extra data
+ * movement is done in the cycle. Only available for scalar problems
+ * without C-point or interpolation vector options. Default is 0, i.e. no
+ * redistribution.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRedistThreshold(HYPRE_Solver solver,
+                                            HYPRE_Int    redist_threshold);
+
+/**
+ * (Optional) Returns the threshold set by HYPRE_BoomerAMGSetRedistThreshold.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetRedistThreshold(HYPRE_Solver  solver,
+                                            HYPRE_Int    *redist_threshold);
+
 /**
  * (Optional) Defines the number of sweeps for the fine and coarse grid,
  * the up and down cycle.
@@ -738,6 +848,11 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 16 : Chebyshev
  *    - 17 : FCF-Jacobi
  *    - 18 : \f$\ell_1\f$-scaled jacobi
+ *    - 88 : \f$\ell_1\f$ multicolor Gauss-Seidel (threads relax the rows of one
+ *           color at a time, so convergence does not depend on the number of
+ *           threads; the colors are swept in reverse order on the up cycle)
+ *    - 39 : sparse direct solver with nested dissection ordering (only on
+ *           coarsest level)
  **/
 HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
                                       HYPRE_Int     relax_type);
@@ -1540,6 +1655,12 @@ HYPRE_Int HYPRE_FSAISolve( HYPRE_Solver       solver,
  *
  *      - 1: Native (can use OpenMP with static scheduling)
  *      - 2: OpenMP with dynamic scheduling
+ *      - 3: Distributed, the pattern of G may include off-processor columns
+ *           (OpenMP with dynamic scheduling)
+ *      - 4: Static pattern, the lower triangle of a thresholded power of A
+ *           (see HYPRE_FSAISetNumLevels and HYPRE_FSAISetThreshold).  The
+ *           pattern is kept and reused by later setups with a matrix of the
+ *           same sparsity.
  **/
 HYPRE_Int HYPRE_FSAISetAlgoType( HYPRE_Solver solver,
                                  HYPRE_Int    algo_type );
@@ -1564,6 +1685,21 @@ HYPRE_Int HYPRE_FSAISetMaxStepSize( HYPRE_Solver solver,
 HYPRE_Int HYPRE_FSAISetKapTolerance( HYPRE_Solver solver,
                                      HYPRE_Real   kap_tolerance  );
 
+/**
+ * (Optional) Sets the power of A whose lower triangle is the pattern of G
+ * for the static pattern algorithm (algo_type 4).  The default is 1.
+ **/
+HYPRE_Int HYPRE_FSAISetNumLevels( HYPRE_Solver solver,
+                                  HYPRE_Int    num_levels );
+
+/**
+ * (Optional) Sets the threshold for dropping the entries a_ij of A with
+ * |a_ij| < threshold * sqrt(|a_ii a_jj|) before computing the static pattern
+ * of G (algo_type 4).  The default is 0.0.
+ **/
+HYPRE_Int HYPRE_FSAISetThreshold( HYPRE_Solver solver,
+                                  HYPRE_Real   threshold );
+
 /**
  * (Optional) Sets the relaxation factor for FSAI
  **/
@@ -2214,6 +2350,31 @@ HYPRE_Int HYPRE_AMSSetTol(HYPRE_Solver solver,
 HYPRE_Int HYPRE_AMSSetCycleType(HYPRE_Solver solver,
                                 HYPRE_Int    cycle_type);
 
+/**
+ * (Optional) For the additive cycle types (2, 8, 12 and 14), do the
+ * subspace corrections of the additive part of the cycle concurrently, on
+ * disjoint groups of processes.  The subspace matrices are redistributed to
+ * the groups in the setup, and their AMG solvers work on the group
+ * communicators.  The group sizes are proportional to the number of
+ * nonzeros of the subspace matrices.  This requires at least one process
+ * per concurrent subspace; otherwise the option is ignored.
+ * The default is 0 (sequential corrections).
+ **/
+HYPRE_Int HYPRE_AMSSetConcurrentSubspaces(HYPRE_Solver solver,
+                                          HYPRE_Int    concurrent_subspaces);
+
+/**
+ * (Optional) Do not construct the Nedelec interpolation matrix Pi (or its
+ * components Pi{x,y,z} for the cycle types above 10).  Pi is applied from
+ * the discrete gradient and the vertex coordinates (or the representations
+ * of the constant vector fields), and the Galerkin product Pi^T A Pi
+ * is computed directly from them.  This reduces the memory of the setup.
+ * The option is ignored if Pi is given by the user, with cycle type 20,
+ * and on devices.  The default is 0.
+ **/
+HYPRE_Int HYPRE_AMSSetMatrixFreePi(HYPRE_Solver solver,
+                                   HYPRE_Int    matrix_free_Pi);
+
 /**
  * (Optional) Control how much information is printed during the
  * solution iterations.
@@ -4152,6 +4313,29 @@ HYPRE_MGRGetCoarseGridConvergenceFactor (HYPRE_Solver solver, HYPRE_Real *conv_f
 HYPRE_Int
 HYPRE_MGRSetPMaxElmts( HYPRE_Solver solver, HYPRE_Int P_max_elmts);
 
+/**
+ * (Optional) Reuse the hierarchy in later setups with a matrix of the same
+ * sparsity pattern, e.g., the Jacobians of a Newton iteration.  The CF
+ * splitting, the communication packages and the sparsity patterns of the
+ * interpolation, restriction, coarse grid and F-relaxation operators of the
+ * first setup are kept, and only their values are recomputed.  Entries
+ * outside of the kept patterns are dropped.  Parameters changed after the
+ * first setup are not taken into account.  Host memory only.
+ * The default is 0 (no reuse).
+ **/
+HYPRE_Int
+HYPRE_MGRSetReuseSetup( HYPRE_Solver solver, HYPRE_Int reuse_setup );
+
+/**
+ * (Optional) With setup reuse, keep the setups of the F-relaxation and
+ * coarse grid solvers, and of the global ILU smoothers, for lag
+ * consecutive setups.  They then work with the updated finest matrices
+ * but with their previous hierarchies or factorizations.
+ * The default is 0 (redo these setups at every setup).
+ **/
+HYPRE_Int
+HYPRE_MGRSetInnerSetupLag( HYPRE_Solver solver, HYPRE_Int lag );
+
 /**
  * (Optional) Return the norm of the final relative residual.
  **/
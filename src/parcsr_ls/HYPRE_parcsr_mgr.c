@@ -488,6 +488,26 @@ HYPRE_MGRSetPMaxElmts( HYPRE_Solver solver, HYPRE_Int P_max_elmts )
    return hypre_MGRSetPMaxElmts(solver, P_max_elmts);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetReuseSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_MGRSetReuseSetup( HYPRE_Solver solver, HYPRE_Int reuse_setup )
+{
+   return hypre_MGRSetReuseSetup(solver, reuse_setup);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetInnerSetupLag
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_MGRSetInnerSetupLag( HYPRE_Solver solver, HYPRE_Int lag )
+{
+   return hypre_MGRSetInnerSetupLag(solver, lag);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_MGRGetCoarseGridConvergenceFactor
  *--------------------------------------------------------------------------*/
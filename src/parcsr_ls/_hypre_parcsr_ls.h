@@ -67,6 +67,8 @@ typedef struct
    HYPRE_Int      is_triangular;
    HYPRE_Int      gmres_switch;
    HYPRE_Int      agg_num_levels;
+   HYPRE_Int      sa_num_levels;
+   HYPRE_Real     sa_jacobi_weight;
    HYPRE_Int      num_paths;
    HYPRE_Int      post_interp_type;
    HYPRE_Int      num_CR_relax_steps;
@@ -77,6 +79,7 @@ typedef struct
    HYPRE_Int      min_coarse_size;
    HYPRE_Int      seq_threshold;
    HYPRE_Int      redundant;
+   HYPRE_Int      redist_threshold;
    HYPRE_Int      participate;
    HYPRE_Int      Sabs;
 
@@ -177,11 +180,18 @@ typedef struct
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   /* data for multicolor Gauss-Seidel */
+   hypre_IntArray     **color_starts;
+   hypre_IntArray     **color_rows;
+   hypre_Vector       **color_l1_norms;
+
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerk_tol;
    HYPRE_Real          nongalerkin_tol;
    HYPRE_Real         *nongal_tol_array;
+   HYPRE_Real          nongal_op_complexity;
+   HYPRE_Real          nongal_stencil_growth;
 
    /* data generated in the solve phase */
    hypre_ParVector   *Vtemp;
@@ -241,6 +251,7 @@ typedef struct
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
+   HYPRE_Int  *A_piv;
    HYPRE_Real *b_vec;
    HYPRE_Int  *comm_info;
 
@@ -284,6 +295,9 @@ typedef struct
    HYPRE_Solver dslu_solver;
 #endif
 
+   /* built-in sparse direct coarse solver (relax_type 39) */
+   void *sparse_direct_solver;
+
 } hypre_ParAMGData;
 
 /*--------------------------------------------------------------------------
@@ -319,6 +333,8 @@ typedef struct
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
 #define hypre_ParAMGDataNumPaths(amg_data)             ((amg_data) -> num_paths)
 #define hypre_ParAMGDataAggNumLevels(amg_data)         ((amg_data) -> agg_num_levels)
+#define hypre_ParAMGDataSANumLevels(amg_data)          ((amg_data) -> sa_num_levels)
+#define hypre_ParAMGDataSAJacobiWeight(amg_data)       ((amg_data) -> sa_jacobi_weight)
 #define hypre_ParAMGDataPostInterpType(amg_data)       ((amg_data) -> post_interp_type)
 #define hypre_ParAMGDataNumCRRelaxSteps(amg_data)      ((amg_data) -> num_CR_relax_steps)
 #define hypre_ParAMGDataCRRate(amg_data)               ((amg_data) -> CR_rate)
@@ -332,6 +348,7 @@ typedef struct
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
 #define hypre_ParAMGDataSeqThreshold(amg_data)         ((amg_data) -> seq_threshold)
+#define hypre_ParAMGDataRedistThreshold(amg_data)      ((amg_data) -> redist_threshold)
 
 /* solve params */
 
@@ -423,6 +440,11 @@ typedef struct
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+/* multicolor Gauss-Seidel */
+#define hypre_ParAMGDataColorStarts(amg_data) ((amg_data)->color_starts)
+#define hypre_ParAMGDataColorRows(amg_data) ((amg_data)->color_rows)
+#define hypre_ParAMGDataColorL1Norms(amg_data) ((amg_data)->color_l1_norms)
+
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
@@ -490,6 +512,7 @@ typedef struct
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
 #define hypre_ParAMGDataAInv(amg_data) ((amg_data)->A_inv)
+#define hypre_ParAMGDataAPiv(amg_data) ((amg_data)->A_piv)
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
 
@@ -513,6 +536,8 @@ typedef struct
 #define hypre_ParAMGDataNonGalerkTol(amg_data) ((amg_data)->nongalerk_tol)
 #define hypre_ParAMGDataNonGalerkinTol(amg_data) ((amg_data)->nongalerkin_tol)
 #define hypre_ParAMGDataNonGalTolArray(amg_data) ((amg_data)->nongal_tol_array)
+#define hypre_ParAMGDataNonGalOpComplexity(amg_data) ((amg_data)->nongal_op_complexity)
+#define hypre_ParAMGDataNonGalStencilGrowth(amg_data) ((amg_data)->nongal_stencil_growth)
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
@@ -538,6 +563,9 @@ typedef struct
 #define hypre_ParAMGDataDSLUSolver(amg_data) ((amg_data)->dslu_solver)
 #endif
 
+/* built-in sparse direct coarse solver */
+#define hypre_ParAMGDataSparseDirectSolver(amg_data) ((amg_data)->sparse_direct_solver)
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -574,6 +602,17 @@ typedef struct
    ****recv_map; // mapping from recv buffer to appropriate local indices on each comp grid
    HYPRE_Int       ****recv_red_marker; // marker indicating a redundant recv
 
+   // Persistent residual communication, set up once the composite grids are finalized
+   hypre_MPI_Request **res_requests;      // recv requests followed by send requests on each level
+   HYPRE_Complex     **res_send_buffer;   // send buffer on each level, procs one after the other
+   HYPRE_Complex     **res_recv_buffer;   // recv buffer on each level, procs one after the other
+   HYPRE_Int         **res_pack_starts;   // owned and nonowned nodes of each composite level to pack
+   HYPRE_Int         **res_pack_pos;      // send buffer positions of the nodes to pack
+   HYPRE_Int         **res_pack_elmts;    // local indices of the nodes to pack
+   HYPRE_Int         **res_unpack_starts; // nodes of each composite level to unpack
+   HYPRE_Int         **res_unpack_pos;    // recv buffer positions of the nodes to unpack
+   HYPRE_Int         **res_unpack_elmts;  // nonowned local indices of the nodes to unpack
+
 } hypre_AMGDDCommPkg;
 
 /*--------------------------------------------------------------------------
@@ -592,6 +631,15 @@ typedef struct
 #define hypre_AMGDDCommPkgSendFlag(compGridCommPkg)       ((compGridCommPkg) -> send_flag)
 #define hypre_AMGDDCommPkgRecvMap(compGridCommPkg)        ((compGridCommPkg) -> recv_map)
 #define hypre_AMGDDCommPkgRecvRedMarker(compGridCommPkg)  ((compGridCommPkg) -> recv_red_marker)
+#define hypre_AMGDDCommPkgResRequests(compGridCommPkg)     ((compGridCommPkg) -> res_requests)
+#define hypre_AMGDDCommPkgResSendBuffer(compGridCommPkg)   ((compGridCommPkg) -> res_send_buffer)
+#define hypre_AMGDDCommPkgResRecvBuffer(compGridCommPkg)   ((compGridCommPkg) -> res_recv_buffer)
+#define hypre_AMGDDCommPkgResPackStarts(compGridCommPkg)   ((compGridCommPkg) -> res_pack_starts)
+#define hypre_AMGDDCommPkgResPackPos(compGridCommPkg)      ((compGridCommPkg) -> res_pack_pos)
+#define hypre_AMGDDCommPkgResPackElmts(compGridCommPkg)    ((compGridCommPkg) -> res_pack_elmts)
+#define hypre_AMGDDCommPkgResUnpackStarts(compGridCommPkg) ((compGridCommPkg) -> res_unpack_starts)
+#define hypre_AMGDDCommPkgResUnpackPos(compGridCommPkg)    ((compGridCommPkg) -> res_unpack_pos)
+#define hypre_AMGDDCommPkgResUnpackElmts(compGridCommPkg)  ((compGridCommPkg) -> res_unpack_elmts)
 
 /*--------------------------------------------------------------------------
  * AMGDDCompGridMatrix (basically a coupled collection of CSR matrices)
@@ -608,6 +656,10 @@ typedef struct
    hypre_CSRMatrix      *real_real;  // Domain: nonowned real. Range: nonowned real.
    hypre_CSRMatrix      *real_ghost; // Domain: nonowned ghost. Range: nonowned real.
 
+   hypre_CSRMatrix      *composite;      // Domain: composite grid. Range: composite grid.
+   HYPRE_Int            *composite_map;  // Composite grid index of each nonowned node
+   HYPRE_Complex        *composite_work; // Vector on the composite grid
+
    HYPRE_Int             owns_owned_matrices;
    HYPRE_Int             owns_offd_col_indices;
 
@@ -623,6 +675,9 @@ typedef struct
 #define hypre_AMGDDCompGridMatrixNonOwnedOffd(matrix)       ((matrix) -> nonowned_offd)
 #define hypre_AMGDDCompGridMatrixRealReal(matrix)           ((matrix) -> real_real)
 #define hypre_AMGDDCompGridMatrixRealGhost(matrix)          ((matrix) -> real_ghost)
+#define hypre_AMGDDCompGridMatrixComposite(matrix)          ((matrix) -> composite)
+#define hypre_AMGDDCompGridMatrixCompositeMap(matrix)       ((matrix) -> composite_map)
+#define hypre_AMGDDCompGridMatrixCompositeWork(matrix)      ((matrix) -> composite_work)
 #define hypre_AMGDDCompGridMatrixOwnsOwnedMatrices(matrix)  ((matrix) -> owns_owned_matrices)
 #define hypre_AMGDDCompGridMatrixOwnsOffdColIndices(matrix) ((matrix) -> owns_offd_col_indices)
 
@@ -809,6 +864,10 @@ typedef struct hypre_ParFSAIData_struct
    HYPRE_Int
    max_step_size;   /* Maximum number of nonzero elements added to a row of G per step */
    HYPRE_Real            kap_tolerance;   /* Minimum amount of change between two steps */
+   HYPRE_Int             num_levels;      /* Power of A giving the static pattern of G */
+   HYPRE_Real            threshold;       /* Dropping threshold for the static pattern */
+   hypre_CSRMatrix      *static_patt;     /* Cached static pattern (strictly lower part of G) */
+   hypre_CSRMatrix      *static_patt_A;   /* Sparsity of A_diag the static pattern belongs to */
    hypre_ParCSRMatrix   *Gmat;            /* Matrix holding FSAI factor. M^(-1) = G'G */
    hypre_ParCSRMatrix   *GTmat;           /* Matrix holding the transpose of the FSAI factor */
 
@@ -840,6 +899,10 @@ typedef struct hypre_ParFSAIData_struct
 #define hypre_ParFSAIDataMaxSteps(fsai_data)                ((fsai_data) -> max_steps)
 #define hypre_ParFSAIDataMaxStepSize(fsai_data)             ((fsai_data) -> max_step_size)
 #define hypre_ParFSAIDataKapTolerance(fsai_data)            ((fsai_data) -> kap_tolerance)
+#define hypre_ParFSAIDataNumLevels(fsai_data)               ((fsai_data) -> num_levels)
+#define hypre_ParFSAIDataThreshold(fsai_data)               ((fsai_data) -> threshold)
+#define hypre_ParFSAIDataStaticPattern(fsai_data)           ((fsai_data) -> static_patt)
+#define hypre_ParFSAIDataStaticPatternA(fsai_data)          ((fsai_data) -> static_patt_A)
 #define hypre_ParFSAIDataGmat(fsai_data)                    ((fsai_data) -> Gmat)
 #define hypre_ParFSAIDataGTmat(fsai_data)                   ((fsai_data) -> GTmat)
 #define hypre_ParFSAIDataDensity(fsai_data)                 ((fsai_data) -> density)
@@ -1040,6 +1103,8 @@ HYPRE_Int hypre_AMSSetProjectionFrequency ( void *solver, HYPRE_Int projection_f
 HYPRE_Int hypre_AMSSetMaxIter ( void *solver, HYPRE_Int maxit );
 HYPRE_Int hypre_AMSSetTol ( void *solver, HYPRE_Real tol );
 HYPRE_Int hypre_AMSSetCycleType ( void *solver, HYPRE_Int cycle_type );
+HYPRE_Int hypre_AMSSetConcurrentSubspaces ( void *solver, HYPRE_Int concurrent_subspaces );
+HYPRE_Int hypre_AMSSetMatrixFreePi ( void *solver, HYPRE_Int matrix_free_Pi );
 HYPRE_Int hypre_AMSSetPrintLevel ( void *solver, HYPRE_Int print_level );
 HYPRE_Int hypre_AMSSetSmoothingOptions ( void *solver, HYPRE_Int A_relax_type,
                                          HYPRE_Int A_relax_times, HYPRE_Real A_relax_weight, HYPRE_Real A_omega );
@@ -1060,16 +1125,37 @@ HYPRE_Int hypre_AMSComputePixyz ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *G,
                                   hypre_ParCSRMatrix **Piy_ptr, hypre_ParCSRMatrix **Piz_ptr );
 HYPRE_Int hypre_AMSComputeGPi ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *G, hypre_ParVector *Gx,
                                 hypre_ParVector *Gy, hypre_ParVector *Gz, HYPRE_Int dim, hypre_ParCSRMatrix **GPi_ptr );
+HYPRE_Int hypre_AMSMatrixFreePiSetup ( void *solver );
+HYPRE_Int hypre_AMSMatrixFreePiMatvec ( void *solver, HYPRE_Int subspace, HYPRE_Int trans,
+                                        HYPRE_Complex alpha, hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
+HYPRE_Int hypre_AMSMatrixFreePiRAP ( void *solver, HYPRE_Int subspace, hypre_ParCSRMatrix *A,
+                                     hypre_ParCSRMatrix **A_Pi_ptr );
 HYPRE_Int hypre_AMSSetup ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
+HYPRE_Int hypre_AMSCycleString ( void *solver, char *cycle );
 HYPRE_Int hypre_AMSSolve ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
 HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0, HYPRE_Int A0_relax_type,
                                      HYPRE_Int A0_relax_times, HYPRE_Real *A0_l1_norms, HYPRE_Real A0_relax_weight, HYPRE_Real A0_omega,
                                      HYPRE_Real A0_max_eig_est, HYPRE_Real A0_min_eig_est, HYPRE_Int A0_cheby_order,
                                      HYPRE_Real A0_cheby_fraction, hypre_ParCSRMatrix **A, HYPRE_Solver *B, HYPRE_PtrToSolverFcn *HB,
-                                     hypre_ParCSRMatrix **P, hypre_ParVector **r, hypre_ParVector **g, hypre_ParVector *x,
-                                     hypre_ParVector *y, hypre_ParVector *r0, hypre_ParVector *g0, char *cycle, hypre_ParVector *z );
+                                     hypre_ParCSRMatrix **P, HYPRE_Int (*Pfcn)(void *, HYPRE_Int, HYPRE_Int, HYPRE_Complex,
+                                                                               hypre_ParVector *, HYPRE_Complex, hypre_ParVector *), void *Pdata,
+                                     hypre_ParVector **r, hypre_ParVector **g, hypre_ParVector *x,
+                                     hypre_ParVector *y, hypre_ParVector *r0, hypre_ParVector *g0, char *cycle, hypre_ParVector *z,
+                                     void *groups_vdata );
+void *hypre_ParCSRSubspaceGroupsCreate ( MPI_Comm comm, char *cycle, HYPRE_Int num_subspaces,
+                                         HYPRE_Int *eligible );
+HYPRE_Int hypre_ParCSRSubspaceGroupsDestroy ( void *groups_vdata );
+HYPRE_Int hypre_ParCSRSubspaceGroupsConcurrent ( void *groups_vdata, HYPRE_Int i );
+hypre_ParCSRMatrix *hypre_ParCSRSubspaceGroupsRedistribution ( MPI_Comm comm,
+                                                               HYPRE_BigInt global_size, HYPRE_BigInt *starts, HYPRE_Int first, HYPRE_Int last,
+                                                               HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_ParCSRSubspaceGroupsSetup ( void *groups_vdata, hypre_ParCSRMatrix **A,
+                                            HYPRE_Solver *B, hypre_ParCSRMatrix **P );
+HYPRE_Int hypre_ParCSRSubspaceGroupsSolve ( void *groups_vdata, char *first, char *last,
+                                            HYPRE_Solver *B, HYPRE_PtrToSolverFcn *HB, hypre_ParVector *r0, hypre_ParVector *g0,
+                                            hypre_ParVector *y );
 HYPRE_Int hypre_AMSGetNumIterations ( void *solver, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_AMSGetFinalRelativeResidualNorm ( void *solver, HYPRE_Real *rel_resid_norm );
 HYPRE_Int hypre_AMSProjectOutGradients ( void *solver, hypre_ParVector *x );
@@ -1212,6 +1298,8 @@ HYPRE_Int HYPRE_AMSSetProjectionFrequency ( HYPRE_Solver solver, HYPRE_Int proje
 HYPRE_Int HYPRE_AMSSetMaxIter ( HYPRE_Solver solver, HYPRE_Int maxit );
 HYPRE_Int HYPRE_AMSSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_AMSSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
+HYPRE_Int HYPRE_AMSSetConcurrentSubspaces ( HYPRE_Solver solver, HYPRE_Int concurrent_subspaces );
+HYPRE_Int HYPRE_AMSSetMatrixFreePi ( HYPRE_Solver solver, HYPRE_Int matrix_free_Pi );
 HYPRE_Int HYPRE_AMSSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int print_level );
 HYPRE_Int HYPRE_AMSSetSmoothingOptions ( HYPRE_Solver solver, HYPRE_Int relax_type,
                                          HYPRE_Int relax_times, HYPRE_Real relax_weight, HYPRE_Real omega );
@@ -1246,6 +1334,9 @@ HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPR
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                   HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGAutotune ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
+                                    HYPRE_ParVector x, HYPRE_Int max_trials, const char *filename );
+HYPRE_Int HYPRE_BoomerAMGReadAutotune ( HYPRE_Solver solver, const char *filename );
 HYPRE_Int HYPRE_BoomerAMGSetRestriction ( HYPRE_Solver solver, HYPRE_Int restr_par );
 HYPRE_Int HYPRE_BoomerAMGSetIsTriangular ( HYPRE_Solver solver, HYPRE_Int is_triangular );
 HYPRE_Int HYPRE_BoomerAMGSetGMRESSwitchR ( HYPRE_Solver solver, HYPRE_Int gmres_switch );
@@ -1257,6 +1348,8 @@ HYPRE_Int HYPRE_BoomerAMGSetMinCoarseSize ( HYPRE_Solver solver, HYPRE_Int min_c
 HYPRE_Int HYPRE_BoomerAMGGetMinCoarseSize ( HYPRE_Solver solver, HYPRE_Int *min_coarse_size );
 HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int seq_threshold );
 HYPRE_Int HYPRE_BoomerAMGGetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int *seq_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetRedistThreshold ( HYPRE_Solver solver, HYPRE_Int redist_threshold );
+HYPRE_Int HYPRE_BoomerAMGGetRedistThreshold ( HYPRE_Solver solver, HYPRE_Int *redist_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver, HYPRE_Int redundant );
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver, HYPRE_Int *redundant );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
@@ -1383,6 +1476,8 @@ HYPRE_Int HYPRE_BoomerAMGSetKeepSameSign ( HYPRE_Solver solver, HYPRE_Int keep_s
 HYPRE_Int HYPRE_BoomerAMGSetDofFunc ( HYPRE_Solver solver, HYPRE_Int *dof_func );
 HYPRE_Int HYPRE_BoomerAMGSetNumPaths ( HYPRE_Solver solver, HYPRE_Int num_paths );
 HYPRE_Int HYPRE_BoomerAMGSetAggNumLevels ( HYPRE_Solver solver, HYPRE_Int agg_num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetSANumLevels ( HYPRE_Solver solver, HYPRE_Int sa_num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetSAJacobiWeight ( HYPRE_Solver solver, HYPRE_Real sa_jacobi_weight );
 HYPRE_Int HYPRE_BoomerAMGSetAggInterpType ( HYPRE_Solver solver, HYPRE_Int agg_interp_type );
 HYPRE_Int HYPRE_BoomerAMGSetAggTruncFactor ( HYPRE_Solver solver, HYPRE_Real agg_trunc_factor );
 HYPRE_Int HYPRE_BoomerAMGSetAddTruncFactor ( HYPRE_Solver solver, HYPRE_Real add_trunc_factor );
@@ -1436,6 +1531,9 @@ HYPRE_Int HYPRE_BoomerAMGSetLevelNonGalerkinTol ( HYPRE_Solver solver, HYPRE_Rea
                                                   HYPRE_Int level );
 HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongalerk_num_tol,
                                            HYPRE_Real *nongalerk_tol );
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinOpComplexity ( HYPRE_Solver solver, HYPRE_Real op_complexity );
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinStencilGrowth ( HYPRE_Solver solver,
+                                                       HYPRE_Real stencil_growth );
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
@@ -1694,6 +1792,16 @@ HYPRE_Int HYPRE_ParCSRMultiVectorPrint ( void *x_, const char *fileName );
 void *HYPRE_ParCSRMultiVectorRead ( MPI_Comm comm, void *ii_, const char *fileName );
 HYPRE_Int aux_maskCount ( HYPRE_Int n, HYPRE_Int *mask );
 void aux_indexFromMask ( HYPRE_Int n, HYPRE_Int *mask, HYPRE_Int *index );
+HYPRE_Int hypre_ParCSRMultiVectorCollect ( void *x_, hypre_ParVector **px );
+void hypre_ParCSRMultiVectorInnerProdLocal ( void *x_, void *y_, HYPRE_Int xyGHeight,
+                                             HYPRE_Int xyHeight, HYPRE_Int xyWidth, HYPRE_Real *xyVal );
+HYPRE_Int hypre_ParCSRMultiVectorGlobalSum ( void *x_, HYPRE_Int n, HYPRE_Real *val );
+void hypre_ParCSRMultiVectorInnerProd ( void *x_, void *y_, HYPRE_Int xyGHeight, HYPRE_Int xyHeight,
+                                        HYPRE_Int xyWidth, HYPRE_Real *xyVal );
+void hypre_ParCSRMultiVectorInnerProdDiag ( void *x_, void *y_, HYPRE_Int *mask, HYPRE_Int n,
+                                            HYPRE_Real *diag );
+HYPRE_Int hypre_ParCSRMultiVectorMatvec ( void *matvec_data, HYPRE_Complex alpha, void *A_,
+                                          void *x_, HYPRE_Complex beta, void *y_ );
 HYPRE_Int HYPRE_TempParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupMatvec ( HYPRE_MatvecFunctions *mv );
@@ -1774,6 +1882,10 @@ HYPRE_Int HYPRE_FSAISetMaxStepSize ( HYPRE_Solver solver, HYPRE_Int max_step_siz
 HYPRE_Int HYPRE_FSAIGetMaxStepSize ( HYPRE_Solver solver, HYPRE_Int *max_step_size );
 HYPRE_Int HYPRE_FSAISetKapTolerance ( HYPRE_Solver solver, HYPRE_Real  kap_tolerance );
 HYPRE_Int HYPRE_FSAIGetKapTolerance ( HYPRE_Solver solver, HYPRE_Real *kap_tolerance );
+HYPRE_Int HYPRE_FSAISetNumLevels ( HYPRE_Solver solver, HYPRE_Int num_levels );
+HYPRE_Int HYPRE_FSAIGetNumLevels ( HYPRE_Solver solver, HYPRE_Int *num_levels );
+HYPRE_Int HYPRE_FSAISetThreshold ( HYPRE_Solver solver, HYPRE_Real threshold );
+HYPRE_Int HYPRE_FSAIGetThreshold ( HYPRE_Solver solver, HYPRE_Real *threshold );
 HYPRE_Int HYPRE_FSAISetTolerance ( HYPRE_Solver solver, HYPRE_Real tolerance );
 HYPRE_Int HYPRE_FSAIGetTolerance ( HYPRE_Solver solver, HYPRE_Real *tolerance );
 HYPRE_Int HYPRE_FSAISetOmega ( HYPRE_Solver solver, HYPRE_Real omega );
@@ -1849,6 +1961,11 @@ HYPRE_Int hypre_BoomerAMGAdditiveCycle ( void *amg_vdata );
 HYPRE_Int hypre_CreateLambda ( void *amg_vdata );
 HYPRE_Int hypre_CreateDinv ( void *amg_vdata );
 
+/* par_amg_autotune.c */
+HYPRE_Int hypre_BoomerAMGAutotune ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                    hypre_ParVector *u, HYPRE_Int max_trials, const char *filename );
+HYPRE_Int hypre_BoomerAMGReadAutotune ( void *amg_vdata, const char *filename );
+
 /* par_amg.c */
 void *hypre_BoomerAMGCreate ( void );
 HYPRE_Int hypre_BoomerAMGDestroy ( void *data );
@@ -1863,6 +1980,8 @@ HYPRE_Int hypre_BoomerAMGSetMinCoarseSize ( void *data, HYPRE_Int min_coarse_siz
 HYPRE_Int hypre_BoomerAMGGetMinCoarseSize ( void *data, HYPRE_Int *min_coarse_size );
 HYPRE_Int hypre_BoomerAMGSetSeqThreshold ( void *data, HYPRE_Int seq_threshold );
 HYPRE_Int hypre_BoomerAMGGetSeqThreshold ( void *data, HYPRE_Int *seq_threshold );
+HYPRE_Int hypre_BoomerAMGSetRedistThreshold ( void *data, HYPRE_Int redist_threshold );
+HYPRE_Int hypre_BoomerAMGGetRedistThreshold ( void *data, HYPRE_Int *redist_threshold );
 HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data, HYPRE_Int redundant );
@@ -1960,6 +2079,8 @@ HYPRE_Int hypre_BoomerAMGSetNodalDiag ( void *data, HYPRE_Int nodal );
 HYPRE_Int hypre_BoomerAMGSetKeepSameSign ( void *data, HYPRE_Int keep_same_sign );
 HYPRE_Int hypre_BoomerAMGSetNumPaths ( void *data, HYPRE_Int num_paths );
 HYPRE_Int hypre_BoomerAMGSetAggNumLevels ( void *data, HYPRE_Int agg_num_levels );
+HYPRE_Int hypre_BoomerAMGSetSANumLevels ( void *data, HYPRE_Int sa_num_levels );
+HYPRE_Int hypre_BoomerAMGSetSAJacobiWeight ( void *data, HYPRE_Real sa_jacobi_weight );
 HYPRE_Int hypre_BoomerAMGSetAggInterpType ( void *data, HYPRE_Int agg_interp_type );
 HYPRE_Int hypre_BoomerAMGSetAggPMaxElmts ( void *data, HYPRE_Int agg_P_max_elmts );
 HYPRE_Int hypre_BoomerAMGSetMultAddPMaxElmts ( void *data, HYPRE_Int add_P_max_elmts );
@@ -2038,6 +2159,8 @@ HYPRE_Int hypre_BoomerAMGSetLevelNonGalerkinTol ( void *data, HYPRE_Real nongale
                                                   HYPRE_Int level );
 HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_tol,
                                            HYPRE_Real *nongalerk_tol );
+HYPRE_Int hypre_BoomerAMGSetNonGalerkinOpComplexity ( void *data, HYPRE_Real op_complexity );
+HYPRE_Int hypre_BoomerAMGSetNonGalerkinStencilGrowth ( void *data, HYPRE_Real stencil_growth );
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
@@ -2473,6 +2596,8 @@ HYPRE_Int hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RA
                                                          hypre_ParCSRMatrix *AP, HYPRE_Real strong_threshold, HYPRE_Real max_row_sum,
                                                          HYPRE_Int num_functions, HYPRE_Int * dof_func_value, HYPRE_Int * CF_marker, HYPRE_Real droptol,
                                                          HYPRE_Int sym_collapse, HYPRE_Real lump_percent, HYPRE_Int collapse_beta );
+HYPRE_Int hypre_BoomerAMGSparsifyCoarseOperator ( hypre_ParCSRMatrix *A_H, HYPRE_Real max_nnz,
+                                                  HYPRE_Real max_tol, HYPRE_Real *droptol_ptr );
 
 /* par_rap.c */
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
@@ -2486,6 +2611,20 @@ HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT, hypre_ParCSRM
 HYPRE_Int hypre_GenerateSendMapAndCommPkg ( MPI_Comm comm, HYPRE_Int num_sends, HYPRE_Int num_recvs,
                                             HYPRE_Int *recv_procs, HYPRE_Int *send_procs, HYPRE_Int *recv_vec_starts, hypre_ParCSRMatrix *A );
 
+/* par_aggregation.c */
+HYPRE_Int hypre_BoomerAMGCoarsenAggregates ( hypre_ParCSRMatrix *S, hypre_IntArray **CF_marker_ptr,
+                                             HYPRE_BigInt **aggregates_ptr, HYPRE_Int *num_aggregates_ptr );
+HYPRE_Int hypre_BoomerAMGBuildSAInterp ( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
+                                         hypre_ParCSRMatrix *S, HYPRE_BigInt *aggregates, HYPRE_Int num_aggregates,
+                                         HYPRE_Int num_functions, HYPRE_Int *dof_func, HYPRE_Int num_vectors,
+                                         HYPRE_Real *nullspace, HYPRE_Real jacobi_weight, HYPRE_Int debug_flag,
+                                         HYPRE_Real trunc_factor, HYPRE_Int max_elmts, hypre_ParCSRMatrix **P_ptr,
+                                         hypre_IntArray **coarse_dof_func_ptr, HYPRE_Real **coarse_nullspace_ptr );
+
+/* par_redistribute.c */
+HYPRE_Int hypre_BoomerAMGRedistributeCoarse ( hypre_ParCSRMatrix **P_ptr,
+                                              hypre_ParCSRMatrix **R_ptr, HYPRE_Int min_rows, HYPRE_Int *stride_ptr );
+
 /* par_relax.c */
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                  HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
@@ -2585,6 +2724,14 @@ HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HY
                                    HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp,
                                    hypre_ParVector *Ztemp );
 
+/* par_relax_multicolor.c */
+HYPRE_Int hypre_BoomerAMGMulticolorSetup ( hypre_ParCSRMatrix *A, hypre_IntArray **color_starts_ptr,
+                                           hypre_IntArray **color_rows_ptr, HYPRE_Real **l1_norm_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorGaussSeidel ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                      HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight,
+                                                      HYPRE_Real *l1_norms, hypre_IntArray *color_starts, hypre_IntArray *color_rows,
+                                                      HYPRE_Int reverse, hypre_ParVector *u );
+
 /* par_relax_more.c */
 HYPRE_Int hypre_ParCSRMaxEigEstimate ( hypre_ParCSRMatrix *A, HYPRE_Int scale, HYPRE_Real *max_eig,
                                        HYPRE_Real *min_eig );
@@ -2642,6 +2789,12 @@ HYPRE_Int hypre_SchwarzSetScale ( void *data, HYPRE_Real *scale );
 HYPRE_Int hypre_SchwarzReScale ( void *data, HYPRE_Int size, HYPRE_Real value );
 HYPRE_Int hypre_SchwarzSetDofFunc ( void *data, HYPRE_Int *dof_func );
 
+/* par_sparse_direct.c */
+HYPRE_Int hypre_SparseDirectSetup ( void **solver_ptr, hypre_ParCSRMatrix *A,
+                                    HYPRE_Int print_level );
+HYPRE_Int hypre_SparseDirectSolve ( void *solver, hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_SparseDirectDestroy ( void *solver );
+
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
@@ -2920,6 +3073,8 @@ HYPRE_Int hypre_MGRSetFSolver( void  *mgr_vdata, HYPRE_Int  (*fine_grid_solver_s
                                                                                       void*, void*), HYPRE_Int  (*fine_grid_solver_setup)(void*, void*, void*, void*), void  *fsolver );
 HYPRE_Int hypre_MGRSetup( void *mgr_vdata, hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                           hypre_ParVector    *u );
+HYPRE_Int hypre_MGRSetupReuse( void *mgr_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                               hypre_ParVector *u );
 HYPRE_Int hypre_MGRSolve( void *mgr_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                           hypre_ParVector  *u );
 HYPRE_Int hypre_block_jacobi_scaling(hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **B_ptr,
@@ -2940,6 +3095,9 @@ HYPRE_Int hypre_MGRGetSubBlock( hypre_ParCSRMatrix *A, HYPRE_Int *row_cf_marker,
                                 HYPRE_Int *col_cf_marker, HYPRE_Int debug_flag, hypre_ParCSRMatrix **A_ff_ptr );
 HYPRE_Int hypre_MGRBuildAff( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker, HYPRE_Int debug_flag,
                              hypre_ParCSRMatrix **A_ff_ptr );
+HYPRE_Int hypre_MGRUpdateMatrixValues( hypre_ParCSRMatrix *A_new, hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_MGRComputeCoarseGridValues( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
+                                            hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *RAP );
 HYPRE_Int hypre_MGRApproximateInverse(hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **A_inv);
 HYPRE_Int hypre_MGRAddVectorP ( hypre_IntArray *CF_marker, HYPRE_Int point_type, HYPRE_Real a,
                                 hypre_ParVector *fromVector, HYPRE_Real b, hypre_ParVector **toVector );
@@ -2976,6 +3134,8 @@ HYPRE_Int hypre_MGRSetTruncateCoarseGridThreshold( void *mgr_vdata, HYPRE_Real t
 HYPRE_Int hypre_MGRSetLogging( void *mgr_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_MGRSetMaxIter( void *mgr_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_MGRSetPMaxElmts( void *mgr_vdata, HYPRE_Int P_max_elmts);
+HYPRE_Int hypre_MGRSetReuseSetup( void *mgr_vdata, HYPRE_Int reuse_setup );
+HYPRE_Int hypre_MGRSetInnerSetupLag( void *mgr_vdata, HYPRE_Int lag );
 HYPRE_Int hypre_MGRSetTol( void *mgr_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_MGRSetAffInv( void *mgr_vdata, hypre_ParCSRMatrix *A_ff_inv);
 #ifdef HYPRE_USING_DSUPERLU
@@ -3200,12 +3360,14 @@ HYPRE_Int hypre_BoomerAMGDDGetAMG ( void *data, void **amg_solver );
 HYPRE_Int hypre_BoomerAMGDDSolve ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                                    hypre_ParVector *x );
 HYPRE_Int hypre_BoomerAMGDD_Cycle ( hypre_ParAMGDDData *amgdd_data );
+HYPRE_Int hypre_BoomerAMGDD_ResidualCommunicationSetup ( hypre_ParAMGDDData *amgdd_data );
+HYPRE_Int hypre_BoomerAMGDD_ResidualCommunicationStart ( hypre_ParAMGDDData *amgdd_data );
 HYPRE_Int hypre_BoomerAMGDD_ResidualCommunication ( hypre_ParAMGDDData *amgdd_data );
-HYPRE_Complex* hypre_BoomerAMGDD_PackResidualBuffer ( hypre_AMGDDCompGrid **compGrid,
-                                                      hypre_AMGDDCommPkg *compGridCommPkg, HYPRE_Int current_level, HYPRE_Int proc );
-HYPRE_Int hypre_BoomerAMGDD_UnpackResidualBuffer ( HYPRE_Complex *buffer,
-                                                   hypre_AMGDDCompGrid **compGrid, hypre_AMGDDCommPkg *compGridCommPkg, HYPRE_Int current_level,
-                                                   HYPRE_Int proc );
+HYPRE_Int hypre_BoomerAMGDD_ResidualCommunicationWait ( hypre_ParAMGDDData *amgdd_data );
+HYPRE_Int hypre_BoomerAMGDD_PackResidual ( hypre_AMGDDCompGrid **compGrid,
+                                           hypre_AMGDDCommPkg *compGridCommPkg, HYPRE_Int current_level, HYPRE_Int nonowned );
+HYPRE_Int hypre_BoomerAMGDD_UnpackResidual ( hypre_AMGDDCompGrid **compGrid,
+                                             hypre_AMGDDCommPkg *compGridCommPkg, HYPRE_Int current_level );
 
 /* par_amgdd_setup.c */
 HYPRE_Int hypre_BoomerAMGDDSetup ( void *amgdd_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *b,
@@ -3241,6 +3403,10 @@ HYPRE_Int hypre_BoomerAMGDD_FAC_CFL1JacobiDevice ( void *amgdd_vdata, HYPRE_Int
 /* par_amgdd_comp_grid.c */
 hypre_AMGDDCompGridMatrix* hypre_AMGDDCompGridMatrixCreate();
 HYPRE_Int hypre_AMGDDCompGridMatrixDestroy ( hypre_AMGDDCompGridMatrix *matrix );
+HYPRE_Int hypre_AMGDDCompGridMatrixSetupComposite ( hypre_AMGDDCompGridMatrix *A,
+                                                   HYPRE_Int num_owned, HYPRE_Int num_nonowned );
+HYPRE_Int hypre_AMGDDCompGridMatrixCompositeGather ( hypre_AMGDDCompGridMatrix *A,
+                                                    hypre_AMGDDCompGridVector *x );
 HYPRE_Int hypre_AMGDDCompGridMatvec ( HYPRE_Complex alpha, hypre_AMGDDCompGridMatrix *A,
                                       hypre_AMGDDCompGridVector *x, HYPRE_Complex beta, hypre_AMGDDCompGridVector *y );
 HYPRE_Int hypre_AMGDDCompGridRealMatvec ( HYPRE_Complex alpha, hypre_AMGDDCompGridMatrix *A,
@@ -3322,6 +3488,9 @@ HYPRE_Int hypre_FSAISetAlgoType ( void *data, HYPRE_Int algo_type );
 HYPRE_Int hypre_FSAISetMaxSteps ( void *data, HYPRE_Int max_steps );
 HYPRE_Int hypre_FSAISetMaxStepSize ( void *data, HYPRE_Int max_step_size );
 HYPRE_Int hypre_FSAISetKapTolerance ( void *data, HYPRE_Real kap_tolerance );
+HYPRE_Int hypre_FSAISetNumLevels ( void *data, HYPRE_Int num_levels );
+HYPRE_Int hypre_FSAISetThreshold ( void *data, HYPRE_Real threshold );
+HYPRE_Int hypre_FSAIClearStaticPattern ( void *data );
 HYPRE_Int hypre_FSAISetMaxIterations ( void *data, HYPRE_Int max_iterations );
 HYPRE_Int hypre_FSAISetEigMaxIters ( void *data, HYPRE_Int eig_max_iters );
 HYPRE_Int hypre_FSAISetZeroGuess ( void *data, HYPRE_Int zero_guess );
@@ -3334,6 +3503,8 @@ HYPRE_Int hypre_FSAIGetAlgoType ( void *data, HYPRE_Int *algo_type );
 HYPRE_Int hypre_FSAIGetMaxSteps ( void *data, HYPRE_Int *max_steps );
 HYPRE_Int hypre_FSAIGetMaxStepSize ( void *data, HYPRE_Int *max_step_size );
 HYPRE_Int hypre_FSAIGetKapTolerance ( void *data, HYPRE_Real *kap_tolerance );
+HYPRE_Int hypre_FSAIGetNumLevels ( void *data, HYPRE_Int *num_levels );
+HYPRE_Int hypre_FSAIGetThreshold ( void *data, HYPRE_Real *threshold );
 HYPRE_Int hypre_FSAIGetMaxIterations ( void *data, HYPRE_Int *max_iterations );
 HYPRE_Int hypre_FSAIGetEigMaxIters ( void *data, HYPRE_Int *eig_max_iters );
 HYPRE_Int hypre_FSAIGetZeroGuess ( void *data, HYPRE_Int *zero_guess );
@@ -3353,6 +3524,17 @@ HYPRE_Int hypre_FindKapGrad ( hypre_CSRMatrix *A_diag, hypre_Vector *kaporin_gra
                               HYPRE_Int max_row_size, HYPRE_Int row_num, HYPRE_Int *kg_marker );
 HYPRE_Int hypre_AddToPattern ( hypre_Vector *kaporin_gradient, HYPRE_Int *kap_grad_nonzeros,
                                HYPRE_Int *S_Pattern, HYPRE_Int *S_nnz, HYPRE_Int *kg_marker, HYPRE_Int max_step_size );
+HYPRE_Int hypre_DenseSPDSystemSolveBatch ( HYPRE_Int n, HYPRE_Int nb, HYPRE_Complex *mat,
+                                           HYPRE_Complex *rhs, HYPRE_Int *info );
+HYPRE_Int hypre_FSAISetupRowBlock ( hypre_CSRMatrix *A, HYPRE_Int shift, HYPRE_Int ns, HYPRE_Int ne,
+                                    HYPRE_Int max_steps, HYPRE_Int max_step_size, HYPRE_Real kap_tolerance,
+                                    HYPRE_Int max_cand_size, HYPRE_Int *kg_marker, HYPRE_Int *marker,
+                                    HYPRE_Int *G_j, HYPRE_Complex *G_a, HYPRE_Int *G_nnzcnt );
+HYPRE_Int hypre_FSAIComputeStaticPattern ( hypre_CSRMatrix *A, HYPRE_Int num_levels,
+                                           HYPRE_Real threshold, hypre_CSRMatrix **P_ptr );
+HYPRE_Int hypre_FSAISetupStaticRowBlock ( hypre_CSRMatrix *A, hypre_CSRMatrix *P, HYPRE_Int ns,
+                                          HYPRE_Int ne, HYPRE_Int *marker, HYPRE_Int *G_i,
+                                          HYPRE_Int *G_j, HYPRE_Complex *G_a );
 HYPRE_Int hypre_FSAISetup ( void *fsai_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                             hypre_ParVector *u );
 HYPRE_Int hypre_FSAIPrintStats ( void *fsai_vdata, hypre_ParCSRMatrix *A );
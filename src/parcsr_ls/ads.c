@@ -1583,12 +1583,13 @@ HYPRE_Int hypre_ADSSolve(void *solver,
                                ads_data -> A_min_eig_est,
                                ads_data -> A_cheby_order,
                                ads_data -> A_cheby_fraction,
-                               Ai, Bi, HBi, Pi, ri, gi,
+                               Ai, Bi, HBi, Pi, NULL, NULL, ri, gi,
                                b, x,
                                ads_data -> r0,
                                ads_data -> g0,
                                cycle,
-                               z);
+                               z,
+                               NULL);
 
       /* Compute new residual norms */
       if (ads_data -> maxit > 1)
@@ -898,6 +898,10 @@ void * hypre_AMSCreate()
    ams_data -> owns_Pi   = 1;
    ams_data -> owns_A_G  = 0;
    ams_data -> owns_A_Pi = 0;
+   ams_data -> owns_Gxyz = 0;
+
+   ams_data -> matrix_free_Pi = 0;
+   ams_data -> Pi_comm_pkg    = NULL;
 
    return (void *) ams_data;
 }
@@ -981,6 +985,19 @@ HYPRE_Int hypre_AMSDestroy(void *solver)
       HYPRE_BoomerAMGDestroy(ams_data -> B_Piz);
    }
 
+   hypre_ParCSRSubspaceGroupsDestroy(ams_data -> subspace_groups);
+
+   if (ams_data -> Pi_comm_pkg)
+   {
+      hypre_MatvecCommPkgDestroy(ams_data -> Pi_comm_pkg);
+   }
+   if (ams_data -> owns_Gxyz)
+   {
+      hypre_ParVectorDestroy(ams_data -> Gx);
+      hypre_ParVectorDestroy(ams_data -> Gy);
+      hypre_ParVectorDestroy(ams_data -> Gz);
+   }
+
    if (ams_data -> r0)
    {
       hypre_ParVectorDestroy(ams_data -> r0);
@@ -1319,6 +1336,41 @@ HYPRE_Int hypre_AMSSetCycleType(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetConcurrentSubspaces
+ *
+ * For the additive cycle types (2, 8, 12 and 14), correct the subspaces of
+ * the additive part of the cycle concurrently, on disjoint groups of
+ * processes to which their matrices are redistributed in hypre_AMSSetup.
+ * This needs at least as many processes as concurrent subspaces.  The
+ * default is 0 (sequential corrections).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetConcurrentSubspaces(void *solver,
+                                          HYPRE_Int concurrent_subspaces)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   ams_data -> concurrent_subspaces = concurrent_subspaces;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetMatrixFreePi
+ *
+ * Do not construct the Nedelec interpolation Pi (or Pi{x,y,z}), but apply
+ * it from G and the vectors G{x,y,z}, and compute its Galerkin product
+ * Pi^T A Pi directly.  Only used when Pi is computed by AMS, on the host,
+ * and with cycle types other than 20.  The default is 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetMatrixFreePi(void *solver,
+                                   HYPRE_Int matrix_free_Pi)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   ams_data -> matrix_free_Pi = matrix_free_Pi;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSSetPrintLevel
  *
@@ -2630,219 +2682,1076 @@ HYPRE_Int hypre_AMSComputeGPi(hypre_ParCSRMatrix *A,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_AMSSetup
- *
- * Construct the AMS solver components.
+ * hypre_AMSMatrixFreePiSetup
  *
- * The following functions need to be called before hypre_AMSSetup():
- * - hypre_AMSSetDimension() (if solving a 2D problem)
- * - hypre_AMSSetDiscreteGradient()
- * - hypre_AMSSetCoordinateVectors() or hypre_AMSSetEdgeConstantVectors
+ * Prepare the matrix-free application of Pi: the halo exchange of vector
+ * vertex values, which is that of G with each vertex expanded to its dim
+ * components.
  *--------------------------------------------------------------------------*/
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-__global__ void
-hypreCUDAKernel_FixInterNodes( HYPRE_Int      nrows,
-                               HYPRE_Int     *G0t_diag_i,
-                               HYPRE_Complex *G0t_diag_data,
-                               HYPRE_Int     *G0t_offd_i,
-                               HYPRE_Complex *G0t_offd_data,
-                               HYPRE_Real    *interior_nodes_data)
+
+HYPRE_Int hypre_AMSMatrixFreePiSetup(void *solver)
 {
-   HYPRE_Int row_i = hypre_cuda_get_grid_warp_id<1, 1>();
+   hypre_AMSData       *ams_data = (hypre_AMSData *) solver;
+   hypre_ParCSRMatrix  *G        = ams_data -> G;
+   HYPRE_Int            dim      = ams_data -> dim;
+   hypre_ParCSRCommPkg *comm_pkg_G, *comm_pkg;
+   HYPRE_Int            num_sends, num_recvs, i, d;
 
-   if (row_i >= nrows)
+   if (!hypre_ParCSRMatrixCommPkg(G))
    {
-      return;
+      hypre_MatvecCommPkgCreate(G);
    }
+   comm_pkg_G = hypre_ParCSRMatrixCommPkg(G);
+   num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg_G);
+   num_recvs  = hypre_ParCSRCommPkgNumRecvs(comm_pkg_G);
 
-   HYPRE_Int lane = hypre_cuda_get_lane_id<1>();
-   HYPRE_Int not1 = 0;
-
-   if (lane == 0)
+   if (ams_data -> Pi_comm_pkg)
    {
-      not1 = read_only_load(&interior_nodes_data[row_i]) != 1.0;
+      hypre_MatvecCommPkgDestroy(ams_data -> Pi_comm_pkg);
    }
 
-   not1 = __shfl_sync(HYPRE_WARP_FULL_MASK, not1, 0);
+   comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgComm(comm_pkg)     = hypre_ParCSRCommPkgComm(comm_pkg_G);
+   hypre_ParCSRCommPkgNumSends(comm_pkg) = num_sends;
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg) = num_recvs;
 
-   if (!not1)
+   hypre_ParCSRCommPkgSendProcs(comm_pkg)     = hypre_TAlloc(HYPRE_Int, num_sends,
+                                                             HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends + 1,
+                                                             HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgSendMapElmts(comm_pkg)  =
+      hypre_TAlloc(HYPRE_Int, dim * hypre_ParCSRCommPkgSendMapStart(comm_pkg_G, num_sends),
+                   HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvProcs(comm_pkg)     = hypre_TAlloc(HYPRE_Int, num_recvs,
+                                                             HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs + 1,
+                                                             HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_sends; i++)
    {
-      return;
+      hypre_ParCSRCommPkgSendProc(comm_pkg, i) = hypre_ParCSRCommPkgSendProc(comm_pkg_G, i);
    }
-
-   HYPRE_Int p1, q1, p2 = 0, q2 = 0;
-   bool nonempty_offd = G0t_offd_data != NULL;
-
-   if (lane < 2)
+   for (i = 0; i <= num_sends; i++)
    {
-      p1 = read_only_load(G0t_diag_i + row_i + lane);
-      if (nonempty_offd)
-      {
-         p2 = read_only_load(G0t_offd_i + row_i + lane);
-      }
+      hypre_ParCSRCommPkgSendMapStart(comm_pkg, i) =
+         dim * hypre_ParCSRCommPkgSendMapStart(comm_pkg_G, i);
    }
-
-   q1 = __shfl_sync(HYPRE_WARP_FULL_MASK, p1, 1);
-   p1 = __shfl_sync(HYPRE_WARP_FULL_MASK, p1, 0);
-   if (nonempty_offd)
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg_G, num_sends); i++)
    {
-      q2 = __shfl_sync(HYPRE_WARP_FULL_MASK, p2, 1);
-      p2 = __shfl_sync(HYPRE_WARP_FULL_MASK, p2, 0);
+      for (d = 0; d < dim; d++)
+      {
+         hypre_ParCSRCommPkgSendMapElmt(comm_pkg, dim * i + d) =
+            dim * hypre_ParCSRCommPkgSendMapElmt(comm_pkg_G, i) + d;
+      }
    }
-
-   for (HYPRE_Int j = p1 + lane; j < q1; j += HYPRE_WARP_SIZE)
+   for (i = 0; i < num_recvs; i++)
    {
-      G0t_diag_data[j] = 0.0;
+      hypre_ParCSRCommPkgRecvProc(comm_pkg, i) = hypre_ParCSRCommPkgRecvProc(comm_pkg_G, i);
    }
-   for (HYPRE_Int j = p2 + lane; j < q2; j += HYPRE_WARP_SIZE)
+   for (i = 0; i <= num_recvs; i++)
    {
-      G0t_offd_data[j] = 0.0;
+      hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i) =
+         dim * hypre_ParCSRCommPkgRecvVecStart(comm_pkg_G, i);
    }
+
+   ams_data -> Pi_comm_pkg = comm_pkg;
+
+   return hypre_error_flag;
 }
 
-__global__ void
-hypreCUDAKernel_AMSSetupScaleGGt( HYPRE_Int   Gt_num_rows,
-                                  HYPRE_Int  *Gt_diag_i,
-                                  HYPRE_Int  *Gt_diag_j,
-                                  HYPRE_Real *Gt_diag_data,
-                                  HYPRE_Int  *Gt_offd_i,
-                                  HYPRE_Real *Gt_offd_data,
-                                  HYPRE_Real *Gx_data,
-                                  HYPRE_Real *Gy_data,
-                                  HYPRE_Real *Gz_data )
-{
-   HYPRE_Int row_i = hypre_cuda_get_grid_warp_id<1, 1>();
+/*--------------------------------------------------------------------------
+ * hypre_AMSMatrixFreePiMatvec
+ *
+ * Matrix-free interpolation for hypre_ParCSRSubspacePrec, with the
+ * subspace numbering of hypre_AMSSolve: P = Pi for subspace 1, and
+ * P = Pix, Piy, Piz for subspaces 2, 3, 4.  Computes y = alpha P x + beta y,
+ * or y = alpha P^t x + beta y if trans is nonzero.  The entries of Pi are
+ * 0.5 |G_ej| (Gx_e, Gy_e, Gz_e) for the edges e and the vertices j of G.
+ *--------------------------------------------------------------------------*/
 
-   if (row_i >= Gt_num_rows)
+HYPRE_Int hypre_AMSMatrixFreePiMatvec(void *solver,
+                                      HYPRE_Int subspace,
+                                      HYPRE_Int trans,
+                                      HYPRE_Complex alpha,
+                                      hypre_ParVector *x,
+                                      HYPRE_Complex beta,
+                                      hypre_ParVector *y)
+{
+   hypre_AMSData      *ams_data    = (hypre_AMSData *) solver;
+   hypre_ParCSRMatrix *G           = ams_data -> G;
+   hypre_CSRMatrix    *G_diag      = hypre_ParCSRMatrixDiag(G);
+   HYPRE_Int          *G_diag_i    = hypre_CSRMatrixI(G_diag);
+   HYPRE_Int          *G_diag_j    = hypre_CSRMatrixJ(G_diag);
+   HYPRE_Real         *G_diag_data = hypre_CSRMatrixData(G_diag);
+   hypre_CSRMatrix    *G_offd      = hypre_ParCSRMatrixOffd(G);
+   HYPRE_Int          *G_offd_i    = hypre_CSRMatrixI(G_offd);
+   HYPRE_Int          *G_offd_j    = hypre_CSRMatrixJ(G_offd);
+   HYPRE_Real         *G_offd_data = hypre_CSRMatrixData(G_offd);
+   HYPRE_Int           num_edges   = hypre_CSRMatrixNumRows(G_diag);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(G_offd);
+   HYPRE_Complex      *x_data      = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex      *y_data      = hypre_VectorData(hypre_ParVectorLocalVector(y));
+
+   hypre_ParVector        *Gd[3];
+   HYPRE_Real             *w[3];
+   hypre_ParCSRCommPkg    *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Complex          *buf_data = NULL, *ext_data = NULL;
+   HYPRE_Complex           s[3], t;
+   HYPRE_Int               nb, comp, num_sends, num_elmts = 0;
+   HYPRE_Int               e, i, jj, j, d;
+
+   Gd[0] = ams_data -> Gx;  Gd[1] = ams_data -> Gy;  Gd[2] = ams_data -> Gz;
+   if (subspace == 1)
+   {
+      nb   = ams_data -> dim;
+      comp = 0;
+      comm_pkg = ams_data -> Pi_comm_pkg;
+   }
+   else
    {
-      return;
+      nb   = 1;
+      comp = subspace - 2;
+      comm_pkg = hypre_ParCSRMatrixCommPkg(G);
    }
-
-   HYPRE_Int lane = hypre_cuda_get_lane_id<1>();
-   HYPRE_Real h2 = 0.0;
-   HYPRE_Int ne, p1, q1, p2 = 0, q2 = 0;
-
-   if (lane < 2)
+   for (d = 0; d < nb; d++)
    {
-      p1 = read_only_load(Gt_diag_i + row_i + lane);
+      w[d] = hypre_VectorData(hypre_ParVectorLocalVector(Gd[comp + d]));
    }
-   q1 = __shfl_sync(HYPRE_WARP_FULL_MASK, p1, 1);
-   p1 = __shfl_sync(HYPRE_WARP_FULL_MASK, p1, 0);
-   ne = q1 - p1;
 
-   if (ne == 0)
+   if (comm_pkg)
    {
-      return;
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      num_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      buf_data  = hypre_TAlloc(HYPRE_Complex, num_elmts, HYPRE_MEMORY_HOST);
+      ext_data  = hypre_CTAlloc(HYPRE_Complex, nb * num_cols_offd, HYPRE_MEMORY_HOST);
    }
 
-   if (Gt_offd_data != NULL)
+   if (!trans)
    {
-      if (lane < 2)
+      /* values of x at the off-processor vertices */
+      if (comm_pkg)
       {
-         p2 = read_only_load(Gt_offd_i + row_i + lane);
+         for (i = 0; i < num_elmts; i++)
+         {
+            buf_data[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+         }
+         comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, buf_data, ext_data);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
       }
-      q2 = __shfl_sync(HYPRE_WARP_FULL_MASK, p2, 1);
-      p2 = __shfl_sync(HYPRE_WARP_FULL_MASK, p2, 0);
-   }
 
-   for (HYPRE_Int j = p1 + lane; j < q1; j += HYPRE_WARP_SIZE)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(e,jj,j,d,s,t) HYPRE_SMP_SCHEDULE
+#endif
+      for (e = 0; e < num_edges; e++)
+      {
+         for (d = 0; d < nb; d++)
+         {
+            s[d] = 0.0;
+         }
+         for (jj = G_diag_i[e]; jj < G_diag_i[e + 1]; jj++)
+         {
+            j = G_diag_j[jj];
+            for (d = 0; d < nb; d++)
+            {
+               s[d] += fabs(G_diag_data[jj]) * x_data[nb * j + d];
+            }
+         }
+         for (jj = G_offd_i[e]; jj < G_offd_i[e + 1]; jj++)
+         {
+            j = G_offd_j[jj];
+            for (d = 0; d < nb; d++)
+            {
+               s[d] += fabs(G_offd_data[jj]) * ext_data[nb * j + d];
+            }
+         }
+         t = 0.0;
+         for (d = 0; d < nb; d++)
+         {
+            t += w[d][e] * s[d];
+         }
+         if (beta == 0.0)
+         {
+            y_data[e] = 0.5 * alpha * t;
+         }
+         else
+         {
+            y_data[e] = beta * y_data[e] + 0.5 * alpha * t;
+         }
+      }
+   }
+   else
    {
-      const HYPRE_Int k = read_only_load(&Gt_diag_j[j]);
-      const HYPRE_Real Gx = read_only_load(&Gx_data[k]);
-      const HYPRE_Real Gy = read_only_load(&Gy_data[k]);
-      const HYPRE_Real Gz = read_only_load(&Gz_data[k]);
+      if (beta == 0.0)
+      {
+         hypre_ParVectorSetConstantValues(y, 0.0);
+      }
+      else if (beta != 1.0)
+      {
+         hypre_ParVectorScale(beta, y);
+      }
 
-      h2 += Gx * Gx + Gy * Gy + Gz * Gz;
+      /* scatter the edge values to the vertices */
+      for (e = 0; e < num_edges; e++)
+      {
+         t = 0.5 * alpha * x_data[e];
+         for (d = 0; d < nb; d++)
+         {
+            s[d] = t * w[d][e];
+         }
+         for (jj = G_diag_i[e]; jj < G_diag_i[e + 1]; jj++)
+         {
+            j = G_diag_j[jj];
+            for (d = 0; d < nb; d++)
+            {
+               y_data[nb * j + d] += fabs(G_diag_data[jj]) * s[d];
+            }
+         }
+         for (jj = G_offd_i[e]; jj < G_offd_i[e + 1]; jj++)
+         {
+            j = G_offd_j[jj];
+            for (d = 0; d < nb; d++)
+            {
+               ext_data[nb * j + d] += fabs(G_offd_data[jj]) * s[d];
+            }
+         }
+      }
+
+      /* add the contributions to the off-processor vertices */
+      if (comm_pkg)
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate(2, comm_pkg, ext_data, buf_data);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         for (i = 0; i < num_elmts; i++)
+         {
+            y_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)] += buf_data[i];
+         }
+      }
    }
 
-   h2 = warp_allreduce_sum(h2) / ne;
+   hypre_TFree(buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(ext_data, HYPRE_MEMORY_HOST);
 
-   for (HYPRE_Int j = p1 + lane; j < q1; j += HYPRE_WARP_SIZE)
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSMatrixFreePiRAP
+ *
+ * Galerkin product P^T A P for the matrix-free P of subspace 1, 2, 3 or 4
+ * (see hypre_AMSMatrixFreePiMatvec), without forming P.  With the weights
+ * w_e = (Gx_e, Gy_e, Gz_e) (or one of them for Pi{x,y,z}), the nb x nb
+ * block of vertices j and k is
+ *    0.25 sum_{e,f} |G_ej| A_ef |G_fk| w_e w_f^T,
+ * so the product is computed once on the vertex pattern, with the edge
+ * weights applied in its innermost loop.  The rows of the vertices of
+ * other processes are sent to their owners, as in the RAP of two ParCSR
+ * matrices.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSMatrixFreePiRAP(void *solver,
+                                   HYPRE_Int subspace,
+                                   hypre_ParCSRMatrix *A,
+                                   hypre_ParCSRMatrix **A_Pi_ptr)
+{
+   hypre_AMSData      *ams_data       = (hypre_AMSData *) solver;
+   hypre_ParCSRMatrix *G              = ams_data -> G;
+   MPI_Comm            comm           = hypre_ParCSRMatrixComm(G);
+   hypre_CSRMatrix    *G_diag         = hypre_ParCSRMatrixDiag(G);
+   HYPRE_Int          *G_diag_i       = hypre_CSRMatrixI(G_diag);
+   HYPRE_Int          *G_diag_j       = hypre_CSRMatrixJ(G_diag);
+   HYPRE_Real         *G_diag_data    = hypre_CSRMatrixData(G_diag);
+   hypre_CSRMatrix    *G_offd         = hypre_ParCSRMatrixOffd(G);
+   HYPRE_Int          *G_offd_i       = hypre_CSRMatrixI(G_offd);
+   HYPRE_Int          *G_offd_j       = hypre_CSRMatrixJ(G_offd);
+   HYPRE_Real         *G_offd_data    = hypre_CSRMatrixData(G_offd);
+   HYPRE_BigInt       *col_map_offd_G = hypre_ParCSRMatrixColMapOffd(G);
+   HYPRE_BigInt        first_node     = hypre_ParCSRMatrixFirstColDiag(G);
+   HYPRE_Int           num_edges      = hypre_CSRMatrixNumRows(G_diag);
+   HYPRE_Int           num_nodes      = hypre_CSRMatrixNumCols(G_diag);
+   HYPRE_Int           num_cols_offd_G = hypre_CSRMatrixNumCols(G_offd);
+   hypre_CSRMatrix    *A_diag         = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int          *A_diag_i       = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int          *A_diag_j       = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real         *A_diag_data    = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix    *A_offd         = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int          *A_offd_i       = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int          *A_offd_j       = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real         *A_offd_data    = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_ParCSRMatrix  *A_Pi;
+   hypre_ParVector     *Gd[3];
+   hypre_ParCSRCommPkg *comm_pkg_A, *comm_pkg_Pi = NULL;
+   hypre_CSRMatrix     *G_ext = NULL;
+   HYPRE_Int           *G_ext_i = NULL;
+   HYPRE_BigInt        *G_ext_j = NULL;
+   HYPRE_Real          *G_ext_data = NULL;
+   hypre_CSRMatrix     *C_diag, *C_offd, *C_int;
+   HYPRE_Int           *C_diag_i, *C_diag_j, *C_offd_i, *C_offd_j, *C_int_i;
+   HYPRE_BigInt        *C_int_j;
+   HYPRE_Real          *C_diag_data, *C_offd_data, *C_int_data;
+   HYPRE_BigInt        *col_map_Q = NULL, *col_map_offd_C = NULL;
+   HYPRE_BigInt         starts[2], global_nodes, big_k;
+   HYPRE_Int           *G_offd_map = NULL;
+   HYPRE_Int           *Gf_i, *Gf_j, *GT_i, *GT_j, *N_i, *N_j = NULL;
+   HYPRE_Real          *Gf_data, *GT_data, *w, *N_data = NULL, *buf_data, *ext_data;
+   HYPRE_Int            num_procs, nb, nb2, comp, num_cols_Q, num_cols_offd_C;
+   HYPRE_Int            num_rows, nnz_diag, nnz_offd, nnz_int, num_sends;
+   HYPRE_Int            i, ii, jj, kk, k, d, b, r, cnt;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   Gd[0] = ams_data -> Gx;  Gd[1] = ams_data -> Gy;  Gd[2] = ams_data -> Gz;
+   if (subspace == 1)
+   {
+      nb   = ams_data -> dim;
+      comp = 0;
+      comm_pkg_Pi = ams_data -> Pi_comm_pkg;
+   }
+   else
    {
-      Gt_diag_data[j] *= h2;
+      nb   = 1;
+      comp = subspace - 2;
+      comm_pkg_Pi = hypre_ParCSRMatrixCommPkg(G);
    }
+   nb2 = nb * nb;
 
-   for (HYPRE_Int j = p2 + lane; j < q2; j += HYPRE_WARP_SIZE)
+   if (!hypre_ParCSRMatrixCommPkg(A))
    {
-      Gt_offd_data[j] *= h2;
+      hypre_MatvecCommPkgCreate(A);
    }
-}
-#endif
-
-HYPRE_Int hypre_AMSSetup(void *solver,
-                         hypre_ParCSRMatrix *A,
-                         hypre_ParVector *b,
-                         hypre_ParVector *x)
-{
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_ParCSRMatrixMemoryLocation(A) );
-#endif
-
-   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
-
-   HYPRE_Int input_info = 0;
+   comm_pkg_A = hypre_ParCSRMatrixCommPkg(A);
 
-   ams_data -> A = A;
+   /*-----------------------------------------------------------------------
+    * Edge weights, and rows of G, for the local and the off-processor
+    * columns of A (numbered after the local edges)
+    *-----------------------------------------------------------------------*/
 
-   /* Modifications for problems with zero-conductivity regions */
-   if (ams_data -> interior_nodes)
+   w = hypre_TAlloc(HYPRE_Real, nb * (num_edges + num_cols_offd_A), HYPRE_MEMORY_HOST);
+   for (d = 0; d < nb; d++)
    {
-      hypre_ParCSRMatrix *G0t, *Aorig = A;
-
-      /* Make sure that multiple Setup()+Solve() give identical results */
-      ams_data -> solve_counter = 0;
+      HYPRE_Real *Gd_data = hypre_VectorData(hypre_ParVectorLocalVector(Gd[comp + d]));
+      for (i = 0; i < num_edges; i++)
+      {
+         w[nb * i + d] = Gd_data[i];
+      }
+   }
 
-      /* Construct the discrete gradient matrix for the zero-conductivity region
-         by eliminating the zero-conductivity nodes from G^t. The range of G0
-         represents the kernel of A, i.e. the gradients of nodal basis functions
-         supported in zero-conductivity regions. */
-      hypre_ParCSRMatrixTranspose(ams_data -> G, &G0t, 1);
+   if (num_procs > 1)
+   {
+      hypre_ParCSRCommHandle *comm_handle;
 
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+      buf_data  = hypre_TAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends),
+                               HYPRE_MEMORY_HOST);
+      ext_data  = hypre_TAlloc(HYPRE_Real, num_cols_offd_A, HYPRE_MEMORY_HOST);
+      for (d = 0; d < nb; d++)
       {
-         HYPRE_Int i, j;
-         HYPRE_Int nv = hypre_ParCSRMatrixNumCols(ams_data -> G);
-         hypre_CSRMatrix *G0td = hypre_ParCSRMatrixDiag(G0t);
-         HYPRE_Int *G0tdI = hypre_CSRMatrixI(G0td);
-         HYPRE_Real *G0tdA = hypre_CSRMatrixData(G0td);
-         hypre_CSRMatrix *G0to = hypre_ParCSRMatrixOffd(G0t);
-         HYPRE_Int *G0toI = hypre_CSRMatrixI(G0to);
-         HYPRE_Real *G0toA = hypre_CSRMatrixData(G0to);
-         HYPRE_Real *interior_nodes_data = hypre_VectorData(
-                                              hypre_ParVectorLocalVector((hypre_ParVector*) ams_data -> interior_nodes));
-
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-         if (exec == HYPRE_EXEC_DEVICE)
+         HYPRE_Real *Gd_data = hypre_VectorData(hypre_ParVectorLocalVector(Gd[comp + d]));
+         for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends); i++)
          {
-            dim3 bDim = hypre_GetDefaultDeviceBlockDimension();
-            dim3 gDim = hypre_GetDefaultDeviceGridDimension(nv, "warp", bDim);
-            HYPRE_CUDA_LAUNCH( hypreCUDAKernel_FixInterNodes, gDim, bDim,
-                               nv, G0tdI, G0tdA, G0toI, G0toA, interior_nodes_data );
+            buf_data[i] = Gd_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg_A, i)];
          }
-         else
-#endif
+         comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg_A, buf_data, ext_data);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         for (i = 0; i < num_cols_offd_A; i++)
          {
-            for (i = 0; i < nv; i++)
-            {
-               if (interior_nodes_data[i] != 1)
-               {
-                  for (j = G0tdI[i]; j < G0tdI[i + 1]; j++)
-                  {
-                     G0tdA[j] = 0.0;
-                  }
-                  if (G0toI)
-                     for (j = G0toI[i]; j < G0toI[i + 1]; j++)
-                     {
-                        G0toA[j] = 0.0;
-                     }
-               }
-            }
+            w[nb * (num_edges + i) + d] = ext_data[i];
          }
       }
-      hypre_ParCSRMatrixTranspose(G0t, & ams_data -> G0, 1);
+      hypre_TFree(buf_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(ext_data, HYPRE_MEMORY_HOST);
 
-      /* Construct the subspace matrix A_G0 = G0^T G0 */
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      if (exec == HYPRE_EXEC_DEVICE)
+      G_ext      = hypre_ParCSRMatrixExtractBExt(G, A, 1);
+      G_ext_i    = hypre_CSRMatrixI(G_ext);
+      G_ext_j    = hypre_CSRMatrixBigJ(G_ext);
+      G_ext_data = hypre_CSRMatrixData(G_ext);
+   }
+
+   /* off-processor vertices: those of G, and those reached through A */
+   num_cols_Q = num_cols_offd_G;
+   if (G_ext)
+   {
+      num_cols_Q += G_ext_i[num_cols_offd_A];
+   }
+   col_map_Q = hypre_TAlloc(HYPRE_BigInt, num_cols_Q, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_G; i++)
+   {
+      col_map_Q[i] = col_map_offd_G[i];
+   }
+   cnt = num_cols_offd_G;
+   if (G_ext)
+   {
+      for (i = 0; i < G_ext_i[num_cols_offd_A]; i++)
+      {
+         if (G_ext_j[i] < first_node || G_ext_j[i] >= first_node + num_nodes)
+         {
+            col_map_Q[cnt++] = G_ext_j[i];
+         }
+      }
+   }
+   num_cols_Q = 0;
+   if (cnt)
+   {
+      hypre_BigQsort0(col_map_Q, 0, cnt - 1);
+      num_cols_Q = 1;
+      for (i = 1; i < cnt; i++)
+      {
+         if (col_map_Q[i] > col_map_Q[num_cols_Q - 1])
+         {
+            col_map_Q[num_cols_Q++] = col_map_Q[i];
+         }
+      }
+   }
+
+   G_offd_map = hypre_TAlloc(HYPRE_Int, num_cols_offd_G, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_G; i++)
+   {
+      G_offd_map[i] = num_nodes + hypre_BigBinarySearch(col_map_Q, col_map_offd_G[i], num_cols_Q);
+   }
+
+   /* |G| for all these edges, with local vertex numbers (the off-processor
+      vertices numbered after the local ones) */
+   num_rows = num_edges + num_cols_offd_A;
+   Gf_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   Gf_i[0] = 0;
+   for (i = 0; i < num_edges; i++)
+   {
+      Gf_i[i + 1] = Gf_i[i] + (G_diag_i[i + 1] - G_diag_i[i]) + (G_offd_i[i + 1] - G_offd_i[i]);
+   }
+   for (i = 0; i < num_cols_offd_A; i++)
+   {
+      Gf_i[num_edges + i + 1] = Gf_i[num_edges + i] + G_ext_i[i + 1] - G_ext_i[i];
+   }
+   Gf_j    = hypre_TAlloc(HYPRE_Int,  Gf_i[num_rows], HYPRE_MEMORY_HOST);
+   Gf_data = hypre_TAlloc(HYPRE_Real, Gf_i[num_rows], HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (i = 0; i < num_edges; i++)
+   {
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         Gf_j[cnt]      = G_diag_j[jj];
+         Gf_data[cnt++] = fabs(G_diag_data[jj]);
+      }
+      for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+      {
+         Gf_j[cnt]      = G_offd_map[G_offd_j[jj]];
+         Gf_data[cnt++] = fabs(G_offd_data[jj]);
+      }
+   }
+   for (i = 0; i < num_cols_offd_A; i++)
+   {
+      for (jj = G_ext_i[i]; jj < G_ext_i[i + 1]; jj++)
+      {
+         big_k = G_ext_j[jj];
+         if (big_k >= first_node && big_k < first_node + num_nodes)
+         {
+            Gf_j[cnt] = (HYPRE_Int) (big_k - first_node);
+         }
+         else
+         {
+            Gf_j[cnt] = num_nodes + hypre_BigBinarySearch(col_map_Q, big_k, num_cols_Q);
+         }
+         Gf_data[cnt++] = fabs(G_ext_data[jj]);
+      }
+   }
+   hypre_CSRMatrixDestroy(G_ext);
+
+   /* |G|^T for the local edges: the local vertices, then the off-processor
+      vertices of G */
+   num_rows = num_nodes + num_cols_offd_G;
+   GT_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_edges; i++)
+   {
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         GT_i[G_diag_j[jj] + 1]++;
+      }
+      for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+      {
+         GT_i[num_nodes + G_offd_j[jj] + 1]++;
+      }
+   }
+   for (r = 0; r < num_rows; r++)
+   {
+      GT_i[r + 1] += GT_i[r];
+   }
+   GT_j    = hypre_TAlloc(HYPRE_Int,  GT_i[num_rows], HYPRE_MEMORY_HOST);
+   GT_data = hypre_TAlloc(HYPRE_Real, GT_i[num_rows], HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_edges; i++)
+   {
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         r = G_diag_j[jj];
+         GT_j[GT_i[r]]      = i;
+         GT_data[GT_i[r]++] = 0.25 * fabs(G_diag_data[jj]);
+      }
+      for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+      {
+         r = num_nodes + G_offd_j[jj];
+         GT_j[GT_i[r]]      = i;
+         GT_data[GT_i[r]++] = 0.25 * fabs(G_offd_data[jj]);
+      }
+   }
+   for (r = num_rows; r > 0; r--)
+   {
+      GT_i[r] = GT_i[r - 1];
+   }
+   GT_i[0] = 0;
+
+   /*-----------------------------------------------------------------------
+    * Vertex rows of the product, with nb x nb blocks: row-wise, as
+    * |G|^T (A |G|), with a symbolic and a numeric pass
+    *-----------------------------------------------------------------------*/
+
+   N_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, ii, jj, kk, k, d, b, r, cnt)
+#endif
+   {
+      HYPRE_Int   num_cols = num_nodes + num_cols_Q;
+      HYPRE_Int  *marker   = hypre_TAlloc(HYPRE_Int, num_cols, HYPRE_MEMORY_HOST);
+      HYPRE_Int  *Ae_i, *Ae_j, part, f, row_start;
+      HYPRE_Real *Ae_data, *we, *wf, *block, a, t, v[3];
+      HYPRE_Int   ns, ne;
+
+      hypre_partition1D(num_rows, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      for (k = 0; k < num_cols; k++)
+      {
+         marker[k] = -1;
+      }
+      for (r = ns; r < ne; r++)
+      {
+         cnt = 0;
+         for (ii = GT_i[r]; ii < GT_i[r + 1]; ii++)
+         {
+            i = GT_j[ii];
+            for (part = 0; part < 2; part++)
+            {
+               Ae_i = part ? A_offd_i : A_diag_i;
+               Ae_j = part ? A_offd_j : A_diag_j;
+               for (jj = Ae_i[i]; jj < Ae_i[i + 1]; jj++)
+               {
+                  f = part ? num_edges + Ae_j[jj] : Ae_j[jj];
+                  for (kk = Gf_i[f]; kk < Gf_i[f + 1]; kk++)
+                  {
+                     if (marker[Gf_j[kk]] != r)
+                     {
+                        marker[Gf_j[kk]] = r;
+                        cnt++;
+                     }
+                  }
+               }
+            }
+         }
+         N_i[r + 1] = cnt;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+      #pragma omp single
+#endif
+      {
+         for (r = 0; r < num_rows; r++)
+         {
+            N_i[r + 1] += N_i[r];
+         }
+         N_j    = hypre_TAlloc(HYPRE_Int, N_i[num_rows], HYPRE_MEMORY_HOST);
+         N_data = hypre_CTAlloc(HYPRE_Real, nb2 * N_i[num_rows], HYPRE_MEMORY_HOST);
+      }
+
+      for (k = 0; k < num_cols; k++)
+      {
+         marker[k] = -1;
+      }
+      for (r = ns; r < ne; r++)
+      {
+         row_start = cnt = N_i[r];
+         for (ii = GT_i[r]; ii < GT_i[r + 1]; ii++)
+         {
+            i  = GT_j[ii];
+            we = &w[nb * i];
+            for (part = 0; part < 2; part++)
+            {
+               Ae_i    = part ? A_offd_i : A_diag_i;
+               Ae_j    = part ? A_offd_j : A_diag_j;
+               Ae_data = part ? A_offd_data : A_diag_data;
+               for (jj = Ae_i[i]; jj < Ae_i[i + 1]; jj++)
+               {
+                  f  = part ? num_edges + Ae_j[jj] : Ae_j[jj];
+                  wf = &w[nb * f];
+                  a  = GT_data[ii] * Ae_data[jj];
+                  for (d = 0; d < nb; d++)
+                  {
+                     v[d] = a * we[d];
+                  }
+                  for (kk = Gf_i[f]; kk < Gf_i[f + 1]; kk++)
+                  {
+                     k = Gf_j[kk];
+                     if (marker[k] < row_start)
+                     {
+                        marker[k] = cnt;
+                        N_j[cnt++] = k;
+                     }
+                     block = &N_data[nb2 * marker[k]];
+                     for (d = 0; d < nb; d++)
+                     {
+                        t = v[d] * Gf_data[kk];
+                        for (b = 0; b < nb; b++)
+                        {
+                           block[d * nb + b] += t * wf[b];
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(w, HYPRE_MEMORY_HOST);
+   hypre_TFree(Gf_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(Gf_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(Gf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(GT_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(GT_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(GT_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(G_offd_map, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Expand the blocks: rows and columns nb * vertex + component.  The
+    * local rows give C_diag and C_offd, the other ones C_int.
+    *-----------------------------------------------------------------------*/
+
+   nnz_diag = 0;
+   for (r = 0; r < num_nodes; r++)
+   {
+      for (jj = N_i[r]; jj < N_i[r + 1]; jj++)
+      {
+         if (N_j[jj] < num_nodes)
+         {
+            nnz_diag++;
+         }
+      }
+   }
+   nnz_offd = N_i[num_nodes] - nnz_diag;
+   nnz_int  = N_i[num_rows] - N_i[num_nodes];
+
+   C_diag = hypre_CSRMatrixCreate(nb * num_nodes, nb * num_nodes, nb2 * nnz_diag);
+   C_offd = hypre_CSRMatrixCreate(nb * num_nodes, nb * num_cols_Q, nb2 * nnz_offd);
+   hypre_CSRMatrixInitialize_v2(C_diag, 0, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixInitialize_v2(C_offd, 0, HYPRE_MEMORY_HOST);
+   C_diag_i    = hypre_CSRMatrixI(C_diag);
+   C_diag_j    = hypre_CSRMatrixJ(C_diag);
+   C_diag_data = hypre_CSRMatrixData(C_diag);
+   C_offd_i    = hypre_CSRMatrixI(C_offd);
+   C_offd_j    = hypre_CSRMatrixJ(C_offd);
+   C_offd_data = hypre_CSRMatrixData(C_offd);
+
+   nnz_diag = 0;
+   nnz_offd = 0;
+   for (r = 0; r < num_nodes; r++)
+   {
+      for (d = 0; d < nb; d++)
+      {
+         C_diag_i[nb * r + d] = nnz_diag;
+         C_offd_i[nb * r + d] = nnz_offd;
+         for (jj = N_i[r]; jj < N_i[r + 1]; jj++)
+         {
+            k = N_j[jj];
+            for (b = 0; b < nb; b++)
+            {
+               if (k < num_nodes)
+               {
+                  C_diag_j[nnz_diag]      = nb * k + b;
+                  C_diag_data[nnz_diag++] = N_data[nb2 * jj + d * nb + b];
+               }
+               else
+               {
+                  C_offd_j[nnz_offd]      = nb * (k - num_nodes) + b;
+                  C_offd_data[nnz_offd++] = N_data[nb2 * jj + d * nb + b];
+               }
+            }
+         }
+      }
+   }
+   C_diag_i[nb * num_nodes] = nnz_diag;
+   C_offd_i[nb * num_nodes] = nnz_offd;
+
+   global_nodes = hypre_ParCSRMatrixGlobalNumCols(G);
+   num_cols_offd_C = 0;
+
+   if (num_procs > 1)
+   {
+      hypre_CSRMatrix *C_ext, *C_ext_diag = NULL, *C_ext_offd = NULL, *C_new;
+      HYPRE_BigInt    *col_map_offd_Q;
+      HYPRE_Int       *map_Q_to_C;
+      void            *request;
+
+      C_int      = hypre_CSRMatrixCreate(nb * num_cols_offd_G, (HYPRE_Int) (nb * global_nodes),
+                                         nb2 * nnz_int);
+      C_int_i    = hypre_TAlloc(HYPRE_Int, nb * num_cols_offd_G + 1, HYPRE_MEMORY_HOST);
+      C_int_j    = hypre_TAlloc(HYPRE_BigInt, nb2 * nnz_int, HYPRE_MEMORY_HOST);
+      C_int_data = hypre_TAlloc(HYPRE_Real, nb2 * nnz_int, HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (r = num_nodes; r < num_rows; r++)
+      {
+         for (d = 0; d < nb; d++)
+         {
+            C_int_i[nb * (r - num_nodes) + d] = cnt;
+            for (jj = N_i[r]; jj < N_i[r + 1]; jj++)
+            {
+               k = N_j[jj];
+               big_k = (k < num_nodes) ? first_node + k : col_map_Q[k - num_nodes];
+               for (b = 0; b < nb; b++)
+               {
+                  C_int_j[cnt]      = nb * big_k + b;
+                  C_int_data[cnt++] = N_data[nb2 * jj + d * nb + b];
+               }
+            }
+         }
+      }
+      C_int_i[nb * num_cols_offd_G] = cnt;
+      hypre_CSRMatrixI(C_int)    = C_int_i;
+      hypre_CSRMatrixBigJ(C_int) = C_int_j;
+      hypre_CSRMatrixData(C_int) = C_int_data;
+      hypre_CSRMatrixMemoryLocation(C_int) = HYPRE_MEMORY_HOST;
+
+      hypre_TFree(N_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(N_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(N_data, HYPRE_MEMORY_HOST);
+
+      /* send the rows of the off-processor vertices to their owners */
+      hypre_ExchangeExternalRowsInit(C_int, comm_pkg_Pi, &request);
+      C_ext = hypre_ExchangeExternalRowsWait(request);
+      hypre_CSRMatrixDestroy(C_int);
+
+      col_map_offd_Q = hypre_TAlloc(HYPRE_BigInt, nb * num_cols_Q, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_Q; i++)
+      {
+         for (b = 0; b < nb; b++)
+         {
+            col_map_offd_Q[nb * i + b] = nb * col_map_Q[i] + b;
+         }
+      }
+
+      hypre_CSRMatrixSplit(C_ext, nb * first_node, nb * (first_node + num_nodes) - 1,
+                           nb * num_cols_Q, col_map_offd_Q, &num_cols_offd_C, &col_map_offd_C,
+                           &C_ext_diag, &C_ext_offd);
+      hypre_CSRMatrixDestroy(C_ext);
+
+      /* renumber the columns of C_offd, and add the received rows */
+      if (num_cols_Q)
+      {
+         map_Q_to_C = hypre_TAlloc(HYPRE_Int, nb * num_cols_Q, HYPRE_MEMORY_HOST);
+         cnt = 0;
+         for (i = 0; i < num_cols_offd_C && cnt < nb * num_cols_Q; i++)
+         {
+            if (col_map_offd_C[i] == col_map_offd_Q[cnt])
+            {
+               map_Q_to_C[cnt++] = i;
+            }
+         }
+         for (i = 0; i < C_offd_i[nb * num_nodes]; i++)
+         {
+            C_offd_j[i] = map_Q_to_C[C_offd_j[i]];
+         }
+         hypre_TFree(map_Q_to_C, HYPRE_MEMORY_HOST);
+      }
+      hypre_CSRMatrixNumCols(C_offd) = num_cols_offd_C;
+      hypre_TFree(col_map_offd_Q, HYPRE_MEMORY_HOST);
+
+      C_new = hypre_CSRMatrixAddPartial(C_diag, C_ext_diag,
+                                        hypre_ParCSRCommPkgSendMapElmts(comm_pkg_Pi));
+      hypre_CSRMatrixDestroy(C_diag);
+      hypre_CSRMatrixDestroy(C_ext_diag);
+      C_diag = C_new;
+
+      C_new = hypre_CSRMatrixAddPartial(C_offd, C_ext_offd,
+                                        hypre_ParCSRCommPkgSendMapElmts(comm_pkg_Pi));
+      hypre_CSRMatrixDestroy(C_offd);
+      hypre_CSRMatrixDestroy(C_ext_offd);
+      C_offd = C_new;
+   }
+   else
+   {
+      hypre_TFree(N_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(N_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(N_data, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(col_map_Q, HYPRE_MEMORY_HOST);
+
+   hypre_CSRMatrixReorder(C_diag);
+
+   starts[0] = nb * hypre_ParCSRMatrixColStarts(G)[0];
+   starts[1] = nb * hypre_ParCSRMatrixColStarts(G)[1];
+   A_Pi = hypre_ParCSRMatrixCreate(comm, nb * global_nodes, nb * global_nodes,
+                                   starts, starts, num_cols_offd_C, 0, 0);
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(A_Pi));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(A_Pi));
+   hypre_ParCSRMatrixDiag(A_Pi) = C_diag;
+   hypre_ParCSRMatrixOffd(A_Pi) = C_offd;
+   hypre_ParCSRMatrixColMapOffd(A_Pi) = col_map_offd_C;
+   hypre_MatvecCommPkgCreate(A_Pi);
+
+   *A_Pi_ptr = A_Pi;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetup
+ *
+ * Construct the AMS solver components.
+ *
+ * The following functions need to be called before hypre_AMSSetup():
+ * - hypre_AMSSetDimension() (if solving a 2D problem)
+ * - hypre_AMSSetDiscreteGradient()
+ * - hypre_AMSSetCoordinateVectors() or hypre_AMSSetEdgeConstantVectors
+ *--------------------------------------------------------------------------*/
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+__global__ void
+hypreCUDAKernel_FixInterNodes( HYPRE_Int      nrows,
+                               HYPRE_Int     *G0t_diag_i,
+                               HYPRE_Complex *G0t_diag_data,
+                               HYPRE_Int     *G0t_offd_i,
+                               HYPRE_Complex *G0t_offd_data,
+                               HYPRE_Real    *interior_nodes_data)
+{
+   HYPRE_Int row_i = hypre_cuda_get_grid_warp_id<1, 1>();
+
+   if (row_i >= nrows)
+   {
+      return;
+   }
+
+   HYPRE_Int lane = hypre_cuda_get_lane_id<1>();
+   HYPRE_Int not1 = 0;
+
+   if (lane == 0)
+   {
+      not1 = read_only_load(&interior_nodes_data[row_i]) != 1.0;
+   }
+
+   not1 = __shfl_sync(HYPRE_WARP_FULL_MASK, not1, 0);
+
+   if (!not1)
+   {
+      return;
+   }
+
+   HYPRE_Int p1, q1, p2 = 0, q2 = 0;
+   bool nonempty_offd = G0t_offd_data != NULL;
+
+   if (lane < 2)
+   {
+      p1 = read_only_load(G0t_diag_i + row_i + lane);
+      if (nonempty_offd)
+      {
+         p2 = read_only_load(G0t_offd_i + row_i + lane);
+      }
+   }
+
+   q1 = __shfl_sync(HYPRE_WARP_FULL_MASK, p1, 1);
+   p1 = __shfl_sync(HYPRE_WARP_FULL_MASK, p1, 0);
+   if (nonempty_offd)
+   {
+      q2 = __shfl_sync(HYPRE_WARP_FULL_MASK, p2, 1);
+      p2 = __shfl_sync(HYPRE_WARP_FULL_MASK, p2, 0);
+   }
+
+   for (HYPRE_Int j = p1 + lane; j < q1; j += HYPRE_WARP_SIZE)
+   {
+      G0t_diag_data[j] = 0.0;
+   }
+   for (HYPRE_Int j = p2 + lane; j < q2; j += HYPRE_WARP_SIZE)
+   {
+      G0t_offd_data[j] = 0.0;
+   }
+}
+
+__global__ void
+hypreCUDAKernel_AMSSetupScaleGGt( HYPRE_Int   Gt_num_rows,
+                                  HYPRE_Int  *Gt_diag_i,
+                                  HYPRE_Int  *Gt_diag_j,
+                                  HYPRE_Real *Gt_diag_data,
+                                  HYPRE_Int  *Gt_offd_i,
+                                  HYPRE_Real *Gt_offd_data,
+                                  HYPRE_Real *Gx_data,
+                                  HYPRE_Real *Gy_data,
+                                  HYPRE_Real *Gz_data )
+{
+   HYPRE_Int row_i = hypre_cuda_get_grid_warp_id<1, 1>();
+
+   if (row_i >= Gt_num_rows)
+   {
+      return;
+   }
+
+   HYPRE_Int lane = hypre_cuda_get_lane_id<1>();
+   HYPRE_Real h2 = 0.0;
+   HYPRE_Int ne, p1, q1, p2 = 0, q2 = 0;
+
+   if (lane < 2)
+   {
+      p1 = read_only_load(Gt_diag_i + row_i + lane);
+   }
+   q1 = __shfl_sync(HYPRE_WARP_FULL_MASK, p1, 1);
+   p1 = __shfl_sync(HYPRE_WARP_FULL_MASK, p1, 0);
+   ne = q1 - p1;
+
+   if (ne == 0)
+   {
+      return;
+   }
+
+   if (Gt_offd_data != NULL)
+   {
+      if (lane < 2)
+      {
+         p2 = read_only_load(Gt_offd_i + row_i + lane);
+      }
+      q2 = __shfl_sync(HYPRE_WARP_FULL_MASK, p2, 1);
+      p2 = __shfl_sync(HYPRE_WARP_FULL_MASK, p2, 0);
+   }
+
+   for (HYPRE_Int j = p1 + lane; j < q1; j += HYPRE_WARP_SIZE)
+   {
+      const HYPRE_Int k = read_only_load(&Gt_diag_j[j]);
+      const HYPRE_Real Gx = read_only_load(&Gx_data[k]);
+      const HYPRE_Real Gy = read_only_load(&Gy_data[k]);
+      const HYPRE_Real Gz = read_only_load(&Gz_data[k]);
+
+      h2 += Gx * Gx + Gy * Gy + Gz * Gz;
+   }
+
+   h2 = warp_allreduce_sum(h2) / ne;
+
+   for (HYPRE_Int j = p1 + lane; j < q1; j += HYPRE_WARP_SIZE)
+   {
+      Gt_diag_data[j] *= h2;
+   }
+
+   for (HYPRE_Int j = p2 + lane; j < q2; j += HYPRE_WARP_SIZE)
+   {
+      Gt_offd_data[j] *= h2;
+   }
+}
+#endif
+
+HYPRE_Int hypre_AMSSetup(void *solver,
+                         hypre_ParCSRMatrix *A,
+                         hypre_ParVector *b,
+                         hypre_ParVector *x)
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_ParCSRMatrixMemoryLocation(A) );
+#endif
+
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+
+   HYPRE_Int input_info = 0;
+
+   ams_data -> A = A;
+
+   /* The matrix-free Pi needs the vertex coordinates or G{x,y,z} */
+   if (ams_data -> Pi != NULL || ams_data -> Pix != NULL ||
+       ams_data -> cycle_type == 20 ||
+       (ams_data -> x == NULL && ams_data -> Gx == NULL))
+   {
+      ams_data -> matrix_free_Pi = 0;
+   }
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      ams_data -> matrix_free_Pi = 0;
+   }
+#endif
+
+   /* Subspaces with concurrent additive corrections */
+   hypre_ParCSRSubspaceGroupsDestroy(ams_data -> subspace_groups);
+   ams_data -> subspace_groups = NULL;
+   if (ams_data -> concurrent_subspaces)
+   {
+      char cycle[30];
+      HYPRE_Int eligible[5] = {1, 1, 1, 1, 1};
+
+      /* the redistribution needs Pi (or Pi{x,y,z}) as a matrix */
+      if (ams_data -> matrix_free_Pi)
+      {
+         eligible[1] = eligible[2] = eligible[3] = eligible[4] = 0;
+      }
+
+      hypre_AMSCycleString(ams_data, cycle);
+      ams_data -> subspace_groups =
+         (hypre_ParCSRSubspaceGroups *) hypre_ParCSRSubspaceGroupsCreate(hypre_ParCSRMatrixComm(A),
+                                                                          cycle, 5, eligible);
+   }
+
+   /* Modifications for problems with zero-conductivity regions */
+   if (ams_data -> interior_nodes)
+   {
+      hypre_ParCSRMatrix *G0t, *Aorig = A;
+
+      /* Make sure that multiple Setup()+Solve() give identical results */
+      ams_data -> solve_counter = 0;
+
+      /* Construct the discrete gradient matrix for the zero-conductivity region
+         by eliminating the zero-conductivity nodes from G^t. The range of G0
+         represents the kernel of A, i.e. the gradients of nodal basis functions
+         supported in zero-conductivity regions. */
+      hypre_ParCSRMatrixTranspose(ams_data -> G, &G0t, 1);
+
+      {
+         HYPRE_Int i, j;
+         HYPRE_Int nv = hypre_ParCSRMatrixNumCols(ams_data -> G);
+         hypre_CSRMatrix *G0td = hypre_ParCSRMatrixDiag(G0t);
+         HYPRE_Int *G0tdI = hypre_CSRMatrixI(G0td);
+         HYPRE_Real *G0tdA = hypre_CSRMatrixData(G0td);
+         hypre_CSRMatrix *G0to = hypre_ParCSRMatrixOffd(G0t);
+         HYPRE_Int *G0toI = hypre_CSRMatrixI(G0to);
+         HYPRE_Real *G0toA = hypre_CSRMatrixData(G0to);
+         HYPRE_Real *interior_nodes_data = hypre_VectorData(
+                                              hypre_ParVectorLocalVector((hypre_ParVector*) ams_data -> interior_nodes));
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+         if (exec == HYPRE_EXEC_DEVICE)
+         {
+            dim3 bDim = hypre_GetDefaultDeviceBlockDimension();
+            dim3 gDim = hypre_GetDefaultDeviceGridDimension(nv, "warp", bDim);
+            HYPRE_CUDA_LAUNCH( hypreCUDAKernel_FixInterNodes, gDim, bDim,
+                               nv, G0tdI, G0tdA, G0toI, G0toA, interior_nodes_data );
+         }
+         else
+#endif
+         {
+            for (i = 0; i < nv; i++)
+            {
+               if (interior_nodes_data[i] != 1)
+               {
+                  for (j = G0tdI[i]; j < G0tdI[i + 1]; j++)
+                  {
+                     G0tdA[j] = 0.0;
+                  }
+                  if (G0toI)
+                     for (j = G0toI[i]; j < G0toI[i + 1]; j++)
+                     {
+                        G0toA[j] = 0.0;
+                     }
+               }
+            }
+         }
+      }
+      hypre_ParCSRMatrixTranspose(G0t, & ams_data -> G0, 1);
+
+      /* Construct the subspace matrix A_G0 = G0^T G0 */
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      if (exec == HYPRE_EXEC_DEVICE)
       {
          ams_data -> A_G0 = hypre_ParCSRMatMat(G0t, ams_data -> G0);
       }
@@ -3074,7 +3983,11 @@ HYPRE_Int hypre_AMSSetup(void *solver,
       }
    }
 
-   if (ams_data -> Pi == NULL && ams_data -> Pix == NULL)
+   if (ams_data -> matrix_free_Pi)
+   {
+      hypre_AMSMatrixFreePiSetup(ams_data);
+   }
+   else if (ams_data -> Pi == NULL && ams_data -> Pix == NULL)
    {
       if (ams_data -> cycle_type == 20)
          /* Construct the combined interpolation matrix [G,Pi] */
@@ -3108,8 +4021,13 @@ HYPRE_Int hypre_AMSSetup(void *solver,
    }
 
    /* Keep Gx, Gy and Gz only if use the method with discrete divergence
-      stabilization (where we use them to compute the local mesh size). */
-   if (input_info == 1 && ams_data -> cycle_type != 9)
+      stabilization (where we use them to compute the local mesh size),
+      or the matrix-free Pi. */
+   if (input_info == 1 && ams_data -> matrix_free_Pi)
+   {
+      ams_data -> owns_Gxyz = 1;
+   }
+   else if (input_info == 1 && ams_data -> cycle_type != 9)
    {
       hypre_ParVectorDestroy(ams_data -> Gx);
       if (ams_data -> dim >= 2)
@@ -3181,9 +4099,12 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          ams_data -> owns_A_G = 1;
       }
 
-      HYPRE_BoomerAMGSetup(ams_data -> B_G,
-                           (HYPRE_ParCSRMatrix)ams_data -> A_G,
-                           NULL, NULL);
+      if (!hypre_ParCSRSubspaceGroupsConcurrent(ams_data -> subspace_groups, 0))
+      {
+         HYPRE_BoomerAMGSetup(ams_data -> B_G,
+                              (HYPRE_ParCSRMatrix)ams_data -> A_G,
+                              NULL, NULL);
+      }
    }
 
    if (ams_data -> cycle_type > 10 && ams_data -> cycle_type != 20)
@@ -3241,34 +4162,48 @@ HYPRE_Int hypre_AMSSetup(void *solver,
       }
 
       /* Construct the coarse space matrices by RAP */
-      if (!hypre_ParCSRMatrixCommPkg(ams_data -> Pix))
+      if (ams_data -> matrix_free_Pi)
       {
-         hypre_MatvecCommPkgCreate(ams_data -> Pix);
+         hypre_AMSMatrixFreePiRAP(ams_data, 2, ams_data -> A, &ams_data -> A_Pix);
       }
+      else
+      {
+         if (!hypre_ParCSRMatrixCommPkg(ams_data -> Pix))
+         {
+            hypre_MatvecCommPkgCreate(ams_data -> Pix);
+         }
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      if (exec == HYPRE_EXEC_DEVICE)
-      {
-         ams_data -> A_Pix = hypre_ParCSRMatrixRAPKT(ams_data -> Pix, ams_data -> A, ams_data -> Pix, 1);
-      }
-      else
+         if (exec == HYPRE_EXEC_DEVICE)
+         {
+            ams_data -> A_Pix = hypre_ParCSRMatrixRAPKT(ams_data -> Pix, ams_data -> A, ams_data -> Pix, 1);
+         }
+         else
 #endif
-      {
-         hypre_BoomerAMGBuildCoarseOperator(ams_data -> Pix,
-                                            ams_data -> A,
-                                            ams_data -> Pix,
-                                            &ams_data -> A_Pix);
+         {
+            hypre_BoomerAMGBuildCoarseOperator(ams_data -> Pix,
+                                               ams_data -> A,
+                                               ams_data -> Pix,
+                                               &ams_data -> A_Pix);
+         }
       }
 
       /* Make sure that A_Pix has no zero rows (this can happen
          for some kinds of boundary conditions with contact). */
       hypre_ParCSRMatrixFixZeroRows(ams_data -> A_Pix);
 
-      HYPRE_BoomerAMGSetup(ams_data -> B_Pix,
-                           (HYPRE_ParCSRMatrix)ams_data -> A_Pix,
-                           NULL, NULL);
+      if (!hypre_ParCSRSubspaceGroupsConcurrent(ams_data -> subspace_groups, 2))
+      {
+         HYPRE_BoomerAMGSetup(ams_data -> B_Pix,
+                              (HYPRE_ParCSRMatrix)ams_data -> A_Pix,
+                              NULL, NULL);
+      }
 
-      if (ams_data -> Piy)
+      if (ams_data -> matrix_free_Pi && ams_data -> dim >= 2)
+      {
+         hypre_AMSMatrixFreePiRAP(ams_data, 3, ams_data -> A, &ams_data -> A_Piy);
+      }
+      else if (ams_data -> Piy)
       {
          if (!hypre_ParCSRMatrixCommPkg(ams_data -> Piy))
          {
@@ -3290,17 +4225,28 @@ HYPRE_Int hypre_AMSSetup(void *solver,
                                                ams_data -> Piy,
                                                &ams_data -> A_Piy);
          }
+      }
+
+      if (ams_data -> A_Piy)
+      {
 
          /* Make sure that A_Piy has no zero rows (this can happen
             for some kinds of boundary conditions with contact). */
          hypre_ParCSRMatrixFixZeroRows(ams_data -> A_Piy);
 
-         HYPRE_BoomerAMGSetup(ams_data -> B_Piy,
-                              (HYPRE_ParCSRMatrix)ams_data -> A_Piy,
-                              NULL, NULL);
+         if (!hypre_ParCSRSubspaceGroupsConcurrent(ams_data -> subspace_groups, 3))
+         {
+            HYPRE_BoomerAMGSetup(ams_data -> B_Piy,
+                                 (HYPRE_ParCSRMatrix)ams_data -> A_Piy,
+                                 NULL, NULL);
+         }
       }
 
-      if (ams_data -> Piz)
+      if (ams_data -> matrix_free_Pi && ams_data -> dim >= 3)
+      {
+         hypre_AMSMatrixFreePiRAP(ams_data, 4, ams_data -> A, &ams_data -> A_Piz);
+      }
+      else if (ams_data -> Piz)
       {
          if (!hypre_ParCSRMatrixCommPkg(ams_data -> Piz))
          {
@@ -3322,14 +4268,21 @@ HYPRE_Int hypre_AMSSetup(void *solver,
                                                ams_data -> Piz,
                                                &ams_data -> A_Piz);
          }
+      }
+
+      if (ams_data -> A_Piz)
+      {
 
          /* Make sure that A_Piz has no zero rows (this can happen
             for some kinds of boundary conditions with contact). */
          hypre_ParCSRMatrixFixZeroRows(ams_data -> A_Piz);
 
-         HYPRE_BoomerAMGSetup(ams_data -> B_Piz,
-                              (HYPRE_ParCSRMatrix)ams_data -> A_Piz,
-                              NULL, NULL);
+         if (!hypre_ParCSRSubspaceGroupsConcurrent(ams_data -> subspace_groups, 4))
+         {
+            HYPRE_BoomerAMGSetup(ams_data -> B_Piz,
+                                 (HYPRE_ParCSRMatrix)ams_data -> A_Piz,
+                                 NULL, NULL);
+         }
       }
    }
    else
@@ -3360,7 +4313,7 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          notify BoomerAMG that this is a dim x dim block system. */
       if (!ams_data -> A_Pi)
       {
-         if (!hypre_ParCSRMatrixCommPkg(ams_data -> Pi))
+         if (!ams_data -> matrix_free_Pi && !hypre_ParCSRMatrixCommPkg(ams_data -> Pi))
          {
             hypre_MatvecCommPkgCreate(ams_data -> Pi);
          }
@@ -3437,7 +4390,7 @@ HYPRE_Int hypre_AMSSetup(void *solver,
                }
 
                /* we only needed Gx, Gy and Gz to compute the local mesh size */
-               if (input_info == 1)
+               if (input_info == 1 && !ams_data -> matrix_free_Pi)
                {
                   hypre_ParVectorDestroy(ams_data -> Gx);
                   if (ams_data -> dim >= 2)
@@ -3510,21 +4463,32 @@ HYPRE_Int hypre_AMSSetup(void *solver,
 
                hypre_ParCSRMatrixDestroy(GGt);
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-               if (exec == HYPRE_EXEC_DEVICE)
+               if (ams_data -> matrix_free_Pi)
                {
-                  ams_data -> A_Pi = hypre_ParCSRMatrixRAPKT(ams_data -> Pi, ApGGt, ams_data -> Pi, 1);
+                  hypre_AMSMatrixFreePiRAP(ams_data, 1, ApGGt, &ams_data -> A_Pi);
                }
                else
-#endif
                {
-                  hypre_BoomerAMGBuildCoarseOperator(ams_data -> Pi,
-                                                     ApGGt,
-                                                     ams_data -> Pi,
-                                                     &ams_data -> A_Pi);
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+                  if (exec == HYPRE_EXEC_DEVICE)
+                  {
+                     ams_data -> A_Pi = hypre_ParCSRMatrixRAPKT(ams_data -> Pi, ApGGt, ams_data -> Pi, 1);
+                  }
+                  else
+#endif
+                  {
+                     hypre_BoomerAMGBuildCoarseOperator(ams_data -> Pi,
+                                                        ApGGt,
+                                                        ams_data -> Pi,
+                                                        &ams_data -> A_Pi);
+                  }
                }
             }
          }
+         else if (ams_data -> matrix_free_Pi)
+         {
+            hypre_AMSMatrixFreePiRAP(ams_data, 1, ams_data -> A, &ams_data -> A_Pi);
+         }
          else
          {
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -3559,9 +4523,28 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          some kinds of boundary conditions with contact). */
       hypre_ParCSRMatrixFixZeroRows(ams_data -> A_Pi);
 
-      HYPRE_BoomerAMGSetup(ams_data -> B_Pi,
-                           (HYPRE_ParCSRMatrix)ams_data -> A_Pi,
-                           0, 0);
+      if (!hypre_ParCSRSubspaceGroupsConcurrent(ams_data -> subspace_groups, 1))
+      {
+         HYPRE_BoomerAMGSetup(ams_data -> B_Pi,
+                              (HYPRE_ParCSRMatrix)ams_data -> A_Pi,
+                              0, 0);
+      }
+   }
+
+   /* Redistribute the subspaces with concurrent corrections to their groups
+      of processes, and set up their AMG solvers there */
+   if (ams_data -> subspace_groups)
+   {
+      hypre_ParCSRMatrix *Ai[5], *Pi[5];
+      HYPRE_Solver Bi[5];
+
+      Ai[0] = ams_data -> A_G;    Pi[0] = ams_data -> G;    Bi[0] = ams_data -> B_G;
+      Ai[1] = ams_data -> A_Pi;   Pi[1] = ams_data -> Pi;   Bi[1] = ams_data -> B_Pi;
+      Ai[2] = ams_data -> A_Pix;  Pi[2] = ams_data -> Pix;  Bi[2] = ams_data -> B_Pix;
+      Ai[3] = ams_data -> A_Piy;  Pi[3] = ams_data -> Piy;  Bi[3] = ams_data -> B_Piy;
+      Ai[4] = ams_data -> A_Piz;  Pi[4] = ams_data -> Piz;  Bi[4] = ams_data -> B_Piz;
+
+      hypre_ParCSRSubspaceGroupsSetup(ams_data -> subspace_groups, Ai, Bi, Pi);
    }
 
    /* Allocate temporary vectors */
@@ -3582,91 +4565,38 @@ HYPRE_Int hypre_AMSSetup(void *solver,
       ams_data -> r2 = hypre_ParVectorInDomainOf(ams_data -> Pi);
       ams_data -> g2 = hypre_ParVectorInDomainOf(ams_data -> Pi);
    }
+   else if (ams_data -> matrix_free_Pi && ams_data -> cycle_type <= 10)
+   {
+      HYPRE_Int    dim = ams_data -> dim;
+      HYPRE_BigInt starts[2];
+
+      starts[0] = dim * hypre_ParCSRMatrixColStarts(ams_data -> G)[0];
+      starts[1] = dim * hypre_ParCSRMatrixColStarts(ams_data -> G)[1];
+      ams_data -> r2 = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                             dim * hypre_ParCSRMatrixGlobalNumCols(ams_data -> G),
+                                             starts);
+      ams_data -> g2 = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                             dim * hypre_ParCSRMatrixGlobalNumCols(ams_data -> G),
+                                             starts);
+      hypre_ParVectorInitialize(ams_data -> r2);
+      hypre_ParVectorInitialize(ams_data -> g2);
+   }
 
    return hypre_error_flag;
 }
 
 /*--------------------------------------------------------------------------
- * hypre_AMSSolve
+ * hypre_AMSCycleString
  *
- * Solve the system A x = b.
+ * The cycle of hypre_ParCSRSubspacePrec corresponding to the AMS cycle
+ * type (at most 30 characters).
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int hypre_AMSSolve(void *solver,
-                         hypre_ParCSRMatrix *A,
-                         hypre_ParVector *b,
-                         hypre_ParVector *x)
+HYPRE_Int hypre_AMSCycleString(void *solver,
+                               char *cycle)
 {
    hypre_AMSData *ams_data = (hypre_AMSData *) solver;
 
-   HYPRE_Int i, my_id = -1;
-   HYPRE_Real r0_norm, r_norm, b_norm, relative_resid = 0, old_resid;
-
-   char cycle[30];
-   hypre_ParCSRMatrix *Ai[5], *Pi[5];
-   HYPRE_Solver Bi[5];
-   HYPRE_PtrToSolverFcn HBi[5];
-   hypre_ParVector *ri[5], *gi[5];
-   HYPRE_Int needZ = 0;
-
-   hypre_ParVector *z = ams_data -> zz;
-
-   Ai[0] = ams_data -> A_G;    Pi[0] = ams_data -> G;
-   Ai[1] = ams_data -> A_Pi;   Pi[1] = ams_data -> Pi;
-   Ai[2] = ams_data -> A_Pix;  Pi[2] = ams_data -> Pix;
-   Ai[3] = ams_data -> A_Piy;  Pi[3] = ams_data -> Piy;
-   Ai[4] = ams_data -> A_Piz;  Pi[4] = ams_data -> Piz;
-
-   Bi[0] = ams_data -> B_G;    HBi[0] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve;
-   Bi[1] = ams_data -> B_Pi;   HBi[1] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGBlockSolve;
-   Bi[2] = ams_data -> B_Pix;  HBi[2] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve;
-   Bi[3] = ams_data -> B_Piy;  HBi[3] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve;
-   Bi[4] = ams_data -> B_Piz;  HBi[4] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve;
-
-   ri[0] = ams_data -> r1;     gi[0] = ams_data -> g1;
-   ri[1] = ams_data -> r2;     gi[1] = ams_data -> g2;
-   ri[2] = ams_data -> r1;     gi[2] = ams_data -> g1;
-   ri[3] = ams_data -> r1;     gi[3] = ams_data -> g1;
-   ri[4] = ams_data -> r1;     gi[4] = ams_data -> g1;
-
-   /* may need to create an additional temporary vector for relaxation */
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_ParCSRMatrixMemoryLocation(A) );
-
-   if (exec == HYPRE_EXEC_DEVICE)
-   {
-      needZ = ams_data -> A_relax_type == 2 || ams_data -> A_relax_type == 4 ||
-              ams_data -> A_relax_type == 16;
-   }
-   else
-#endif
-   {
-      needZ = hypre_NumThreads() > 1 || ams_data -> A_relax_type == 16;
-   }
-
-   if (needZ && !z)
-   {
-      z = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
-                                hypre_ParCSRMatrixGlobalNumRows(A),
-                                hypre_ParCSRMatrixRowStarts(A));
-      hypre_ParVectorInitialize(z);
-      ams_data -> zz = z;
-   }
-
-   if (ams_data -> print_level > 0)
-   {
-      hypre_MPI_Comm_rank(hypre_ParCSRMatrixComm(A), &my_id);
-   }
-
-   /* Compatible subspace projection for problems with zero-conductivity regions.
-      Note that this modifies the input (r.h.s.) vector b! */
-   if ( (ams_data -> B_G0) &&
-        (++ams_data->solve_counter % ( ams_data -> projection_frequency ) == 0) )
-   {
-      /* hypre_printf("Projecting onto the compatible subspace...\n"); */
-      hypre_AMSProjectOutGradients(ams_data, b);
-   }
-
    if (ams_data -> beta_is_zero)
    {
       switch (ams_data -> cycle_type)
@@ -3752,6 +4682,92 @@ HYPRE_Int hypre_AMSSolve(void *solver,
       }
    }
 
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSSolve
+ *
+ * Solve the system A x = b.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSolve(void *solver,
+                         hypre_ParCSRMatrix *A,
+                         hypre_ParVector *b,
+                         hypre_ParVector *x)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+
+   HYPRE_Int i, my_id = -1;
+   HYPRE_Real r0_norm, r_norm, b_norm, relative_resid = 0, old_resid;
+
+   char cycle[30];
+   hypre_ParCSRMatrix *Ai[5], *Pi[5];
+   HYPRE_Solver Bi[5];
+   HYPRE_PtrToSolverFcn HBi[5];
+   hypre_ParVector *ri[5], *gi[5];
+   HYPRE_Int needZ = 0;
+
+   hypre_ParVector *z = ams_data -> zz;
+
+   Ai[0] = ams_data -> A_G;    Pi[0] = ams_data -> G;
+   Ai[1] = ams_data -> A_Pi;   Pi[1] = ams_data -> Pi;
+   Ai[2] = ams_data -> A_Pix;  Pi[2] = ams_data -> Pix;
+   Ai[3] = ams_data -> A_Piy;  Pi[3] = ams_data -> Piy;
+   Ai[4] = ams_data -> A_Piz;  Pi[4] = ams_data -> Piz;
+
+   Bi[0] = ams_data -> B_G;    HBi[0] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve;
+   Bi[1] = ams_data -> B_Pi;   HBi[1] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGBlockSolve;
+   Bi[2] = ams_data -> B_Pix;  HBi[2] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve;
+   Bi[3] = ams_data -> B_Piy;  HBi[3] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve;
+   Bi[4] = ams_data -> B_Piz;  HBi[4] = (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve;
+
+   ri[0] = ams_data -> r1;     gi[0] = ams_data -> g1;
+   ri[1] = ams_data -> r2;     gi[1] = ams_data -> g2;
+   ri[2] = ams_data -> r1;     gi[2] = ams_data -> g1;
+   ri[3] = ams_data -> r1;     gi[3] = ams_data -> g1;
+   ri[4] = ams_data -> r1;     gi[4] = ams_data -> g1;
+
+   /* may need to create an additional temporary vector for relaxation */
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_ParCSRMatrixMemoryLocation(A) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      needZ = ams_data -> A_relax_type == 2 || ams_data -> A_relax_type == 4 ||
+              ams_data -> A_relax_type == 16;
+   }
+   else
+#endif
+   {
+      needZ = hypre_NumThreads() > 1 || ams_data -> A_relax_type == 16;
+   }
+
+   if (needZ && !z)
+   {
+      z = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize(z);
+      ams_data -> zz = z;
+   }
+
+   if (ams_data -> print_level > 0)
+   {
+      hypre_MPI_Comm_rank(hypre_ParCSRMatrixComm(A), &my_id);
+   }
+
+   /* Compatible subspace projection for problems with zero-conductivity regions.
+      Note that this modifies the input (r.h.s.) vector b! */
+   if ( (ams_data -> B_G0) &&
+        (++ams_data->solve_counter % ( ams_data -> projection_frequency ) == 0) )
+   {
+      /* hypre_printf("Projecting onto the compatible subspace...\n"); */
+      hypre_AMSProjectOutGradients(ams_data, b);
+   }
+
+   hypre_AMSCycleString(ams_data, cycle);
+
    for (i = 0; i < ams_data -> maxit; i++)
    {
       /* Compute initial residual norms */
@@ -3791,12 +4807,15 @@ HYPRE_Int hypre_AMSSolve(void *solver,
                                ams_data -> A_min_eig_est,
                                ams_data -> A_cheby_order,
                                ams_data -> A_cheby_fraction,
-                               Ai, Bi, HBi, Pi, ri, gi,
+                               Ai, Bi, HBi, Pi,
+                               hypre_AMSMatrixFreePiMatvec, ams_data,
+                               ri, gi,
                                b, x,
                                ams_data -> r0,
                                ams_data -> g0,
                                cycle,
-                               z);
+                               z,
+                               ams_data -> subspace_groups);
 
       /* Compute new residual norms */
       if (ams_data -> maxit > 1)
@@ -3851,6 +4870,14 @@ HYPRE_Int hypre_AMSSolve(void *solver,
  *
  * The default mode is multiplicative, '+' changes the next correction
  * to additive, based on residual computed at '('.
+ *
+ * If P[i] is NULL, the interpolation is applied by the function Pfcn as
+ * Pfcn(Pdata, i, trans, alpha, x, beta, y), which computes
+ * y = alpha P x + beta y, or y = alpha P^t x + beta y if trans is nonzero.
+ *
+ * If groups_vdata is given (see hypre_ParCSRSubspaceGroupsCreate), the
+ * additive corrections of its concurrent subspaces are done at the same
+ * time on disjoint groups of processes.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
@@ -3873,6 +4900,10 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
    HYPRE_PtrToSolverFcn *HB,
    /* subspace interpolations */
    hypre_ParCSRMatrix **P,
+   /* matrix-free interpolations, for the subspaces with P[i] == NULL */
+   HYPRE_Int (*Pfcn)(void *, HYPRE_Int, HYPRE_Int, HYPRE_Complex, hypre_ParVector *,
+                     HYPRE_Complex, hypre_ParVector *),
+   void *Pdata,
    /* temporary subspace vectors */
    hypre_ParVector **r,
    hypre_ParVector **g,
@@ -3886,9 +4917,12 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
    hypre_ParVector *g0,
    char *cycle,
    /* temporary vector */
-   hypre_ParVector *z)
+   hypre_ParVector *z,
+   /* concurrent subspace corrections (may be NULL) */
+   void *groups_vdata)
 {
-   char *op;
+   hypre_ParCSRSubspaceGroups *groups = (hypre_ParCSRSubspaceGroups *) groups_vdata;
+   char *op, *segment_end = NULL;
    HYPRE_Int use_saved_residual = 0;
 
    for (op = cycle; *op != '\0'; op++)
@@ -3941,23 +4975,569 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
          /* skip empty subspaces */
          if (!A[i]) { continue; }
 
-         /* compute the residual? */
-         if (use_saved_residual)
+         /* concurrent subspaces: correct all of them at the first one of the
+            additive segment, and skip the others */
+         if (groups && i < groups -> num_subspaces && groups -> concurrent[i])
          {
             use_saved_residual = 0;
-            hypre_ParCSRMatrixMatvecT(1.0, P[i], r0, 0.0, r[i]);
+            if (!segment_end || op > segment_end)
+            {
+               for (segment_end = op; segment_end[1] == '+' && segment_end[2] != '\0';
+                    segment_end += 2);
+               hypre_ParCSRSubspaceGroupsSolve(groups, op, segment_end, B, HB, r0, g0, y);
+            }
+            continue;
          }
-         else
+
+         /* compute the residual? */
+         if (!use_saved_residual)
          {
             hypre_ParVectorCopy(x, g0);
             hypre_ParCSRMatrixMatvec(-1.0, A0, y, 1.0, g0);
-            hypre_ParCSRMatrixMatvecT(1.0, P[i], g0, 0.0, r[i]);
          }
+         if (P[i])
+         {
+            hypre_ParCSRMatrixMatvecT(1.0, P[i], use_saved_residual ? r0 : g0, 0.0, r[i]);
+         }
+         else
+         {
+            (*Pfcn)(Pdata, i, 1, 1.0, use_saved_residual ? r0 : g0, 0.0, r[i]);
+         }
+         use_saved_residual = 0;
 
          hypre_ParVectorSetConstantValues(g[i], 0.0);
          (*HB[i]) (B[i], (HYPRE_Matrix)A[i],
                    (HYPRE_Vector)r[i], (HYPRE_Vector)g[i]);
-         hypre_ParCSRMatrixMatvec(1.0, P[i], g[i], 0.0, g0);
+         if (P[i])
+         {
+            hypre_ParCSRMatrixMatvec(1.0, P[i], g[i], 0.0, g0);
+         }
+         else
+         {
+            (*Pfcn)(Pdata, i, 0, 1.0, g[i], 0.0, g0);
+         }
+         hypre_ParVectorAxpy(1.0, g0, y);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceGroupsCreate
+ *
+ * Select the subspaces of the cycle of hypre_ParCSRSubspacePrec whose
+ * corrections are done concurrently: the subspaces i with eligible[i] != 0
+ * that appear in the cycle only in additive segments "+i+j...".  Their
+ * solvers must be BoomerAMG, and they are set up in
+ * hypre_ParCSRSubspaceGroupsSetup instead of by the caller.  Returns NULL
+ * if fewer than two subspaces qualify, or if there are fewer processes
+ * than such subspaces.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ParCSRSubspaceGroupsCreate( MPI_Comm   comm,
+                                  char      *cycle,
+                                  HYPRE_Int  num_subspaces,
+                                  HYPRE_Int *eligible )
+{
+   hypre_ParCSRSubspaceGroups *groups;
+   HYPRE_Int                  *concurrent;
+   char                       *op;
+   HYPRE_Int                   num_procs, num_concurrent, i;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* 1 for additive corrections only, -1 if there is a multiplicative one */
+   concurrent = hypre_CTAlloc(HYPRE_Int, num_subspaces, HYPRE_MEMORY_HOST);
+   for (op = cycle; *op != '\0'; op++)
+   {
+      i = *op - '1';
+      if (i < 0 || i >= num_subspaces)
+      {
+         continue;
+      }
+      if (op > cycle && op[-1] == '+')
+      {
+         if (concurrent[i] == 0 && eligible[i])
+         {
+            concurrent[i] = 1;
+         }
+      }
+      else
+      {
+         concurrent[i] = -1;
+      }
+   }
+
+   num_concurrent = 0;
+   for (i = 0; i < num_subspaces; i++)
+   {
+      if (concurrent[i] == 1)
+      {
+         num_concurrent++;
+      }
+      else
+      {
+         concurrent[i] = 0;
+      }
+   }
+
+   if (num_concurrent < 2 || num_procs < num_concurrent)
+   {
+      hypre_TFree(concurrent, HYPRE_MEMORY_HOST);
+      return NULL;
+   }
+
+   groups = hypre_CTAlloc(hypre_ParCSRSubspaceGroups, 1, HYPRE_MEMORY_HOST);
+   groups -> num_subspaces = num_subspaces;
+   groups -> concurrent    = concurrent;
+   groups -> comm          = hypre_MPI_COMM_NULL;
+   groups -> my_subspace   = -1;
+   groups -> P = hypre_CTAlloc(hypre_ParCSRMatrix *, num_subspaces, HYPRE_MEMORY_HOST);
+   groups -> r = hypre_CTAlloc(hypre_ParVector *, num_subspaces, HYPRE_MEMORY_HOST);
+   groups -> g = hypre_CTAlloc(hypre_ParVector *, num_subspaces, HYPRE_MEMORY_HOST);
+
+   return (void *) groups;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceGroupsDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRSubspaceGroupsDestroy( void *groups_vdata )
+{
+   hypre_ParCSRSubspaceGroups *groups = (hypre_ParCSRSubspaceGroups *) groups_vdata;
+   HYPRE_Int                   i;
+
+   if (groups)
+   {
+      for (i = 0; i < groups -> num_subspaces; i++)
+      {
+         hypre_ParCSRMatrixDestroy(groups -> P[i]);
+         hypre_ParVectorDestroy(groups -> r[i]);
+         hypre_ParVectorDestroy(groups -> g[i]);
+      }
+      hypre_ParCSRMatrixDestroy(groups -> A);
+      hypre_ParVectorDestroy(groups -> r_sub);
+      hypre_ParVectorDestroy(groups -> g_sub);
+      if (groups -> comm != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&groups -> comm);
+      }
+
+      hypre_TFree(groups -> concurrent, HYPRE_MEMORY_HOST);
+      hypre_TFree(groups -> P, HYPRE_MEMORY_HOST);
+      hypre_TFree(groups -> r, HYPRE_MEMORY_HOST);
+      hypre_TFree(groups -> g, HYPRE_MEMORY_HOST);
+      hypre_TFree(groups, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceGroupsConcurrent
+ *
+ * Is the correction of subspace i done concurrently?  If so, its solver is
+ * set up by hypre_ParCSRSubspaceGroupsSetup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRSubspaceGroupsConcurrent( void      *groups_vdata,
+                                      HYPRE_Int  i )
+{
+   hypre_ParCSRSubspaceGroups *groups = (hypre_ParCSRSubspaceGroups *) groups_vdata;
+
+   return groups ? groups -> concurrent[i] : 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceGroupsRedistribution
+ *
+ * Identity matrix with the given row partitioning (starts holds the first
+ * and last+1 local row), and a column partitioning in which the processes
+ * first to last-1 own all rows.  With m = last - first, process first+j
+ * takes over the rows of the processes p with p*m/num_procs == j, so the
+ * local ranges stay unions of the original ones.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRSubspaceGroupsRedistribution( MPI_Comm              comm,
+                                          HYPRE_BigInt          global_size,
+                                          HYPRE_BigInt         *starts,
+                                          HYPRE_Int             first,
+                                          HYPRE_Int             last,
+                                          HYPRE_MemoryLocation  memory_location )
+{
+   hypre_ParCSRMatrix   *M;
+   hypre_CSRMatrix      *M_diag, *M_offd;
+   HYPRE_Int            *M_diag_i, *M_diag_j, *M_offd_i, *M_offd_j;
+   HYPRE_Complex        *M_diag_data, *M_offd_data;
+   HYPRE_BigInt         *col_map_offd;
+   HYPRE_BigInt         *all_starts;
+   HYPRE_BigInt          new_starts[2], row;
+   HYPRE_Int             num_procs, my_id, m, j;
+   HYPRE_Int             num_rows, nnz_diag, nnz_offd, i;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   all_starts = hypre_TAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&starts[0], 1, HYPRE_MPI_BIG_INT, all_starts, 1,
+                       HYPRE_MPI_BIG_INT, comm);
+   all_starts[num_procs] = global_size;
+
+   if (my_id < first)
+   {
+      new_starts[0] = new_starts[1] = 0;
+   }
+   else if (my_id >= last)
+   {
+      new_starts[0] = new_starts[1] = global_size;
+   }
+   else
+   {
+      m = last - first;
+      j = my_id - first;
+      new_starts[0] = all_starts[(j * num_procs + m - 1) / m];
+      new_starts[1] = all_starts[((j + 1) * num_procs + m - 1) / m];
+   }
+   hypre_TFree(all_starts, HYPRE_MEMORY_HOST);
+
+   num_rows = (HYPRE_Int) (starts[1] - starts[0]);
+   nnz_diag = 0;
+   for (row = starts[0]; row < starts[1]; row++)
+   {
+      if (row >= new_starts[0] && row < new_starts[1])
+      {
+         nnz_diag++;
+      }
+   }
+   nnz_offd = num_rows - nnz_diag;
+
+   M = hypre_ParCSRMatrixCreate(comm, global_size, global_size, starts, new_starts,
+                                nnz_offd, nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(M, HYPRE_MEMORY_HOST);
+
+   M_diag       = hypre_ParCSRMatrixDiag(M);
+   M_offd       = hypre_ParCSRMatrixOffd(M);
+   M_diag_i     = hypre_CSRMatrixI(M_diag);
+   M_diag_j     = hypre_CSRMatrixJ(M_diag);
+   M_diag_data  = hypre_CSRMatrixData(M_diag);
+   M_offd_i     = hypre_CSRMatrixI(M_offd);
+   M_offd_j     = hypre_CSRMatrixJ(M_offd);
+   M_offd_data  = hypre_CSRMatrixData(M_offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(M);
+
+   nnz_diag = 0;
+   nnz_offd = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row = starts[0] + (HYPRE_BigInt) i;
+      M_diag_i[i] = nnz_diag;
+      M_offd_i[i] = nnz_offd;
+      if (row >= new_starts[0] && row < new_starts[1])
+      {
+         M_diag_j[nnz_diag]    = (HYPRE_Int) (row - new_starts[0]);
+         M_diag_data[nnz_diag] = 1.0;
+         nnz_diag++;
+      }
+      else
+      {
+         col_map_offd[nnz_offd] = row;
+         M_offd_j[nnz_offd]     = nnz_offd;
+         M_offd_data[nnz_offd]  = 1.0;
+         nnz_offd++;
+      }
+   }
+   M_diag_i[num_rows] = nnz_diag;
+   M_offd_i[num_rows] = nnz_offd;
+
+   hypre_ParCSRMatrixMigrate(M, memory_location);
+   hypre_MatvecCommPkgCreate(M);
+
+   return M;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceGroupsSetup
+ *
+ * Split the processes into one group per concurrent subspace.  The group
+ * sizes are proportional to the work of the subspace solves, estimated by
+ * the number of nonzeros of A[i] (times the number of blocks for block
+ * solves).  A[i] and P[i] are redistributed to the group of subspace i,
+ * and B[i] is set up there, on the communicator of the group.
+ *
+ * Concurrent subspaces with an empty matrix are dropped.  If fewer than two
+ * remain, their solvers are set up on the full communicator instead.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRSubspaceGroupsSetup( void                *groups_vdata,
+                                 hypre_ParCSRMatrix **A,
+                                 HYPRE_Solver        *B,
+                                 hypre_ParCSRMatrix **P )
+{
+   hypre_ParCSRSubspaceGroups *groups = (hypre_ParCSRSubspaceGroups *) groups_vdata;
+
+   MPI_Comm              comm = hypre_MPI_COMM_NULL;
+   HYPRE_MemoryLocation  memory_location;
+   hypre_ParCSRMatrix   *M, *M_A, *A_red, *A_sub;
+   hypre_CSRMatrix      *diag, *offd;
+   hypre_ParVector      *v, *v_sub;
+   hypre_Vector         *v_sub_local;
+   HYPRE_Int            *concurrent, *first;
+   HYPRE_Real           *weight, total_weight, sum_weight;
+   HYPRE_Int             num_subspaces, num_concurrent, num_procs, my_id;
+   HYPRE_Int             i, k, s;
+
+   if (!groups)
+   {
+      return hypre_error_flag;
+   }
+
+   num_subspaces = groups -> num_subspaces;
+   concurrent    = groups -> concurrent;
+
+   num_concurrent = 0;
+   for (i = 0; i < num_subspaces; i++)
+   {
+      if (concurrent[i] && !A[i])
+      {
+         concurrent[i] = 0;
+      }
+      if (concurrent[i])
+      {
+         comm = hypre_ParCSRMatrixComm(A[i]);
+         num_concurrent++;
+      }
+   }
+
+   if (num_concurrent < 2)
+   {
+      for (i = 0; i < num_subspaces; i++)
+      {
+         if (concurrent[i])
+         {
+            HYPRE_BoomerAMGSetup(B[i], (HYPRE_ParCSRMatrix) A[i], NULL, NULL);
+            concurrent[i] = 0;
+         }
+      }
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* work estimate of the subspace solves */
+   weight = hypre_CTAlloc(HYPRE_Real, num_subspaces, HYPRE_MEMORY_HOST);
+   total_weight = 0.0;
+   for (i = 0; i < num_subspaces; i++)
+   {
+      if (concurrent[i])
+      {
+         hypre_ParCSRMatrixSetDNumNonzeros(A[i]);
+         weight[i] = hypre_ParCSRMatrixDNumNonzeros(A[i]) *
+                     (HYPRE_Real) (hypre_ParCSRMatrixGlobalNumCols(P[i]) /
+                                   hypre_ParCSRMatrixGlobalNumRows(A[i]));
+         total_weight += weight[i];
+      }
+   }
+   total_weight = hypre_max(total_weight, 1.0);
+
+   /* the group of the k-th concurrent subspace is first[k] to first[k+1]-1,
+      with at least one process */
+   first = hypre_TAlloc(HYPRE_Int, num_concurrent + 1, HYPRE_MEMORY_HOST);
+   first[0] = 0;
+   sum_weight = 0.0;
+   k = 0;
+   for (i = 0; i < num_subspaces; i++)
+   {
+      if (concurrent[i])
+      {
+         sum_weight += weight[i];
+         k++;
+         first[k] = (HYPRE_Int) (sum_weight / total_weight * (HYPRE_Real) num_procs + 0.5);
+         first[k] = hypre_max(first[k], first[k - 1] + 1);
+         first[k] = hypre_min(first[k], num_procs - (num_concurrent - k));
+         if (k == num_concurrent)
+         {
+            first[k] = num_procs;
+         }
+         if (my_id >= first[k - 1] && my_id < first[k])
+         {
+            groups -> my_subspace = i;
+         }
+      }
+   }
+   hypre_TFree(weight, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Comm_split(comm, groups -> my_subspace, my_id, &groups -> comm);
+
+   k = 0;
+   for (i = 0; i < num_subspaces; i++)
+   {
+      if (!concurrent[i])
+      {
+         continue;
+      }
+
+      memory_location = hypre_ParCSRMatrixMemoryLocation(A[i]);
+      if (!hypre_ParCSRMatrixCommPkg(A[i]))
+      {
+         hypre_MatvecCommPkgCreate(A[i]);
+      }
+
+      /* redistributed interpolation P M */
+      M = hypre_ParCSRSubspaceGroupsRedistribution(comm,
+                                                   hypre_ParCSRMatrixGlobalNumCols(P[i]),
+                                                   hypre_ParCSRMatrixColStarts(P[i]),
+                                                   first[k], first[k + 1],
+                                                   memory_location);
+      groups -> P[i] = hypre_ParCSRMatMat(P[i], M);
+      if (!hypre_ParCSRMatrixCommPkg(groups -> P[i]))
+      {
+         hypre_MatvecCommPkgCreate(groups -> P[i]);
+      }
+      groups -> r[i] = hypre_ParVectorInDomainOf(groups -> P[i]);
+      groups -> g[i] = hypre_ParVectorInDomainOf(groups -> P[i]);
+
+      /* redistributed matrix M^T A M (A may be a block of P^T A0 P) */
+      if (hypre_ParCSRMatrixGlobalNumRows(A[i]) == hypre_ParCSRMatrixGlobalNumCols(P[i]))
+      {
+         M_A = M;
+      }
+      else
+      {
+         M_A = hypre_ParCSRSubspaceGroupsRedistribution(comm,
+                                                        hypre_ParCSRMatrixGlobalNumRows(A[i]),
+                                                        hypre_ParCSRMatrixRowStarts(A[i]),
+                                                        first[k], first[k + 1],
+                                                        memory_location);
+      }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE)
+      {
+         A_red = hypre_ParCSRMatrixRAPKT(M_A, A[i], M_A, 1);
+      }
+      else
+#endif
+      {
+         hypre_BoomerAMGBuildCoarseOperator(M_A, A[i], M_A, &A_red);
+      }
+
+      if (M_A != M)
+      {
+         hypre_ParCSRMatrixDestroy(M_A);
+      }
+      hypre_ParCSRMatrixDestroy(M);
+
+      /* the group of subspace i takes over A_red on its own communicator */
+      if (i == groups -> my_subspace)
+      {
+         A_sub = hypre_ParCSRMatrixCreate(groups -> comm,
+                                          hypre_ParCSRMatrixGlobalNumRows(A_red),
+                                          hypre_ParCSRMatrixGlobalNumCols(A_red),
+                                          hypre_ParCSRMatrixRowStarts(A_red),
+                                          hypre_ParCSRMatrixColStarts(A_red),
+                                          0, 0, 0);
+         diag = hypre_ParCSRMatrixDiag(A_sub);
+         offd = hypre_ParCSRMatrixOffd(A_sub);
+         hypre_ParCSRMatrixDiag(A_sub)             = hypre_ParCSRMatrixDiag(A_red);
+         hypre_ParCSRMatrixOffd(A_sub)             = hypre_ParCSRMatrixOffd(A_red);
+         hypre_ParCSRMatrixColMapOffd(A_sub)       = hypre_ParCSRMatrixColMapOffd(A_red);
+         hypre_ParCSRMatrixDeviceColMapOffd(A_sub) = hypre_ParCSRMatrixDeviceColMapOffd(A_red);
+         hypre_ParCSRMatrixDiag(A_red)             = diag;
+         hypre_ParCSRMatrixOffd(A_red)             = offd;
+         hypre_ParCSRMatrixColMapOffd(A_red)       = NULL;
+         hypre_ParCSRMatrixDeviceColMapOffd(A_red) = NULL;
+         hypre_MatvecCommPkgCreate(A_sub);
+         groups -> A = A_sub;
+
+         /* vectors on the group communicator, sharing the data of r[i], g[i] */
+         for (s = 0; s < 2; s++)
+         {
+            v = s ? groups -> g[i] : groups -> r[i];
+            v_sub = hypre_ParVectorCreate(groups -> comm,
+                                          hypre_ParVectorGlobalSize(v),
+                                          hypre_ParVectorPartitioning(v));
+            v_sub_local = hypre_ParVectorLocalVector(v_sub);
+            hypre_VectorData(v_sub_local) = hypre_VectorData(hypre_ParVectorLocalVector(v));
+            hypre_SeqVectorSetDataOwner(v_sub_local, 0);
+            hypre_ParVectorInitialize_v2(v_sub, hypre_ParVectorMemoryLocation(v));
+            if (s)
+            {
+               groups -> g_sub = v_sub;
+            }
+            else
+            {
+               groups -> r_sub = v_sub;
+            }
+         }
+
+         HYPRE_BoomerAMGSetup(B[i], (HYPRE_ParCSRMatrix) A_sub, NULL, NULL);
+      }
+      hypre_ParCSRMatrixDestroy(A_red);
+
+      k++;
+   }
+   hypre_TFree(first, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceGroupsSolve
+ *
+ * Additive corrections y += P[i] B[i]^{-1} P[i]^t r0 for the concurrent
+ * subspaces i of the cycle segment from first to last ("i+j+...").  The
+ * restrictions and prolongations involve all processes, while each group
+ * only solves for its own subspace, at the same time as the others.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRSubspaceGroupsSolve( void                 *groups_vdata,
+                                 char                 *first,
+                                 char                 *last,
+                                 HYPRE_Solver         *B,
+                                 HYPRE_PtrToSolverFcn *HB,
+                                 hypre_ParVector      *r0,
+                                 hypre_ParVector      *g0,
+                                 hypre_ParVector      *y )
+{
+   hypre_ParCSRSubspaceGroups *groups = (hypre_ParCSRSubspaceGroups *) groups_vdata;
+   HYPRE_Int                  *concurrent = groups -> concurrent;
+   HYPRE_Int                   my_subspace = groups -> my_subspace;
+   HYPRE_Int                   solve = 0;
+   char                       *op;
+   HYPRE_Int                   i;
+
+   for (op = first; op <= last; op += 2)
+   {
+      i = *op - '1';
+      if (concurrent[i])
+      {
+         hypre_ParCSRMatrixMatvecT(1.0, groups -> P[i], r0, 0.0, groups -> r[i]);
+         solve = solve || (i == my_subspace);
+      }
+   }
+
+   if (solve)
+   {
+      hypre_ParVectorSetConstantValues(groups -> g_sub, 0.0);
+      (*HB[my_subspace]) (B[my_subspace], (HYPRE_Matrix) groups -> A,
+                          (HYPRE_Vector) groups -> r_sub, (HYPRE_Vector) groups -> g_sub);
+   }
+
+   for (op = first; op <= last; op += 2)
+   {
+      i = *op - '1';
+      if (concurrent[i])
+      {
+         hypre_ParCSRMatrixMatvec(1.0, groups -> P[i], groups -> g[i], 0.0, g0);
          hypre_ParVectorAxpy(1.0, g0, y);
       }
    }
@@ -8,6 +8,36 @@
 #ifndef hypre_AMS_DATA_HEADER
 #define hypre_AMS_DATA_HEADER
 
+/*--------------------------------------------------------------------------
+ * Concurrent additive subspace corrections
+ *
+ * The processes are split into groups, one per subspace solved
+ * concurrently, and the matrix of each such subspace is redistributed to
+ * the processes of its group.
+ *--------------------------------------------------------------------------*/
+typedef struct
+{
+   /* Number of subspaces of the cycle */
+   HYPRE_Int num_subspaces;
+   /* Is the correction of subspace i done concurrently? */
+   HYPRE_Int *concurrent;
+
+   /* Communicator of the group of this process */
+   MPI_Comm comm;
+   /* Subspace solved by the group of this process */
+   HYPRE_Int my_subspace;
+
+   /* Subspace interpolations P[i] M[i], where M[i] redistributes to the group */
+   hypre_ParCSRMatrix **P;
+   /* Temporary vectors in the domain of P[i] M[i] */
+   hypre_ParVector **r, **g;
+
+   /* Matrix of my_subspace and its temporary vectors on comm */
+   hypre_ParCSRMatrix *A;
+   hypre_ParVector *r_sub, *g_sub;
+
+} hypre_ParCSRSubspaceGroups;
+
 /*--------------------------------------------------------------------------
  * Auxiliary space Maxwell Solver data
  *--------------------------------------------------------------------------*/
@@ -47,11 +77,18 @@ typedef struct
    /* Does the solver own the coarse grid matrices? */
    HYPRE_Int owns_A_G, owns_A_Pi;
 
+   /* Apply Pi (or Pi{x,y,z}) matrix-free, from G and G{x,y,z}? */
+   HYPRE_Int matrix_free_Pi;
+   /* Halo exchange of the vector vertex values for the matrix-free Pi */
+   hypre_ParCSRCommPkg *Pi_comm_pkg;
+
    /* Coordinates of the vertices (z = 0 if dim == 2) */
    hypre_ParVector *x, *y, *z;
 
    /* Representations of the constant vectors in the Nedelec basis */
    hypre_ParVector *Gx, *Gy, *Gz;
+   /* Does the solver own Gx, Gy and Gz? */
+   HYPRE_Int owns_Gxyz;
 
    /* Nodes in the interior of the zero-conductivity region */
    hypre_ParVector *interior_nodes;
@@ -71,6 +108,9 @@ typedef struct
    HYPRE_Real tol;
    HYPRE_Int cycle_type;
    HYPRE_Int print_level;
+   /* Solve the additive subspace corrections concurrently? */
+   HYPRE_Int concurrent_subspaces;
+   hypre_ParCSRSubspaceGroups *subspace_groups;
 
    /* Smoothing options for A */
    HYPRE_Int A_relax_type;
@@ -0,0 +1,1105 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Smoothed aggregation for BoomerAMG
+ *
+ * Aggregates are formed from the symmetrized strength graph with a parallel
+ * distance-2 maximal independent set, so they may cross process boundaries.
+ * Each aggregate has a root point, which is marked as a C-point in CF_marker;
+ * all other points are F-points.  An aggregate belongs to the process that
+ * owns its root.
+ *
+ * The tentative prolongator is built from the near-nullspace vectors: their
+ * restriction to each aggregate is orthonormalized (B_a = Q_a R_a), Q_a gives
+ * the columns of the aggregate, and R_a gives the near-nullspace vectors of
+ * the coarse grid.  The coarse grid thus has one point per aggregate and
+ * vector.  The tentative prolongator is smoothed by one damped Jacobi step on
+ * the filtered matrix, in which weak connections are lumped into the
+ * diagonal.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_SAMaxNeighbor
+ *
+ * Replaces (key, gid) of every point by the largest pair over the point and
+ * its neighbors in G, ordered by key first and gid second.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SAMaxNeighbor( hypre_ParCSRMatrix  *G,
+                     HYPRE_Real          *key,
+                     HYPRE_BigInt        *gid,
+                     HYPRE_Real          *key_offd,
+                     HYPRE_BigInt        *gid_offd,
+                     HYPRE_Real          *key_new,
+                     HYPRE_BigInt        *gid_new )
+{
+   hypre_ParCSRCommPkg     *comm_pkg   = hypre_ParCSRMatrixCommPkg(G);
+   hypre_ParCSRCommHandle  *comm_handle;
+   hypre_CSRMatrix         *G_diag     = hypre_ParCSRMatrixDiag(G);
+   HYPRE_Int               *G_diag_i   = hypre_CSRMatrixI(G_diag);
+   HYPRE_Int               *G_diag_j   = hypre_CSRMatrixJ(G_diag);
+   hypre_CSRMatrix         *G_offd     = hypre_ParCSRMatrixOffd(G);
+   HYPRE_Int               *G_offd_i   = hypre_CSRMatrixI(G_offd);
+   HYPRE_Int               *G_offd_j   = hypre_CSRMatrixJ(G_offd);
+   HYPRE_Int                num_rows   = hypre_CSRMatrixNumRows(G_diag);
+   HYPRE_Int                num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                num_elmts  = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   HYPRE_Real              *real_buf;
+   HYPRE_BigInt            *big_buf;
+   HYPRE_Int                i, j, jj;
+
+   real_buf = hypre_TAlloc(HYPRE_Real, num_elmts, HYPRE_MEMORY_HOST);
+   big_buf  = hypre_TAlloc(HYPRE_BigInt, num_elmts, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_elmts; i++)
+   {
+      j = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i);
+      real_buf[i] = key[j];
+      big_buf[i]  = gid[j];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, real_buf, key_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, big_buf, gid_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   hypre_TFree(real_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_buf, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      key_new[i] = key[i];
+      gid_new[i] = gid[i];
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         j = G_diag_j[jj];
+         if (key[j] > key_new[i] || (key[j] == key_new[i] && gid[j] > gid_new[i]))
+         {
+            key_new[i] = key[j];
+            gid_new[i] = gid[j];
+         }
+      }
+      for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+      {
+         j = G_offd_j[jj];
+         if (key_offd[j] > key_new[i] || (key_offd[j] == key_new[i] && gid_offd[j] > gid_new[i]))
+         {
+            key_new[i] = key_offd[j];
+            gid_new[i] = gid_offd[j];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCoarsenAggregates
+ *
+ * Aggregation of the strength graph S + S^T.  Phase 1 computes a distance-2
+ * maximal independent set of roots in parallel: every undecided point holds
+ * a random key, and in each sweep a point becomes a root if its key is the
+ * largest in its distance-2 neighborhood, or is removed if that
+ * neighborhood contains a root.  Each root forms an aggregate with its
+ * neighbors.  Phase 2 adds every remaining point to the neighboring
+ * aggregate it has the most strong connections to.  Points without strong
+ * connections are left out of all aggregates.
+ *
+ * The random keys follow one global sequence, so the aggregates do not
+ * depend on the number of processes.  The aggregates are numbered globally
+ * in the order of their roots.  On return, aggregates[i] is the global
+ * number of the aggregate of point i, or -1, and num_aggregates is the
+ * number of aggregates owned by this process.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCoarsenAggregates( hypre_ParCSRMatrix  *S,
+                                  hypre_IntArray     **CF_marker_ptr,
+                                  HYPRE_BigInt       **aggregates_ptr,
+                                  HYPRE_Int           *num_aggregates_ptr )
+{
+   MPI_Comm                 comm       = hypre_ParCSRMatrixComm(S);
+   HYPRE_Int                num_rows   = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(S));
+   HYPRE_BigInt             first_row  = hypre_ParCSRMatrixFirstRowIndex(S);
+
+   hypre_ParCSRMatrix      *S1, *ST, *G;
+   hypre_ParCSRCommPkg     *comm_pkg;
+   hypre_ParCSRCommHandle  *comm_handle;
+   hypre_CSRMatrix         *G_diag, *G_offd;
+   HYPRE_Int               *G_diag_i, *G_diag_j, *G_offd_i, *G_offd_j;
+   HYPRE_Real              *S1_data;
+   HYPRE_Int                num_cols_offd, num_sends, num_elmts;
+
+   HYPRE_Int               *CF_marker;
+   HYPRE_Int               *state;
+   HYPRE_Real              *key, *key_max, *key_tmp, *key_offd;
+   HYPRE_BigInt            *gid, *gid_max, *gid_tmp, *gid_offd;
+   HYPRE_BigInt            *aggregates, *aggregates_offd, *new_aggregates;
+   HYPRE_BigInt            *nbr_aggregates, *big_buf;
+   HYPRE_BigInt             agg, best_agg, agg_first, big_num_aggregates;
+   HYPRE_Int                num_aggregates, num_undecided, global_num_undecided;
+   HYPRE_Int                num_nbrs, max_nbrs;
+   HYPRE_Int                i, j, jj, count, best_count;
+
+   /*-----------------------------------------------------------------------
+    * Symmetrized strength graph G = S + S^T
+    *-----------------------------------------------------------------------*/
+
+   S1 = hypre_ParCSRMatrixClone_v2(S, 0, HYPRE_MEMORY_HOST);
+   S1_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(S1));
+   for (i = 0; i < hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(S1)); i++)
+   {
+      S1_data[i] = 1.0;
+   }
+   S1_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(S1));
+   for (i = 0; i < hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(S1)); i++)
+   {
+      S1_data[i] = 1.0;
+   }
+   hypre_ParCSRMatrixTranspose(S1, &ST, 1);
+   hypre_ParCSRMatrixAdd(1.0, S1, 1.0, ST, &G);
+   hypre_ParCSRMatrixDestroy(S1);
+   hypre_ParCSRMatrixDestroy(ST);
+
+   if (!hypre_ParCSRMatrixCommPkg(G))
+   {
+      hypre_MatvecCommPkgCreate(G);
+   }
+   comm_pkg      = hypre_ParCSRMatrixCommPkg(G);
+   num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_elmts     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   G_diag        = hypre_ParCSRMatrixDiag(G);
+   G_diag_i      = hypre_CSRMatrixI(G_diag);
+   G_diag_j      = hypre_CSRMatrixJ(G_diag);
+   G_offd        = hypre_ParCSRMatrixOffd(G);
+   G_offd_i      = hypre_CSRMatrixI(G_offd);
+   G_offd_j      = hypre_CSRMatrixJ(G_offd);
+   num_cols_offd = hypre_CSRMatrixNumCols(G_offd);
+
+   if (*CF_marker_ptr == NULL)
+   {
+      *CF_marker_ptr = hypre_IntArrayCreate(num_rows);
+      hypre_IntArrayInitialize(*CF_marker_ptr);
+   }
+   CF_marker = hypre_IntArrayData(*CF_marker_ptr);
+
+   state    = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   key      = hypre_CTAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   key_max  = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   key_tmp  = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   key_offd = hypre_TAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+   gid      = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   gid_max  = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   gid_tmp  = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   gid_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Phase 1: distance-2 maximal independent set.  The state of a point is
+    * -2 if it is isolated, -1 if it is removed, 0 if it is undecided and 1
+    * if it is a root.  Its key is a random number in [0,1) plus 0, 2 or 4
+    * for removed (or isolated), undecided and root points.
+    *-----------------------------------------------------------------------*/
+
+   hypre_BoomerAMGIndepSetInit(G, key, 1);
+
+   num_undecided = 0;
+   max_nbrs      = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      gid[i]   = first_row + (HYPRE_BigInt) i;
+      state[i] = -2;
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         if (G_diag_j[jj] != i)
+         {
+            state[i] = 0;
+         }
+      }
+      if (G_offd_i[i + 1] > G_offd_i[i])
+      {
+         state[i] = 0;
+      }
+      if (state[i] == 0)
+      {
+         key[i] += 2.0;
+         num_undecided++;
+      }
+      max_nbrs = hypre_max(max_nbrs, G_diag_i[i + 1] - G_diag_i[i] + G_offd_i[i + 1] - G_offd_i[i]);
+   }
+   hypre_MPI_Allreduce(&num_undecided, &global_num_undecided, 1, HYPRE_MPI_INT,
+                       hypre_MPI_SUM, comm);
+
+   while (global_num_undecided > 0)
+   {
+      hypre_SAMaxNeighbor(G, key, gid, key_offd, gid_offd, key_tmp, gid_tmp);
+      hypre_SAMaxNeighbor(G, key_tmp, gid_tmp, key_offd, gid_offd, key_max, gid_max);
+
+      num_undecided = 0;
+      for (i = 0; i < num_rows; i++)
+      {
+         if (state[i] == 0)
+         {
+            if (gid_max[i] == gid[i])
+            {
+               state[i] = 1;
+               key[i]  += 2.0;
+            }
+            else if (key_max[i] >= 4.0)
+            {
+               state[i] = -1;
+               key[i]  -= 2.0;
+            }
+            else
+            {
+               num_undecided++;
+            }
+         }
+      }
+      hypre_MPI_Allreduce(&num_undecided, &global_num_undecided, 1, HYPRE_MPI_INT,
+                          hypre_MPI_SUM, comm);
+   }
+
+   hypre_TFree(key, HYPRE_MEMORY_HOST);
+   hypre_TFree(key_max, HYPRE_MEMORY_HOST);
+   hypre_TFree(key_tmp, HYPRE_MEMORY_HOST);
+   hypre_TFree(key_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(gid, HYPRE_MEMORY_HOST);
+   hypre_TFree(gid_max, HYPRE_MEMORY_HOST);
+   hypre_TFree(gid_tmp, HYPRE_MEMORY_HOST);
+   hypre_TFree(gid_offd, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Number the aggregates in the order of their roots, and add the
+    * neighbors of each root to its aggregate.  Roots are at distance three
+    * or more from each other, so each point has at most one root neighbor.
+    *-----------------------------------------------------------------------*/
+
+   num_aggregates = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (state[i] == 1)
+      {
+         num_aggregates++;
+      }
+   }
+   big_num_aggregates = (HYPRE_BigInt) num_aggregates;
+   hypre_MPI_Scan(&big_num_aggregates, &agg_first, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   agg_first -= big_num_aggregates;
+
+   aggregates      = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   new_aggregates  = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   nbr_aggregates  = hypre_TAlloc(HYPRE_BigInt, max_nbrs, HYPRE_MEMORY_HOST);
+   aggregates_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+   big_buf         = hypre_TAlloc(HYPRE_BigInt, num_elmts, HYPRE_MEMORY_HOST);
+
+   agg = agg_first;
+   for (i = 0; i < num_rows; i++)
+   {
+      CF_marker[i]  = -1;
+      aggregates[i] = -1;
+      if (state[i] == 1)
+      {
+         CF_marker[i]  = 1;
+         aggregates[i] = agg++;
+      }
+   }
+
+   for (i = 0; i < num_elmts; i++)
+   {
+      big_buf[i] = aggregates[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, big_buf, aggregates_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      if (state[i] == 1)
+      {
+         continue;
+      }
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         j = G_diag_j[jj];
+         if (state[j] == 1)
+         {
+            aggregates[i] = aggregates[j];
+         }
+      }
+      for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+      {
+         j = G_offd_j[jj];
+         if (aggregates_offd[j] > -1)
+         {
+            aggregates[i] = aggregates_offd[j];
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Phase 2: join the neighboring aggregate with the most strong
+    * connections, the one with the smallest number on ties
+    *-----------------------------------------------------------------------*/
+
+   for (i = 0; i < num_elmts; i++)
+   {
+      big_buf[i] = aggregates[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, big_buf, aggregates_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      new_aggregates[i] = aggregates[i];
+      if (aggregates[i] > -1 || state[i] == -2)
+      {
+         continue;
+      }
+
+      /* gather the aggregates of the neighbors */
+      num_nbrs = 0;
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         if (aggregates[G_diag_j[jj]] > -1)
+         {
+            nbr_aggregates[num_nbrs++] = aggregates[G_diag_j[jj]];
+         }
+      }
+      for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+      {
+         if (aggregates_offd[G_offd_j[jj]] > -1)
+         {
+            nbr_aggregates[num_nbrs++] = aggregates_offd[G_offd_j[jj]];
+         }
+      }
+      hypre_BigQsort0(nbr_aggregates, 0, num_nbrs - 1);
+
+      best_agg   = -1;
+      best_count = 0;
+      for (jj = 0; jj < num_nbrs; jj += count)
+      {
+         for (count = 1; jj + count < num_nbrs; count++)
+         {
+            if (nbr_aggregates[jj + count] != nbr_aggregates[jj])
+            {
+               break;
+            }
+         }
+         if (count > best_count)
+         {
+            best_agg   = nbr_aggregates[jj];
+            best_count = count;
+         }
+      }
+      new_aggregates[i] = best_agg;
+   }
+
+   hypre_TFree(aggregates, HYPRE_MEMORY_HOST);
+   hypre_TFree(aggregates_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(nbr_aggregates, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(state, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixDestroy(G);
+
+   *aggregates_ptr     = new_aggregates;
+   *num_aggregates_ptr = num_aggregates;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SAOrthonormalize
+ *
+ * QR factorization B = Q R of a dense m x k block, stored by columns, with
+ * classical Gram-Schmidt and one reorthogonalization.  Q overwrites B.  A
+ * column that depends on the previous ones gets a zero diagonal in R, and
+ * is replaced by the unit vector farthest from their span, so that Q keeps
+ * k orthonormal columns when m >= k.  R is stored by rows, with a
+ * nonnegative diagonal.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SAOrthonormalize( HYPRE_Int    m,
+                        HYPRE_Int    k,
+                        HYPRE_Real  *B,
+                        HYPRE_Real  *R )
+{
+   HYPRE_Real  *b, *q;
+   HYPRE_Real   norm, norm0, h, dist, best_dist;
+   HYPRE_Int    i, j, p, pass, best;
+
+   for (p = 0; p < k; p++)
+   {
+      b = &B[p * m];
+      for (j = 0; j < k; j++)
+      {
+         R[j * k + p] = 0.0;
+      }
+
+      norm0 = 0.0;
+      for (i = 0; i < m; i++)
+      {
+         norm0 += b[i] * b[i];
+      }
+      norm0 = sqrt(norm0);
+
+      for (pass = 0; pass < 2; pass++)
+      {
+         for (j = 0; j < p; j++)
+         {
+            q = &B[j * m];
+            h = 0.0;
+            for (i = 0; i < m; i++)
+            {
+               h += q[i] * b[i];
+            }
+            R[j * k + p] += h;
+            for (i = 0; i < m; i++)
+            {
+               b[i] -= h * q[i];
+            }
+         }
+      }
+
+      norm = 0.0;
+      for (i = 0; i < m; i++)
+      {
+         norm += b[i] * b[i];
+      }
+      norm = sqrt(norm);
+
+      if (norm > 1.0e-10 * norm0)
+      {
+         R[p * k + p] = norm;
+      }
+      else
+      {
+         /* complete Q with the unit vector that has the smallest
+            component in the span of the previous columns */
+         best      = -1;
+         best_dist = 0.0;
+         for (i = 0; i < m; i++)
+         {
+            dist = 1.0;
+            for (j = 0; j < p; j++)
+            {
+               dist -= B[j * m + i] * B[j * m + i];
+            }
+            if (dist > best_dist + 1.0e-10)
+            {
+               best      = i;
+               best_dist = dist;
+            }
+         }
+
+         for (i = 0; i < m; i++)
+         {
+            b[i] = (i == best) ? 1.0 : 0.0;
+         }
+         if (best > -1)
+         {
+            for (pass = 0; pass < 2; pass++)
+            {
+               for (j = 0; j < p; j++)
+               {
+                  q = &B[j * m];
+                  h = q[best];
+                  if (pass)
+                  {
+                     h = 0.0;
+                     for (i = 0; i < m; i++)
+                     {
+                        h += q[i] * b[i];
+                     }
+                  }
+                  for (i = 0; i < m; i++)
+                  {
+                     b[i] -= h * q[i];
+                  }
+               }
+            }
+            norm = 0.0;
+            for (i = 0; i < m; i++)
+            {
+               norm += b[i] * b[i];
+            }
+            norm = sqrt(norm);
+         }
+      }
+
+      if (norm > 0.0)
+      {
+         for (i = 0; i < m; i++)
+         {
+            b[i] /= norm;
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildSAInterp
+ *
+ * Builds the smoothed aggregation prolongator
+ *
+ *    P = (I - omega D_F^{-1} A_F) P_tent,
+ *
+ * where the columns of P_tent on each aggregate are an orthonormal basis of
+ * the num_vectors near-nullspace vectors restricted to it, and A_F is A
+ * restricted to the strong connections given by S, with the weak
+ * connections to unknowns of the same function added to the diagonal D_F.
+ * If jacobi_weight is negative, omega = 4 / (3 rho(D_F^{-1} A_F)); if it is
+ * zero, P = P_tent.  P is truncated with trunc_factor and max_elmts.
+ *
+ * nullspace holds the vectors by rows (num_vectors values per local row),
+ * or is NULL for the constant vector.  The coarse point num_vectors * a + r
+ * belongs to aggregate a and vector r, and the coarse near-nullspace
+ * vectors, which are exactly interpolated by P_tent, are returned in
+ * coarse_nullspace in the same layout.  If num_functions or num_vectors is
+ * larger than one, coarse_dof_func returns the function of each coarse
+ * point: the vector for num_vectors > 1, that of the root otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildSAInterp( hypre_ParCSRMatrix   *A,
+                              HYPRE_Int            *CF_marker,
+                              hypre_ParCSRMatrix   *S,
+                              HYPRE_BigInt         *aggregates,
+                              HYPRE_Int             num_aggregates,
+                              HYPRE_Int             num_functions,
+                              HYPRE_Int            *dof_func,
+                              HYPRE_Int             num_vectors,
+                              HYPRE_Real           *nullspace,
+                              HYPRE_Real            jacobi_weight,
+                              HYPRE_Int             debug_flag,
+                              HYPRE_Real            trunc_factor,
+                              HYPRE_Int             max_elmts,
+                              hypre_ParCSRMatrix  **P_ptr,
+                              hypre_IntArray      **coarse_dof_func_ptr,
+                              HYPRE_Real          **coarse_nullspace_ptr )
+{
+   MPI_Comm              comm            = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg  *comm_pkg        = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+
+   hypre_CSRMatrix      *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int            *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int            *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real           *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix      *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int            *A_offd_i        = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int            *A_offd_j        = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real           *A_offd_data     = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int             num_cols_offd   = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix      *S_diag          = hypre_ParCSRMatrixDiag(S);
+   HYPRE_Int            *S_diag_i        = hypre_CSRMatrixI(S_diag);
+   HYPRE_Int            *S_diag_j        = hypre_CSRMatrixJ(S_diag);
+   hypre_CSRMatrix      *S_offd          = hypre_ParCSRMatrixOffd(S);
+   HYPRE_Int            *S_offd_i        = hypre_CSRMatrixI(S_offd);
+   HYPRE_Int            *S_offd_j        = hypre_CSRMatrixJ(S_offd);
+
+   HYPRE_Int             num_rows        = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int             k               = num_vectors;
+   HYPRE_BigInt          agg_first, agg_last, total_aggregates;
+   HYPRE_BigInt          big_num_aggregates, col_starts[2];
+   HYPRE_Int             my_id;
+
+   hypre_ParCSRMatrix   *P0, *P0T, *P_tent, *A_F, *AP, *P;
+   hypre_CSRMatrix      *P0_diag, *P0_offd, *P0T_diag, *P0T_offd;
+   HYPRE_Int            *P0_diag_i, *P0_diag_j, *P0_offd_i, *P0_offd_j;
+   HYPRE_Real           *P0_diag_data, *P0_offd_data;
+   HYPRE_Int            *P0T_diag_i, *P0T_diag_j, *P0T_offd_i, *P0T_offd_j;
+   HYPRE_Real           *P0T_diag_data, *P0T_offd_data;
+   HYPRE_BigInt         *col_map_offd_P0, *remote_aggregates;
+   HYPRE_Int             num_remote, num_cols_offd_P0T;
+   HYPRE_Int            *diag_marker, *offd_marker;
+   HYPRE_Real           *B_agg, *R_agg, *coarse_nullspace;
+   hypre_IntArray       *coarse_dof_func = NULL;
+   HYPRE_Int            *coarse_dof_func_data;
+   HYPRE_Int             la, m, p, q, row, pos, max_m;
+
+   hypre_CSRMatrix      *A_F_diag, *A_F_offd, *AP_diag, *AP_offd;
+   HYPRE_Int            *A_F_diag_i, *A_F_diag_j, *A_F_offd_i, *A_F_offd_j;
+   HYPRE_Real           *A_F_diag_data, *A_F_offd_data;
+   HYPRE_Int            *AP_diag_i, *AP_offd_i;
+   HYPRE_Real           *AP_diag_data, *AP_offd_data;
+   HYPRE_BigInt         *col_map_offd_A_F;
+
+   HYPRE_Int            *dof_func_offd = NULL;
+   HYPRE_Int            *int_buf_data;
+   HYPRE_Real           *D_F;
+   HYPRE_Real            omega, max_eig, min_eig, wall_time = 0.0;
+   HYPRE_Int             i, j, jj, jA, jS, nnz_diag, nnz_offd, cnt_diag, cnt_offd;
+   HYPRE_Int             num_sends, begin, end;
+
+   if (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Smoothed aggregation is only available on the host!\n");
+      return hypre_error_flag;
+   }
+
+   if (debug_flag == 4) { wall_time = time_getWallclockSeconds(); }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (!nullspace)
+   {
+      k = 1;
+   }
+
+   big_num_aggregates = (HYPRE_BigInt) num_aggregates;
+   hypre_MPI_Scan(&big_num_aggregates, &agg_last, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   hypre_MPI_Allreduce(&big_num_aggregates, &total_aggregates, 1, HYPRE_MPI_BIG_INT,
+                       hypre_MPI_SUM, comm);
+   agg_first = agg_last - big_num_aggregates;
+   col_starts[0] = agg_first * (HYPRE_BigInt) k;
+   col_starts[1] = agg_last * (HYPRE_BigInt) k;
+
+   /*-----------------------------------------------------------------------
+    * P0: the near-nullspace vectors, with the k columns of each aggregate
+    *-----------------------------------------------------------------------*/
+
+   nnz_diag   = 0;
+   num_remote = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (aggregates[i] >= agg_first && aggregates[i] < agg_last)
+      {
+         nnz_diag += k;
+      }
+      else if (aggregates[i] > -1)
+      {
+         num_remote++;
+      }
+   }
+   nnz_offd = num_remote * k;
+
+   remote_aggregates = hypre_TAlloc(HYPRE_BigInt, num_remote, HYPRE_MEMORY_HOST);
+   num_remote = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (aggregates[i] > -1 && (aggregates[i] < agg_first || aggregates[i] >= agg_last))
+      {
+         remote_aggregates[num_remote++] = aggregates[i];
+      }
+   }
+   hypre_BigQsort0(remote_aggregates, 0, num_remote - 1);
+   for (i = 0, j = 0; i < num_remote; i++)
+   {
+      if (j == 0 || remote_aggregates[i] != remote_aggregates[j - 1])
+      {
+         remote_aggregates[j++] = remote_aggregates[i];
+      }
+   }
+   num_remote = (num_remote > 0) ? j : 0;
+
+   P0 = hypre_ParCSRMatrixCreate(comm,
+                                 hypre_ParCSRMatrixGlobalNumRows(A),
+                                 total_aggregates * (HYPRE_BigInt) k,
+                                 hypre_ParCSRMatrixRowStarts(A),
+                                 col_starts,
+                                 num_remote * k, nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(P0, HYPRE_MEMORY_HOST);
+
+   P0_diag         = hypre_ParCSRMatrixDiag(P0);
+   P0_diag_i       = hypre_CSRMatrixI(P0_diag);
+   P0_diag_j       = hypre_CSRMatrixJ(P0_diag);
+   P0_diag_data    = hypre_CSRMatrixData(P0_diag);
+   P0_offd         = hypre_ParCSRMatrixOffd(P0);
+   P0_offd_i       = hypre_CSRMatrixI(P0_offd);
+   P0_offd_j       = hypre_CSRMatrixJ(P0_offd);
+   P0_offd_data    = hypre_CSRMatrixData(P0_offd);
+   col_map_offd_P0 = hypre_ParCSRMatrixColMapOffd(P0);
+
+   for (i = 0; i < num_remote; i++)
+   {
+      for (p = 0; p < k; p++)
+      {
+         col_map_offd_P0[i * k + p] = remote_aggregates[i] * (HYPRE_BigInt) k + (HYPRE_BigInt) p;
+      }
+   }
+
+   cnt_diag = 0;
+   cnt_offd = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      P0_diag_i[i] = cnt_diag;
+      P0_offd_i[i] = cnt_offd;
+      if (aggregates[i] >= agg_first && aggregates[i] < agg_last)
+      {
+         for (p = 0; p < k; p++)
+         {
+            P0_diag_j[cnt_diag]    = (HYPRE_Int) (aggregates[i] - agg_first) * k + p;
+            P0_diag_data[cnt_diag] = nullspace ? nullspace[i * k + p] : 1.0;
+            cnt_diag++;
+         }
+      }
+      else if (aggregates[i] > -1)
+      {
+         j = hypre_BigBinarySearch(remote_aggregates, aggregates[i], num_remote);
+         for (p = 0; p < k; p++)
+         {
+            P0_offd_j[cnt_offd]    = j * k + p;
+            P0_offd_data[cnt_offd] = nullspace ? nullspace[i * k + p] : 1.0;
+            cnt_offd++;
+         }
+      }
+   }
+   P0_diag_i[num_rows] = cnt_diag;
+   P0_offd_i[num_rows] = cnt_offd;
+   hypre_TFree(remote_aggregates, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Orthonormalize the vectors on each aggregate where it is owned.  Row
+    * k * la + p of P0^T holds vector p on the local aggregate la, and all
+    * k rows of an aggregate have the same columns.
+    *-----------------------------------------------------------------------*/
+
+   hypre_MatvecCommPkgCreate(P0);
+   hypre_ParCSRMatrixTranspose(P0, &P0T, 1);
+   hypre_ParCSRMatrixDestroy(P0);
+
+   P0T_diag          = hypre_ParCSRMatrixDiag(P0T);
+   P0T_diag_i        = hypre_CSRMatrixI(P0T_diag);
+   P0T_diag_j        = hypre_CSRMatrixJ(P0T_diag);
+   P0T_diag_data     = hypre_CSRMatrixData(P0T_diag);
+   P0T_offd          = hypre_ParCSRMatrixOffd(P0T);
+   P0T_offd_i        = hypre_CSRMatrixI(P0T_offd);
+   P0T_offd_j        = hypre_CSRMatrixJ(P0T_offd);
+   P0T_offd_data     = hypre_CSRMatrixData(P0T_offd);
+   num_cols_offd_P0T = hypre_CSRMatrixNumCols(P0T_offd);
+
+   max_m = 0;
+   for (la = 0; la < num_aggregates; la++)
+   {
+      row   = la * k;
+      max_m = hypre_max(max_m, P0T_diag_i[row + 1] - P0T_diag_i[row] +
+                        P0T_offd_i[row + 1] - P0T_offd_i[row]);
+   }
+
+   diag_marker      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   offd_marker      = hypre_TAlloc(HYPRE_Int, num_cols_offd_P0T, HYPRE_MEMORY_HOST);
+   B_agg            = hypre_TAlloc(HYPRE_Real, max_m * k, HYPRE_MEMORY_HOST);
+   R_agg            = hypre_TAlloc(HYPRE_Real, k * k, HYPRE_MEMORY_HOST);
+   coarse_nullspace = hypre_TAlloc(HYPRE_Real, num_aggregates * k * k, HYPRE_MEMORY_HOST);
+
+   for (la = 0; la < num_aggregates; la++)
+   {
+      /* position of each point in the aggregate */
+      row = la * k;
+      m   = 0;
+      for (jj = P0T_diag_i[row]; jj < P0T_diag_i[row + 1]; jj++)
+      {
+         diag_marker[P0T_diag_j[jj]] = m++;
+      }
+      for (jj = P0T_offd_i[row]; jj < P0T_offd_i[row + 1]; jj++)
+      {
+         offd_marker[P0T_offd_j[jj]] = m++;
+      }
+
+      for (p = 0; p < k; p++)
+      {
+         row = la * k + p;
+         for (jj = P0T_diag_i[row]; jj < P0T_diag_i[row + 1]; jj++)
+         {
+            B_agg[p * m + diag_marker[P0T_diag_j[jj]]] = P0T_diag_data[jj];
+         }
+         for (jj = P0T_offd_i[row]; jj < P0T_offd_i[row + 1]; jj++)
+         {
+            B_agg[p * m + offd_marker[P0T_offd_j[jj]]] = P0T_offd_data[jj];
+         }
+      }
+
+      hypre_SAOrthonormalize(m, k, B_agg, R_agg);
+
+      for (p = 0; p < k; p++)
+      {
+         row = la * k + p;
+         for (jj = P0T_diag_i[row]; jj < P0T_diag_i[row + 1]; jj++)
+         {
+            P0T_diag_data[jj] = B_agg[p * m + diag_marker[P0T_diag_j[jj]]];
+         }
+         for (jj = P0T_offd_i[row]; jj < P0T_offd_i[row + 1]; jj++)
+         {
+            P0T_offd_data[jj] = B_agg[p * m + offd_marker[P0T_offd_j[jj]]];
+         }
+         for (q = 0; q < k; q++)
+         {
+            coarse_nullspace[row * k + q] = R_agg[p * k + q];
+         }
+      }
+   }
+
+   hypre_TFree(diag_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(B_agg, HYPRE_MEMORY_HOST);
+   hypre_TFree(R_agg, HYPRE_MEMORY_HOST);
+
+   /* drop the zeros, e.g. of vectors that vanish on some functions */
+   cnt_diag = 0;
+   cnt_offd = 0;
+   for (row = 0; row < num_aggregates * k; row++)
+   {
+      pos = cnt_diag;
+      for (jj = P0T_diag_i[row]; jj < P0T_diag_i[row + 1]; jj++)
+      {
+         if (P0T_diag_data[jj] != 0.0)
+         {
+            P0T_diag_j[cnt_diag]    = P0T_diag_j[jj];
+            P0T_diag_data[cnt_diag] = P0T_diag_data[jj];
+            cnt_diag++;
+         }
+      }
+      P0T_diag_i[row] = pos;
+
+      pos = cnt_offd;
+      for (jj = P0T_offd_i[row]; jj < P0T_offd_i[row + 1]; jj++)
+      {
+         if (P0T_offd_data[jj] != 0.0)
+         {
+            P0T_offd_j[cnt_offd]    = P0T_offd_j[jj];
+            P0T_offd_data[cnt_offd] = P0T_offd_data[jj];
+            cnt_offd++;
+         }
+      }
+      P0T_offd_i[row] = pos;
+   }
+   P0T_diag_i[num_aggregates * k] = cnt_diag;
+   P0T_offd_i[num_aggregates * k] = cnt_offd;
+   hypre_CSRMatrixNumNonzeros(P0T_diag) = cnt_diag;
+   hypre_CSRMatrixNumNonzeros(P0T_offd) = cnt_offd;
+
+   hypre_ParCSRMatrixTranspose(P0T, &P_tent, 1);
+   hypre_ParCSRMatrixDestroy(P0T);
+
+   /*-----------------------------------------------------------------------
+    * Functions of the coarse points
+    *-----------------------------------------------------------------------*/
+
+   if (num_functions > 1 || k > 1)
+   {
+      coarse_dof_func = hypre_IntArrayCreate(num_aggregates * k);
+      hypre_IntArrayInitialize_v2(coarse_dof_func, HYPRE_MEMORY_HOST);
+      coarse_dof_func_data = hypre_IntArrayData(coarse_dof_func);
+      if (k > 1)
+      {
+         for (i = 0; i < num_aggregates * k; i++)
+         {
+            coarse_dof_func_data[i] = i % k;
+         }
+      }
+      else
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            if (CF_marker[i] > 0 && aggregates[i] >= agg_first && aggregates[i] < agg_last)
+            {
+               coarse_dof_func_data[aggregates[i] - agg_first] = dof_func[i];
+            }
+         }
+      }
+   }
+
+   if (jacobi_weight == 0.0)
+   {
+      P = P_tent;
+      if (!hypre_ParCSRMatrixCommPkg(P))
+      {
+         hypre_MatvecCommPkgCreate(P);
+      }
+   }
+   else
+   {
+      /*--------------------------------------------------------------------
+       * Filtered matrix: the diagonal and the strong connections of A.
+       * The columns of each row of S are a subsequence of those of A.
+       *--------------------------------------------------------------------*/
+
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      if (num_functions > 1)
+      {
+         num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+         dof_func_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+         int_buf_data  = hypre_CTAlloc(HYPRE_Int,
+                                       hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                       HYPRE_MEMORY_HOST);
+         begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+         end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+         for (j = begin; j < end; j++)
+         {
+            int_buf_data[j - begin] = dof_func[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         }
+         comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, dof_func_offd);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+      }
+
+      nnz_diag = num_rows + S_diag_i[num_rows];
+      nnz_offd = S_offd_i[num_rows];
+
+      A_F = hypre_ParCSRMatrixCreate(comm,
+                                     hypre_ParCSRMatrixGlobalNumRows(A),
+                                     hypre_ParCSRMatrixGlobalNumCols(A),
+                                     hypre_ParCSRMatrixRowStarts(A),
+                                     hypre_ParCSRMatrixColStarts(A),
+                                     num_cols_offd, nnz_diag, nnz_offd);
+      hypre_ParCSRMatrixInitialize_v2(A_F, HYPRE_MEMORY_HOST);
+
+      A_F_diag      = hypre_ParCSRMatrixDiag(A_F);
+      A_F_diag_i    = hypre_CSRMatrixI(A_F_diag);
+      A_F_diag_j    = hypre_CSRMatrixJ(A_F_diag);
+      A_F_diag_data = hypre_CSRMatrixData(A_F_diag);
+      A_F_offd      = hypre_ParCSRMatrixOffd(A_F);
+      A_F_offd_i    = hypre_CSRMatrixI(A_F_offd);
+      A_F_offd_j    = hypre_CSRMatrixJ(A_F_offd);
+      A_F_offd_data = hypre_CSRMatrixData(A_F_offd);
+
+      col_map_offd_A_F = hypre_ParCSRMatrixColMapOffd(A_F);
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         col_map_offd_A_F[i] = hypre_ParCSRMatrixColMapOffd(A)[i];
+      }
+
+      D_F = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+
+      cnt_diag = 0;
+      cnt_offd = 0;
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Int  diag_pos = cnt_diag;
+
+         A_F_diag_i[i] = cnt_diag;
+         A_F_offd_i[i] = cnt_offd;
+
+         /* the diagonal is stored first */
+         A_F_diag_j[cnt_diag]    = i;
+         A_F_diag_data[cnt_diag] = A_diag_data[A_diag_i[i]];
+         cnt_diag++;
+
+         jS = S_diag_i[i];
+         for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+         {
+            j = A_diag_j[jA];
+            if (jS < S_diag_i[i + 1] && S_diag_j[jS] == j)
+            {
+               A_F_diag_j[cnt_diag]    = j;
+               A_F_diag_data[cnt_diag] = A_diag_data[jA];
+               cnt_diag++;
+               jS++;
+            }
+            else if (num_functions == 1 || dof_func[i] == dof_func[j])
+            {
+               A_F_diag_data[diag_pos] += A_diag_data[jA];
+            }
+         }
+
+         jS = S_offd_i[i];
+         for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+         {
+            j = A_offd_j[jA];
+            if (jS < S_offd_i[i + 1] && S_offd_j[jS] == j)
+            {
+               A_F_offd_j[cnt_offd]    = j;
+               A_F_offd_data[cnt_offd] = A_offd_data[jA];
+               cnt_offd++;
+               jS++;
+            }
+            else if (num_functions == 1 || dof_func[i] == dof_func_offd[j])
+            {
+               A_F_diag_data[diag_pos] += A_offd_data[jA];
+            }
+         }
+
+         /* fall back to the diagonal of A if lumping cancels it */
+         if (A_F_diag_data[diag_pos] == 0.0)
+         {
+            A_F_diag_data[diag_pos] = A_diag_data[A_diag_i[i]];
+         }
+         D_F[i] = A_F_diag_data[diag_pos];
+      }
+      A_F_diag_i[num_rows] = cnt_diag;
+      A_F_offd_i[num_rows] = cnt_offd;
+      hypre_CSRMatrixNumNonzeros(A_F_diag) = cnt_diag;
+      hypre_CSRMatrixNumNonzeros(A_F_offd) = cnt_offd;
+
+      hypre_ParCSRMatrixMigrate(A_F, memory_location);
+      hypre_ParCSRMatrixMigrate(P_tent, memory_location);
+      hypre_MatvecCommPkgCreate(A_F);
+
+      omega = jacobi_weight;
+      if (omega < 0.0)
+      {
+         hypre_ParCSRMaxEigEstimateCG(A_F, 1, 10, &max_eig, &min_eig);
+         omega = (max_eig > 0.0) ? 4.0 / (3.0 * max_eig) : 2.0 / 3.0;
+      }
+
+      /*--------------------------------------------------------------------
+       * P = P_tent - omega D_F^{-1} A_F P_tent
+       *--------------------------------------------------------------------*/
+
+      AP = hypre_ParCSRMatMat(A_F, P_tent);
+
+      AP_diag      = hypre_ParCSRMatrixDiag(AP);
+      AP_diag_i    = hypre_CSRMatrixI(AP_diag);
+      AP_diag_data = hypre_CSRMatrixData(AP_diag);
+      AP_offd      = hypre_ParCSRMatrixOffd(AP);
+      AP_offd_i    = hypre_CSRMatrixI(AP_offd);
+      AP_offd_data = hypre_CSRMatrixData(AP_offd);
+
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Real scale = -omega / D_F[i];
+
+         for (j = AP_diag_i[i]; j < AP_diag_i[i + 1]; j++)
+         {
+            AP_diag_data[j] *= scale;
+         }
+         for (j = AP_offd_i[i]; j < AP_offd_i[i + 1]; j++)
+         {
+            AP_offd_data[j] *= scale;
+         }
+      }
+
+      hypre_ParCSRMatrixAdd(1.0, P_tent, 1.0, AP, &P);
+
+      hypre_ParCSRMatrixDestroy(AP);
+      hypre_ParCSRMatrixDestroy(A_F);
+      hypre_ParCSRMatrixDestroy(P_tent);
+      hypre_TFree(D_F, HYPRE_MEMORY_HOST);
+      hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
+
+      if (trunc_factor != 0.0 || max_elmts > 0)
+      {
+         hypre_BoomerAMGInterpTruncation(P, trunc_factor, max_elmts);
+      }
+   }
+
+   if (debug_flag == 4)
+   {
+      wall_time = time_getWallclockSeconds() - wall_time;
+      hypre_printf("Proc = %d     SA interpolation time = %f\n", my_id, wall_time);
+   }
+
+   *P_ptr                = P;
+   *coarse_dof_func_ptr  = coarse_dof_func;
+   *coarse_nullspace_ptr = coarse_nullspace;
+
+   return hypre_error_flag;
+}
@@ -55,6 +55,8 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    keep_same_sign;
    HYPRE_Int    num_paths;
    HYPRE_Int    agg_num_levels;
+   HYPRE_Int    sa_num_levels;
+   HYPRE_Real   sa_jacobi_weight;
    HYPRE_Int    agg_interp_type;
    HYPRE_Int    agg_P_max_elmts;
    HYPRE_Int    agg_P12_max_elmts;
@@ -65,6 +67,7 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    cgc_its;
    HYPRE_Int    seq_threshold;
    HYPRE_Int    redundant;
+   HYPRE_Int    redist_threshold;
    HYPRE_Int    rap2;
    HYPRE_Int    keepT;
    HYPRE_Int    modu_rap;
@@ -151,6 +154,7 @@ hypre_BoomerAMGCreate()
    min_coarse_size = 0;
    seq_threshold = 0;
    redundant = 0;
+   redist_threshold = 0;
    coarsen_cut_factor = 0;
    strong_threshold = 0.25;
    strong_threshold_R = 0.25;
@@ -176,6 +180,8 @@ hypre_BoomerAMGCreate()
    keep_same_sign = 0;
    num_paths = 1;
    agg_num_levels = 0;
+   sa_num_levels = 0;
+   sa_jacobi_weight = -1.0;
    post_interp_type = 0;
    agg_interp_type = 4;
    num_CR_relax_steps = 2;
@@ -323,6 +329,8 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetKeepSameSign(amg_data, keep_same_sign);
    hypre_BoomerAMGSetNumPaths(amg_data, num_paths);
    hypre_BoomerAMGSetAggNumLevels(amg_data, agg_num_levels);
+   hypre_BoomerAMGSetSANumLevels(amg_data, sa_num_levels);
+   hypre_BoomerAMGSetSAJacobiWeight(amg_data, sa_jacobi_weight);
    hypre_BoomerAMGSetAggInterpType(amg_data, agg_interp_type);
    hypre_BoomerAMGSetPostInterpType(amg_data, post_interp_type);
    hypre_BoomerAMGSetNumCRRelaxSteps(amg_data, num_CR_relax_steps);
@@ -442,6 +450,11 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
 
+   /* multicolor Gauss-Seidel */
+   hypre_ParAMGDataColorStarts(amg_data) = NULL;
+   hypre_ParAMGDataColorRows(amg_data) = NULL;
+   hypre_ParAMGDataColorL1Norms(amg_data) = NULL;
+
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
    hypre_BoomerAMGSetPlotFileName (amg_data, plot_file_name);
@@ -467,6 +480,9 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataSeqThreshold(amg_data) = seq_threshold;
    hypre_ParAMGDataRedundant(amg_data) = redundant;
    hypre_ParAMGDataCoarseSolver(amg_data) = NULL;
+
+   /* for redistribution of coarse levels onto fewer processes */
+   hypre_ParAMGDataRedistThreshold(amg_data) = redist_threshold;
    hypre_ParAMGDataACoarse(amg_data) = NULL;
    hypre_ParAMGDataFCoarse(amg_data) = NULL;
    hypre_ParAMGDataUCoarse(amg_data) = NULL;
@@ -476,11 +492,14 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataGSSetup(amg_data) = 0;
    hypre_ParAMGDataAMat(amg_data) = NULL;
    hypre_ParAMGDataAInv(amg_data) = NULL;
+   hypre_ParAMGDataAPiv(amg_data) = NULL;
    hypre_ParAMGDataBVec(amg_data) = NULL;
    hypre_ParAMGDataCommInfo(amg_data) = NULL;
 
    hypre_ParAMGDataNonGalerkinTol(amg_data) = nongalerkin_tol;
    hypre_ParAMGDataNonGalTolArray(amg_data) = NULL;
+   hypre_ParAMGDataNonGalOpComplexity(amg_data) = 0.0;
+   hypre_ParAMGDataNonGalStencilGrowth(amg_data) = 0.0;
 
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
@@ -500,6 +519,7 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataDSLUThreshold(amg_data) = 0;
    hypre_ParAMGDataDSLUSolver(amg_data) = NULL;
 #endif
+   hypre_ParAMGDataSparseDirectSolver(amg_data) = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -533,6 +553,12 @@ hypre_BoomerAMGDestroy( void *data )
    }
 #endif
 
+   if (hypre_ParAMGDataSparseDirectSolver(amg_data) != NULL)
+   {
+      hypre_SparseDirectDestroy(hypre_ParAMGDataSparseDirectSolver(amg_data));
+      hypre_ParAMGDataSparseDirectSolver(amg_data) = NULL;
+   }
+
    if (hypre_ParAMGDataMaxEigEst(amg_data))
    {
       hypre_TFree(hypre_ParAMGDataMaxEigEst(amg_data), HYPRE_MEMORY_HOST);
@@ -694,6 +720,19 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
    }
 
+   if (hypre_ParAMGDataColorStarts(amg_data))
+   {
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_IntArrayDestroy(hypre_ParAMGDataColorStarts(amg_data)[i]);
+         hypre_IntArrayDestroy(hypre_ParAMGDataColorRows(amg_data)[i]);
+         hypre_SeqVectorDestroy(hypre_ParAMGDataColorL1Norms(amg_data)[i]);
+      }
+      hypre_TFree(hypre_ParAMGDataColorStarts(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataColorRows(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataColorL1Norms(amg_data), HYPRE_MEMORY_HOST);
+   }
+
    if (hypre_ParAMGDataDinv(amg_data))
    {
       hypre_TFree(hypre_ParAMGDataDinv(amg_data), HYPRE_MEMORY_HOST);
@@ -826,8 +865,10 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_ParAMGDataResidual(amg_data) = NULL;
    }
 
+   /* the array is not created if smoothed aggregation took the vectors */
    if (hypre_ParAMGInterpVecVariant(amg_data) > 0
-       &&  hypre_ParAMGNumInterpVectors(amg_data) > 0)
+       &&  hypre_ParAMGNumInterpVectors(amg_data) > 0
+       &&  hypre_ParAMGInterpVectorsArray(amg_data))
    {
 
       HYPRE_Int j;
@@ -887,6 +928,7 @@ hypre_BoomerAMGDestroy( void *data )
 
    if (hypre_ParAMGDataAMat(amg_data)) { hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataAInv(amg_data)) { hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST); }
+   if (hypre_ParAMGDataAPiv(amg_data)) { hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataBVec(amg_data)) { hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataCommInfo(amg_data)) { hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST); }
 
@@ -1169,6 +1211,46 @@ hypre_BoomerAMGGetSeqThreshold( void *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetRedistThreshold( void      *data,
+                                   HYPRE_Int  redist_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (redist_threshold < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataRedistThreshold(amg_data) = redist_threshold;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetRedistThreshold( void      *data,
+                                   HYPRE_Int *redist_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *redist_threshold = hypre_ParAMGDataRedistThreshold(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetRedundant( void *data,
                              HYPRE_Int   redundant )
@@ -3323,6 +3405,52 @@ hypre_BoomerAMGSetAggNumLevels( void     *data,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Indicates the number of levels of smoothed aggregation
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetSANumLevels( void     *data,
+                               HYPRE_Int       sa_num_levels )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (sa_num_levels < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataSANumLevels(amg_data) = sa_num_levels;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Indicates the Jacobi weight used to smooth the tentative prolongator
+ * of smoothed aggregation (negative: 4/3 over the estimated spectral radius)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetSAJacobiWeight( void     *data,
+                                  HYPRE_Real      sa_jacobi_weight )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataSAJacobiWeight(amg_data) = sa_jacobi_weight;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Indicates the interpolation used with aggressive coarsening
  *--------------------------------------------------------------------------*/
@@ -4750,6 +4878,52 @@ hypre_BoomerAMGSetLevelNonGalerkinTol( void   *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetNonGalerkinOpComplexity( void       *data,
+                                           HYPRE_Real  op_complexity )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (op_complexity != 0.0 && op_complexity < 1.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNonGalOpComplexity(amg_data) = op_complexity;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetNonGalerkinStencilGrowth( void       *data,
+                                            HYPRE_Real  stencil_growth )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (stencil_growth < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNonGalStencilGrowth(amg_data) = stencil_growth;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetNonGalerkTol( void   *data,
                                 HYPRE_Int   nongalerk_num_tol,
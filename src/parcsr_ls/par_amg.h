@@ -49,6 +49,8 @@ typedef struct
    HYPRE_Int      is_triangular;
    HYPRE_Int      gmres_switch;
    HYPRE_Int      agg_num_levels;
+   HYPRE_Int      sa_num_levels;
+   HYPRE_Real     sa_jacobi_weight;
    HYPRE_Int      num_paths;
    HYPRE_Int      post_interp_type;
    HYPRE_Int      num_CR_relax_steps;
@@ -59,6 +61,7 @@ typedef struct
    HYPRE_Int      min_coarse_size;
    HYPRE_Int      seq_threshold;
    HYPRE_Int      redundant;
+   HYPRE_Int      redist_threshold;
    HYPRE_Int      participate;
    HYPRE_Int      Sabs;
 
@@ -159,11 +162,18 @@ typedef struct
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   /* data for multicolor Gauss-Seidel */
+   hypre_IntArray     **color_starts;
+   hypre_IntArray     **color_rows;
+   hypre_Vector       **color_l1_norms;
+
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerk_tol;
    HYPRE_Real          nongalerkin_tol;
    HYPRE_Real         *nongal_tol_array;
+   HYPRE_Real          nongal_op_complexity;
+   HYPRE_Real          nongal_stencil_growth;
 
    /* data generated in the solve phase */
    hypre_ParVector   *Vtemp;
@@ -223,6 +233,7 @@ typedef struct
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
+   HYPRE_Int  *A_piv;
    HYPRE_Real *b_vec;
    HYPRE_Int  *comm_info;
 
@@ -266,6 +277,9 @@ typedef struct
    HYPRE_Solver dslu_solver;
 #endif
 
+   /* built-in sparse direct coarse solver (relax_type 39) */
+   void *sparse_direct_solver;
+
 } hypre_ParAMGData;
 
 /*--------------------------------------------------------------------------
@@ -301,6 +315,8 @@ typedef struct
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
 #define hypre_ParAMGDataNumPaths(amg_data)             ((amg_data) -> num_paths)
 #define hypre_ParAMGDataAggNumLevels(amg_data)         ((amg_data) -> agg_num_levels)
+#define hypre_ParAMGDataSANumLevels(amg_data)          ((amg_data) -> sa_num_levels)
+#define hypre_ParAMGDataSAJacobiWeight(amg_data)       ((amg_data) -> sa_jacobi_weight)
 #define hypre_ParAMGDataPostInterpType(amg_data)       ((amg_data) -> post_interp_type)
 #define hypre_ParAMGDataNumCRRelaxSteps(amg_data)      ((amg_data) -> num_CR_relax_steps)
 #define hypre_ParAMGDataCRRate(amg_data)               ((amg_data) -> CR_rate)
@@ -314,6 +330,7 @@ typedef struct
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
 #define hypre_ParAMGDataSeqThreshold(amg_data)         ((amg_data) -> seq_threshold)
+#define hypre_ParAMGDataRedistThreshold(amg_data)      ((amg_data) -> redist_threshold)
 
 /* solve params */
 
@@ -405,6 +422,11 @@ typedef struct
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+/* multicolor Gauss-Seidel */
+#define hypre_ParAMGDataColorStarts(amg_data) ((amg_data)->color_starts)
+#define hypre_ParAMGDataColorRows(amg_data) ((amg_data)->color_rows)
+#define hypre_ParAMGDataColorL1Norms(amg_data) ((amg_data)->color_l1_norms)
+
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
@@ -472,6 +494,7 @@ typedef struct
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
 #define hypre_ParAMGDataAInv(amg_data) ((amg_data)->A_inv)
+#define hypre_ParAMGDataAPiv(amg_data) ((amg_data)->A_piv)
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
 
@@ -495,6 +518,8 @@ typedef struct
 #define hypre_ParAMGDataNonGalerkTol(amg_data) ((amg_data)->nongalerk_tol)
 #define hypre_ParAMGDataNonGalerkinTol(amg_data) ((amg_data)->nongalerkin_tol)
 #define hypre_ParAMGDataNonGalTolArray(amg_data) ((amg_data)->nongal_tol_array)
+#define hypre_ParAMGDataNonGalOpComplexity(amg_data) ((amg_data)->nongal_op_complexity)
+#define hypre_ParAMGDataNonGalStencilGrowth(amg_data) ((amg_data)->nongal_stencil_growth)
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
@@ -520,4 +545,7 @@ typedef struct
 #define hypre_ParAMGDataDSLUSolver(amg_data) ((amg_data)->dslu_solver)
 #endif
 
+/* built-in sparse direct coarse solver */
+#define hypre_ParAMGDataSparseDirectSolver(amg_data) ((amg_data)->sparse_direct_solver)
+
 #endif
@@ -0,0 +1,451 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * BoomerAMG parameter autotuning
+ *
+ * A small set of parameters (strong threshold, coarsening, interpolation,
+ * P_max_elmts, aggressive coarsening levels and relaxation) is tuned by
+ * coordinate descent.  Each trial sets up the hierarchy for the matrix at
+ * hand and runs a few cycles; the measured setup time, cycle time and
+ * convergence factor give an estimate of the time to reduce the residual
+ * by the solver tolerance, which is the objective.  All decisions are
+ * based on globally reduced quantities, so that every process follows the
+ * same path.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+#define HYPRE_AUTOTUNE_NUM_PARAMS  6
+#define HYPRE_AUTOTUNE_NUM_CYCLES  8
+
+typedef struct
+{
+   HYPRE_Real  strong_threshold;
+   HYPRE_Int   coarsen_type;
+   HYPRE_Int   interp_type;
+   HYPRE_Int   P_max_elmts;
+   HYPRE_Int   agg_num_levels;
+   HYPRE_Int   relax_type;      /* down cycle, see hypre_AMGAutotuneRelaxUp */
+
+} hypre_AMGAutotuneConfig;
+
+/* candidate values of each parameter */
+static const HYPRE_Real hypre_autotune_strong_threshold[] = {0.25, 0.5, 0.7};
+static const HYPRE_Int  hypre_autotune_coarsen_type[]     = {6, 8, 10};
+static const HYPRE_Int  hypre_autotune_interp_type[]      = {0, 6, 8};
+static const HYPRE_Int  hypre_autotune_P_max_elmts[]      = {0, 4, 6};
+static const HYPRE_Int  hypre_autotune_agg_num_levels[]   = {0, 1, 2};
+static const HYPRE_Int  hypre_autotune_relax_type[]       = {3, 6, 8, 13, 18};
+
+static const HYPRE_Int  hypre_autotune_num_values[HYPRE_AUTOTUNE_NUM_PARAMS] = {3, 3, 3, 3, 3, 5};
+
+/* forward/backward pairs are used on the down/up cycle */
+static HYPRE_Int
+hypre_AMGAutotuneRelaxUp( HYPRE_Int relax_type )
+{
+   return (relax_type == 3 || relax_type == 13) ? relax_type + 1 : relax_type;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGAutotuneSetValue
+ *
+ * Set parameter 'param' of config to its candidate number 'k'.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_AMGAutotuneSetValue( hypre_AMGAutotuneConfig *config,
+                           HYPRE_Int                param,
+                           HYPRE_Int                k )
+{
+   switch (param)
+   {
+      case 0: config->coarsen_type     = hypre_autotune_coarsen_type[k];     break;
+      case 1: config->interp_type      = hypre_autotune_interp_type[k];      break;
+      case 2: config->strong_threshold = hypre_autotune_strong_threshold[k]; break;
+      case 3: config->P_max_elmts      = hypre_autotune_P_max_elmts[k];      break;
+      case 4: config->agg_num_levels   = hypre_autotune_agg_num_levels[k];   break;
+      case 5: config->relax_type       = hypre_autotune_relax_type[k];       break;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGAutotuneSame
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_AMGAutotuneSame( hypre_AMGAutotuneConfig *a,
+                       hypre_AMGAutotuneConfig *b )
+{
+   return (a->strong_threshold == b->strong_threshold &&
+           a->coarsen_type     == b->coarsen_type     &&
+           a->interp_type      == b->interp_type      &&
+           a->P_max_elmts      == b->P_max_elmts      &&
+           a->agg_num_levels   == b->agg_num_levels   &&
+           a->relax_type       == b->relax_type);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGAutotuneApply
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_AMGAutotuneApply( void                    *amg_vdata,
+                        hypre_AMGAutotuneConfig *config )
+{
+   hypre_BoomerAMGSetStrongThreshold(amg_vdata, config->strong_threshold);
+   hypre_BoomerAMGSetCoarsenType(amg_vdata, config->coarsen_type);
+   hypre_BoomerAMGSetInterpType(amg_vdata, config->interp_type);
+   hypre_BoomerAMGSetPMaxElmts(amg_vdata, config->P_max_elmts);
+   hypre_BoomerAMGSetAggNumLevels(amg_vdata, config->agg_num_levels);
+   hypre_BoomerAMGSetCycleRelaxType(amg_vdata, config->relax_type, 1);
+   hypre_BoomerAMGSetCycleRelaxType(amg_vdata, hypre_AMGAutotuneRelaxUp(config->relax_type), 2);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGAutotuneTrial
+ *
+ * Set up and run HYPRE_AUTOTUNE_NUM_CYCLES cycles with the given
+ * configuration.  Returns the estimated time to reduce the residual by
+ * 'reduction', or a huge value if the cycle does not converge or the
+ * setup or solve raises an error.  Errors of the trial are not passed on
+ * to the caller.  The
+ * measurements are returned in stats: setup time, time per cycle,
+ * convergence factor and operator complexity.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_AMGAutotuneTrial( void                    *amg_vdata,
+                        hypre_AMGAutotuneConfig *config,
+                        hypre_ParCSRMatrix      *A,
+                        hypre_ParVector         *f,
+                        hypre_ParVector         *u,
+                        hypre_ParVector         *u0,
+                        hypre_ParVector         *r,
+                        HYPRE_Int                coarse_relax_type,
+                        HYPRE_Int                coarse_num_sweeps,
+                        HYPRE_Real               reduction,
+                        HYPRE_Real              *stats )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+   MPI_Comm             comm     = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRMatrix **A_array;
+   HYPRE_Real           times[2], max_times[2], r0_norm, r_norm, rho, nnz, num_cycles;
+   HYPRE_Int            level, error_flag, local_error, trial_error;
+
+   hypre_AMGAutotuneApply(amg_vdata, config);
+
+   /* the setup may replace the coarsest grid solver; start from the original */
+   hypre_ParAMGDataGridRelaxType(amg_data)[3] = coarse_relax_type;
+   hypre_ParAMGDataNumGridSweeps(amg_data)[3] = coarse_num_sweeps;
+
+   hypre_ParVectorCopy(u0, u);
+
+   /* not converging in the few cycles is expected; other errors reject
+      the configuration */
+   error_flag = HYPRE_GetError(); HYPRE_ClearAllErrors();
+
+   times[0] = hypre_MPI_Wtime();
+   hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+   times[0] = hypre_MPI_Wtime() - times[0];
+
+   hypre_ParVectorCopy(f, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+   r0_norm = sqrt(hypre_ParVectorInnerProd(r, r));
+
+   times[1] = hypre_MPI_Wtime();
+   hypre_BoomerAMGSolve(amg_vdata, A, f, u);
+   times[1] = hypre_MPI_Wtime() - times[1];
+
+   local_error = hypre_error_flag & ~HYPRE_ERROR_CONV;
+   hypre_MPI_Allreduce(&local_error, &trial_error, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   hypre_error_flag = error_flag;
+
+   hypre_ParVectorCopy(f, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+   r_norm = sqrt(hypre_ParVectorInnerProd(r, r));
+
+   hypre_MPI_Allreduce(times, max_times, 2, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   rho = (r0_norm > 0.0) ? pow(r_norm / r0_norm, 1.0 / HYPRE_AUTOTUNE_NUM_CYCLES) : 0.0;
+
+   nnz = 0.0;
+   A_array = hypre_ParAMGDataAArray(amg_data);
+   for (level = 1; level < hypre_ParAMGDataNumLevels(amg_data); level++)
+   {
+      nnz += hypre_ParCSRMatrixDNumNonzeros(A_array[level]);
+   }
+
+   stats[0] = max_times[0];
+   stats[1] = max_times[1] / HYPRE_AUTOTUNE_NUM_CYCLES;
+   stats[2] = rho;
+   stats[3] = 1.0 + nnz / hypre_ParCSRMatrixDNumNonzeros(A);
+
+   if (trial_error || !(rho < 0.99))
+   {
+      return HYPRE_REAL_MAX;
+   }
+   num_cycles = (rho > 0.0) ? hypre_max(1.0, ceil(log(reduction) / log(rho))) : 1.0;
+
+   return stats[0] + stats[1] * num_cycles;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAutotune
+ *
+ * Tune the parameters of amg_vdata for the system A u = f with at most
+ * max_trials trial setups (a full sweep over all parameters if
+ * max_trials <= 0).  The other parameters of amg_vdata are used as they
+ * are, and the initial guess u is not changed.  On return, the best
+ * configuration is set in amg_vdata and, if filename is given, written to
+ * that file; the hierarchy needs to be set up again by the caller.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAutotune( void               *amg_vdata,
+                         hypre_ParCSRMatrix *A,
+                         hypre_ParVector    *f,
+                         hypre_ParVector    *u,
+                         HYPRE_Int           max_trials,
+                         const char         *filename )
+{
+   hypre_ParAMGData        *amg_data = (hypre_ParAMGData*) amg_vdata;
+   MPI_Comm                 comm     = hypre_ParCSRMatrixComm(A);
+   hypre_ParVector         *u0, *r;
+   hypre_AMGAutotuneConfig  best, trial;
+   HYPRE_Real               best_time, trial_time, reduction;
+   HYPRE_Real               best_stats[4], stats[4];
+   HYPRE_Int                print_level, logging, max_iter;
+   HYPRE_Real               tol;
+   HYPRE_Int                coarse_relax_type, coarse_num_sweeps;
+   HYPRE_Int                param, k, num_trials, improved, my_id;
+   FILE                    *fp;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* the relaxation arrays are only allocated at the first setup */
+   if (!hypre_ParAMGDataGridRelaxType(amg_data) || !hypre_ParAMGDataNumGridSweeps(amg_data))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Autotuning needs the default relaxation arrays!\n");
+      return hypre_error_flag;
+   }
+
+   print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   logging     = hypre_ParAMGDataLogging(amg_data);
+   max_iter    = hypre_ParAMGDataMaxIter(amg_data);
+   tol         = hypre_ParAMGDataTol(amg_data);
+   coarse_relax_type = hypre_ParAMGDataGridRelaxType(amg_data)[3];
+   coarse_num_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data)[3];
+
+   /* the objective is the time to reduce the residual by tol; a
+      preconditioner usually has tol = 0 */
+   reduction = (tol > 0.0 && tol < 1.0) ? tol : 1.0e-8;
+
+   hypre_ParAMGDataPrintLevel(amg_data) = 0;
+   hypre_ParAMGDataLogging(amg_data)    = 0;
+   hypre_ParAMGDataMaxIter(amg_data)    = HYPRE_AUTOTUNE_NUM_CYCLES;
+   hypre_ParAMGDataTol(amg_data)        = 0.0;
+
+   u0 = hypre_ParVectorCloneDeep_v2(u, hypre_ParVectorMemoryLocation(u));
+   r  = hypre_ParVectorCreate(comm, hypre_ParVectorGlobalSize(f), hypre_ParVectorPartitioning(f));
+   hypre_ParVectorInitialize_v2(r, hypre_ParVectorMemoryLocation(f));
+
+   hypre_ParCSRMatrixSetDNumNonzeros(A);
+
+   /* start from the current parameters */
+   best.strong_threshold = hypre_ParAMGDataStrongThreshold(amg_data);
+   best.coarsen_type     = hypre_ParAMGDataCoarsenType(amg_data);
+   best.interp_type      = hypre_ParAMGDataInterpType(amg_data);
+   best.P_max_elmts      = hypre_ParAMGDataPMaxElmts(amg_data);
+   best.agg_num_levels   = hypre_ParAMGDataAggNumLevels(amg_data);
+   best.relax_type       = hypre_ParAMGDataGridRelaxType(amg_data)[1];
+
+   if (print_level > 0 && my_id == 0)
+   {
+      hypre_printf("\nBoomerAMG autotuning (objective: time to reduce the residual by %e)\n\n",
+                   reduction);
+      hypre_printf("trial  str   coarsen interp Pmax agg relax    setup      cycle      rho    opc   objective\n");
+   }
+
+   best_time  = hypre_AMGAutotuneTrial(amg_vdata, &best, A, f, u, u0, r, coarse_relax_type,
+                                       coarse_num_sweeps, reduction, best_stats);
+   num_trials = 1;
+   if (print_level > 0 && my_id == 0)
+   {
+      hypre_printf("%5d  %.2f  %4d    %4d   %4d %3d  %3d/%-3d %.3e  %.3e  %.3f  %.2f  %.3e\n",
+                   num_trials, best.strong_threshold, best.coarsen_type, best.interp_type,
+                   best.P_max_elmts, best.agg_num_levels, best.relax_type,
+                   hypre_AMGAutotuneRelaxUp(best.relax_type), best_stats[0], best_stats[1],
+                   best_stats[2], best_stats[3], best_time);
+   }
+
+   /* coordinate descent, repeated while it improves */
+   improved = 1;
+   while (improved && (max_trials <= 0 || num_trials < max_trials))
+   {
+      improved = 0;
+      for (param = 0; param < HYPRE_AUTOTUNE_NUM_PARAMS; param++)
+      {
+         hypre_AMGAutotuneConfig param_best = best;
+
+         for (k = 0; k < hypre_autotune_num_values[param]; k++)
+         {
+            if (max_trials > 0 && num_trials >= max_trials)
+            {
+               break;
+            }
+
+            trial = best;
+            hypre_AMGAutotuneSetValue(&trial, param, k);
+            if (hypre_AMGAutotuneSame(&trial, &best))
+            {
+               continue;
+            }
+
+            trial_time = hypre_AMGAutotuneTrial(amg_vdata, &trial, A, f, u, u0, r,
+                                                coarse_relax_type, coarse_num_sweeps,
+                                                reduction, stats);
+            num_trials++;
+
+            if (print_level > 0 && my_id == 0)
+            {
+               hypre_printf("%5d  %.2f  %4d    %4d   %4d %3d  %3d/%-3d %.3e  %.3e  %.3f  %.2f  %.3e\n",
+                            num_trials, trial.strong_threshold, trial.coarsen_type,
+                            trial.interp_type, trial.P_max_elmts, trial.agg_num_levels,
+                            trial.relax_type, hypre_AMGAutotuneRelaxUp(trial.relax_type),
+                            stats[0], stats[1], stats[2], stats[3], trial_time);
+            }
+
+            if (trial_time < best_time)
+            {
+               best_time  = trial_time;
+               param_best = trial;
+               hypre_TMemcpy(best_stats, stats, HYPRE_Real, 4, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+               improved = 1;
+            }
+         }
+         best = param_best;
+      }
+
+      /* a full sweep only when the number of trials is not limited */
+      if (max_trials <= 0)
+      {
+         break;
+      }
+   }
+
+   /* restore the solver and set the best configuration */
+   hypre_AMGAutotuneApply(amg_vdata, &best);
+   hypre_ParAMGDataGridRelaxType(amg_data)[3] = coarse_relax_type;
+   hypre_ParAMGDataNumGridSweeps(amg_data)[3] = coarse_num_sweeps;
+   hypre_ParAMGDataPrintLevel(amg_data) = print_level;
+   hypre_ParAMGDataLogging(amg_data)    = logging;
+   hypre_ParAMGDataMaxIter(amg_data)    = max_iter;
+   hypre_ParAMGDataTol(amg_data)        = tol;
+
+   hypre_ParVectorCopy(u0, u);
+   hypre_ParVectorDestroy(u0);
+   hypre_ParVectorDestroy(r);
+
+   if (print_level > 0 && my_id == 0)
+   {
+      hypre_printf("\nbest: str %.2f coarsen %d interp %d Pmax %d agg %d relax %d/%d,"
+                   " estimated time %e after %d trials\n\n",
+                   best.strong_threshold, best.coarsen_type, best.interp_type, best.P_max_elmts,
+                   best.agg_num_levels, best.relax_type, hypre_AMGAutotuneRelaxUp(best.relax_type),
+                   best_time, num_trials);
+   }
+
+   if (filename && my_id == 0)
+   {
+      if ((fp = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Cannot open autotuning file!\n");
+      }
+      else
+      {
+         hypre_fprintf(fp, "# BoomerAMG autotuning result\n");
+         hypre_fprintf(fp, "# setup %e cycle %e rho %f opc %f objective %e\n",
+                       best_stats[0], best_stats[1], best_stats[2], best_stats[3], best_time);
+         hypre_fprintf(fp, "strong_threshold %.17g\n", best.strong_threshold);
+         hypre_fprintf(fp, "coarsen_type %d\n", best.coarsen_type);
+         hypre_fprintf(fp, "interp_type %d\n", best.interp_type);
+         hypre_fprintf(fp, "P_max_elmts %d\n", best.P_max_elmts);
+         hypre_fprintf(fp, "agg_num_levels %d\n", best.agg_num_levels);
+         hypre_fprintf(fp, "relax_type %d\n", best.relax_type);
+         fclose(fp);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReadAutotune
+ *
+ * Set the parameters from a file written by hypre_BoomerAMGAutotune.
+ * Every process reads the file.  Unknown keys are ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReadAutotune( void       *amg_vdata,
+                             const char *filename )
+{
+   hypre_ParAMGData        *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_AMGAutotuneConfig  config;
+   char                     line[256], key[64];
+   HYPRE_Real               value;
+   FILE                    *fp;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ((fp = fopen(filename, "r")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Cannot open autotuning file!\n");
+      return hypre_error_flag;
+   }
+
+   config.strong_threshold = hypre_ParAMGDataStrongThreshold(amg_data);
+   config.coarsen_type     = hypre_ParAMGDataCoarsenType(amg_data);
+   config.interp_type      = hypre_ParAMGDataInterpType(amg_data);
+   config.P_max_elmts      = hypre_ParAMGDataPMaxElmts(amg_data);
+   config.agg_num_levels   = hypre_ParAMGDataAggNumLevels(amg_data);
+   config.relax_type       = hypre_ParAMGDataGridRelaxType(amg_data) ?
+                             hypre_ParAMGDataGridRelaxType(amg_data)[1] : 13;
+
+   while (fgets(line, sizeof(line), fp))
+   {
+      if (line[0] == '#' || hypre_sscanf(line, "%63s %le", key, &value) != 2)
+      {
+         continue;
+      }
+      if (!strcmp(key, "strong_threshold"))    { config.strong_threshold = value; }
+      else if (!strcmp(key, "coarsen_type"))   { config.coarsen_type     = (HYPRE_Int) value; }
+      else if (!strcmp(key, "interp_type"))    { config.interp_type      = (HYPRE_Int) value; }
+      else if (!strcmp(key, "P_max_elmts"))    { config.P_max_elmts      = (HYPRE_Int) value; }
+      else if (!strcmp(key, "agg_num_levels")) { config.agg_num_levels   = (HYPRE_Int) value; }
+      else if (!strcmp(key, "relax_type"))     { config.relax_type       = (HYPRE_Int) value; }
+   }
+   fclose(fp);
+
+   hypre_AMGAutotuneApply(amg_vdata, &config);
+
+   return hypre_error_flag;
+}
@@ -123,6 +123,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       coarse_threshold = hypre_ParAMGDataMaxCoarseSize(amg_data);
    HYPRE_Int       min_coarse_size = hypre_ParAMGDataMinCoarseSize(amg_data);
    HYPRE_Int       seq_threshold = hypre_ParAMGDataSeqThreshold(amg_data);
+   HYPRE_Int       redist_threshold = hypre_ParAMGDataRedistThreshold(amg_data);
+   HYPRE_Int       redist_stride = 1;
    HYPRE_Int       j, k;
    HYPRE_Int       num_procs, my_id;
 #if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_HIP)
@@ -135,6 +137,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       nodal_diag = hypre_ParAMGDataNodalDiag(amg_data);
    HYPRE_Int       num_paths = hypre_ParAMGDataNumPaths(amg_data);
    HYPRE_Int       agg_num_levels = hypre_ParAMGDataAggNumLevels(amg_data);
+   HYPRE_Int       sa_num_levels = hypre_ParAMGDataSANumLevels(amg_data);
+   HYPRE_Real      sa_jacobi_weight = hypre_ParAMGDataSAJacobiWeight(amg_data);
+   HYPRE_Int       sa_level = 0;
+   HYPRE_BigInt   *sa_aggregates = NULL;
+   HYPRE_Int       sa_num_aggregates = 0;
+   HYPRE_BigInt    big_sa_num_aggregates;
+   HYPRE_Int       sa_num_vectors = 0;
+   HYPRE_Real     *sa_nullspace = NULL;
+   HYPRE_Real     *sa_coarse_nullspace = NULL;
+   hypre_IntArray *sa_coarse_dof_func = NULL;
    HYPRE_Int       agg_interp_type = hypre_ParAMGDataAggInterpType(amg_data);
    HYPRE_Int       sep_weight = hypre_ParAMGDataSepWeight(amg_data);
    hypre_IntArray *coarse_dof_func = NULL;
@@ -192,6 +204,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real *nongalerk_tol = hypre_ParAMGDataNonGalerkTol (amg_data);
    HYPRE_Real nongalerk_tol_l = 0.0;
    HYPRE_Real *nongal_tol_array = hypre_ParAMGDataNonGalTolArray (amg_data);
+   HYPRE_Real nongal_op_complexity = hypre_ParAMGDataNonGalOpComplexity(amg_data);
+   HYPRE_Real nongal_stencil_growth = hypre_ParAMGDataNonGalStencilGrowth(amg_data);
+   HYPRE_Real nongal_nnz_fine = 0.0;
+   HYPRE_Real nongal_nnz_used = 0.0;
 
    hypre_ParCSRBlockMatrix *A_H_block;
 
@@ -324,6 +340,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                         "WARNING: Changing to node-based coarsening because LN of GM interpolation has been specified via HYPRE_BoomerAMGSetInterpVecVariant.\n");
    }
 
+   /* smoothed aggregation takes the interpolation vectors as near-nullspace
+      vectors instead of expanding the interpolation with GM or LN */
+   if (sa_num_levels > 0)
+   {
+      interp_vec_variant = 0;
+   }
+
    /* Verify that settings are correct for solving systmes */
    /* If the user has specified either a block interpolation or a block relaxation then
       we need to make sure the other has been choosen as well  - so we can be
@@ -333,7 +356,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    /* probably should disable stuff like smooth num levels at some point */
 
 
-   if (grid_relax_type[0] >= 20) /* block relaxation choosen */
+   if (grid_relax_type[0] >= 20 && grid_relax_type[0] != 88) /* block relaxation choosen */
    {
 
       if (!((interp_type >= 20 && interp_type != 100) || interp_type == 11 || interp_type == 10 ) )
@@ -365,7 +388,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
       for (i = 0; i < 3; i++)
       {
-         if (grid_relax_type[i] < 20)
+         if (grid_relax_type[i] < 20 || grid_relax_type[i] == 88)
          {
             grid_relax_type[i] = 23;
          }
@@ -483,6 +506,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST);
+      if (hypre_ParAMGDataSparseDirectSolver(amg_data))
+      {
+         hypre_SparseDirectDestroy(hypre_ParAMGDataSparseDirectSolver(amg_data));
+         hypre_ParAMGDataSparseDirectSolver(amg_data) = NULL;
+      }
       hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
 
@@ -509,6 +538,18 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+      if (hypre_ParAMGDataColorStarts(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_IntArrayDestroy(hypre_ParAMGDataColorStarts(amg_data)[i]);
+            hypre_IntArrayDestroy(hypre_ParAMGDataColorRows(amg_data)[i]);
+            hypre_SeqVectorDestroy(hypre_ParAMGDataColorL1Norms(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataColorStarts(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorRows(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorL1Norms(amg_data), HYPRE_MEMORY_HOST);
+      }
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > old_num_levels - 1)
@@ -1081,12 +1122,26 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          }
 
+         /* smoothed aggregation replaces the C/F splitting and interpolation;
+            it is not combined with aggressive coarsening or user C/F points */
+         sa_level = (level < sa_num_levels && level >= agg_num_levels &&
+                     nodal > -1 && !block_mode && restri_type == 0 &&
+                     num_C_points_coarse == 0 && num_F_points == 0 &&
+                     num_isolated_F_points == 0 && hypre_ParAMGDataGSMG(amg_data) == 0);
+         if (!sa_level)
+         {
+            hypre_TFree(sa_nullspace, HYPRE_MEMORY_HOST);
+         }
+
          /**** Do the appropriate coarsening ****/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarsening");
 
          if (nodal == 0) /* no nodal coarsening */
          {
-            if (coarsen_type == 6)
+            if (sa_level)
+               hypre_BoomerAMGCoarsenAggregates(S, &(CF_marker_array[level]),
+                                                &sa_aggregates, &sa_num_aggregates);
+            else if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(S, A_array[level], measure_type,
                                              coarsen_cut_factor, debug_flag, &(CF_marker_array[level]));
             else if (coarsen_type == 7)
@@ -1319,7 +1374,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          else if (nodal > 0)
          {
-            if (coarsen_type == 6)
+            if (sa_level)
+               hypre_BoomerAMGCoarsenAggregates(SN, &CFN_marker,
+                                                &sa_aggregates, &sa_num_aggregates);
+            else if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(SN, SN, measure_type, coarsen_cut_factor,
                                              debug_flag, &CFN_marker);
             else if (coarsen_type == 7)
@@ -1407,6 +1465,48 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                SN = NULL;
                hypre_ParCSRMatrixDestroy(AN);
                AN = NULL;
+
+               /* the unknowns of a node belong to its aggregate */
+               if (sa_level)
+               {
+                  HYPRE_BigInt *node_aggregates = sa_aggregates;
+
+                  sa_aggregates = hypre_TAlloc(HYPRE_BigInt, local_num_vars, HYPRE_MEMORY_HOST);
+                  for (i = 0; i < local_num_vars; i++)
+                  {
+                     sa_aggregates[i] = node_aggregates[i / num_functions];
+                  }
+                  hypre_TFree(node_aggregates, HYPRE_MEMORY_HOST);
+               }
+            }
+         }
+
+         /* near-nullspace vectors: the constants of each function and, on
+            the first level, the interpolation vectors */
+         if (sa_level && !sa_nullspace)
+         {
+            sa_num_vectors = 1;
+            if (nodal > 0)
+            {
+               sa_num_vectors = num_functions + ((level == 0) ? num_interp_vectors : 0);
+            }
+            sa_nullspace = hypre_CTAlloc(HYPRE_Real, local_num_vars * sa_num_vectors,
+                                         HYPRE_MEMORY_HOST);
+            for (i = 0; i < local_num_vars; i++)
+            {
+               if (nodal > 0)
+               {
+                  sa_nullspace[i * sa_num_vectors + dof_func_data[i]] = 1.0;
+                  for (j = num_functions; j < sa_num_vectors; j++)
+                  {
+                     sa_nullspace[i * sa_num_vectors + j] =
+                        hypre_VectorData(hypre_ParVectorLocalVector(interp_vectors[j - num_functions]))[i];
+                  }
+               }
+               else
+               {
+                  sa_nullspace[i] = 1.0;
+               }
             }
          }
 
@@ -1497,6 +1597,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                           num_functions, dof_func_array[level], CF_marker_array[level],
                                           &coarse_dof_func, coarse_pnts_global);
             }
+            if (sa_level)
+            {
+               /* one coarse point per aggregate and near-nullspace vector */
+               big_sa_num_aggregates = (HYPRE_BigInt) sa_num_aggregates;
+               hypre_MPI_Scan(&big_sa_num_aggregates, &coarse_pnts_global[1], 1,
+                              HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+               coarse_pnts_global[0] = (coarse_pnts_global[1] - big_sa_num_aggregates) *
+                                       (HYPRE_BigInt) sa_num_vectors;
+               coarse_pnts_global[1] *= (HYPRE_BigInt) sa_num_vectors;
+            }
             if (my_id == (num_procs - 1))
             {
                coarse_size = coarse_pnts_global[1];
@@ -1509,7 +1619,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                HYPRE_Int *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
                HYPRE_Int **grid_relax_points = hypre_ParAMGDataGridRelaxPoints(amg_data);
                if (grid_relax_type[3] ==  9 || grid_relax_type[3] == 99 ||
-                   grid_relax_type[3] == 19 || grid_relax_type[3] == 98)
+                   grid_relax_type[3] == 19 || grid_relax_type[3] == 98 ||
+                   grid_relax_type[3] == 39)
                {
                   grid_relax_type[3] = grid_relax_type[0];
                   num_grid_sweeps[3] = 1;
@@ -1529,6 +1640,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   hypre_ParVectorDestroy(U_array[level]);
                }
                coarse_size = fine_size;
+               hypre_TFree(sa_aggregates, HYPRE_MEMORY_HOST);
 
                if (Sabs)
                {
@@ -1558,6 +1670,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   hypre_ParVectorDestroy(U_array[level]);
                }
                coarse_size = fine_size;
+               hypre_TFree(sa_aggregates, HYPRE_MEMORY_HOST);
 
                if (Sabs)
                {
@@ -2026,7 +2139,49 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
             if (debug_flag == 1) { wall_time = time_getWallclockSeconds(); }
 
-            if (interp_type == 4)
+            if (sa_level)
+            {
+               HYPRE_Int local_P_sz;
+
+               hypre_BoomerAMGBuildSAInterp(A_array[level], CF_marker, S, sa_aggregates,
+                                            sa_num_aggregates, num_functions, dof_func_data,
+                                            sa_num_vectors, sa_nullspace, sa_jacobi_weight,
+                                            debug_flag, trunc_factor, P_max_elmts, &P,
+                                            &sa_coarse_dof_func, &sa_coarse_nullspace);
+               hypre_TFree(sa_aggregates, HYPRE_MEMORY_HOST);
+               hypre_TFree(sa_nullspace, HYPRE_MEMORY_HOST);
+               sa_nullspace = sa_coarse_nullspace;
+
+               /* the coarse functions are the near-nullspace vectors */
+               hypre_IntArrayDestroy(coarse_dof_func);
+               coarse_dof_func = sa_coarse_dof_func;
+               if (nodal > 0)
+               {
+                  num_functions = sa_num_vectors;
+               }
+
+               /* with more near-nullspace vectors than functions, A can get
+                  bigger - if so, need to fix the temporary vectors */
+               local_P_sz = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(P));
+               if (hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) < local_P_sz)
+               {
+                  hypre_ParVector *temp_vecs[4] = {Vtemp, Ztemp, Ptemp, Rtemp};
+                  hypre_Vector    *temp_local;
+
+                  for (j = 0; j < 4; j++)
+                  {
+                     if (temp_vecs[j])
+                     {
+                        temp_local = hypre_ParVectorLocalVector(temp_vecs[j]);
+                        hypre_TFree(hypre_VectorData(temp_local), memory_location);
+                        hypre_VectorSize(temp_local) = local_P_sz;
+                        hypre_VectorData(temp_local) = hypre_CTAlloc(HYPRE_Complex, local_P_sz,
+                                                                     memory_location);
+                     }
+                  }
+               }
+            }
+            else if (interp_type == 4)
             {
                hypre_BoomerAMGBuildMultipass(A_array[level], CF_marker,
                                              S, coarse_pnts_global, num_functions, dof_func_data,
@@ -2337,7 +2492,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_Int    **grid_relax_points =
             hypre_ParAMGDataGridRelaxPoints(amg_data);
          if (grid_relax_type[3] == 9 || grid_relax_type[3] == 99
-             || grid_relax_type[3] == 19 || grid_relax_type[3] == 98)
+             || grid_relax_type[3] == 19 || grid_relax_type[3] == 98
+             || grid_relax_type[3] == 39)
          {
             grid_relax_type[3] = grid_relax_type[0];
             num_grid_sweeps[3] = 1;
@@ -2761,6 +2917,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          else
          {
+            /* move the coarse level onto fewer processes */
+            if (redist_threshold > 0 && num_functions == 1 &&
+                num_C_points_coarse == 0 && interp_vec_variant == 0)
+            {
+               hypre_BoomerAMGRedistributeCoarse(&P, restri_type ? &R : NULL,
+                                                 redist_threshold, &redist_stride);
+            }
+
             P_array[level] = P;
             /* RL: save R matrix */
             if (restri_type)
@@ -2938,6 +3102,42 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       if (!block_mode)
       {
+         /* automatic non-Galerkin sparsification of A_H for scalar problems,
+            unless a drop tolerance was given for this level */
+         if ((nongal_op_complexity > 0.0 || nongal_stencil_growth > 0.0) &&
+             nongalerk_tol_l == 0.0 && num_functions == 1)
+         {
+            HYPRE_Real max_nnz = -1.0, budget, ratio, droptol;
+
+            if (nongal_nnz_fine == 0.0)
+            {
+               hypre_ParCSRMatrixSetDNumNonzeros(A_array[0]);
+               nongal_nnz_fine = hypre_ParCSRMatrixDNumNonzeros(A_array[0]);
+               nongal_nnz_used = nongal_nnz_fine;
+            }
+
+            /* the coarser levels are assumed to shrink like this one */
+            if (nongal_op_complexity > 0.0)
+            {
+               ratio  = (HYPRE_Real) coarse_size / (HYPRE_Real) fine_size;
+               budget = hypre_max(nongal_op_complexity * nongal_nnz_fine - nongal_nnz_used, 0.0);
+               max_nnz = budget * (1.0 - ratio);
+            }
+            if (nongal_stencil_growth > 0.0)
+            {
+               budget = nongal_stencil_growth * nongal_nnz_fine * (HYPRE_Real) coarse_size /
+                        (HYPRE_Real) hypre_ParCSRMatrixGlobalNumRows(A_array[0]);
+               max_nnz = (max_nnz < 0.0) ? budget : hypre_min(max_nnz, budget);
+            }
+
+            hypre_BoomerAMGSparsifyCoarseOperator(A_H, max_nnz, 0.1, &droptol);
+            if (debug_flag == 1 && my_id == 0)
+            {
+               hypre_printf("Level = %d    Non-Galerkin sparsification drop tolerance = %e\n",
+                            level, droptol);
+            }
+         }
+
          /* dropping in A_H */
          hypre_ParCSRMatrixDropSmallEntries(A_H, hypre_ParAMGDataADropTol(amg_data),
                                             hypre_ParAMGDataADropType(amg_data));
@@ -2953,6 +3153,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_ParCSRMatrixSetDNumNonzeros(A_H);
          }
          A_array[level] = A_H;
+         nongal_nnz_used += hypre_ParCSRMatrixDNumNonzeros(A_H);
       }
 
       size = ((HYPRE_Real) fine_size ) * .75;
@@ -2972,6 +3173,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
+   hypre_TFree(sa_nullspace, HYPRE_MEMORY_HOST);
    HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
 
    /* redundant coarse grid solve */
@@ -3004,6 +3206,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          grid_relax_type[3] = grid_relax_type[1];
       }
    }
+   else if (grid_relax_type[3] == 39) /* sparse direct solver on coarsest level */
+   {
+      if (coarse_size <= coarse_threshold)
+      {
+         void *sparse_direct_solver;
+         hypre_SparseDirectSetup(&sparse_direct_solver, A_array[level], amg_print_level);
+         hypre_ParAMGDataSparseDirectSolver(amg_data) = sparse_direct_solver;
+      }
+      else
+      {
+         grid_relax_type[3] = grid_relax_type[1];
+      }
+   }
    else if (grid_relax_type[3] == 19 ||
             grid_relax_type[3] == 98)  /*use of Gaussian elimination on coarsest level */
    {
@@ -3078,6 +3293,18 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataL1Norms(amg_data) = l1_norms;
    }
 
+   /* multicolor Gauss-Seidel */
+   if (grid_relax_type[1] == 88 || grid_relax_type[2] == 88 || grid_relax_type[3] == 88)
+   {
+      hypre_ParAMGDataColorStarts(amg_data) = hypre_CTAlloc(hypre_IntArray *, num_levels,
+                                                            HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataColorRows(amg_data) = hypre_CTAlloc(hypre_IntArray *, num_levels,
+                                                          HYPRE_MEMORY_HOST);
+      /* separate from l1_norms, which other smoothers of the level may use */
+      hypre_ParAMGDataColorL1Norms(amg_data) = hypre_CTAlloc(hypre_Vector *, num_levels,
+                                                             HYPRE_MEMORY_HOST);
+   }
+
    /* Chebyshev */
    if (grid_relax_type[0] == 16 || grid_relax_type[1] == 16 ||
        grid_relax_type[2] == 16 || grid_relax_type[3] == 16)
@@ -3235,6 +3462,22 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(j);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
 
+      if ((j < num_levels - 1 && (grid_relax_type[1] == 88 || grid_relax_type[2] == 88)) ||
+          (j == num_levels - 1 && grid_relax_type[3] == 88))
+      {
+         HYPRE_Real *l1_norm_data = NULL;
+
+         hypre_BoomerAMGMulticolorSetup(A_array[j],
+                                        &hypre_ParAMGDataColorStarts(amg_data)[j],
+                                        &hypre_ParAMGDataColorRows(amg_data)[j],
+                                        &l1_norm_data);
+
+         hypre_ParAMGDataColorL1Norms(amg_data)[j] =
+            hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[j]));
+         hypre_VectorData(hypre_ParAMGDataColorL1Norms(amg_data)[j]) = l1_norm_data;
+         hypre_SeqVectorInitialize_v2(hypre_ParAMGDataColorL1Norms(amg_data)[j], HYPRE_MEMORY_HOST);
+      }
+
       if (grid_relax_type[1] == 7 || grid_relax_type[2] == 7 || (grid_relax_type[3] == 7 &&
                                                                  j == (num_levels - 1)))
       {
@@ -63,6 +63,10 @@ hypre_AMGDDCompGridMatrix* hypre_AMGDDCompGridMatrixCreate()
    hypre_AMGDDCompGridMatrixRealReal(matrix)  = NULL;
    hypre_AMGDDCompGridMatrixRealGhost(matrix) = NULL;
 
+   hypre_AMGDDCompGridMatrixComposite(matrix)     = NULL;
+   hypre_AMGDDCompGridMatrixCompositeMap(matrix)  = NULL;
+   hypre_AMGDDCompGridMatrixCompositeWork(matrix) = NULL;
+
    hypre_AMGDDCompGridMatrixOwnsOwnedMatrices(matrix)  = 0;
    hypre_AMGDDCompGridMatrixOwnsOffdColIndices(matrix) = 0;
 
@@ -94,6 +98,9 @@ hypre_AMGDDCompGridMatrixDestroy( hypre_AMGDDCompGridMatrix *matrix )
       hypre_CSRMatrixDestroy(hypre_AMGDDCompGridMatrixNonOwnedOffd(matrix));
       hypre_CSRMatrixDestroy(hypre_AMGDDCompGridMatrixRealReal(matrix));
       hypre_CSRMatrixDestroy(hypre_AMGDDCompGridMatrixRealGhost(matrix));
+      hypre_CSRMatrixDestroy(hypre_AMGDDCompGridMatrixComposite(matrix));
+      hypre_TFree(hypre_AMGDDCompGridMatrixCompositeMap(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCompGridMatrixCompositeWork(matrix), HYPRE_MEMORY_HOST);
 
       hypre_TFree(matrix, HYPRE_MEMORY_HOST);
    }
@@ -162,6 +169,229 @@ hypre_AMGDDCompGridMatrixSetupRealMatvec( hypre_AMGDDCompGridMatrix *A )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMGDDCompGridMatrixSetupComposite
+ *
+ * Merges the four blocks of A into one CSR matrix on the composite grid.
+ * The rows are the owned rows followed by the nonowned rows.  The columns
+ * are the owned nodes followed by the nonowned nodes in the order in which
+ * a breadth-first traversal starting from the owned nodes reaches them, so
+ * that nonowned nodes are stored next to the nodes they are coupled to.
+ * Within each row, the diag entries come before the offd entries as in
+ * the blocks, so row sums are accumulated in the same order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AMGDDCompGridMatrixSetupComposite( hypre_AMGDDCompGridMatrix *A,
+                                         HYPRE_Int                  num_owned,
+                                         HYPRE_Int                  num_nonowned )
+{
+   hypre_CSRMatrix  *owned_diag    = hypre_AMGDDCompGridMatrixOwnedDiag(A);
+   hypre_CSRMatrix  *owned_offd    = hypre_AMGDDCompGridMatrixOwnedOffd(A);
+   hypre_CSRMatrix  *nonowned_diag = hypre_AMGDDCompGridMatrixNonOwnedDiag(A);
+   hypre_CSRMatrix  *nonowned_offd = hypre_AMGDDCompGridMatrixNonOwnedOffd(A);
+
+   HYPRE_Int        *od_i    = hypre_CSRMatrixI(owned_diag);
+   HYPRE_Int        *od_j    = hypre_CSRMatrixJ(owned_diag);
+   HYPRE_Complex    *od_data = hypre_CSRMatrixData(owned_diag);
+   HYPRE_Int        *oo_i    = NULL, *oo_j = NULL;
+   HYPRE_Int        *nd_i    = NULL, *nd_j = NULL;
+   HYPRE_Int        *no_i    = NULL, *no_j = NULL;
+   HYPRE_Complex    *oo_data = NULL, *nd_data = NULL, *no_data = NULL;
+
+   hypre_CSRMatrix  *composite;
+   HYPRE_Int        *C_i, *C_j;
+   HYPRE_Complex    *C_data;
+   HYPRE_Int        *map, *order;
+   HYPRE_Int         num_rows = num_owned + num_nonowned;
+   HYPRE_Int         num_ordered, next, head;
+   HYPRE_Int         i, k, jj, cnt;
+
+   if (num_nonowned)
+   {
+      if (!owned_offd || !nonowned_diag || !nonowned_offd)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Missing nonowned blocks of composite grid matrix!\n");
+         return hypre_error_flag;
+      }
+
+      oo_i    = hypre_CSRMatrixI(owned_offd);
+      oo_j    = hypre_CSRMatrixJ(owned_offd);
+      oo_data = hypre_CSRMatrixData(owned_offd);
+      nd_i    = hypre_CSRMatrixI(nonowned_diag);
+      nd_j    = hypre_CSRMatrixJ(nonowned_diag);
+      nd_data = hypre_CSRMatrixData(nonowned_diag);
+      no_i    = hypre_CSRMatrixI(nonowned_offd);
+      no_j    = hypre_CSRMatrixJ(nonowned_offd);
+      no_data = hypre_CSRMatrixData(nonowned_offd);
+   }
+
+   hypre_CSRMatrixDestroy(hypre_AMGDDCompGridMatrixComposite(A));
+   hypre_TFree(hypre_AMGDDCompGridMatrixCompositeMap(A), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AMGDDCompGridMatrixCompositeWork(A), HYPRE_MEMORY_HOST);
+
+   // Order the nonowned nodes breadth-first, starting from the owned nodes
+   map   = hypre_TAlloc(HYPRE_Int, num_nonowned, HYPRE_MEMORY_HOST);
+   order = hypre_TAlloc(HYPRE_Int, num_nonowned, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_nonowned; k++)
+   {
+      map[k] = -1;
+   }
+
+   num_ordered = 0;
+   for (i = 0; i < num_owned && num_nonowned; i++)
+   {
+      for (jj = oo_i[i]; jj < oo_i[i + 1]; jj++)
+      {
+         k = oo_j[jj];
+         if (map[k] < 0)
+         {
+            map[k] = num_owned + num_ordered;
+            order[num_ordered++] = k;
+         }
+      }
+   }
+
+   next = 0;
+   for (head = 0; head < num_nonowned; head++)
+   {
+      // Nodes not reached so far start a new traversal
+      if (head == num_ordered)
+      {
+         while (map[next] >= 0)
+         {
+            next++;
+         }
+         map[next] = num_owned + num_ordered;
+         order[num_ordered++] = next;
+      }
+
+      for (jj = nd_i[order[head]]; jj < nd_i[order[head] + 1]; jj++)
+      {
+         k = nd_j[jj];
+         if (map[k] < 0)
+         {
+            map[k] = num_owned + num_ordered;
+            order[num_ordered++] = k;
+         }
+      }
+   }
+   hypre_TFree(order, HYPRE_MEMORY_HOST);
+
+   // Row pointers of the merged matrix
+   C_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   C_i[0] = 0;
+   for (i = 0; i < num_owned; i++)
+   {
+      cnt = od_i[i + 1] - od_i[i];
+      if (num_nonowned)
+      {
+         cnt += oo_i[i + 1] - oo_i[i];
+      }
+      C_i[i + 1] = C_i[i] + cnt;
+   }
+   for (k = 0; k < num_nonowned; k++)
+   {
+      C_i[num_owned + k + 1] = C_i[num_owned + k] +
+                               (nd_i[k + 1] - nd_i[k]) + (no_i[k + 1] - no_i[k]);
+   }
+
+   composite = hypre_CSRMatrixCreate(num_rows, num_rows, C_i[num_rows]);
+   hypre_CSRMatrixI(composite) = C_i;
+   hypre_CSRMatrixInitialize_v2(composite, 0, HYPRE_MEMORY_HOST);
+   C_j    = hypre_CSRMatrixJ(composite);
+   C_data = hypre_CSRMatrixData(composite);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,jj,cnt) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_owned; i++)
+   {
+      cnt = C_i[i];
+      for (jj = od_i[i]; jj < od_i[i + 1]; jj++)
+      {
+         C_j[cnt]      = od_j[jj];
+         C_data[cnt++] = od_data[jj];
+      }
+      if (num_nonowned)
+      {
+         for (jj = oo_i[i]; jj < oo_i[i + 1]; jj++)
+         {
+            C_j[cnt]      = map[oo_j[jj]];
+            C_data[cnt++] = oo_data[jj];
+         }
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k,jj,cnt) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_nonowned; k++)
+   {
+      cnt = C_i[num_owned + k];
+      for (jj = nd_i[k]; jj < nd_i[k + 1]; jj++)
+      {
+         C_j[cnt]      = map[nd_j[jj]];
+         C_data[cnt++] = nd_data[jj];
+      }
+      for (jj = no_i[k]; jj < no_i[k + 1]; jj++)
+      {
+         C_j[cnt]      = no_j[jj];
+         C_data[cnt++] = no_data[jj];
+      }
+   }
+
+   hypre_AMGDDCompGridMatrixComposite(A)     = composite;
+   hypre_AMGDDCompGridMatrixCompositeMap(A)  = map;
+   hypre_AMGDDCompGridMatrixCompositeWork(A) = hypre_TAlloc(HYPRE_Complex, num_rows,
+                                                            HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGDDCompGridMatrixCompositeGather
+ *
+ * Copies x into the composite grid work vector of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AMGDDCompGridMatrixCompositeGather( hypre_AMGDDCompGridMatrix *A,
+                                          hypre_AMGDDCompGridVector *x )
+{
+   HYPRE_Int      num_owned    = hypre_CSRMatrixNumRows(hypre_AMGDDCompGridMatrixOwnedDiag(A));
+   HYPRE_Int      num_nonowned = hypre_CSRMatrixNumRows(hypre_AMGDDCompGridMatrixComposite(A)) -
+                                 num_owned;
+   HYPRE_Int     *map          = hypre_AMGDDCompGridMatrixCompositeMap(A);
+   HYPRE_Complex *work         = hypre_AMGDDCompGridMatrixCompositeWork(A);
+   HYPRE_Complex *x_owned      = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(x));
+   HYPRE_Complex *x_nonowned   = NULL;
+   HYPRE_Int      i;
+
+   if (num_nonowned)
+   {
+      x_nonowned = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(x));
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_owned; i++)
+   {
+      work[i] = x_owned[i];
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonowned; i++)
+   {
+      work[map[i]] = x_nonowned[i];
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_AMGDDCompGridMatvec( HYPRE_Complex alpha,
                            hypre_AMGDDCompGridMatrix *A,
@@ -179,6 +409,59 @@ hypre_AMGDDCompGridMatvec( HYPRE_Complex alpha,
    hypre_Vector *y_owned    = hypre_AMGDDCompGridVectorOwned(y);
    hypre_Vector *y_nonowned = hypre_AMGDDCompGridVectorNonOwned(y);
 
+   hypre_CSRMatrix *composite     = hypre_AMGDDCompGridMatrixComposite(A);
+   HYPRE_Int       *C_i, *C_j;
+   HYPRE_Complex   *C_data, *work, *y_data;
+   HYPRE_Complex    temp;
+   HYPRE_Int        num_owned, num_nonowned, i, jj;
+
+   // Single pass over the rows of the merged matrix if available
+   if (composite)
+   {
+      C_i          = hypre_CSRMatrixI(composite);
+      C_j          = hypre_CSRMatrixJ(composite);
+      C_data       = hypre_CSRMatrixData(composite);
+      work         = hypre_AMGDDCompGridMatrixCompositeWork(A);
+      num_owned    = hypre_CSRMatrixNumRows(owned_diag);
+      num_nonowned = hypre_CSRMatrixNumRows(composite) - num_owned;
+
+      hypre_AMGDDCompGridMatrixCompositeGather(A, x);
+
+      y_data = hypre_VectorData(y_owned);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,jj,temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_owned; i++)
+      {
+         temp = 0.0;
+         for (jj = C_i[i]; jj < C_i[i + 1]; jj++)
+         {
+            temp += C_data[jj] * work[C_j[jj]];
+         }
+         y_data[i] = (beta == 0.0) ? alpha * temp : alpha * temp + beta * y_data[i];
+      }
+
+      if (num_nonowned)
+      {
+         C_i += num_owned;
+         y_data = hypre_VectorData(y_nonowned);
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i,jj,temp) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_nonowned; i++)
+         {
+            temp = 0.0;
+            for (jj = C_i[i]; jj < C_i[i + 1]; jj++)
+            {
+               temp += C_data[jj] * work[C_j[jj]];
+            }
+            y_data[i] = (beta == 0.0) ? alpha * temp : alpha * temp + beta * y_data[i];
+         }
+      }
+
+      return hypre_error_flag;
+   }
+
    hypre_CSRMatrixMatvec(alpha, owned_diag, x_owned, beta, y_owned);
 
    if (owned_offd)
@@ -866,6 +1149,20 @@ HYPRE_Int hypre_AMGDDCompGridSetupRelax( hypre_ParAMGDDData *amgdd_data )
       }
    }
 
+   // Merged composite grid matrices for the host kernels
+   for (level = hypre_ParAMGDDDataStartLevel(amgdd_data); level < hypre_ParAMGDataNumLevels(amg_data);
+        level++)
+   {
+      compGrid = hypre_ParAMGDDDataCompGrid(amgdd_data)[level];
+
+      if (hypre_GetExecPolicy1(hypre_AMGDDCompGridMemoryLocation(compGrid)) == HYPRE_EXEC_HOST)
+      {
+         hypre_AMGDDCompGridMatrixSetupComposite(hypre_AMGDDCompGridA(compGrid),
+                                                 hypre_AMGDDCompGridNumOwnedNodes(compGrid),
+                                                 hypre_AMGDDCompGridNumNonOwnedNodes(compGrid));
+      }
+   }
+
    return hypre_error_flag;
 }
 
@@ -2015,6 +2312,39 @@ HYPRE_Int hypre_AMGDDCommPkgDestroy ( hypre_AMGDDCommPkg *amgddCommPkg )
 {
    HYPRE_Int  i, j, k;
 
+   if ( hypre_AMGDDCommPkgResRequests(amgddCommPkg) )
+   {
+      for (i = 0; i < hypre_AMGDDCommPkgNumLevels(amgddCommPkg); i++)
+      {
+         if (hypre_AMGDDCommPkgResRequests(amgddCommPkg)[i])
+         {
+            for (j = 0; j < hypre_AMGDDCommPkgNumSendProcs(amgddCommPkg)[i] +
+                 hypre_AMGDDCommPkgNumRecvProcs(amgddCommPkg)[i]; j++)
+            {
+               hypre_MPI_Request_free(&(hypre_AMGDDCommPkgResRequests(amgddCommPkg)[i][j]));
+            }
+         }
+         hypre_TFree(hypre_AMGDDCommPkgResRequests(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AMGDDCommPkgResSendBuffer(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AMGDDCommPkgResRecvBuffer(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AMGDDCommPkgResPackStarts(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AMGDDCommPkgResPackPos(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AMGDDCommPkgResPackElmts(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AMGDDCommPkgResUnpackStarts(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AMGDDCommPkgResUnpackPos(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_AMGDDCommPkgResUnpackElmts(amgddCommPkg)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_AMGDDCommPkgResRequests(amgddCommPkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCommPkgResSendBuffer(amgddCommPkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCommPkgResRecvBuffer(amgddCommPkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCommPkgResPackStarts(amgddCommPkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCommPkgResPackPos(amgddCommPkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCommPkgResPackElmts(amgddCommPkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCommPkgResUnpackStarts(amgddCommPkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCommPkgResUnpackPos(amgddCommPkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AMGDDCommPkgResUnpackElmts(amgddCommPkg), HYPRE_MEMORY_HOST);
+   }
+
    if ( hypre_AMGDDCommPkgSendProcs(amgddCommPkg) )
    {
       for (i = 0; i < hypre_AMGDDCommPkgNumLevels(amgddCommPkg); i++)
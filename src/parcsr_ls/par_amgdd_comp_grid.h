@@ -33,6 +33,17 @@ typedef struct
    ****recv_map; // mapping from recv buffer to appropriate local indices on each comp grid
    HYPRE_Int       ****recv_red_marker; // marker indicating a redundant recv
 
+   // Persistent residual communication, set up once the composite grids are finalized
+   hypre_MPI_Request **res_requests;      // recv requests followed by send requests on each level
+   HYPRE_Complex     **res_send_buffer;   // send buffer on each level, procs one after the other
+   HYPRE_Complex     **res_recv_buffer;   // recv buffer on each level, procs one after the other
+   HYPRE_Int         **res_pack_starts;   // owned and nonowned nodes of each composite level to pack
+   HYPRE_Int         **res_pack_pos;      // send buffer positions of the nodes to pack
+   HYPRE_Int         **res_pack_elmts;    // local indices of the nodes to pack
+   HYPRE_Int         **res_unpack_starts; // nodes of each composite level to unpack
+   HYPRE_Int         **res_unpack_pos;    // recv buffer positions of the nodes to unpack
+   HYPRE_Int         **res_unpack_elmts;  // nonowned local indices of the nodes to unpack
+
 } hypre_AMGDDCommPkg;
 
 /*--------------------------------------------------------------------------
@@ -51,6 +62,15 @@ typedef struct
 #define hypre_AMGDDCommPkgSendFlag(compGridCommPkg)       ((compGridCommPkg) -> send_flag)
 #define hypre_AMGDDCommPkgRecvMap(compGridCommPkg)        ((compGridCommPkg) -> recv_map)
 #define hypre_AMGDDCommPkgRecvRedMarker(compGridCommPkg)  ((compGridCommPkg) -> recv_red_marker)
+#define hypre_AMGDDCommPkgResRequests(compGridCommPkg)     ((compGridCommPkg) -> res_requests)
+#define hypre_AMGDDCommPkgResSendBuffer(compGridCommPkg)   ((compGridCommPkg) -> res_send_buffer)
+#define hypre_AMGDDCommPkgResRecvBuffer(compGridCommPkg)   ((compGridCommPkg) -> res_recv_buffer)
+#define hypre_AMGDDCommPkgResPackStarts(compGridCommPkg)   ((compGridCommPkg) -> res_pack_starts)
+#define hypre_AMGDDCommPkgResPackPos(compGridCommPkg)      ((compGridCommPkg) -> res_pack_pos)
+#define hypre_AMGDDCommPkgResPackElmts(compGridCommPkg)    ((compGridCommPkg) -> res_pack_elmts)
+#define hypre_AMGDDCommPkgResUnpackStarts(compGridCommPkg) ((compGridCommPkg) -> res_unpack_starts)
+#define hypre_AMGDDCommPkgResUnpackPos(compGridCommPkg)    ((compGridCommPkg) -> res_unpack_pos)
+#define hypre_AMGDDCommPkgResUnpackElmts(compGridCommPkg)  ((compGridCommPkg) -> res_unpack_elmts)
 
 /*--------------------------------------------------------------------------
  * AMGDDCompGridMatrix (basically a coupled collection of CSR matrices)
@@ -67,6 +87,10 @@ typedef struct
    hypre_CSRMatrix      *real_real;  // Domain: nonowned real. Range: nonowned real.
    hypre_CSRMatrix      *real_ghost; // Domain: nonowned ghost. Range: nonowned real.
 
+   hypre_CSRMatrix      *composite;      // Domain: composite grid. Range: composite grid.
+   HYPRE_Int            *composite_map;  // Composite grid index of each nonowned node
+   HYPRE_Complex        *composite_work; // Vector on the composite grid
+
    HYPRE_Int             owns_owned_matrices;
    HYPRE_Int             owns_offd_col_indices;
 
@@ -82,6 +106,9 @@ typedef struct
 #define hypre_AMGDDCompGridMatrixNonOwnedOffd(matrix)       ((matrix) -> nonowned_offd)
 #define hypre_AMGDDCompGridMatrixRealReal(matrix)           ((matrix) -> real_real)
 #define hypre_AMGDDCompGridMatrixRealGhost(matrix)          ((matrix) -> real_ghost)
+#define hypre_AMGDDCompGridMatrixComposite(matrix)          ((matrix) -> composite)
+#define hypre_AMGDDCompGridMatrixCompositeMap(matrix)       ((matrix) -> composite_map)
+#define hypre_AMGDDCompGridMatrixCompositeWork(matrix)      ((matrix) -> composite_work)
 #define hypre_AMGDDCompGridMatrixOwnsOwnedMatrices(matrix)  ((matrix) -> owns_owned_matrices)
 #define hypre_AMGDDCompGridMatrixOwnsOffdColIndices(matrix) ((matrix) -> owns_offd_col_indices)
 
@@ -249,8 +249,19 @@ hypre_BoomerAMGDD_FAC_JacobiHost( void      *amgdd_vdata,
    hypre_AMGDDCompGridVector  *f = hypre_AMGDDCompGridF(compGrid);
    hypre_AMGDDCompGridVector  *u = hypre_AMGDDCompGridU(compGrid);
 
+   HYPRE_Int                   num_owned  = hypre_AMGDDCompGridNumOwnedNodes(compGrid);
+   HYPRE_Int                   num_real   = hypre_AMGDDCompGridNumNonOwnedRealNodes(compGrid);
+   HYPRE_Complex              *u_owned    = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(u));
+   HYPRE_Complex              *u_nonowned = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(u));
+   HYPRE_Complex              *f_owned    = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(f));
+   HYPRE_Complex              *f_nonowned = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(f));
+
    hypre_CSRMatrix            *diag;
    HYPRE_Int                   total_real_nodes;
+   HYPRE_Int                  *A_i, *A_j;
+   HYPRE_Complex              *A_data, *u_tmp;
+   HYPRE_Real                 *l1_norms;
+   HYPRE_Real                  res;
    HYPRE_Int                   i, j;
 
    // Calculate l1_norms if necessary (right now, I'm just using this vector for the diagonal of A and doing straight ahead Jacobi)
@@ -289,31 +300,44 @@ hypre_BoomerAMGDD_FAC_JacobiHost( void      *amgdd_vdata,
       }
    }
 
-   // Allocate temporary vector if necessary
-   if (!hypre_AMGDDCompGridTemp2(compGrid))
+   l1_norms = hypre_AMGDDCompGridL1Norms(compGrid);
+
+   if (!hypre_AMGDDCompGridMatrixComposite(A))
    {
-      hypre_AMGDDCompGridTemp2(compGrid) = hypre_AMGDDCompGridVectorCreate();
-      hypre_AMGDDCompGridVectorInitialize(hypre_AMGDDCompGridTemp2(compGrid),
-                                          hypre_AMGDDCompGridNumOwnedNodes(compGrid),
-                                          hypre_AMGDDCompGridNumNonOwnedNodes(compGrid),
-                                          hypre_AMGDDCompGridNumNonOwnedRealNodes(compGrid));
+      hypre_AMGDDCompGridMatrixSetupComposite(A, num_owned,
+                                              hypre_AMGDDCompGridNumNonOwnedNodes(compGrid));
    }
+   A_i    = hypre_CSRMatrixI(hypre_AMGDDCompGridMatrixComposite(A));
+   A_j    = hypre_CSRMatrixJ(hypre_AMGDDCompGridMatrixComposite(A));
+   A_data = hypre_CSRMatrixData(hypre_AMGDDCompGridMatrixComposite(A));
+   hypre_AMGDDCompGridMatrixCompositeGather(A, u);
+   u_tmp  = hypre_AMGDDCompGridMatrixCompositeWork(A);
 
-   hypre_AMGDDCompGridVectorCopy(f, hypre_AMGDDCompGridTemp2(compGrid));
-
-   hypre_AMGDDCompGridMatvec(-relax_weight, A, u, relax_weight, hypre_AMGDDCompGridTemp2(compGrid));
-
-   for (i = 0; i < hypre_AMGDDCompGridNumOwnedNodes(compGrid); i++)
+   // u += w D^{-1} (f - A u), one pass over the rows of the composite grid
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,j,res) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_owned; i++)
    {
-      hypre_VectorData(hypre_AMGDDCompGridVectorOwned(u))[i] +=
-         hypre_VectorData(hypre_AMGDDCompGridVectorOwned(hypre_AMGDDCompGridTemp2(compGrid)))[i] /
-         hypre_AMGDDCompGridL1Norms(compGrid)[i];
+      res = f_owned[i];
+      for (j = A_i[i]; j < A_i[i + 1]; j++)
+      {
+         res -= A_data[j] * u_tmp[A_j[j]];
+      }
+      u_owned[i] += relax_weight * res / l1_norms[i];
    }
-   for (i = 0; i < hypre_AMGDDCompGridNumNonOwnedRealNodes(compGrid); i++)
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,j,res) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_real; i++)
    {
-      hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(u))[i] +=
-         hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(hypre_AMGDDCompGridTemp2(compGrid)))[i] /
-         hypre_AMGDDCompGridL1Norms(compGrid)[i + hypre_AMGDDCompGridNumOwnedNodes(compGrid)];
+      res = f_nonowned[i];
+      for (j = A_i[num_owned + i]; j < A_i[num_owned + i + 1]; j++)
+      {
+         res -= A_data[j] * u_tmp[A_j[j]];
+      }
+      u_nonowned[i] += relax_weight * res / l1_norms[num_owned + i];
    }
 
    return hypre_error_flag;
@@ -324,97 +348,96 @@ hypre_BoomerAMGDD_FAC_GaussSeidel( void      *amgdd_vdata,
                                    HYPRE_Int  level,
                                    HYPRE_Int  cycle_param )
 {
-   hypre_ParAMGDDData    *amgdd_data = (hypre_ParAMGDDData*) amgdd_vdata;
-   hypre_AMGDDCompGrid   *compGrid   = hypre_ParAMGDDDataCompGrid(amgdd_data)[level];
+   hypre_ParAMGDDData         *amgdd_data = (hypre_ParAMGDDData*) amgdd_vdata;
+   hypre_AMGDDCompGrid        *compGrid   = hypre_ParAMGDDDataCompGrid(amgdd_data)[level];
 
-   hypre_AMGDDCompGridMatrix      *A = hypre_AMGDDCompGridA(compGrid);
-   hypre_AMGDDCompGridVector      *f = hypre_AMGDDCompGridF(compGrid);
-   hypre_AMGDDCompGridVector      *u = hypre_AMGDDCompGridU(compGrid);
+   hypre_AMGDDCompGridMatrix  *A = hypre_AMGDDCompGridA(compGrid);
+   hypre_AMGDDCompGridVector  *f = hypre_AMGDDCompGridF(compGrid);
+   hypre_AMGDDCompGridVector  *u = hypre_AMGDDCompGridU(compGrid);
 
-   hypre_CSRMatrix  *owned_diag      = hypre_AMGDDCompGridMatrixOwnedDiag(A);
-   hypre_CSRMatrix  *owned_offd      = hypre_AMGDDCompGridMatrixOwnedOffd(A);
-   hypre_CSRMatrix  *nonowned_diag   = hypre_AMGDDCompGridMatrixNonOwnedDiag(A);
-   hypre_CSRMatrix  *nonowned_offd   = hypre_AMGDDCompGridMatrixNonOwnedOffd(A);
+   HYPRE_Int         num_owned       = hypre_AMGDDCompGridNumOwnedNodes(compGrid);
+   HYPRE_Int         num_real        = hypre_AMGDDCompGridNumNonOwnedRealNodes(compGrid);
    HYPRE_Complex    *u_owned_data    = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(u));
    HYPRE_Complex    *u_nonowned_data = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(u));
    HYPRE_Complex    *f_owned_data    = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(f));
    HYPRE_Complex    *f_nonowned_data = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(f));
 
-   HYPRE_Int        i, j; // loop variables
+   HYPRE_Int        *A_i, *A_j, *map;
+   HYPRE_Complex    *A_data, *u_data;
+   HYPRE_Int        i, j, row; // loop variables
+   HYPRE_Complex    res;
    HYPRE_Complex    diagonal; // placeholder for the diagonal of A
 
+   // The sweep runs on the composite grid work vector, which holds the updated values
+   if (!hypre_AMGDDCompGridMatrixComposite(A))
+   {
+      hypre_AMGDDCompGridMatrixSetupComposite(A, num_owned,
+                                              hypre_AMGDDCompGridNumNonOwnedNodes(compGrid));
+   }
+   A_i    = hypre_CSRMatrixI(hypre_AMGDDCompGridMatrixComposite(A));
+   A_j    = hypre_CSRMatrixJ(hypre_AMGDDCompGridMatrixComposite(A));
+   A_data = hypre_CSRMatrixData(hypre_AMGDDCompGridMatrixComposite(A));
+   map    = hypre_AMGDDCompGridMatrixCompositeMap(A);
+   hypre_AMGDDCompGridMatrixCompositeGather(A, u);
+   u_data = hypre_AMGDDCompGridMatrixCompositeWork(A);
+
    // Do Gauss-Seidel relaxation on the owned nodes
-   for (i = 0; i < hypre_AMGDDCompGridNumOwnedNodes(compGrid); i++)
+   for (i = 0; i < num_owned; i++)
    {
-      // Initialize u as RHS
-      u_owned_data[i] = f_owned_data[i];
+      // Initialize residual as RHS
+      res = f_owned_data[i];
       diagonal = 0.0;
 
-      // Loop over diag entries
-      for (j = hypre_CSRMatrixI(owned_diag)[i]; j < hypre_CSRMatrixI(owned_diag)[i + 1]; j++)
+      for (j = A_i[i]; j < A_i[i + 1]; j++)
       {
-         if (hypre_CSRMatrixJ(owned_diag)[j] == i)
+         if (A_j[j] == i)
          {
-            diagonal = hypre_CSRMatrixData(owned_diag)[j];
+            diagonal = A_data[j];
          }
          else
          {
-            u_owned_data[i] -= hypre_CSRMatrixData(owned_diag)[j] * u_owned_data[ hypre_CSRMatrixJ(
-                                                                                     owned_diag)[j] ];
+            res -= A_data[j] * u_data[ A_j[j] ];
          }
       }
 
-      // Loop over offd entries
-      for (j = hypre_CSRMatrixI(owned_offd)[i]; j < hypre_CSRMatrixI(owned_offd)[i + 1]; j++)
-      {
-         u_owned_data[i] -= hypre_CSRMatrixData(owned_offd)[j] * u_nonowned_data[ hypre_CSRMatrixJ(
-                                                                                     owned_offd)[j] ];
-      }
-
       // Divide by diagonal
       if (diagonal == 0.0)
       {
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                            "WARNING: Divide by zero diagonal in hypre_BoomerAMGDD_FAC_GaussSeidel().\n");
       }
-      u_owned_data[i] /= diagonal;
+      u_data[i] = res / diagonal;
+      u_owned_data[i] = u_data[i];
    }
 
    // Do Gauss-Seidel relaxation on the nonowned nodes
-   for (i = 0; i < hypre_AMGDDCompGridNumNonOwnedRealNodes(compGrid); i++)
+   for (i = 0; i < num_real; i++)
    {
-      // Initialize u as RHS
-      u_nonowned_data[i] = f_nonowned_data[i];
+      // Initialize residual as RHS
+      res = f_nonowned_data[i];
       diagonal = 0.0;
+      row = map[i];
 
-      // Loop over diag entries
-      for (j = hypre_CSRMatrixI(nonowned_diag)[i]; j < hypre_CSRMatrixI(nonowned_diag)[i + 1]; j++)
+      for (j = A_i[num_owned + i]; j < A_i[num_owned + i + 1]; j++)
       {
-         if (hypre_CSRMatrixJ(nonowned_diag)[j] == i)
+         if (A_j[j] == row)
          {
-            diagonal = hypre_CSRMatrixData(nonowned_diag)[j];
+            diagonal = A_data[j];
          }
          else
          {
-            u_nonowned_data[i] -= hypre_CSRMatrixData(nonowned_diag)[j] * u_nonowned_data[ hypre_CSRMatrixJ(
-                                                                                              nonowned_diag)[j] ];
+            res -= A_data[j] * u_data[ A_j[j] ];
          }
       }
 
-      // Loop over offd entries
-      for (j = hypre_CSRMatrixI(nonowned_offd)[i]; j < hypre_CSRMatrixI(nonowned_offd)[i + 1]; j++)
-      {
-         u_nonowned_data[i] -= hypre_CSRMatrixData(nonowned_offd)[j] * u_owned_data[ hypre_CSRMatrixJ(
-                                                                                        nonowned_offd)[j] ];
-      }
-
       // Divide by diagonal
       if (diagonal == 0.0)
       {
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                            "WARNING: Divide by zero diagonal in hypre_BoomerAMGDD_FAC_GaussSeidel().\n");
       }
-      u_nonowned_data[i] /= diagonal;
+      u_data[row] = res / diagonal;
+      u_nonowned_data[i] = u_data[row];
    }
 
    return hypre_error_flag;
@@ -609,72 +632,45 @@ hypre_BoomerAMGDD_FAC_CFL1JacobiHost( void      *amgdd_vdata,
                                       HYPRE_Int  level,
                                       HYPRE_Int  relax_set )
 {
-   hypre_ParAMGDDData   *amgdd_data   = (hypre_ParAMGDDData*) amgdd_vdata;
-   hypre_AMGDDCompGrid  *compGrid     = hypre_ParAMGDDDataCompGrid(amgdd_data)[level];
-   HYPRE_Real            relax_weight = hypre_ParAMGDDDataFACRelaxWeight(amgdd_data);
-
-   hypre_CSRMatrix      *owned_diag    = hypre_AMGDDCompGridMatrixOwnedDiag(hypre_AMGDDCompGridA(
-                                                                               compGrid));
-   hypre_CSRMatrix      *owned_offd    = hypre_AMGDDCompGridMatrixOwnedOffd(hypre_AMGDDCompGridA(
-                                                                               compGrid));
-   hypre_CSRMatrix      *nonowned_diag = hypre_AMGDDCompGridMatrixNonOwnedDiag(hypre_AMGDDCompGridA(
-                                                                                  compGrid));
-   hypre_CSRMatrix      *nonowned_offd = hypre_AMGDDCompGridMatrixNonOwnedOffd(hypre_AMGDDCompGridA(
-                                                                                  compGrid));
-
-   HYPRE_Complex        *owned_u       = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(
-                                                             hypre_AMGDDCompGridU(compGrid)));
-   HYPRE_Complex        *nonowned_u    = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(
-                                                             hypre_AMGDDCompGridU(compGrid)));
-   HYPRE_Complex        *owned_f       = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(
-                                                             hypre_AMGDDCompGridF(compGrid)));
-   HYPRE_Complex        *nonowned_f    = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(
-                                                             hypre_AMGDDCompGridF(compGrid)));
-
-   HYPRE_Real           *l1_norms      = hypre_AMGDDCompGridL1Norms(compGrid);
-   HYPRE_Int            *cf_marker     = hypre_AMGDDCompGridCFMarkerArray(compGrid);
-
-   HYPRE_Complex        *owned_tmp;
-   HYPRE_Complex        *nonowned_tmp;
-
-   HYPRE_Int             i, j;
-   HYPRE_Real            res;
-
-   /*-----------------------------------------------------------------
-    * Create and initialize Temp2 vector if not done before.
-    *-----------------------------------------------------------------*/
+   hypre_ParAMGDDData         *amgdd_data   = (hypre_ParAMGDDData*) amgdd_vdata;
+   hypre_AMGDDCompGrid        *compGrid     = hypre_ParAMGDDDataCompGrid(amgdd_data)[level];
+   HYPRE_Real                  relax_weight = hypre_ParAMGDDDataFACRelaxWeight(amgdd_data);
+   hypre_AMGDDCompGridMatrix  *A            = hypre_AMGDDCompGridA(compGrid);
+   HYPRE_Int                   num_owned    = hypre_AMGDDCompGridNumOwnedNodes(compGrid);
+   HYPRE_Int                   num_real     = hypre_AMGDDCompGridNumNonOwnedRealNodes(compGrid);
+
+   HYPRE_Complex              *owned_u      = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(
+                                                                  hypre_AMGDDCompGridU(compGrid)));
+   HYPRE_Complex              *nonowned_u   = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(
+                                                                  hypre_AMGDDCompGridU(compGrid)));
+   HYPRE_Complex              *owned_f      = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(
+                                                                  hypre_AMGDDCompGridF(compGrid)));
+   HYPRE_Complex              *nonowned_f   = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(
+                                                                  hypre_AMGDDCompGridF(compGrid)));
+
+   HYPRE_Real                 *l1_norms     = hypre_AMGDDCompGridL1Norms(compGrid);
+   HYPRE_Int                  *cf_marker    = hypre_AMGDDCompGridCFMarkerArray(compGrid);
+
+   HYPRE_Int                  *A_i, *A_j;
+   HYPRE_Complex              *A_data, *u_tmp;
+   HYPRE_Int                   i, j;
+   HYPRE_Real                  res;
 
-   if (!hypre_AMGDDCompGridTemp2(compGrid))
+   if (!hypre_AMGDDCompGridMatrixComposite(A))
    {
-      hypre_AMGDDCompGridTemp2(compGrid) = hypre_AMGDDCompGridVectorCreate();
-      hypre_AMGDDCompGridVectorInitialize(hypre_AMGDDCompGridTemp2(compGrid),
-                                          hypre_AMGDDCompGridNumOwnedNodes(compGrid),
-                                          hypre_AMGDDCompGridNumNonOwnedNodes(compGrid),
-                                          hypre_AMGDDCompGridNumNonOwnedRealNodes(compGrid));
+      hypre_AMGDDCompGridMatrixSetupComposite(A, num_owned,
+                                              hypre_AMGDDCompGridNumNonOwnedNodes(compGrid));
    }
-   owned_tmp    = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(hypre_AMGDDCompGridTemp2(compGrid)));
-   nonowned_tmp = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(hypre_AMGDDCompGridTemp2(
-                                                                        compGrid)));
+   A_i    = hypre_CSRMatrixI(hypre_AMGDDCompGridMatrixComposite(A));
+   A_j    = hypre_CSRMatrixJ(hypre_AMGDDCompGridMatrixComposite(A));
+   A_data = hypre_CSRMatrixData(hypre_AMGDDCompGridMatrixComposite(A));
 
    /*-----------------------------------------------------------------
-    * Copy current approximation into temporary vector.
+    * Copy current approximation into the composite grid work vector.
     *-----------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
-   for (i = 0; i < hypre_AMGDDCompGridNumOwnedNodes(compGrid); i++)
-   {
-      owned_tmp[i] = owned_u[i];
-   }
-
-#ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
-   for (i = 0; i < hypre_AMGDDCompGridNumNonOwnedNodes(compGrid); i++)
-   {
-      nonowned_tmp[i] = nonowned_u[i];
-   }
+   hypre_AMGDDCompGridMatrixCompositeGather(A, hypre_AMGDDCompGridU(compGrid));
+   u_tmp = hypre_AMGDDCompGridMatrixCompositeWork(A);
 
    /*-----------------------------------------------------------------
    * Relax only C or F points as determined by relax_points.
@@ -683,36 +679,32 @@ hypre_BoomerAMGDD_FAC_CFL1JacobiHost( void      *amgdd_vdata,
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel for private(i,j,res) HYPRE_SMP_SCHEDULE
 #endif
-   for (i = 0; i < hypre_AMGDDCompGridNumOwnedNodes(compGrid); i++)
+   for (i = 0; i < num_owned; i++)
    {
       if (cf_marker[i] == relax_set)
       {
          res = owned_f[i];
-         for (j = hypre_CSRMatrixI(owned_diag)[i]; j < hypre_CSRMatrixI(owned_diag)[i + 1]; j++)
-         {
-            res -= hypre_CSRMatrixData(owned_diag)[j] * owned_tmp[ hypre_CSRMatrixJ(owned_diag)[j] ];
-         }
-         for (j = hypre_CSRMatrixI(owned_offd)[i]; j < hypre_CSRMatrixI(owned_offd)[i + 1]; j++)
+         for (j = A_i[i]; j < A_i[i + 1]; j++)
          {
-            res -= hypre_CSRMatrixData(owned_offd)[j] * nonowned_tmp[ hypre_CSRMatrixJ(owned_offd)[j] ];
+            res -= A_data[j] * u_tmp[A_j[j]];
          }
          owned_u[i] += (relax_weight * res) / l1_norms[i];
       }
    }
-   for (i = 0; i < hypre_AMGDDCompGridNumNonOwnedRealNodes(compGrid); i++)
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,j,res) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_real; i++)
    {
-      if (cf_marker[i + hypre_AMGDDCompGridNumOwnedNodes(compGrid)] == relax_set)
+      if (cf_marker[num_owned + i] == relax_set)
       {
          res = nonowned_f[i];
-         for (j = hypre_CSRMatrixI(nonowned_diag)[i]; j < hypre_CSRMatrixI(nonowned_diag)[i + 1]; j++)
-         {
-            res -= hypre_CSRMatrixData(nonowned_diag)[j] * nonowned_tmp[ hypre_CSRMatrixJ(nonowned_diag)[j] ];
-         }
-         for (j = hypre_CSRMatrixI(nonowned_offd)[i]; j < hypre_CSRMatrixI(nonowned_offd)[i + 1]; j++)
+         for (j = A_i[num_owned + i]; j < A_i[num_owned + i + 1]; j++)
          {
-            res -= hypre_CSRMatrixData(nonowned_offd)[j] * owned_tmp[ hypre_CSRMatrixJ(nonowned_offd)[j] ];
+            res -= A_data[j] * u_tmp[A_j[j]];
          }
-         nonowned_u[i] += (relax_weight * res) / l1_norms[i + hypre_AMGDDCompGridNumOwnedNodes(compGrid)];
+         nonowned_u[i] += (relax_weight * res) / l1_norms[num_owned + i];
       }
    }
 
@@ -329,6 +329,9 @@ hypre_BoomerAMGDDSetup( void               *amgdd_vdata,
    // Setup extra info for specific relaxation methods
    hypre_AMGDDCompGridSetupRelax(amgdd_data);
 
+   // Setup the persistent residual communication of the AMG-DD cycles
+   hypre_BoomerAMGDD_ResidualCommunicationSetup(amgdd_data);
+
    // Cleanup memory
    hypre_TFree(padding, HYPRE_MEMORY_HOST);
    hypre_TFree(nodes_added_on_level, HYPRE_MEMORY_HOST);
@@ -201,6 +201,9 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
     *-----------------------------------------------------------------------*/
    while ( (relative_resid >= tol || cycle_count < min_iter) && cycle_count < max_iter )
    {
+      // Post the receives of the composite grid residuals
+      hypre_BoomerAMGDD_ResidualCommunicationStart(amgdd_data);
+
       // Do normal AMG V-cycle down-sweep to where we start AMG-DD
       if (amgdd_start_level > 0)
       {
@@ -240,6 +243,9 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
          hypre_AMGDDCompGridVectorSetConstantValues(hypre_AMGDDCompGridS(compGrids[level]), 0.0 );
       }
 
+      // Complete the residual communication started above
+      hypre_BoomerAMGDD_ResidualCommunicationWait(amgdd_data);
+
       // Do FAC cycles
       if (fac_num_cycles > 0)
       {
@@ -356,43 +362,254 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
 }
 
 /*--------------------------------------------------------------------------
- * TODO: Don't reallocate requests/sends at each level. Implement
- *       a hypre_AMGDDCommPkgHandle data structure (see hypre_ParCSRCommHandle)
+ * hypre_BoomerAMGDD_ResidualCommunicationSetup
+ *
+ * Sets up the residual communication of the AMG-DD cycles once, after the
+ * composite grids are finalized: persistent requests on each level, with
+ * the messages of all procs in one send and one recv buffer, and flattened
+ * pack/unpack lists of buffer positions and local indices.  The pack lists
+ * of a level hold first the owned and then the nonowned nodes of each
+ * composite level (segments 2*k and 2*k+1 of res_pack_starts), since only
+ * the latter depend on the residual received on coarser levels.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGDD_ResidualCommunicationSetup( hypre_ParAMGDDData *amgdd_data )
+{
+   hypre_ParAMGData      *amg_data = hypre_ParAMGDDDataAMG(amgdd_data);
+   hypre_ParCSRMatrix   **A_array = hypre_ParAMGDataAArray(amg_data);
+   hypre_AMGDDCompGrid  **compGrid = hypre_ParAMGDDDataCompGrid(amgdd_data);
+   hypre_AMGDDCommPkg    *compGridCommPkg = hypre_ParAMGDDDataCommPkg(amgdd_data);
+   HYPRE_Int              num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int              amgdd_start_level = hypre_ParAMGDDDataStartLevel(amgdd_data);
+
+   MPI_Comm               comm;
+   hypre_MPI_Request     *requests;
+   HYPRE_Int             *num_send_procs = hypre_AMGDDCommPkgNumSendProcs(compGridCommPkg);
+   HYPRE_Int             *num_recv_procs = hypre_AMGDDCommPkgNumRecvProcs(compGridCommPkg);
+   HYPRE_Int           ***num_send_nodes = hypre_AMGDDCommPkgNumSendNodes(compGridCommPkg);
+   HYPRE_Int           ***num_recv_nodes = hypre_AMGDDCommPkgNumRecvNodes(compGridCommPkg);
+   HYPRE_Int          ****send_flag = hypre_AMGDDCommPkgSendFlag(compGridCommPkg);
+   HYPRE_Int          ****recv_map = hypre_AMGDDCommPkgRecvMap(compGridCommPkg);
+   HYPRE_Int             *starts, *pos, *elmts;
+   HYPRE_Int              level, lvl, proc, i, k, seg, cnt, offset, size, num_owned;
+
+   hypre_AMGDDCommPkgResRequests(compGridCommPkg)     = hypre_CTAlloc(hypre_MPI_Request *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+   hypre_AMGDDCommPkgResSendBuffer(compGridCommPkg)   = hypre_CTAlloc(HYPRE_Complex *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+   hypre_AMGDDCommPkgResRecvBuffer(compGridCommPkg)   = hypre_CTAlloc(HYPRE_Complex *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+   hypre_AMGDDCommPkgResPackStarts(compGridCommPkg)   = hypre_CTAlloc(HYPRE_Int *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+   hypre_AMGDDCommPkgResPackPos(compGridCommPkg)      = hypre_CTAlloc(HYPRE_Int *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+   hypre_AMGDDCommPkgResPackElmts(compGridCommPkg)    = hypre_CTAlloc(HYPRE_Int *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+   hypre_AMGDDCommPkgResUnpackStarts(compGridCommPkg) = hypre_CTAlloc(HYPRE_Int *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+   hypre_AMGDDCommPkgResUnpackPos(compGridCommPkg)    = hypre_CTAlloc(HYPRE_Int *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+   hypre_AMGDDCommPkgResUnpackElmts(compGridCommPkg)  = hypre_CTAlloc(HYPRE_Int *, num_levels,
+                                                                      HYPRE_MEMORY_HOST);
+
+   for (level = amgdd_start_level; level < num_levels; level++)
+   {
+      if (!num_send_procs[level] && !num_recv_procs[level])
+      {
+         continue;
+      }
+      comm = hypre_ParCSRMatrixComm(A_array[level]);
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_recv_procs[level] + num_send_procs[level],
+                               HYPRE_MEMORY_HOST);
+      hypre_AMGDDCommPkgResRequests(compGridCommPkg)[level] = requests;
+
+      /* Receives and unpack lists */
+      size = 0;
+      for (proc = 0; proc < num_recv_procs[level]; proc++)
+      {
+         size += hypre_AMGDDCommPkgRecvBufferSize(compGridCommPkg)[level][proc];
+      }
+      starts = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+      for (proc = 0; proc < num_recv_procs[level]; proc++)
+      {
+         for (lvl = level; lvl < num_levels; lvl++)
+         {
+            starts[lvl + 1] += num_recv_nodes[level][proc][lvl];
+         }
+      }
+      for (lvl = 0; lvl < num_levels; lvl++)
+      {
+         starts[lvl + 1] += starts[lvl];
+      }
+      pos   = hypre_TAlloc(HYPRE_Int, starts[num_levels], HYPRE_MEMORY_HOST);
+      elmts = hypre_TAlloc(HYPRE_Int, starts[num_levels], HYPRE_MEMORY_HOST);
+
+      hypre_AMGDDCommPkgResRecvBuffer(compGridCommPkg)[level] = hypre_CTAlloc(HYPRE_Complex, size,
+                                                                              HYPRE_MEMORY_HOST);
+      offset = 0;
+      for (proc = 0; proc < num_recv_procs[level]; proc++)
+      {
+         cnt = offset;
+         for (lvl = level; lvl < num_levels; lvl++)
+         {
+            for (i = 0; i < num_recv_nodes[level][proc][lvl]; i++)
+            {
+               k = starts[lvl]++;
+               pos[k]   = cnt++;
+               elmts[k] = recv_map[level][proc][lvl][i];
+            }
+         }
+
+         size = hypre_AMGDDCommPkgRecvBufferSize(compGridCommPkg)[level][proc];
+         hypre_MPI_Recv_init(hypre_AMGDDCommPkgResRecvBuffer(compGridCommPkg)[level] + offset, size,
+                             HYPRE_MPI_COMPLEX, hypre_AMGDDCommPkgRecvProcs(compGridCommPkg)[level][proc],
+                             3 + level, comm, &requests[proc]);
+         offset += size;
+      }
+      for (lvl = num_levels; lvl > 0; lvl--)
+      {
+         starts[lvl] = starts[lvl - 1];
+      }
+      starts[0] = 0;
+      hypre_AMGDDCommPkgResUnpackStarts(compGridCommPkg)[level] = starts;
+      hypre_AMGDDCommPkgResUnpackPos(compGridCommPkg)[level]    = pos;
+      hypre_AMGDDCommPkgResUnpackElmts(compGridCommPkg)[level]  = elmts;
+
+      /* Sends and pack lists */
+      size = 0;
+      for (proc = 0; proc < num_send_procs[level]; proc++)
+      {
+         size += hypre_AMGDDCommPkgSendBufferSize(compGridCommPkg)[level][proc];
+      }
+      starts = hypre_CTAlloc(HYPRE_Int, 2 * num_levels + 1, HYPRE_MEMORY_HOST);
+      for (proc = 0; proc < num_send_procs[level]; proc++)
+      {
+         for (lvl = level; lvl < num_levels; lvl++)
+         {
+            num_owned = hypre_AMGDDCompGridNumOwnedNodes(compGrid[lvl]);
+            for (i = 0; i < num_send_nodes[level][proc][lvl]; i++)
+            {
+               seg = 2 * lvl + (send_flag[level][proc][lvl][i] >= num_owned);
+               starts[seg + 1]++;
+            }
+         }
+      }
+      for (seg = 0; seg < 2 * num_levels; seg++)
+      {
+         starts[seg + 1] += starts[seg];
+      }
+      pos   = hypre_TAlloc(HYPRE_Int, starts[2 * num_levels], HYPRE_MEMORY_HOST);
+      elmts = hypre_TAlloc(HYPRE_Int, starts[2 * num_levels], HYPRE_MEMORY_HOST);
+
+      hypre_AMGDDCommPkgResSendBuffer(compGridCommPkg)[level] = hypre_CTAlloc(HYPRE_Complex, size,
+                                                                              HYPRE_MEMORY_HOST);
+      offset = 0;
+      for (proc = 0; proc < num_send_procs[level]; proc++)
+      {
+         cnt = offset;
+         for (lvl = level; lvl < num_levels; lvl++)
+         {
+            num_owned = hypre_AMGDDCompGridNumOwnedNodes(compGrid[lvl]);
+            for (i = 0; i < num_send_nodes[level][proc][lvl]; i++)
+            {
+               if (send_flag[level][proc][lvl][i] < num_owned)
+               {
+                  k = starts[2 * lvl]++;
+                  elmts[k] = send_flag[level][proc][lvl][i];
+               }
+               else
+               {
+                  k = starts[2 * lvl + 1]++;
+                  elmts[k] = send_flag[level][proc][lvl][i] - num_owned;
+               }
+               pos[k] = cnt++;
+            }
+         }
+
+         size = hypre_AMGDDCommPkgSendBufferSize(compGridCommPkg)[level][proc];
+         hypre_MPI_Send_init(hypre_AMGDDCommPkgResSendBuffer(compGridCommPkg)[level] + offset, size,
+                             HYPRE_MPI_COMPLEX, hypre_AMGDDCommPkgSendProcs(compGridCommPkg)[level][proc],
+                             3 + level, comm, &requests[num_recv_procs[level] + proc]);
+         offset += size;
+      }
+      for (seg = 2 * num_levels; seg > 0; seg--)
+      {
+         starts[seg] = starts[seg - 1];
+      }
+      starts[0] = 0;
+      hypre_AMGDDCommPkgResPackStarts(compGridCommPkg)[level] = starts;
+      hypre_AMGDDCommPkgResPackPos(compGridCommPkg)[level]    = pos;
+      hypre_AMGDDCommPkgResPackElmts(compGridCommPkg)[level]  = elmts;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDD_ResidualCommunicationStart
+ *
+ * Posts the receives of the composite grid residuals on all levels.  This
+ * is done ahead of the fine grid residual computation, which the messages
+ * then do not have to wait for.
  *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGDD_ResidualCommunicationStart( hypre_ParAMGDDData *amgdd_data )
+{
+   hypre_ParAMGData      *amg_data = hypre_ParAMGDDDataAMG(amgdd_data);
+   hypre_AMGDDCommPkg    *compGridCommPkg = hypre_ParAMGDDDataCommPkg(amgdd_data);
+   HYPRE_Int              num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int              amgdd_start_level = hypre_ParAMGDDDataStartLevel(amgdd_data);
+   HYPRE_Int              level, num_recvs;
+
+   if (!compGridCommPkg)
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = amgdd_start_level; level < num_levels; level++)
+   {
+      num_recvs = hypre_AMGDDCommPkgNumRecvProcs(compGridCommPkg)[level];
+      if (num_recvs)
+      {
+         hypre_MPI_Startall(num_recvs, hypre_AMGDDCommPkgResRequests(compGridCommPkg)[level]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDD_ResidualCommunication
+ *
+ * Restricts the residual to all levels and sends the composite grid
+ * residuals from the coarsest to the finest level.  The owned nodes of a
+ * level are packed while the messages of the coarser levels are in
+ * flight.  The messages of the AMG-DD start level are completed by
+ * hypre_BoomerAMGDD_ResidualCommunicationWait.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int
 hypre_BoomerAMGDD_ResidualCommunication( hypre_ParAMGDDData *amgdd_data )
 {
    hypre_ParAMGData      *amg_data = hypre_ParAMGDDDataAMG(amgdd_data);
 
    // info from amg
-   hypre_ParCSRMatrix   **A_array;
    hypre_ParCSRMatrix   **R_array;
    hypre_ParVector      **F_array;
    hypre_AMGDDCommPkg    *compGridCommPkg;
    hypre_AMGDDCompGrid  **compGrid;
 
-   // temporary arrays used for communication during comp grid setup
-   HYPRE_Complex        **send_buffers;
-   HYPRE_Complex        **recv_buffers;
-
-   // MPI stuff
-   MPI_Comm               comm;
-   hypre_MPI_Request     *requests;
-   hypre_MPI_Status      *status;
-   HYPRE_Int              request_counter = 0;
-   HYPRE_Int              num_procs;
-   HYPRE_Int              num_sends, num_recvs;
-   HYPRE_Int              send_buffer_size, recv_buffer_size;
-
    HYPRE_Int              num_levels, amgdd_start_level;
-   HYPRE_Int              level, i;
+   HYPRE_Int              num_sends, num_recvs;
+   HYPRE_Int              level;
 
    // Get info from amg
    num_levels        = hypre_ParAMGDataNumLevels(amg_data);
    amgdd_start_level = hypre_ParAMGDDDataStartLevel(amgdd_data);
    compGrid          = hypre_ParAMGDDDataCompGrid(amgdd_data);
    compGridCommPkg   = hypre_ParAMGDDDataCommPkg(amgdd_data);
-   A_array           = hypre_ParAMGDataAArray(amg_data);
    R_array           = hypre_ParAMGDataRArray(amg_data);
    F_array           = hypre_ParAMGDataFArray(amg_data);
 
@@ -409,128 +626,158 @@ hypre_BoomerAMGDD_ResidualCommunication( hypre_ParAMGDDData *amgdd_data )
       }
    }
 
+   if (!compGridCommPkg)
+   {
+      return hypre_error_flag;
+   }
+
    /* Outer loop over levels:
    Start from coarsest level and work up to finest */
    for (level = num_levels - 1; level >= amgdd_start_level; level--)
    {
-      // Get some communication info
-      comm = hypre_ParCSRMatrixComm(A_array[level]);
-      hypre_MPI_Comm_size(comm, &num_procs);
+      num_sends = hypre_AMGDDCommPkgNumSendProcs(compGridCommPkg)[level];
 
-      if (num_procs > 1)
+      if (num_sends)
       {
-         num_sends = hypre_AMGDDCommPkgNumSendProcs(compGridCommPkg)[level];
-         num_recvs = hypre_AMGDDCommPkgNumRecvProcs(compGridCommPkg)[level];
+         hypre_BoomerAMGDD_PackResidual(compGrid, compGridCommPkg, level, 0);
+      }
 
-         if ( num_sends || num_recvs ) // If there are any owned nodes on this level
+      // Complete the coarser level, whose nonowned nodes may be forwarded on this level
+      if (level < num_levels - 1)
+      {
+         num_recvs = hypre_AMGDDCommPkgNumRecvProcs(compGridCommPkg)[level + 1];
+         if (num_recvs)
          {
-            // allocate space for the buffers, buffer sizes, requests and status, psiComposite_send, psiComposite_recv, send and recv maps
-            recv_buffers = hypre_CTAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
-            send_buffers = hypre_CTAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
-            request_counter = 0;
-            requests = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
-            status = hypre_CTAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
-
-            // allocate space for the receive buffers and post the receives
-            for (i = 0; i < num_recvs; i++)
-            {
-               recv_buffer_size = hypre_AMGDDCommPkgRecvBufferSize(compGridCommPkg)[level][i];
-               recv_buffers[i] = hypre_CTAlloc(HYPRE_Complex, recv_buffer_size, HYPRE_MEMORY_HOST);
-               hypre_MPI_Irecv(recv_buffers[i], recv_buffer_size, HYPRE_MPI_COMPLEX,
-                               hypre_AMGDDCommPkgRecvProcs(compGridCommPkg)[level][i], 3, comm, &requests[request_counter++]);
-            }
+            hypre_MPI_Waitall(num_recvs, hypre_AMGDDCommPkgResRequests(compGridCommPkg)[level + 1],
+                              hypre_MPI_STATUSES_IGNORE);
+            hypre_BoomerAMGDD_UnpackResidual(compGrid, compGridCommPkg, level + 1);
+         }
+      }
 
-            for (i = 0; i < num_sends; i++)
-            {
-               send_buffer_size = hypre_AMGDDCommPkgSendBufferSize(compGridCommPkg)[level][i];
-               send_buffers[i] = hypre_BoomerAMGDD_PackResidualBuffer(compGrid, compGridCommPkg, level, i);
-               hypre_MPI_Isend(send_buffers[i], send_buffer_size, HYPRE_MPI_COMPLEX,
-                               hypre_AMGDDCommPkgSendProcs(compGridCommPkg)[level][i], 3, comm, &requests[request_counter++]);
-            }
+      if (num_sends)
+      {
+         num_recvs = hypre_AMGDDCommPkgNumRecvProcs(compGridCommPkg)[level];
 
-            // wait for buffers to be received
-            hypre_MPI_Waitall( request_counter, requests, status );
+         hypre_BoomerAMGDD_PackResidual(compGrid, compGridCommPkg, level, 1);
+         hypre_MPI_Startall(num_sends, hypre_AMGDDCommPkgResRequests(compGridCommPkg)[level] + num_recvs);
+      }
+   }
 
-            hypre_TFree(requests, HYPRE_MEMORY_HOST);
-            hypre_TFree(status, HYPRE_MEMORY_HOST);
-            for (i = 0; i < num_sends; i++)
-            {
-               hypre_TFree(send_buffers[i], HYPRE_MEMORY_HOST);
-            }
-            hypre_TFree(send_buffers, HYPRE_MEMORY_HOST);
+   return hypre_error_flag;
+}
 
-            // Unpack recv buffers
-            for (i = 0; i < num_recvs; i++)
-            {
-               hypre_BoomerAMGDD_UnpackResidualBuffer(recv_buffers[i], compGrid, compGridCommPkg, level, i);
-            }
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDD_ResidualCommunicationWait
+ *
+ * Completes the residual communication of the AMG-DD start level, and the
+ * sends of all levels.
+ *--------------------------------------------------------------------------*/
 
-            // clean up memory for this level
-            for (i = 0; i < num_recvs; i++)
-            {
-               hypre_TFree(recv_buffers[i], HYPRE_MEMORY_HOST);
-            }
-            hypre_TFree(recv_buffers, HYPRE_MEMORY_HOST);
-         }
+HYPRE_Int
+hypre_BoomerAMGDD_ResidualCommunicationWait( hypre_ParAMGDDData *amgdd_data )
+{
+   hypre_ParAMGData      *amg_data = hypre_ParAMGDDDataAMG(amgdd_data);
+   hypre_AMGDDCommPkg    *compGridCommPkg = hypre_ParAMGDDDataCommPkg(amgdd_data);
+   hypre_AMGDDCompGrid  **compGrid = hypre_ParAMGDDDataCompGrid(amgdd_data);
+   HYPRE_Int              num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int              amgdd_start_level = hypre_ParAMGDDDataStartLevel(amgdd_data);
+   HYPRE_Int              level, num_sends, num_recvs;
+
+   if (!compGridCommPkg)
+   {
+      return hypre_error_flag;
+   }
+
+   num_recvs = hypre_AMGDDCommPkgNumRecvProcs(compGridCommPkg)[amgdd_start_level];
+   if (num_recvs)
+   {
+      hypre_MPI_Waitall(num_recvs, hypre_AMGDDCommPkgResRequests(compGridCommPkg)[amgdd_start_level],
+                        hypre_MPI_STATUSES_IGNORE);
+      hypre_BoomerAMGDD_UnpackResidual(compGrid, compGridCommPkg, amgdd_start_level);
+   }
+
+   for (level = amgdd_start_level; level < num_levels; level++)
+   {
+      num_sends = hypre_AMGDDCommPkgNumSendProcs(compGridCommPkg)[level];
+      num_recvs = hypre_AMGDDCommPkgNumRecvProcs(compGridCommPkg)[level];
+      if (num_sends)
+      {
+         hypre_MPI_Waitall(num_sends, hypre_AMGDDCommPkgResRequests(compGridCommPkg)[level] + num_recvs,
+                           hypre_MPI_STATUSES_IGNORE);
       }
    }
 
    return hypre_error_flag;
 }
 
-HYPRE_Complex*
-hypre_BoomerAMGDD_PackResidualBuffer( hypre_AMGDDCompGrid **compGrid,
-                                      hypre_AMGDDCommPkg   *compGridCommPkg,
-                                      HYPRE_Int             current_level,
-                                      HYPRE_Int             proc )
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDD_PackResidual
+ *
+ * Packs the owned (nonowned = 0) or nonowned (nonowned = 1) nodes of the
+ * residual sent on current_level.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGDD_PackResidual( hypre_AMGDDCompGrid **compGrid,
+                                hypre_AMGDDCommPkg   *compGridCommPkg,
+                                HYPRE_Int             current_level,
+                                HYPRE_Int             nonowned )
 {
-   HYPRE_Complex  *buffer;
-   HYPRE_Int       level, i;
-   HYPRE_Int       send_elmt;
-   HYPRE_Int       cnt = 0;
+   HYPRE_Complex  *buffer = hypre_AMGDDCommPkgResSendBuffer(compGridCommPkg)[current_level];
+   HYPRE_Int      *starts = hypre_AMGDDCommPkgResPackStarts(compGridCommPkg)[current_level];
+   HYPRE_Int      *pos    = hypre_AMGDDCommPkgResPackPos(compGridCommPkg)[current_level];
+   HYPRE_Int      *elmts  = hypre_AMGDDCommPkgResPackElmts(compGridCommPkg)[current_level];
+   HYPRE_Complex  *f_data;
+   HYPRE_Int       level, k;
 
-   buffer = hypre_CTAlloc(HYPRE_Complex,
-                          hypre_AMGDDCommPkgSendBufferSize(compGridCommPkg)[current_level][proc], HYPRE_MEMORY_HOST);
    for (level = current_level; level < hypre_AMGDDCommPkgNumLevels(compGridCommPkg); level++)
    {
-      for (i = 0; i < hypre_AMGDDCommPkgNumSendNodes(compGridCommPkg)[current_level][proc][level]; i++)
+      if (nonowned)
       {
-         send_elmt = hypre_AMGDDCommPkgSendFlag(compGridCommPkg)[current_level][proc][level][i];
-         if (send_elmt < hypre_AMGDDCompGridNumOwnedNodes(compGrid[level]))
-         {
-            buffer[cnt++] = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(hypre_AMGDDCompGridF(
-                                                                               compGrid[level])))[send_elmt];
-         }
-         else
-         {
-            send_elmt -= hypre_AMGDDCompGridNumOwnedNodes(compGrid[level]);
-            buffer[cnt++] = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(hypre_AMGDDCompGridF(
-                                                                                  compGrid[level])))[send_elmt];
-         }
+         f_data = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(hypre_AMGDDCompGridF(
+                                                                        compGrid[level])));
+      }
+      else
+      {
+         f_data = hypre_VectorData(hypre_AMGDDCompGridVectorOwned(hypre_AMGDDCompGridF(
+                                                                     compGrid[level])));
+      }
+
+      for (k = starts[2 * level + nonowned]; k < starts[2 * level + nonowned + 1]; k++)
+      {
+         buffer[pos[k]] = f_data[elmts[k]];
       }
    }
 
-   return buffer;
+   return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDD_UnpackResidual
+ *
+ * Unpacks the residual received on current_level into the nonowned nodes.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int
-hypre_BoomerAMGDD_UnpackResidualBuffer( HYPRE_Complex        *buffer,
-                                        hypre_AMGDDCompGrid **compGrid,
-                                        hypre_AMGDDCommPkg   *compGridCommPkg,
-                                        HYPRE_Int             current_level,
-                                        HYPRE_Int             proc )
+hypre_BoomerAMGDD_UnpackResidual( hypre_AMGDDCompGrid **compGrid,
+                                  hypre_AMGDDCommPkg   *compGridCommPkg,
+                                  HYPRE_Int             current_level )
 {
-   HYPRE_Int  recv_elmt;
-   HYPRE_Int  level, i;
-   HYPRE_Int  cnt = 0;
+   HYPRE_Complex  *buffer = hypre_AMGDDCommPkgResRecvBuffer(compGridCommPkg)[current_level];
+   HYPRE_Int      *starts = hypre_AMGDDCommPkgResUnpackStarts(compGridCommPkg)[current_level];
+   HYPRE_Int      *pos    = hypre_AMGDDCommPkgResUnpackPos(compGridCommPkg)[current_level];
+   HYPRE_Int      *elmts  = hypre_AMGDDCommPkgResUnpackElmts(compGridCommPkg)[current_level];
+   HYPRE_Complex  *f_data;
+   HYPRE_Int       level, k;
 
    for (level = current_level; level < hypre_AMGDDCommPkgNumLevels(compGridCommPkg); level++)
    {
-      for (i = 0; i < hypre_AMGDDCommPkgNumRecvNodes(compGridCommPkg)[current_level][proc][level]; i++)
+      f_data = hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(hypre_AMGDDCompGridF(
+                                                                     compGrid[level])));
+
+      for (k = starts[level]; k < starts[level + 1]; k++)
       {
-         recv_elmt = hypre_AMGDDCommPkgRecvMap(compGridCommPkg)[current_level][proc][level][i];
-         hypre_VectorData(hypre_AMGDDCompGridVectorNonOwned(hypre_AMGDDCompGridF(
-                                                               compGrid[level])))[recv_elmt] = buffer[cnt++];
+         f_data[elmts[k]] = buffer[pos[k]];
       }
    }
 
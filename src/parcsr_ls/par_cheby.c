@@ -199,9 +199,138 @@ hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A,         /* matrix to relax
    return hypre_error_flag;
 }
 
+/**
+ * @brief Start the halo exchange of x for a Chebyshev sweep
+ *
+ * @param[in] comm_pkg Communication package of the matrix
+ * @param[in] x_data Local part of the vector
+ * @param[out] buf_data Send buffer
+ * @param[out] x_offd Receive buffer for the off-processor part of the vector
+ *
+ * @return The communication handle, NULL if there are no neighbors
+ */
+static hypre_ParCSRCommHandle *
+hypre_ParCSRRelax_Cheby_HaloStart(hypre_ParCSRCommPkg *comm_pkg,
+                                  HYPRE_Real          *x_data,
+                                  HYPRE_Real          *buf_data,
+                                  HYPRE_Real          *x_offd)
+{
+   HYPRE_Int num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int i;
+
+   if (num_sends + num_recvs == 0)
+   {
+      return NULL;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      buf_data[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+   return hypre_ParCSRCommHandleCreate(1, comm_pkg, buf_data, x_offd);
+}
+
+/**
+ * @brief One fused row sweep of the Chebyshev polynomial on the host
+ *
+ * Computes s = (A x)_i and, for every row i, with d = ds_data[i] (or 1):
+ *   first sweep (f_data given): r_i = d (f_i - s), t = d coef r_i
+ *   other sweeps:               t = d (coef r_i + d s)
+ * and then y_i = t, or u_i = u_i + t for the last sweep (u_data given).
+ * Rows without off-processor columns are computed while the halo exchange
+ * of x, started by the caller, is in progress.  The row sum s is formed
+ * before it is combined with f, so results agree with the unfused matvec
+ * and vector updates only up to rounding.
+ */
+static void
+hypre_ParCSRRelax_Cheby_FusedSweep(hypre_ParCSRMatrix     *A,
+                                   hypre_ParCSRCommHandle *comm_handle,
+                                   HYPRE_Real             *x_data,
+                                   HYPRE_Real             *x_offd,
+                                   HYPRE_Real             *ds_data,
+                                   HYPRE_Real             *f_data,
+                                   HYPRE_Real             *r_data,
+                                   HYPRE_Real              coef,
+                                   HYPRE_Real             *y_data,
+                                   HYPRE_Real             *u_data)
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real      *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        boundary, i, jj;
+   HYPRE_Real       s, d, t;
+
+   /* interior rows first, then the rows coupled to other processes */
+   for (boundary = 0; boundary < 2; boundary++)
+   {
+      if (boundary && comm_handle)
+      {
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,jj,s,d,t) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         if ((A_offd_i[i + 1] > A_offd_i[i]) != boundary)
+         {
+            continue;
+         }
+
+         s = 0.0;
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            s += A_diag_data[jj] * x_data[A_diag_j[jj]];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            s += A_offd_data[jj] * x_offd[A_offd_j[jj]];
+         }
+
+         d = ds_data ? ds_data[i] : 1.0;
+         if (f_data)
+         {
+            r_data[i] = d * (f_data[i] - s);
+            t = d * coef * r_data[i];
+         }
+         else
+         {
+            t = d * (coef * r_data[i] + d * s);
+         }
+
+         if (u_data)
+         {
+            u_data[i] += t;
+         }
+         else
+         {
+            y_data[i] = t;
+         }
+      }
+   }
+}
+
 /**
  * @brief Solve using a chebyshev polynomial on the host
  *
+ * The polynomial is applied by Horner's rule on the scaled iterate
+ * w = D^(-1/2) u (w = u without scaling), so that every degree is a single
+ * row sweep combining the matvec, the update and the diagonal scaling, and
+ * u itself is only written by the last sweep.  The halo exchange for each
+ * sweep is overlapped with its interior rows.
+ *
  * @param[in] A Matrix to relax with
  * @param[in] f right-hand side
  * @param[in] ds_data Diagonal information
@@ -229,23 +358,19 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
                                   hypre_ParVector    *orig_u_vec, /*another temp vector */
                                   hypre_ParVector    *tmp_vec) /*a potential temp vector */
 {
-   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Real *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
-   HYPRE_Real *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
-   HYPRE_Real *v_data = hypre_VectorData(hypre_ParVectorLocalVector(v));
-
-   HYPRE_Real  *r_data = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   hypre_CSRMatrix        *A_diag   = hypre_ParCSRMatrixDiag(A);
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Real             *u_data   = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real             *f_data   = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real             *r_data   = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Real             *w_data   = hypre_VectorData(hypre_ParVectorLocalVector(v));
+   HYPRE_Real             *w_next;
+   HYPRE_Real             *w_tmp, *buf_data, *x_offd, *scale_data;
+   hypre_ParCSRCommHandle *comm_handle;
 
-   HYPRE_Int i, j;
    HYPRE_Int num_rows = hypre_CSRMatrixNumRows(A_diag);
-
-   HYPRE_Real mult;
-   HYPRE_Real *orig_u;
-
-   HYPRE_Int cheby_order;
-
-   HYPRE_Real  *tmp_data;
-
+   HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Int i, cheby_order;
 
    /* u = u + p(A)r */
 
@@ -262,116 +387,54 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
    cheby_order = order - 1;
 
    hypre_assert(hypre_VectorSize(hypre_ParVectorLocalVector(orig_u_vec)) >= num_rows);
-   orig_u = hypre_VectorData(hypre_ParVectorLocalVector(orig_u_vec));
+   w_next = hypre_VectorData(hypre_ParVectorLocalVector(orig_u_vec));
 
-   if (!scale)
-   {
-      /* get residual: r = f - A*u */
-      hypre_ParVectorCopy(f, r);
-      hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
-
-      /* o = u; u = r .* coef */
-      for ( i = 0; i < num_rows; i++ )
-      {
-         orig_u[i] = u_data[i];
-         u_data[i] = r_data[i] * coefs[cheby_order];
-      }
-      for (i = cheby_order - 1; i >= 0; i-- )
-      {
-         hypre_ParCSRMatrixMatvec(1.0, A, u, 0.0, v);
-         mult = coefs[i];
-         /* u = mult * r + v */
-#ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
-#endif
-         for ( j = 0; j < num_rows; j++ )
-         {
-            u_data[j] = mult * r_data[j] + v_data[j];
-         }
-      }
+   /* with scaling, ds_data is 1/sqrt(|diagonal|) */
+   scale_data = scale ? ds_data : NULL;
 
-      /* u = o + u */
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
-      for ( i = 0; i < num_rows; i++ )
-      {
-         u_data[i] = orig_u[i] + u_data[i];
-      }
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    }
-   else /* scaling! */
+   buf_data = hypre_TAlloc(HYPRE_Real,
+                           hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                                           hypre_ParCSRCommPkgNumSends(comm_pkg)),
+                           HYPRE_MEMORY_HOST);
+   x_offd   = hypre_TAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+   /* r = D^(-1/2) (f - A u), w = D^(-1/2) coef r */
+   comm_handle = hypre_ParCSRRelax_Cheby_HaloStart(comm_pkg, u_data, buf_data, x_offd);
+   hypre_ParCSRRelax_Cheby_FusedSweep(A, comm_handle, u_data, x_offd, scale_data, f_data, r_data,
+                                      coefs[cheby_order], w_data, NULL);
+
+   if (cheby_order == 0)
    {
-
-      /*grab 1/sqrt(diagonal) */
-      tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(tmp_vec));
-
-      /* get ds_data and get scaled residual: r = D^(-1/2)f -
-         * D^(-1/2)A*u */
-
-      hypre_ParCSRMatrixMatvec(-1.0, A, u, 0.0, tmp_vec);
-      /* r = ds .* (f + tmp) */
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
-#endif
-      for ( j = 0; j < num_rows; j++ )
-      {
-         r_data[j] = ds_data[j] * (f_data[j] + tmp_data[j]);
-      }
-
-      /* save original u, then start
-         the iteration by multiplying r by the cheby coef.*/
-
-      /* o = u;  u = r * coef */
+      /* u = u + w */
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-      for ( j = 0; j < num_rows; j++ )
+      for (i = 0; i < num_rows; i++)
       {
-         orig_u[j] = u_data[j]; /* orig, unscaled u */
-
-         u_data[j] = r_data[j] * coefs[cheby_order];
+         u_data[i] += w_data[i];
       }
+   }
 
-      /* now do the other coefficients */
-      for (i = cheby_order - 1; i >= 0; i-- )
-      {
-         /* v = D^(-1/2)AD^(-1/2)u */
-         /* tmp = ds .* u */
-#ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
-#endif
-         for ( j = 0; j < num_rows; j++ )
-         {
-            tmp_data[j]  =  ds_data[j] * u_data[j];
-         }
-         hypre_ParCSRMatrixMatvec(1.0, A, tmp_vec, 0.0, v);
-
-         /* u_new = coef*r + v*/
-         mult = coefs[i];
-
-         /* u = coef * r + ds .* v */
-#ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
-#endif
-         for ( j = 0; j < num_rows; j++ )
-         {
-            u_data[j] = mult * r_data[j] + ds_data[j] * v_data[j];
-         }
-
-      } /* end of cheby_order loop */
-
-      /* now we have to scale u_data before adding it to u_orig*/
+   /* now do the other coefficients: w = D^(-1/2) (coef r + D^(-1/2) A w),
+      adding the last one to u */
+   for (i = cheby_order - 1; i >= 0; i--)
+   {
+      comm_handle = hypre_ParCSRRelax_Cheby_HaloStart(comm_pkg, w_data, buf_data, x_offd);
+      hypre_ParCSRRelax_Cheby_FusedSweep(A, comm_handle, w_data, x_offd, scale_data, NULL, r_data,
+                                         coefs[i], w_next, i ? NULL : u_data);
 
-      /* u = orig_u + ds .* u */
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
-#endif
-      for ( j = 0; j < num_rows; j++ )
-      {
-         u_data[j] = orig_u[j] + ds_data[j] * u_data[j];
-      }
+      w_tmp  = w_data;
+      w_data = w_next;
+      w_next = w_tmp;
+   }
 
-   }/* end of scaling code */
+   hypre_TFree(buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(x_offd, HYPRE_MEMORY_HOST);
 
    return hypre_error_flag;
 }
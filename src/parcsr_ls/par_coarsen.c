@@ -2286,7 +2286,8 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
       hypre_ParCSRCommHandleDestroy(comm_handle);
    }
 
-   /* now add the externally calculated part of the local nodes to the local nodes */
+   /* now add the externally calculated part of the local nodes to the local nodes
+      (sequential, since a node can be sent to several processors) */
    index = 0;
    for (i = 0; i < num_sends; i++)
    {
@@ -2298,6 +2299,9 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
    }
 
    /* set the measures of the external nodes to zero */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i = num_variables; i < num_variables + num_cols_offd; i++)
    {
       measure_array[i] = 0;
@@ -2329,6 +2333,9 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
       graph_array_offd = NULL;
    }
 
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ig) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < num_cols_offd; ig++)
    {
       graph_array_offd[ig] = ig;
@@ -2347,64 +2354,91 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
    }
    CF_marker = hypre_IntArrayData(*CF_marker_ptr);
 
-   if (CF_init == 1)
+   /* graph_array2 first holds the graph flags of the nodes, which are
+      compacted into graph_array at thread offsets given by a prefix sum */
+   HYPRE_Int *graph_array2 = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, 2 * (hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, nnzrow, cnt)
+#endif
    {
+      HYPRE_Int i_begin, i_end;
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_variables);
+
       cnt = 0;
-      for (i = 0; i < num_variables; i++)
+      if (CF_init == 1)
       {
-         if ( CF_marker[i] != SF_PT )
+         for (i = i_begin; i < i_end; i++)
          {
-            if ( S_offd_i[i + 1] - S_offd_i[i] > 0 || CF_marker[i] == -1 )
-            {
-               CF_marker[i] = 0;
-            }
-            if ( CF_marker[i] == Z_PT)
+            graph_array2[i] = 0;
+            if ( CF_marker[i] != SF_PT )
             {
-               if ( measure_array[i] >= 1.0 || S_diag_i[i + 1] - S_diag_i[i] > 0 )
+               if ( S_offd_i[i + 1] - S_offd_i[i] > 0 || CF_marker[i] == -1 )
                {
                   CF_marker[i] = 0;
-                  graph_array[cnt++] = i;
+               }
+               if ( CF_marker[i] == Z_PT)
+               {
+                  if ( measure_array[i] >= 1.0 || S_diag_i[i + 1] - S_diag_i[i] > 0 )
+                  {
+                     CF_marker[i] = 0;
+                     graph_array2[i] = 1;
+                     cnt++;
+                  }
+                  else
+                  {
+                     CF_marker[i] = F_PT;
+                  }
                }
                else
                {
-                  CF_marker[i] = F_PT;
+                  graph_array2[i] = 1;
+                  cnt++;
                }
             }
             else
             {
-               graph_array[cnt++] = i;
+               measure_array[i] = 0;
             }
          }
-         else
-         {
-            measure_array[i] = 0;
-         }
       }
-   }
-   else
-   {
-      cnt = 0;
-      for (i = 0; i < num_variables; i++)
+      else
       {
-         CF_marker[i] = 0;
-         nnzrow = (S_diag_i[i + 1] - S_diag_i[i]) + (S_offd_i[i + 1] - S_offd_i[i]);
-         if (nnzrow == 0)
+         for (i = i_begin; i < i_end; i++)
          {
-            CF_marker[i] = SF_PT; /* an isolated fine grid */
-            if (CF_init == 3 || CF_init == 4)
+            CF_marker[i] = 0;
+            graph_array2[i] = 0;
+            nnzrow = (S_diag_i[i + 1] - S_diag_i[i]) + (S_offd_i[i + 1] - S_offd_i[i]);
+            if (nnzrow == 0)
             {
-               CF_marker[i] = C_PT;
+               CF_marker[i] = SF_PT; /* an isolated fine grid */
+               if (CF_init == 3 || CF_init == 4)
+               {
+                  CF_marker[i] = C_PT;
+               }
+               measure_array[i] = 0;
+            }
+            else
+            {
+               graph_array2[i] = 1;
+               cnt++;
             }
-            measure_array[i] = 0;
          }
-         else
+      }
+
+      hypre_prefix_sum(&cnt, &graph_size, prefix_sum_workspace);
+
+      for (i = i_begin; i < i_end; i++)
+      {
+         if (graph_array2[i])
          {
             graph_array[cnt++] = i;
          }
       }
-   }
+   } /* omp parallel */
 
-   graph_size = cnt;
+   hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
 
    /* now the off-diagonal part of CF_marker */
    if (num_cols_offd)
@@ -2416,6 +2450,9 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
       CF_marker_offd = NULL;
    }
 
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i = 0; i < num_cols_offd; i++)
    {
       CF_marker_offd[i] = 0;
@@ -2425,15 +2462,13 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
     * Communicate the local measures, which are complete,
     to the external nodes
     *------------------------------------------------*/
-   index = 0;
-   for (i = 0; i < num_sends; i++)
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(j, jrow) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); j++)
    {
-      start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-      for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1); j++)
-      {
-         jrow = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j);
-         buf_data[index++] = measure_array[jrow];
-      }
+      jrow = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j);
+      buf_data[j] = measure_array[jrow];
    }
 
    if (num_procs > 1)
@@ -2449,7 +2484,6 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
    }
 
    /* graph_array2 */
-   HYPRE_Int *graph_array2 = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
    HYPRE_Int *graph_array_offd2 = NULL;
    if (num_cols_offd)
    {
@@ -2606,10 +2640,13 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
       iter++;
 
       /*------------------------------------------------
-       * Set C-pts and F-pts.
+       * Set C-pts and F-pts.  This is done in two sweeps,
+       * so that the second one only reads C-points that
+       * are final, and the result does not depend on the
+       * order in which the nodes are visited.
        *------------------------------------------------*/
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(ig, i, jS, j) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE
 #endif
       for (ig = 0; ig < graph_size; ig++)
       {
@@ -2635,13 +2672,22 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
          {
             CF_marker[i] = C_PT;
          }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ig, i, jS, j) HYPRE_SMP_SCHEDULE
+#endif
+      for (ig = 0; ig < graph_size; ig++)
+      {
+         i = graph_array[ig];
+
          /*---------------------------------------------
           * Now treat the case where point i is not in the
           * independent set: loop over
           * all the points j that influence equation i; if
           * j is a C point, then make i an F point.
           *---------------------------------------------*/
-         else
+         if (CF_marker[i] <= 0)
          {
             /* first the local part */
             for (jS = S_diag_i[i]; jS < S_diag_i[i + 1]; jS++)
@@ -2662,8 +2708,8 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
                   CF_marker[i] = F_PT;
                }
             }
-         } /* end else */
-      } /* end first loop over graph */
+         } /* end if not a C point */
+      } /* end second loop over graph */
 
       /* now communicate CF_marker to CF_marker_offd, to make
          sure that new external F points are known on this processor */
@@ -2671,14 +2717,12 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
       /*------------------------------------------------------------------------------
        * Exchange boundary data for CF_marker: send internal points to external points
        *------------------------------------------------------------------------------*/
-      index = 0;
-      for (i = 0; i < num_sends; i++)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); j++)
       {
-         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1); j++)
-         {
-            int_buf_data[index++] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
-         }
+         int_buf_data[j] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
       }
 
       if (num_procs > 1)
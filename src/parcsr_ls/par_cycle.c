@@ -482,6 +482,36 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                   /* Gaussian elimination */
                   hypre_GaussElimSolve(amg_data, level, relax_type);
                }
+               else if (relax_type == 39)
+               {
+                  /* sparse direct solver */
+                  hypre_SparseDirectSolve(hypre_ParAMGDataSparseDirectSolver(amg_data),
+                                          Aux_F, Aux_U);
+               }
+               else if (relax_type == 88)
+               {
+                  /* multicolor Gauss-Seidel, colors in reverse order on the up cycle */
+                  HYPRE_Int     cf_points[2] = {0, 0};
+                  HYPRE_Int     num_cf = 1, k;
+                  hypre_Vector *color_l1_norms = hypre_ParAMGDataColorL1Norms(amg_data)[level];
+
+                  if (relax_local == 1 && cycle_param < 3)
+                  {
+                     cf_points[0] = cycle_param < 2 ? 1 : -1;
+                     cf_points[1] = -cf_points[0];
+                     num_cf = 2;
+                  }
+                  for (k = 0; k < num_cf; k++)
+                  {
+                     hypre_BoomerAMGRelaxMulticolorGaussSeidel(A_array[level], Aux_F, CF_marker,
+                                                               cf_points[k], relax_weight[level],
+                                                               color_l1_norms ?
+                                                               hypre_VectorData(color_l1_norms) : NULL,
+                                                               hypre_ParAMGDataColorStarts(amg_data)[level],
+                                                               hypre_ParAMGDataColorRows(amg_data)[level],
+                                                               cycle_param == 2, Aux_U);
+                  }
+               }
                else if (relax_type == 18)
                {
                   /* L1 - Jacobi*/
@@ -22,6 +22,8 @@ hypre_FSAICreate()
    HYPRE_Int            max_steps;
    HYPRE_Int            max_step_size;
    HYPRE_Real           kap_tolerance;
+   HYPRE_Int            num_levels;
+   HYPRE_Real           threshold;
 
    /* solver params */
    HYPRE_Int            eig_max_iters;
@@ -46,6 +48,8 @@ hypre_FSAICreate()
    max_steps = 3;
    max_step_size = 5;
    kap_tolerance = 1.0e-3;
+   num_levels = 1;
+   threshold = 0.0;
 
    /* solver params */
    eig_max_iters = 0;
@@ -71,11 +75,15 @@ hypre_FSAICreate()
    hypre_ParFSAIDataRWork(fsai_data)     = NULL;
    hypre_ParFSAIDataZWork(fsai_data)     = NULL;
    hypre_ParFSAIDataZeroGuess(fsai_data) = 0;
+   hypre_ParFSAIDataStaticPattern(fsai_data)  = NULL;
+   hypre_ParFSAIDataStaticPatternA(fsai_data) = NULL;
 
    hypre_FSAISetAlgoType(fsai_data, algo_type);
    hypre_FSAISetMaxSteps(fsai_data, max_steps);
    hypre_FSAISetMaxStepSize(fsai_data, max_step_size);
    hypre_FSAISetKapTolerance(fsai_data, kap_tolerance);
+   hypre_FSAISetNumLevels(fsai_data, num_levels);
+   hypre_FSAISetThreshold(fsai_data, threshold);
 
    hypre_FSAISetMaxIterations(fsai_data, max_iterations);
    hypre_FSAISetEigMaxIters(fsai_data, eig_max_iters);
@@ -117,6 +125,8 @@ hypre_FSAIDestroy( void *data )
 
       hypre_ParVectorDestroy(hypre_ParFSAIDataRWork(fsai_data));
       hypre_ParVectorDestroy(hypre_ParFSAIDataZWork(fsai_data));
+      hypre_CSRMatrixDestroy(hypre_ParFSAIDataStaticPattern(fsai_data));
+      hypre_CSRMatrixDestroy(hypre_ParFSAIDataStaticPatternA(fsai_data));
 
       hypre_TFree(fsai_data, HYPRE_MEMORY_HOST);
    }
@@ -222,6 +232,81 @@ hypre_FSAISetKapTolerance( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_FSAISetNumLevels( void      *data,
+                        HYPRE_Int  num_levels )
+{
+   hypre_ParFSAIData  *fsai_data = (hypre_ParFSAIData*) data;
+
+   if (!fsai_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (num_levels < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /* The cached static pattern no longer applies */
+   if (num_levels != hypre_ParFSAIDataNumLevels(fsai_data))
+   {
+      hypre_FSAIClearStaticPattern(fsai_data);
+   }
+   hypre_ParFSAIDataNumLevels(fsai_data) = num_levels;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_FSAISetThreshold( void       *data,
+                        HYPRE_Real  threshold )
+{
+   hypre_ParFSAIData  *fsai_data = (hypre_ParFSAIData*) data;
+
+   if (!fsai_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (threshold < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /* The cached static pattern no longer applies */
+   if (threshold != hypre_ParFSAIDataThreshold(fsai_data))
+   {
+      hypre_FSAIClearStaticPattern(fsai_data);
+   }
+   hypre_ParFSAIDataThreshold(fsai_data) = threshold;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_FSAIClearStaticPattern( void *data )
+{
+   hypre_ParFSAIData  *fsai_data = (hypre_ParFSAIData*) data;
+
+   if (!fsai_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixDestroy(hypre_ParFSAIDataStaticPattern(fsai_data));
+   hypre_CSRMatrixDestroy(hypre_ParFSAIDataStaticPatternA(fsai_data));
+   hypre_ParFSAIDataStaticPattern(fsai_data)  = NULL;
+   hypre_ParFSAIDataStaticPatternA(fsai_data) = NULL;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_FSAISetMaxIterations( void      *data,
                             HYPRE_Int  max_iterations )
@@ -485,6 +570,40 @@ hypre_FSAIGetKapTolerance( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_FSAIGetNumLevels( void      *data,
+                        HYPRE_Int *num_levels )
+{
+   hypre_ParFSAIData  *fsai_data = (hypre_ParFSAIData*) data;
+
+   if (!fsai_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *num_levels = hypre_ParFSAIDataNumLevels(fsai_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_FSAIGetThreshold( void       *data,
+                        HYPRE_Real *threshold )
+{
+   hypre_ParFSAIData  *fsai_data = (hypre_ParFSAIData*) data;
+
+   if (!fsai_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *threshold = hypre_ParFSAIDataThreshold(fsai_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_FSAIGetMaxIterations( void      *data,
                             HYPRE_Int *max_iterations )
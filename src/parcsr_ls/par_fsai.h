@@ -20,6 +20,10 @@ typedef struct hypre_ParFSAIData_struct
    HYPRE_Int
    max_step_size;   /* Maximum number of nonzero elements added to a row of G per step */
    HYPRE_Real            kap_tolerance;   /* Minimum amount of change between two steps */
+   HYPRE_Int             num_levels;      /* Power of A giving the static pattern of G */
+   HYPRE_Real            threshold;       /* Dropping threshold for the static pattern */
+   hypre_CSRMatrix      *static_patt;     /* Cached static pattern (strictly lower part of G) */
+   hypre_CSRMatrix      *static_patt_A;   /* Sparsity of A_diag the static pattern belongs to */
    hypre_ParCSRMatrix   *Gmat;            /* Matrix holding FSAI factor. M^(-1) = G'G */
    hypre_ParCSRMatrix   *GTmat;           /* Matrix holding the transpose of the FSAI factor */
 
@@ -51,6 +55,10 @@ typedef struct hypre_ParFSAIData_struct
 #define hypre_ParFSAIDataMaxSteps(fsai_data)                ((fsai_data) -> max_steps)
 #define hypre_ParFSAIDataMaxStepSize(fsai_data)             ((fsai_data) -> max_step_size)
 #define hypre_ParFSAIDataKapTolerance(fsai_data)            ((fsai_data) -> kap_tolerance)
+#define hypre_ParFSAIDataNumLevels(fsai_data)               ((fsai_data) -> num_levels)
+#define hypre_ParFSAIDataThreshold(fsai_data)               ((fsai_data) -> threshold)
+#define hypre_ParFSAIDataStaticPattern(fsai_data)           ((fsai_data) -> static_patt)
+#define hypre_ParFSAIDataStaticPatternA(fsai_data)          ((fsai_data) -> static_patt_A)
 #define hypre_ParFSAIDataGmat(fsai_data)                    ((fsai_data) -> Gmat)
 #define hypre_ParFSAIDataGTmat(fsai_data)                   ((fsai_data) -> GTmat)
 #define hypre_ParFSAIDataDensity(fsai_data)                 ((fsai_data) -> density)
@@ -11,6 +11,9 @@
 
 #define DEBUG 0
 
+/* Number of rows whose dense systems are solved together */
+#define FSAI_BATCH_SIZE 64
+
 /*****************************************************************************
  *
  * Routine for driving the setup phase of FSAI
@@ -399,8 +402,425 @@ hypre_DenseSPDSystemSolve( hypre_Vector *mat,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_DenseSPDSystemSolveBatch
+ *
+ * Solve nb dense SPD linear systems of size n at once with Cholesky:
+ *
+ *    mat_b*x_b = rhs_b,   b = 0, ..., nb-1
+ *
+ * The systems are interleaved: entry (i, j) of mat_b is stored in
+ * mat[(j*n + i)*nb + b] and entry i of rhs_b in rhs[i*nb + b], so that the
+ * innermost loops run across the systems and vectorize.  Only the lower
+ * triangles of the matrices are read; they are overwritten with their
+ * Cholesky factors, and rhs with the solutions.
+ *
+ * As with dpotrf, info[b] is 0 on success, or j+1 if the pivot of column j
+ * of mat_b is not positive.  Such a pivot is replaced by 1 so that the
+ * other systems of the batch can be completed, and the solution of system
+ * b is not valid; the caller must handle it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_DenseSPDSystemSolveBatch( HYPRE_Int      n,
+                                HYPRE_Int      nb,
+                                HYPRE_Complex *mat,
+                                HYPRE_Complex *rhs,
+                                HYPRE_Int     *info )
+{
+   HYPRE_Complex *L_jj, *L_ij, *L_ik, *L_jk, *x_i, *x_k;
+   HYPRE_Complex *work;
+   HYPRE_Int      i, j, k, b;
+
+   work = hypre_TAlloc(HYPRE_Complex, nb, HYPRE_MEMORY_HOST);
+   for (b = 0; b < nb; b++)
+   {
+      info[b] = 0;
+   }
+
+   /* Cholesky factorization, column by column (same operation order as dpotf2) */
+   for (j = 0; j < n; j++)
+   {
+      L_jj = mat + (j * n + j) * nb;
+      for (b = 0; b < nb; b++)
+      {
+         work[b] = 0.0;
+      }
+      for (k = 0; k < j; k++)
+      {
+         L_jk = mat + (k * n + j) * nb;
+         for (b = 0; b < nb; b++)
+         {
+            work[b] += L_jk[b] * L_jk[b];
+         }
+      }
+      for (b = 0; b < nb; b++)
+      {
+         L_jj[b] -= work[b];
+         if (hypre_creal(L_jj[b]) <= 0.0)
+         {
+            L_jj[b] = 1.0;
+            if (!info[b])
+            {
+               info[b] = j + 1;
+            }
+         }
+      }
+      for (b = 0; b < nb; b++)
+      {
+         L_jj[b] = hypre_csqrt(L_jj[b]);
+         work[b] = 1.0 / L_jj[b];
+      }
+
+      for (i = j + 1; i < n; i++)
+      {
+         L_ij = mat + (j * n + i) * nb;
+         for (k = 0; k < j; k++)
+         {
+            L_ik = mat + (k * n + i) * nb;
+            L_jk = mat + (k * n + j) * nb;
+            for (b = 0; b < nb; b++)
+            {
+               L_ij[b] -= L_ik[b] * L_jk[b];
+            }
+         }
+         for (b = 0; b < nb; b++)
+         {
+            L_ij[b] *= work[b];
+         }
+      }
+   }
+
+   /* Forward substitution with L */
+   for (i = 0; i < n; i++)
+   {
+      x_i = rhs + i * nb;
+      for (k = 0; k < i; k++)
+      {
+         L_ik = mat + (k * n + i) * nb;
+         x_k  = rhs + k * nb;
+         for (b = 0; b < nb; b++)
+         {
+            x_i[b] -= L_ik[b] * x_k[b];
+         }
+      }
+      L_jj = mat + (i * n + i) * nb;
+      for (b = 0; b < nb; b++)
+      {
+         x_i[b] /= L_jj[b];
+      }
+   }
+
+   /* Backward substitution with L^T */
+   for (i = n - 1; i >= 0; i--)
+   {
+      x_i = rhs + i * nb;
+      for (k = i + 1; k < n; k++)
+      {
+         L_ik = mat + (i * n + k) * nb;
+         x_k  = rhs + k * nb;
+         for (b = 0; b < nb; b++)
+         {
+            x_i[b] -= L_ik[b] * x_k[b];
+         }
+      }
+      L_jj = mat + (i * n + i) * nb;
+      for (b = 0; b < nb; b++)
+      {
+         x_i[b] /= L_jj[b];
+      }
+   }
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAISetupRowBlock
+ *
+ * Compute rows ns to ne-1 of G (at most FSAI_BATCH_SIZE rows) with the
+ * adaptive FSAI algorithm.  The rows go through the pattern steps together,
+ * so that the dense systems A[P, P] G[i, P]' = -A[i, P] of one step can be
+ * grouped by size and solved with hypre_DenseSPDSystemSolveBatch.  If the
+ * Cholesky factorization of a row's system fails, an error naming the row
+ * is raised and the row keeps the pattern and values of the previous step.
+ *
+ * Row i of G is computed from row i + shift of A and is written to G_j and
+ * G_a starting at position i * max_nnzrow_G, with the column indices of A.
+ * On input, kg_marker must be all zeros and marker all -1 (both of length
+ * equal to the number of rows of A); they are returned as such.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FSAISetupRowBlock( hypre_CSRMatrix *A,
+                         HYPRE_Int        shift,
+                         HYPRE_Int        ns,
+                         HYPRE_Int        ne,
+                         HYPRE_Int        max_steps,
+                         HYPRE_Int        max_step_size,
+                         HYPRE_Real       kap_tolerance,
+                         HYPRE_Int        max_cand_size,
+                         HYPRE_Int       *kg_marker,
+                         HYPRE_Int       *marker,
+                         HYPRE_Int       *G_j,
+                         HYPRE_Complex   *G_a,
+                         HYPRE_Int       *G_nnzcnt )
+{
+   HYPRE_Int      *A_i = hypre_CSRMatrixI(A);
+   HYPRE_Complex  *A_a = hypre_CSRMatrixData(A);
+   HYPRE_Int       max_nnzrow_G = max_steps * max_step_size + 1;
+   HYPRE_Int       nb = ne - ns;
+
+   hypre_Vector   *G_temp;        /* Vector holding the values of G[i,:] */
+   hypre_Vector   *A_sub;         /* Vector holding the dense submatrix A[P, P] */
+   hypre_Vector   *A_subrow;      /* Vector holding A[i, P] */
+   hypre_Vector   *kap_grad;      /* Vector holding the Kaporin gradient values */
+   HYPRE_Int      *kg_pos;        /* Indices of nonzero entries of kap_grad */
+   HYPRE_Int      *pattern;       /* Column indices of G[i,:], max_nnzrow_G apart */
+   HYPRE_Int      *patt_size;     /* Number of entries in current patterns */
+   HYPRE_Int      *prev_size;     /* Number of entries in the patterns of the previous step */
+   HYPRE_Int      *active;        /* Rows whose pattern is still growing */
+   HYPRE_Int      *sys, *sys_size;/* Rows to solve for in the current step, and sizes */
+   HYPRE_Int      *info;          /* Cholesky status of the systems */
+   HYPRE_Complex  *G_vals;        /* Values of G[i,:], max_nnzrow_G apart */
+   HYPRE_Complex  *old_psi;       /* GAG' before k-th interation of aFSAI */
+   HYPRE_Complex  *new_psi;       /* GAG' after k-th interation of aFSAI */
+   HYPRE_Complex  *mat, *rhs;     /* Interleaved dense systems */
+   HYPRE_Complex  *subrow;        /* Interleaved copies of A[i, P] */
+   HYPRE_Complex  *G_temp_data;
+   HYPRE_Complex  *A_sub_data;
+   HYPRE_Complex  *A_subrow_data;
+   HYPRE_Complex   row_scale;     /* Scaling factor for G[i,:] */
+   HYPRE_Int      *pattern_r;
+   HYPRE_Int       num_sys, patt_size_old, n, m;
+   HYPRE_Int       i, j, jj, k, r, b, s, t;
+   char            msg[512];      /* Warning message */
+
+   /* Allocate work space */
+   G_temp    = hypre_SeqVectorCreate(max_nnzrow_G);
+   A_subrow  = hypre_SeqVectorCreate(max_nnzrow_G);
+   kap_grad  = hypre_SeqVectorCreate(max_cand_size);
+   A_sub     = hypre_SeqVectorCreate(max_nnzrow_G * max_nnzrow_G);
+   hypre_SeqVectorInitialize(G_temp);
+   hypre_SeqVectorInitialize(A_subrow);
+   hypre_SeqVectorInitialize(kap_grad);
+   hypre_SeqVectorInitialize(A_sub);
+   G_temp_data   = hypre_VectorData(G_temp);
+   A_sub_data    = hypre_VectorData(A_sub);
+   A_subrow_data = hypre_VectorData(A_subrow);
+
+   kg_pos    = hypre_CTAlloc(HYPRE_Int, max_cand_size, HYPRE_MEMORY_HOST);
+   pattern   = hypre_CTAlloc(HYPRE_Int, nb * max_nnzrow_G, HYPRE_MEMORY_HOST);
+   patt_size = hypre_CTAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   prev_size = hypre_CTAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   active    = hypre_CTAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   sys       = hypre_CTAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   sys_size  = hypre_CTAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   info      = hypre_CTAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   G_vals    = hypre_CTAlloc(HYPRE_Complex, nb * max_nnzrow_G, HYPRE_MEMORY_HOST);
+   old_psi   = hypre_CTAlloc(HYPRE_Complex, nb, HYPRE_MEMORY_HOST);
+   new_psi   = hypre_CTAlloc(HYPRE_Complex, nb, HYPRE_MEMORY_HOST);
+   mat       = hypre_CTAlloc(HYPRE_Complex, nb * max_nnzrow_G * max_nnzrow_G, HYPRE_MEMORY_HOST);
+   rhs       = hypre_CTAlloc(HYPRE_Complex, nb * max_nnzrow_G, HYPRE_MEMORY_HOST);
+   subrow    = hypre_CTAlloc(HYPRE_Complex, nb * max_nnzrow_G, HYPRE_MEMORY_HOST);
+
+   /* Set old_psi up front so we don't have to compute GAG' twice in the step loop */
+   for (r = 0; r < nb; r++)
+   {
+      active[r]  = 1;
+      new_psi[r] = old_psi[r] = A_a[A_i[ns + r + shift]];
+   }
+
+   /* Cycle through the steps for all rows of the block */
+   for (k = 0; k < max_steps; k++)
+   {
+      /* Extend the patterns of the active rows */
+      num_sys = 0;
+      for (r = 0; r < nb; r++)
+      {
+         if (!active[r])
+         {
+            continue;
+         }
+         pattern_r = pattern + r * max_nnzrow_G;
+
+         /* Entries of the current pattern are no candidates */
+         for (j = 0; j < patt_size[r]; j++)
+         {
+            kg_marker[pattern_r[j]] = -1;
+            G_temp_data[j] = G_vals[r * max_nnzrow_G + j];
+         }
+         hypre_VectorSize(G_temp) = patt_size[r];
+
+         /* Compute Kaporin Gradient */
+         hypre_FindKapGrad(A, kap_grad, kg_pos, G_temp, pattern_r,
+                           patt_size[r], max_nnzrow_G, ns + r + shift, kg_marker);
+
+         /* Find max_step_size largest values of the kaporin gradient,
+            find their column indices, and add it to pattern */
+         patt_size_old = prev_size[r] = patt_size[r];
+         hypre_AddToPattern(kap_grad, kg_pos, pattern_r, &patt_size[r],
+                            kg_marker, max_step_size);
+         for (j = 0; j < patt_size[r]; j++)
+         {
+            kg_marker[pattern_r[j]] = 0;
+         }
+
+         if (patt_size[r] == patt_size_old)
+         {
+            new_psi[r] = old_psi[r];
+            active[r]  = 0;
+         }
+         else
+         {
+            sys[num_sys]      = r;
+            sys_size[num_sys] = patt_size[r];
+            num_sys++;
+         }
+      }
+
+      if (!num_sys)
+      {
+         break;
+      }
+
+      /* Solve the systems of each size at once */
+      hypre_qsort2i(sys_size, sys, 0, num_sys - 1);
+      for (s = 0; s < num_sys; s = t)
+      {
+         n = sys_size[s];
+         for (t = s; t < num_sys && sys_size[t] == n; t++);
+         m = t - s;
+
+         /* Gather A[P, P] and -A[i, P] */
+         hypre_VectorSize(A_sub)    = n * n;
+         hypre_VectorSize(A_subrow) = n;
+         for (b = 0; b < m; b++)
+         {
+            r = sys[s + b];
+            pattern_r = pattern + r * max_nnzrow_G;
+            for (j = 0; j < n; j++)
+            {
+               marker[pattern_r[j]] = j;
+            }
+            hypre_CSRMatrixExtractDenseMat(A, A_sub, pattern_r, n, marker);
+            hypre_CSRMatrixExtractDenseRow(A, A_subrow, marker, ns + r + shift);
+            for (j = 0; j < n; j++)
+            {
+               marker[pattern_r[j]] = -1;
+            }
+
+            for (jj = 0; jj < n * n; jj++)
+            {
+               mat[jj * m + b] = A_sub_data[jj];
+            }
+            for (j = 0; j < n; j++)
+            {
+               subrow[j * m + b] = A_subrow_data[j];
+               rhs[j * m + b]    = -A_subrow_data[j];
+            }
+         }
+
+         /* Solve A[P, P] G[i, P]' = -A[i, P] */
+         hypre_DenseSPDSystemSolveBatch(n, m, mat, rhs, info);
+
+         /* Determine psi_{k+1} = G_temp[i]*A*G_temp[i]' and check its reduction */
+         for (b = 0; b < m; b++)
+         {
+            r = sys[s + b];
+            if (info[b])
+            {
+               hypre_sprintf(msg, "Error: Cholesky factorization failed with code %d in row %d\n",
+                             info[b], ns + r);
+               hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+
+               /* Keep the row of the previous step */
+               patt_size[r] = prev_size[r];
+               new_psi[r]   = old_psi[r];
+               active[r]    = 0;
+               continue;
+            }
+
+            new_psi[r] = A_a[A_i[ns + r + shift]];
+            for (j = 0; j < n; j++)
+            {
+               G_vals[r * max_nnzrow_G + j] = rhs[j * m + b];
+               new_psi[r] += rhs[j * m + b] * subrow[j * m + b];
+            }
+
+            if (hypre_cabs(new_psi[r] - old_psi[r]) < hypre_creal(kap_tolerance * old_psi[r]))
+            {
+               active[r] = 0;
+            }
+            else
+            {
+               old_psi[r] = new_psi[r];
+            }
+         }
+      }
+   }
+
+   /* Pass the scaled rows into G */
+   for (r = 0; r < nb; r++)
+   {
+      i = ns + r;
+      pattern_r = pattern + r * max_nnzrow_G;
+
+      /* Compute scaling factor */
+      if (hypre_creal(new_psi[r]) > 0 && hypre_cimag(new_psi[r]) == 0)
+      {
+         row_scale = 1.0 / hypre_csqrt(new_psi[r]);
+      }
+      else
+      {
+         hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", i);
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+
+         row_scale = 1.0 / hypre_cabs(A_a[A_i[i + shift]]);
+         patt_size[r] = 0;
+      }
+
+      j = i * max_nnzrow_G;
+      G_j[j] = i + shift;
+      G_a[j] = row_scale;
+      j++;
+      for (jj = 0; jj < patt_size[r]; jj++)
+      {
+         G_j[j] = pattern_r[jj];
+         G_a[j++] = row_scale * G_vals[r * max_nnzrow_G + jj];
+      }
+      G_nnzcnt[i] = patt_size[r] + 1;
+   }
+
+   /* Free memory */
+   hypre_SeqVectorDestroy(G_temp);
+   hypre_SeqVectorDestroy(A_subrow);
+   hypre_SeqVectorDestroy(kap_grad);
+   hypre_SeqVectorDestroy(A_sub);
+   hypre_TFree(kg_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(pattern, HYPRE_MEMORY_HOST);
+   hypre_TFree(patt_size, HYPRE_MEMORY_HOST);
+   hypre_TFree(prev_size, HYPRE_MEMORY_HOST);
+   hypre_TFree(active, HYPRE_MEMORY_HOST);
+   hypre_TFree(sys, HYPRE_MEMORY_HOST);
+   hypre_TFree(sys_size, HYPRE_MEMORY_HOST);
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(G_vals, HYPRE_MEMORY_HOST);
+   hypre_TFree(old_psi, HYPRE_MEMORY_HOST);
+   hypre_TFree(new_psi, HYPRE_MEMORY_HOST);
+   hypre_TFree(mat, HYPRE_MEMORY_HOST);
+   hypre_TFree(rhs, HYPRE_MEMORY_HOST);
+   hypre_TFree(subrow, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_FSAISetupNative
+ *
+ * Each thread computes a contiguous range of rows, in blocks of
+ * FSAI_BATCH_SIZE rows.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -417,8 +837,6 @@ hypre_FSAISetupNative( void               *fsai_vdata,
 
    /* CSRMatrix A_diag variables */
    hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Int              *A_i              = hypre_CSRMatrixI(A_diag);
-   HYPRE_Complex          *A_a              = hypre_CSRMatrixData(A_diag);
    HYPRE_Int               num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_Int               num_nnzs_diag_A  = hypre_CSRMatrixNumNonzeros(A_diag);
    HYPRE_Int               avg_nnzrow_diag_A;
@@ -429,12 +847,12 @@ hypre_FSAISetupNative( void               *fsai_vdata,
    HYPRE_Int              *G_i;
    HYPRE_Int              *G_j;
    HYPRE_Complex          *G_a;
+   HYPRE_Int              *G_nnzcnt;            /* Array holding number of nonzeros of row G[i,:] */
    HYPRE_Int               max_nnzrow_diag_G;   /* Max. number of nonzeros per row in G_diag */
    HYPRE_Int               max_cand_size;       /* Max size of kg_pos */
 
    /* Local variables */
-   char                     msg[512];    /* Warning message */
-   HYPRE_Complex           *twspace;     /* shared work space for omp threads */
+   HYPRE_Int               i, j, jj;
 
    /* Initalize some variables */
    avg_nnzrow_diag_A = (num_rows_diag_A > 0) ? num_nnzs_diag_A / num_rows_diag_A : 0;
@@ -445,9 +863,7 @@ hypre_FSAISetupNative( void               *fsai_vdata,
    G_a = hypre_CSRMatrixData(G_diag);
    G_i = hypre_CSRMatrixI(G_diag);
    G_j = hypre_CSRMatrixJ(G_diag);
-
-   /* Allocate shared work space array for OpenMP threads */
-   twspace = hypre_CTAlloc(HYPRE_Complex, hypre_NumThreads() + 1, HYPRE_MEMORY_HOST);
+   G_nnzcnt = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
 
    /**********************************************************************
    * Start of Adaptive FSAI algorithm
@@ -459,220 +875,49 @@ hypre_FSAISetupNative( void               *fsai_vdata,
    #pragma omp parallel
 #endif
    {
-      hypre_Vector   *G_temp;        /* Vector holding the values of G[i,:] */
-      hypre_Vector   *A_sub;         /* Vector holding the dense submatrix A[P, P] */
-      hypre_Vector   *A_subrow;      /* Vector holding A[i, P] */
-      hypre_Vector   *kap_grad;      /* Vector holding the Kaporin gradient values */
-      HYPRE_Int      *kg_pos;        /* Indices of nonzero entries of kap_grad */
       HYPRE_Int      *kg_marker;     /* Marker array with nonzeros pointing to kg_pos */
       HYPRE_Int      *marker;        /* Marker array with nonzeros pointing to P */
-      HYPRE_Int      *pattern;       /* Array holding column indices of G[i,:] */
-      HYPRE_Int       patt_size;     /* Number of entries in current pattern */
-      HYPRE_Int       patt_size_old; /* Number of entries in previous pattern */
       HYPRE_Int       ii;            /* Thread identifier */
       HYPRE_Int       num_threads;   /* Number of active threads */
       HYPRE_Int       ns, ne;        /* Initial and last row indices */
-      HYPRE_Int       i, j, k, iloc; /* Loop variables */
-      HYPRE_Complex   old_psi;       /* GAG' before k-th interation of aFSAI */
-      HYPRE_Complex   new_psi;       /* GAG' after k-th interation of aFSAI */
-      HYPRE_Complex   row_scale;     /* Scaling factor for G_temp */
-      HYPRE_Complex  *G_temp_data;
-      HYPRE_Complex  *A_subrow_data;
-
-      HYPRE_Int       num_rows_Gloc;
-      HYPRE_Int       num_nnzs_Gloc;
-      HYPRE_Int      *Gloc_i;
-      HYPRE_Int      *Gloc_j;
-      HYPRE_Complex  *Gloc_a;
-
-      /* Allocate and initialize local vector variables */
-      G_temp    = hypre_SeqVectorCreate(max_nnzrow_diag_G);
-      A_subrow  = hypre_SeqVectorCreate(max_nnzrow_diag_G);
-      kap_grad  = hypre_SeqVectorCreate(max_cand_size);
-      A_sub     = hypre_SeqVectorCreate(max_nnzrow_diag_G * max_nnzrow_diag_G);
-      pattern   = hypre_CTAlloc(HYPRE_Int, max_nnzrow_diag_G, HYPRE_MEMORY_HOST);
-      kg_pos    = hypre_CTAlloc(HYPRE_Int, max_cand_size, HYPRE_MEMORY_HOST);
+      HYPRE_Int       i;
+
       kg_marker = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
       marker    = hypre_TAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
-
-      hypre_SeqVectorInitialize(G_temp);
-      hypre_SeqVectorInitialize(A_subrow);
-      hypre_SeqVectorInitialize(kap_grad);
-      hypre_SeqVectorInitialize(A_sub);
       hypre_Memset(marker, -1, num_rows_diag_A * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
 
-      /* Setting data variables for vectors */
-      G_temp_data   = hypre_VectorData(G_temp);
-      A_subrow_data = hypre_VectorData(A_subrow);
-
       ii = hypre_GetThreadNum();
       num_threads = hypre_NumActiveThreads();
       hypre_partition1D(num_rows_diag_A, num_threads, ii, &ns, &ne);
 
-      num_rows_Gloc = ne - ns;
-      if (num_threads == 1)
-      {
-         Gloc_i = G_i;
-         Gloc_j = G_j;
-         Gloc_a = G_a;
-      }
-      else
-      {
-         num_nnzs_Gloc = num_rows_Gloc * max_nnzrow_diag_G;
-
-         Gloc_i = hypre_CTAlloc(HYPRE_Int, num_rows_Gloc + 1, HYPRE_MEMORY_HOST);
-         Gloc_j = hypre_CTAlloc(HYPRE_Int, num_nnzs_Gloc, HYPRE_MEMORY_HOST);
-         Gloc_a = hypre_CTAlloc(HYPRE_Complex, num_nnzs_Gloc, HYPRE_MEMORY_HOST);
-      }
-
-      for (i = ns; i < ne; i++)
-      {
-         patt_size = 0;
-
-         /* Set old_psi up front so we don't have to compute GAG' twice in the inner for-loop */
-         new_psi = old_psi = A_a[A_i[i]];
-
-         /* Cycle through each iteration for that row */
-         for (k = 0; k < max_steps; k++)
-         {
-            /* Compute Kaporin Gradient */
-            hypre_FindKapGrad(A_diag, kap_grad, kg_pos, G_temp, pattern,
-                              patt_size, max_nnzrow_diag_G, i, kg_marker);
-
-            /* Find max_step_size largest values of the kaporin gradient,
-               find their column indices, and add it to pattern */
-            patt_size_old = patt_size;
-            hypre_AddToPattern(kap_grad, kg_pos, pattern, &patt_size,
-                               kg_marker, max_step_size);
-
-            /* Update sizes */
-            hypre_VectorSize(A_sub)    = patt_size * patt_size;
-            hypre_VectorSize(A_subrow) = patt_size;
-            hypre_VectorSize(G_temp)   = patt_size;
-
-            if (patt_size == patt_size_old)
-            {
-               new_psi = old_psi;
-               break;
-            }
-            else
-            {
-               /* Gather A[P, P] and -A[i, P] */
-               for (j = 0; j < patt_size; j++)
-               {
-                  marker[pattern[j]] = j;
-               }
-               hypre_CSRMatrixExtractDenseMat(A_diag, A_sub, pattern, patt_size, marker);
-               hypre_CSRMatrixExtractDenseRow(A_diag, A_subrow, marker, i);
-
-               /* Solve A[P, P] G[i, P]' = -A[i, P] */
-               hypre_DenseSPDSystemSolve(A_sub, A_subrow, G_temp);
-
-               /* Determine psi_{k+1} = G_temp[i]*A*G_temp[i]' */
-               new_psi = A_a[A_i[i]];
-               for (j = 0; j < patt_size; j++)
-               {
-                  new_psi += G_temp_data[j] * A_subrow_data[j];
-               }
-
-               /* Check psi reduction */
-               if (hypre_cabs(new_psi - old_psi) < hypre_creal(kap_tolerance * old_psi))
-               {
-                  break;
-               }
-               else
-               {
-                  old_psi = new_psi;
-               }
-            }
-         }
-
-         /* Reset marker for building dense linear system */
-         for (j = 0; j < patt_size; j++)
-         {
-            marker[pattern[j]] = -1;
-         }
-
-         /* Compute scaling factor */
-         if (hypre_creal(new_psi) > 0 && hypre_cimag(new_psi) == 0)
-         {
-            row_scale = 1.0 / hypre_csqrt(new_psi);
-         }
-         else
-         {
-            hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", i);
-            hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
-
-            row_scale = 1.0 / hypre_cabs(A_a[A_i[i]]);
-            hypre_VectorSize(G_temp) = patt_size = 0;
-         }
-
-         /* Pass values of G_temp into G */
-         iloc = i - ns;
-         Gloc_j[Gloc_i[iloc]] = i;
-         Gloc_a[Gloc_i[iloc]] = row_scale;
-         for (k = 0; k < patt_size; k++)
-         {
-            j = Gloc_i[iloc] + k + 1;
-            Gloc_j[j] = pattern[k];
-            Gloc_a[j] = row_scale * G_temp_data[k];
-            kg_marker[pattern[k]] = 0;
-         }
-         Gloc_i[iloc + 1] = Gloc_i[iloc] + k + 1;
-      }
-
-      /* Copy data to shared memory */
-      twspace[ii + 1] = Gloc_i[num_rows_Gloc] - Gloc_i[0];
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp barrier
-      #pragma omp single
-#endif
-      {
-         for (i = 0; i < num_threads; i++)
-         {
-            twspace[i + 1] += twspace[i];
-         }
-      }
-
-      if (num_threads > 1)
+      for (i = ns; i < ne; i += FSAI_BATCH_SIZE)
       {
-         /* Correct row pointer G_i */
-         G_i[ns] = twspace[ii];
-         for (i = ns; i < ne; i++)
-         {
-            iloc = i - ns;
-            G_i[i + 1] = G_i[i] + Gloc_i[iloc + 1] - Gloc_i[iloc];
-         }
-
-         /* Move G_j and G_a */
-         for (i = ns; i < ne; i++)
-         {
-            for (j = G_i[i]; j < G_i[i + 1]; j++)
-            {
-               G_j[j] = Gloc_j[j - G_i[ns]];
-               G_a[j] = Gloc_a[j - G_i[ns]];
-            }
-         }
-
-         hypre_TFree(Gloc_i, HYPRE_MEMORY_HOST);
-         hypre_TFree(Gloc_j, HYPRE_MEMORY_HOST);
-         hypre_TFree(Gloc_a, HYPRE_MEMORY_HOST);
+         hypre_FSAISetupRowBlock(A_diag, 0, i, hypre_min(i + FSAI_BATCH_SIZE, ne),
+                                 max_steps, max_step_size, kap_tolerance, max_cand_size,
+                                 kg_marker, marker, G_j, G_a, G_nnzcnt);
       }
 
       /* Free memory */
-      hypre_SeqVectorDestroy(G_temp);
-      hypre_SeqVectorDestroy(A_subrow);
-      hypre_SeqVectorDestroy(kap_grad);
-      hypre_SeqVectorDestroy(A_sub);
-      hypre_TFree(kg_pos, HYPRE_MEMORY_HOST);
-      hypre_TFree(pattern, HYPRE_MEMORY_HOST);
       hypre_TFree(marker, HYPRE_MEMORY_HOST);
       hypre_TFree(kg_marker, HYPRE_MEMORY_HOST);
    } /* end openmp region */
    HYPRE_ANNOTATE_REGION_END("%s", "MainLoop");
 
+   /* Reorder array */
+   G_i[0] = 0;
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      G_i[i + 1] = G_i[i] + G_nnzcnt[i];
+      jj = i * max_nnzrow_diag_G;
+      for (j = G_i[i]; j < G_i[i + 1]; j++)
+      {
+         G_j[j] = G_j[jj];
+         G_a[j] = G_a[jj++];
+      }
+   }
+
    /* Free memory */
-   hypre_TFree(twspace, HYPRE_MEMORY_HOST);
+   hypre_TFree(G_nnzcnt, HYPRE_MEMORY_HOST);
 
    /* Update local number of nonzeros of G */
    hypre_CSRMatrixNumNonzeros(G_diag) = G_i[num_rows_diag_A];
@@ -682,6 +927,8 @@ hypre_FSAISetupNative( void               *fsai_vdata,
 
 /*--------------------------------------------------------------------------
  * hypre_FSAISetupOMPDyn
+ *
+ * Blocks of FSAI_BATCH_SIZE rows are handed out to the threads dynamically.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -698,8 +945,6 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
 
    /* CSRMatrix A_diag variables */
    hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Int              *A_i              = hypre_CSRMatrixI(A_diag);
-   HYPRE_Complex          *A_a              = hypre_CSRMatrixData(A_diag);
    HYPRE_Int               num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_Int               num_nnzs_diag_A  = hypre_CSRMatrixNumNonzeros(A_diag);
    HYPRE_Int               avg_nnzrow_diag_A;
@@ -716,13 +961,13 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
 
    /* Local variables */
    HYPRE_Int                i, j, jj;
-   char                     msg[512];    /* Warning message */
-   HYPRE_Complex           *twspace;     /* shared work space for omp threads */
+   HYPRE_Int                num_blocks;
 
    /* Initalize some variables */
-   avg_nnzrow_diag_A = num_nnzs_diag_A / num_rows_diag_A;
+   avg_nnzrow_diag_A = (num_rows_diag_A > 0) ? num_nnzs_diag_A / num_rows_diag_A : 0;
    max_nnzrow_diag_G = max_steps * max_step_size + 1;
    max_cand_size     = avg_nnzrow_diag_A * max_nnzrow_diag_G;
+   num_blocks        = (num_rows_diag_A + FSAI_BATCH_SIZE - 1) / FSAI_BATCH_SIZE;
 
    G_diag = hypre_ParCSRMatrixDiag(G);
    G_a = hypre_CSRMatrixData(G_diag);
@@ -730,9 +975,6 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
    G_j = hypre_CSRMatrixJ(G_diag);
    G_nnzcnt = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
 
-   /* Allocate shared work space array for OpenMP threads */
-   twspace = hypre_CTAlloc(HYPRE_Complex, hypre_NumThreads() + 1, HYPRE_MEMORY_HOST);
-
    /**********************************************************************
    * Start of Adaptive FSAI algorithm
    ***********************************************************************/
@@ -743,150 +985,26 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
    #pragma omp parallel
 #endif
    {
-      hypre_Vector   *G_temp;        /* Vector holding the values of G[i,:] */
-      hypre_Vector   *A_sub;         /* Vector holding the dense submatrix A[P, P] */
-      hypre_Vector   *A_subrow;      /* Vector holding A[i, P] */
-      hypre_Vector   *kap_grad;      /* Vector holding the Kaporin gradient values */
-      HYPRE_Int      *kg_pos;        /* Indices of nonzero entries of kap_grad */
       HYPRE_Int      *kg_marker;     /* Marker array with nonzeros pointing to kg_pos */
       HYPRE_Int      *marker;        /* Marker array with nonzeros pointing to P */
-      HYPRE_Int      *pattern;       /* Array holding column indices of G[i,:] */
-      HYPRE_Int       patt_size;     /* Number of entries in current pattern */
-      HYPRE_Int       patt_size_old; /* Number of entries in previous pattern */
-      HYPRE_Int       i, j, k;       /* Loop variables */
-      HYPRE_Complex   old_psi;       /* GAG' before k-th interation of aFSAI */
-      HYPRE_Complex   new_psi;       /* GAG' after k-th interation of aFSAI */
-      HYPRE_Complex   row_scale;     /* Scaling factor for G_temp */
-      HYPRE_Complex  *G_temp_data;
-      HYPRE_Complex  *A_subrow_data;
-
-
-      /* Allocate and initialize local vector variables */
-      G_temp    = hypre_SeqVectorCreate(max_nnzrow_diag_G);
-      A_subrow  = hypre_SeqVectorCreate(max_nnzrow_diag_G);
-      kap_grad  = hypre_SeqVectorCreate(max_cand_size);
-      A_sub     = hypre_SeqVectorCreate(max_nnzrow_diag_G * max_nnzrow_diag_G);
-      pattern   = hypre_CTAlloc(HYPRE_Int, max_nnzrow_diag_G, HYPRE_MEMORY_HOST);
-      kg_pos    = hypre_CTAlloc(HYPRE_Int, max_cand_size, HYPRE_MEMORY_HOST);
+      HYPRE_Int       k, ns;
+
       kg_marker = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
       marker    = hypre_TAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
-
-      hypre_SeqVectorInitialize(G_temp);
-      hypre_SeqVectorInitialize(A_subrow);
-      hypre_SeqVectorInitialize(kap_grad);
-      hypre_SeqVectorInitialize(A_sub);
       hypre_Memset(marker, -1, num_rows_diag_A * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
 
-      /* Setting data variables for vectors */
-      G_temp_data   = hypre_VectorData(G_temp);
-      A_subrow_data = hypre_VectorData(A_subrow);
-
 #ifdef HYPRE_USING_OPENMP
       #pragma omp for schedule(dynamic)
 #endif
-      for (i = 0; i < num_rows_diag_A; i++)
+      for (k = 0; k < num_blocks; k++)
       {
-         patt_size = 0;
-
-         /* Set old_psi up front so we don't have to compute GAG' twice in the inner for-loop */
-         new_psi = old_psi = A_a[A_i[i]];
-
-         /* Cycle through each iteration for that row */
-         for (k = 0; k < max_steps; k++)
-         {
-            /* Compute Kaporin Gradient */
-            hypre_FindKapGrad(A_diag, kap_grad, kg_pos, G_temp, pattern,
-                              patt_size, max_nnzrow_diag_G, i, kg_marker);
-
-            /* Find max_step_size largest values of the kaporin gradient,
-               find their column indices, and add it to pattern */
-            patt_size_old = patt_size;
-            hypre_AddToPattern(kap_grad, kg_pos, pattern, &patt_size,
-                               kg_marker, max_step_size);
-
-            /* Update sizes */
-            hypre_VectorSize(A_sub)    = patt_size * patt_size;
-            hypre_VectorSize(A_subrow) = patt_size;
-            hypre_VectorSize(G_temp)   = patt_size;
-
-            if (patt_size == patt_size_old)
-            {
-               new_psi = old_psi;
-               break;
-            }
-            else
-            {
-               /* Gather A[P, P] and -A[i, P] */
-               for (j = 0; j < patt_size; j++)
-               {
-                  marker[pattern[j]] = j;
-               }
-               hypre_CSRMatrixExtractDenseMat(A_diag, A_sub, pattern, patt_size, marker);
-               hypre_CSRMatrixExtractDenseRow(A_diag, A_subrow, marker, i);
-
-               /* Solve A[P, P] G[i, P]' = -A[i, P] */
-               hypre_DenseSPDSystemSolve(A_sub, A_subrow, G_temp);
-
-               /* Determine psi_{k+1} = G_temp[i]*A*G_temp[i]' */
-               new_psi = A_a[A_i[i]];
-               for (j = 0; j < patt_size; j++)
-               {
-                  new_psi += G_temp_data[j] * A_subrow_data[j];
-               }
-
-               /* Check psi reduction */
-               if (hypre_cabs(new_psi - old_psi) < hypre_creal(kap_tolerance * old_psi))
-               {
-                  break;
-               }
-               else
-               {
-                  old_psi = new_psi;
-               }
-            }
-         }
-
-         /* Reset marker for building dense linear system */
-         for (j = 0; j < patt_size; j++)
-         {
-            marker[pattern[j]] = -1;
-         }
-
-         /* Compute scaling factor */
-         if (hypre_creal(new_psi) > 0 && hypre_cimag(new_psi) == 0)
-         {
-            row_scale = 1.0 / hypre_csqrt(new_psi);
-         }
-         else
-         {
-            hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", i);
-            hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
-
-            row_scale = 1.0 / hypre_cabs(A_a[A_i[i]]);
-            hypre_VectorSize(G_temp) = patt_size = 0;
-         }
-
-         /* Pass values of G_temp into G */
-         j = i * max_nnzrow_diag_G;
-         G_j[j] = i;
-         G_a[j] = row_scale;
-         j++;
-         for (k = 0; k < patt_size; k++)
-         {
-            G_j[j] = pattern[k];
-            G_a[j++] = row_scale * G_temp_data[k];
-            kg_marker[pattern[k]] = 0;
-         }
-         G_nnzcnt[i] = patt_size + 1;
+         ns = k * FSAI_BATCH_SIZE;
+         hypre_FSAISetupRowBlock(A_diag, 0, ns, hypre_min(ns + FSAI_BATCH_SIZE, num_rows_diag_A),
+                                 max_steps, max_step_size, kap_tolerance, max_cand_size,
+                                 kg_marker, marker, G_j, G_a, G_nnzcnt);
       } /* omp for schedule(dynamic) */
 
       /* Free memory */
-      hypre_SeqVectorDestroy(G_temp);
-      hypre_SeqVectorDestroy(A_subrow);
-      hypre_SeqVectorDestroy(kap_grad);
-      hypre_SeqVectorDestroy(A_sub);
-      hypre_TFree(kg_pos, HYPRE_MEMORY_HOST);
-      hypre_TFree(pattern, HYPRE_MEMORY_HOST);
       hypre_TFree(marker, HYPRE_MEMORY_HOST);
       hypre_TFree(kg_marker, HYPRE_MEMORY_HOST);
    } /* end openmp region */
@@ -906,7 +1024,6 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
    }
 
    /* Free memory */
-   hypre_TFree(twspace, HYPRE_MEMORY_HOST);
    hypre_TFree(G_nnzcnt, HYPRE_MEMORY_HOST);
 
    /* Update local number of nonzeros of G */
@@ -916,13 +1033,729 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_FSAISetup
+ * hypre_FSAISetupDistributed
+ *
+ * Adaptive FSAI whose pattern may also contain off-processor columns.
+ *
+ * The rows of A for the off-processor columns that precede the local rows
+ * in the global ordering are fetched from their owners, and together with
+ * the local rows they form the matrix B, numbered such that the order of
+ * its rows matches the global order:
+ *
+ *    B = [ A_ext(low, low)   A_ext(low, loc) ]
+ *        [ A_offd(:, low)    A_diag          ]
+ *
+ * The rows of G are then computed from B as in hypre_FSAISetupOMPDyn, so G
+ * stays lower triangular with respect to the global ordering.  Columns of
+ * the external rows that are neither local nor offd columns of A are
+ * dropped, so the pattern of G is restricted to the column set of A.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
-hypre_FSAISetup( void               *fsai_vdata,
-                 hypre_ParCSRMatrix *A,
-                 hypre_ParVector    *f,
+hypre_FSAISetupDistributed( void               *fsai_vdata,
+                            hypre_ParCSRMatrix *A,
+                            hypre_ParVector    *f,
+                            hypre_ParVector    *u )
+{
+   /* Data structure variables */
+   hypre_ParFSAIData      *fsai_data        = (hypre_ParFSAIData*) fsai_vdata;
+   HYPRE_Real              kap_tolerance    = hypre_ParFSAIDataKapTolerance(fsai_data);
+   HYPRE_Int               max_steps        = hypre_ParFSAIDataMaxSteps(fsai_data);
+   HYPRE_Int               max_step_size    = hypre_ParFSAIDataMaxStepSize(fsai_data);
+
+   /* ParCSRMatrix A variables */
+   MPI_Comm                comm             = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt            first_row        = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_BigInt           *col_map_offd_A   = hypre_ParCSRMatrixColMapOffd(A);
+   hypre_ParCSRCommPkg    *comm_pkg         = hypre_ParCSRMatrixCommPkg(A);
+
+   /* CSRMatrix A_diag and A_offd variables */
+   hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int              *A_diag_i         = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j         = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex          *A_diag_a         = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix        *A_offd           = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int              *A_offd_i         = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j         = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex          *A_offd_a         = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int               num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_cols_offd_A  = hypre_CSRMatrixNumCols(A_offd);
+
+   /* External rows and extended matrix B */
+   hypre_CSRMatrix        *A_ext = NULL;
+   HYPRE_Int              *A_ext_i = NULL;
+   HYPRE_BigInt           *A_ext_j = NULL;
+   HYPRE_Complex          *A_ext_a = NULL;
+   hypre_CSRMatrix        *B;
+   HYPRE_Int              *B_i;
+   HYPRE_Int              *B_j;
+   HYPRE_Complex          *B_a;
+   HYPRE_Int               num_low;         /* Number of offd columns preceding the local rows */
+   HYPRE_Int               num_rows_B;
+   HYPRE_Int               num_nnzs_B;
+   HYPRE_Int               avg_nnzrow_B;
+
+   /* Matrix G variables */
+   hypre_ParCSRMatrix     *G;
+   hypre_CSRMatrix        *G_diag;
+   hypre_CSRMatrix        *G_offd;
+   HYPRE_Int              *G_diag_i, *G_diag_j;
+   HYPRE_Int              *G_offd_i, *G_offd_j;
+   HYPRE_Complex          *G_diag_a, *G_offd_a;
+   HYPRE_BigInt           *col_map_offd_G;
+   HYPRE_Int               num_cols_offd_G;
+   HYPRE_Int              *G_nnzcnt;          /* Array holding number of nonzeros of row G[i,:] */
+   HYPRE_Int              *G_tmp_j;           /* Rows of G in B numbering, max_nnzrow_G apart */
+   HYPRE_Complex          *G_tmp_a;
+   HYPRE_Int               max_nnzrow_G;      /* Max. number of nonzeros per row in G */
+   HYPRE_Int               max_cand_size;     /* Max size of kg_pos */
+
+   /* Local variables */
+   void                   *request = NULL;
+   HYPRE_Int              *offd_map;
+   HYPRE_Int               num_procs, num_blocks;
+   HYPRE_Int               i, j, jj, k, nnz_diag, nnz_offd;
+   HYPRE_BigInt            big_j;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* Offd columns are sorted, so the ones preceding the local rows come first */
+   for (num_low = 0; num_low < num_cols_offd_A; num_low++)
+   {
+      if (col_map_offd_A[num_low] >= first_row)
+      {
+         break;
+      }
+   }
+
+   /* Start fetching the rows of A for the offd columns.  The rows of G couple
+      local and external rows of B, so they are only set up after the wait */
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      hypre_ParcsrGetExternalRowsInit(A, num_cols_offd_A, col_map_offd_A,
+                                      comm_pkg, 1, &request);
+   }
+
+   /* Count the nonzeros of the local rows of B while the external rows are in flight */
+   num_rows_B = num_low + num_rows_diag_A;
+   num_nnzs_B = hypre_CSRMatrixNumNonzeros(A_diag);
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      for (j = A_offd_i[i]; j < A_offd_i[i + 1]; j++)
+      {
+         num_nnzs_B += (A_offd_j[j] < num_low) ? 1 : 0;
+      }
+   }
+
+   if (num_procs > 1)
+   {
+      A_ext   = hypre_ParcsrGetExternalRowsWait(request);
+      A_ext_i = hypre_CSRMatrixI(A_ext);
+      A_ext_j = hypre_CSRMatrixBigJ(A_ext);
+      A_ext_a = hypre_CSRMatrixData(A_ext);
+      num_nnzs_B += A_ext_i[num_low];
+   }
+
+   B = hypre_CSRMatrixCreate(num_rows_B, num_rows_B, num_nnzs_B);
+   hypre_CSRMatrixInitialize_v2(B, 0, HYPRE_MEMORY_HOST);
+   B_i = hypre_CSRMatrixI(B);
+   B_j = hypre_CSRMatrixJ(B);
+   B_a = hypre_CSRMatrixData(B);
+
+   /* External rows: keep the columns that are local or low offd columns */
+   k = 0;
+   for (i = 0; i < num_low; i++)
+   {
+      B_i[i] = k;
+      for (j = A_ext_i[i]; j < A_ext_i[i + 1]; j++)
+      {
+         big_j = A_ext_j[j];
+         if (big_j >= first_row && big_j < first_row + num_rows_diag_A)
+         {
+            B_j[k]   = num_low + (HYPRE_Int) (big_j - first_row);
+            B_a[k++] = A_ext_a[j];
+         }
+         else if ((jj = hypre_BigBinarySearch(col_map_offd_A, big_j, num_low)) > -1)
+         {
+            B_j[k]   = jj;
+            B_a[k++] = A_ext_a[j];
+         }
+      }
+   }
+
+   /* Local rows: the diagonal stays the first entry of each row */
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      B_i[num_low + i] = k;
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         B_j[k]   = num_low + A_diag_j[j];
+         B_a[k++] = A_diag_a[j];
+      }
+      for (j = A_offd_i[i]; j < A_offd_i[i + 1]; j++)
+      {
+         if (A_offd_j[j] < num_low)
+         {
+            B_j[k]   = A_offd_j[j];
+            B_a[k++] = A_offd_a[j];
+         }
+      }
+   }
+   B_i[num_rows_B] = k;
+   hypre_CSRMatrixNumNonzeros(B) = k;
+   hypre_CSRMatrixDestroy(A_ext);
+
+   /* Initalize some variables */
+   avg_nnzrow_B  = (num_rows_B > 0) ? k / num_rows_B : 0;
+   max_nnzrow_G  = max_steps * max_step_size + 1;
+   max_cand_size = avg_nnzrow_B * max_nnzrow_G;
+   num_blocks    = (num_rows_diag_A + FSAI_BATCH_SIZE - 1) / FSAI_BATCH_SIZE;
+
+   G_tmp_j  = hypre_TAlloc(HYPRE_Int, num_rows_diag_A * max_nnzrow_G, HYPRE_MEMORY_HOST);
+   G_tmp_a  = hypre_TAlloc(HYPRE_Complex, num_rows_diag_A * max_nnzrow_G, HYPRE_MEMORY_HOST);
+   G_nnzcnt = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
+
+   /**********************************************************************
+   * Start of Adaptive FSAI algorithm
+   ***********************************************************************/
+
+   /* Cycle through each of the local rows */
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "MainLoop");
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      *kg_marker;     /* Marker array with nonzeros pointing to kg_pos */
+      HYPRE_Int      *marker;        /* Marker array with nonzeros pointing to P */
+      HYPRE_Int       k, ns;
+
+      kg_marker = hypre_CTAlloc(HYPRE_Int, num_rows_B, HYPRE_MEMORY_HOST);
+      marker    = hypre_TAlloc(HYPRE_Int, num_rows_B, HYPRE_MEMORY_HOST);
+      hypre_Memset(marker, -1, num_rows_B * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for schedule(dynamic)
+#endif
+      for (k = 0; k < num_blocks; k++)
+      {
+         ns = k * FSAI_BATCH_SIZE;
+         hypre_FSAISetupRowBlock(B, num_low, ns, hypre_min(ns + FSAI_BATCH_SIZE, num_rows_diag_A),
+                                 max_steps, max_step_size, kap_tolerance, max_cand_size,
+                                 kg_marker, marker, G_tmp_j, G_tmp_a, G_nnzcnt);
+      } /* omp for schedule(dynamic) */
+
+      /* Free memory */
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(kg_marker, HYPRE_MEMORY_HOST);
+   } /* end openmp region */
+   HYPRE_ANNOTATE_REGION_END("%s", "MainLoop");
+
+   /* Split G into its diag and offd parts and compress the offd columns */
+   offd_map = hypre_CTAlloc(HYPRE_Int, num_low + 1, HYPRE_MEMORY_HOST);
+   nnz_diag = nnz_offd = 0;
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      for (jj = i * max_nnzrow_G; jj < i * max_nnzrow_G + G_nnzcnt[i]; jj++)
+      {
+         if (G_tmp_j[jj] < num_low)
+         {
+            offd_map[G_tmp_j[jj]] = 1;
+            nnz_offd++;
+         }
+         else
+         {
+            nnz_diag++;
+         }
+      }
+   }
+   num_cols_offd_G = 0;
+   for (j = 0; j < num_low; j++)
+   {
+      offd_map[j] = offd_map[j] ? num_cols_offd_G++ : -1;
+   }
+
+   G = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixGlobalNumCols(A),
+                                hypre_ParCSRMatrixRowStarts(A),
+                                hypre_ParCSRMatrixColStarts(A),
+                                num_cols_offd_G, nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize(G);
+   hypre_ParFSAIDataGmat(fsai_data) = G;
+
+   G_diag   = hypre_ParCSRMatrixDiag(G);
+   G_offd   = hypre_ParCSRMatrixOffd(G);
+   G_diag_i = hypre_CSRMatrixI(G_diag);
+   G_diag_j = hypre_CSRMatrixJ(G_diag);
+   G_diag_a = hypre_CSRMatrixData(G_diag);
+   G_offd_i = hypre_CSRMatrixI(G_offd);
+   G_offd_j = hypre_CSRMatrixJ(G_offd);
+   G_offd_a = hypre_CSRMatrixData(G_offd);
+   col_map_offd_G = hypre_ParCSRMatrixColMapOffd(G);
+
+   for (j = 0; j < num_low; j++)
+   {
+      if (offd_map[j] > -1)
+      {
+         col_map_offd_G[offd_map[j]] = col_map_offd_A[j];
+      }
+   }
+
+   nnz_diag = nnz_offd = 0;
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      G_diag_i[i] = nnz_diag;
+      G_offd_i[i] = nnz_offd;
+      for (jj = i * max_nnzrow_G; jj < i * max_nnzrow_G + G_nnzcnt[i]; jj++)
+      {
+         if (G_tmp_j[jj] < num_low)
+         {
+            G_offd_j[nnz_offd] = offd_map[G_tmp_j[jj]];
+            G_offd_a[nnz_offd++] = G_tmp_a[jj];
+         }
+         else
+         {
+            G_diag_j[nnz_diag] = G_tmp_j[jj] - num_low;
+            G_diag_a[nnz_diag++] = G_tmp_a[jj];
+         }
+      }
+   }
+   G_diag_i[num_rows_diag_A] = nnz_diag;
+   G_offd_i[num_rows_diag_A] = nnz_offd;
+
+   hypre_MatvecCommPkgCreate(G);
+
+   /* Free memory */
+   hypre_CSRMatrixDestroy(B);
+   hypre_TFree(offd_map, HYPRE_MEMORY_HOST);
+   hypre_TFree(G_tmp_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(G_tmp_a, HYPRE_MEMORY_HOST);
+   hypre_TFree(G_nnzcnt, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAIComputeStaticPattern
+ *
+ * Compute the static pattern of G: the strictly lower triangular part of
+ * S^num_levels, where S holds the diagonal of A and the entries with
+ * |a_ij| >= threshold * sqrt(|a_ii| |a_jj|).  The column indices of each
+ * row of the returned pattern are sorted in ascending order; the matrix
+ * carries no values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FSAIComputeStaticPattern( hypre_CSRMatrix  *A,
+                                HYPRE_Int         num_levels,
+                                HYPRE_Real        threshold,
+                                hypre_CSRMatrix **P_ptr )
+{
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Complex    *A_a      = hypre_CSRMatrixData(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+
+   hypre_CSRMatrix  *S, *Sk, *T, *P;
+   HYPRE_Int        *S_i, *S_j, *Sk_i, *Sk_j, *P_i, *P_j;
+   HYPRE_Complex    *S_a;
+   HYPRE_Real       *diag;
+   HYPRE_Int         i, j, k, l;
+
+   /* Sparsified A */
+   diag = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      diag[i] = hypre_cabs(A_a[A_i[i]]);
+   }
+
+   S = hypre_CSRMatrixCreate(num_rows, num_rows, A_i[num_rows]);
+   hypre_CSRMatrixInitialize_v2(S, 0, HYPRE_MEMORY_HOST);
+   S_i = hypre_CSRMatrixI(S);
+   S_j = hypre_CSRMatrixJ(S);
+   S_a = hypre_CSRMatrixData(S);
+
+   k = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      S_i[i] = k;
+      for (j = A_i[i]; j < A_i[i + 1]; j++)
+      {
+         if (A_j[j] == i ||
+             hypre_cabs(A_a[j]) >= threshold * sqrt(diag[i] * diag[A_j[j]]))
+         {
+            S_j[k]   = A_j[j];
+            S_a[k++] = 1.0;
+         }
+      }
+   }
+   S_i[num_rows] = k;
+   hypre_CSRMatrixNumNonzeros(S) = k;
+   hypre_TFree(diag, HYPRE_MEMORY_HOST);
+
+   /* Powers of S */
+   Sk = S;
+   for (l = 1; l < num_levels; l++)
+   {
+      T = hypre_CSRMatrixMultiplyHost(Sk, S);
+      if (Sk != S)
+      {
+         hypre_CSRMatrixDestroy(Sk);
+      }
+      Sk = T;
+   }
+   Sk_i = hypre_CSRMatrixI(Sk);
+   Sk_j = hypre_CSRMatrixJ(Sk);
+
+   /* Strictly lower triangular part */
+   k = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = Sk_i[i]; j < Sk_i[i + 1]; j++)
+      {
+         k += (Sk_j[j] < i) ? 1 : 0;
+      }
+   }
+
+   P   = hypre_CSRMatrixCreate(num_rows, num_rows, k);
+   P_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   P_j = hypre_CTAlloc(HYPRE_Int, k, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixI(P) = P_i;
+   hypre_CSRMatrixJ(P) = P_j;
+   hypre_CSRMatrixMemoryLocation(P) = HYPRE_MEMORY_HOST;
+
+   k = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      P_i[i] = k;
+      for (j = Sk_i[i]; j < Sk_i[i + 1]; j++)
+      {
+         if (Sk_j[j] < i)
+         {
+            P_j[k++] = Sk_j[j];
+         }
+      }
+      hypre_qsort0(P_j, P_i[i], k - 1);
+   }
+   P_i[num_rows] = k;
+
+   if (Sk != S)
+   {
+      hypre_CSRMatrixDestroy(Sk);
+   }
+   hypre_CSRMatrixDestroy(S);
+
+   *P_ptr = P;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAISetupStaticRowBlock
+ *
+ * Compute rows ns to ne-1 of G for the static pattern P, solving the dense
+ * systems of equal size at once with hypre_DenseSPDSystemSolveBatch.  Row i
+ * of G is its diagonal followed by the entries of row i of P, starting at
+ * G_i[i].  If the Cholesky factorization of a row's system fails, an error
+ * naming the row is raised and its off-diagonal entries are set to zero.
+ * marker must be all -1 and is returned as such.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FSAISetupStaticRowBlock( hypre_CSRMatrix *A,
+                               hypre_CSRMatrix *P,
+                               HYPRE_Int        ns,
+                               HYPRE_Int        ne,
+                               HYPRE_Int       *marker,
+                               HYPRE_Int       *G_i,
+                               HYPRE_Int       *G_j,
+                               HYPRE_Complex   *G_a )
+{
+   HYPRE_Int      *A_i = hypre_CSRMatrixI(A);
+   HYPRE_Complex  *A_a = hypre_CSRMatrixData(A);
+   HYPRE_Int      *P_i = hypre_CSRMatrixI(P);
+   HYPRE_Int      *P_j = hypre_CSRMatrixJ(P);
+   HYPRE_Int       nb  = ne - ns;
+
+   hypre_Vector   *A_sub;         /* Vector holding the dense submatrix A[P, P] */
+   hypre_Vector   *A_subrow;      /* Vector holding A[i, P] */
+   HYPRE_Complex  *A_sub_data;
+   HYPRE_Complex  *A_subrow_data;
+   HYPRE_Complex  *mat, *rhs;     /* Interleaved dense systems */
+   HYPRE_Complex  *subrow;        /* Interleaved copies of A[i, P] */
+   HYPRE_Complex   psi, row_scale;
+   HYPRE_Int      *sys, *sys_size;
+   HYPRE_Int      *info;          /* Cholesky status of the systems */
+   HYPRE_Int      *pattern;
+   HYPRE_Int       max_size, n, m;
+   HYPRE_Int       i, j, jj, b, s, t;
+   char            msg[512];      /* Warning message */
+
+   /* Rows of the block sorted by pattern size */
+   sys      = hypre_TAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   sys_size = hypre_TAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   info     = hypre_CTAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   max_size = 0;
+   for (b = 0; b < nb; b++)
+   {
+      sys[b]      = ns + b;
+      sys_size[b] = P_i[ns + b + 1] - P_i[ns + b];
+      max_size    = hypre_max(max_size, sys_size[b]);
+   }
+   hypre_qsort2i(sys_size, sys, 0, nb - 1);
+
+   A_sub    = hypre_SeqVectorCreate(max_size * max_size);
+   A_subrow = hypre_SeqVectorCreate(max_size);
+   hypre_SeqVectorInitialize(A_sub);
+   hypre_SeqVectorInitialize(A_subrow);
+   A_sub_data    = hypre_VectorData(A_sub);
+   A_subrow_data = hypre_VectorData(A_subrow);
+   mat    = hypre_TAlloc(HYPRE_Complex, nb * max_size * max_size, HYPRE_MEMORY_HOST);
+   rhs    = hypre_TAlloc(HYPRE_Complex, nb * max_size, HYPRE_MEMORY_HOST);
+   subrow = hypre_TAlloc(HYPRE_Complex, nb * max_size, HYPRE_MEMORY_HOST);
+
+   for (s = 0; s < nb; s = t)
+   {
+      n = sys_size[s];
+      for (t = s; t < nb && sys_size[t] == n; t++);
+      m = t - s;
+
+      /* Gather A[P, P] and -A[i, P] */
+      hypre_VectorSize(A_sub)    = n * n;
+      hypre_VectorSize(A_subrow) = n;
+      for (b = 0; b < m; b++)
+      {
+         i = sys[s + b];
+         pattern = P_j + P_i[i];
+         for (j = 0; j < n; j++)
+         {
+            marker[pattern[j]] = j;
+         }
+         hypre_CSRMatrixExtractDenseMat(A, A_sub, pattern, n, marker);
+         hypre_CSRMatrixExtractDenseRow(A, A_subrow, marker, i);
+         for (j = 0; j < n; j++)
+         {
+            marker[pattern[j]] = -1;
+         }
+
+         for (jj = 0; jj < n * n; jj++)
+         {
+            mat[jj * m + b] = A_sub_data[jj];
+         }
+         for (j = 0; j < n; j++)
+         {
+            subrow[j * m + b] = A_subrow_data[j];
+            rhs[j * m + b]    = -A_subrow_data[j];
+         }
+      }
+
+      /* Solve A[P, P] G[i, P]' = -A[i, P] */
+      if (n > 0)
+      {
+         hypre_DenseSPDSystemSolveBatch(n, m, mat, rhs, info);
+      }
+
+      /* Scale by psi = G_temp[i]*A*G_temp[i]' and pass the rows into G */
+      for (b = 0; b < m; b++)
+      {
+         i = sys[s + b];
+         if (n > 0 && info[b])
+         {
+            hypre_sprintf(msg, "Error: Cholesky factorization failed with code %d in row %d\n",
+                          info[b], i);
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+
+            for (j = 0; j < n; j++)
+            {
+               rhs[j * m + b] = 0.0;
+            }
+         }
+
+         psi = A_a[A_i[i]];
+         for (j = 0; j < n; j++)
+         {
+            psi += rhs[j * m + b] * subrow[j * m + b];
+         }
+
+         if (hypre_creal(psi) > 0 && hypre_cimag(psi) == 0)
+         {
+            row_scale = 1.0 / hypre_csqrt(psi);
+         }
+         else
+         {
+            hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", i);
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+
+            row_scale = 1.0 / hypre_cabs(A_a[A_i[i]]);
+            for (j = 0; j < n; j++)
+            {
+               rhs[j * m + b] = 0.0;
+            }
+         }
+
+         jj = G_i[i];
+         G_j[jj] = i;
+         G_a[jj] = row_scale;
+         for (j = 0; j < n; j++)
+         {
+            G_j[jj + 1 + j] = P_j[P_i[i] + j];
+            G_a[jj + 1 + j] = row_scale * rhs[j * m + b];
+         }
+      }
+   }
+
+   /* Free memory */
+   hypre_SeqVectorDestroy(A_sub);
+   hypre_SeqVectorDestroy(A_subrow);
+   hypre_TFree(sys, HYPRE_MEMORY_HOST);
+   hypre_TFree(sys_size, HYPRE_MEMORY_HOST);
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(mat, HYPRE_MEMORY_HOST);
+   hypre_TFree(rhs, HYPRE_MEMORY_HOST);
+   hypre_TFree(subrow, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAISetupStaticPattern
+ *
+ * FSAI with the static pattern of hypre_FSAIComputeStaticPattern.  The
+ * pattern is kept in fsai_data together with the sparsity of A_diag it was
+ * computed for, so a later setup with a matrix of the same sparsity only
+ * recomputes the values of G.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FSAISetupStaticPattern( void               *fsai_vdata,
+                              hypre_ParCSRMatrix *A,
+                              hypre_ParVector    *f,
+                              hypre_ParVector    *u )
+{
+   /* Data structure variables */
+   hypre_ParFSAIData      *fsai_data        = (hypre_ParFSAIData*) fsai_vdata;
+   HYPRE_Int               num_levels       = hypre_ParFSAIDataNumLevels(fsai_data);
+   HYPRE_Real              threshold        = hypre_ParFSAIDataThreshold(fsai_data);
+   hypre_CSRMatrix        *P                = hypre_ParFSAIDataStaticPattern(fsai_data);
+   hypre_CSRMatrix        *P_A              = hypre_ParFSAIDataStaticPatternA(fsai_data);
+
+   /* CSRMatrix A_diag variables */
+   hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int              *A_i              = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_j              = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int               num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_nnzs_diag_A  = hypre_CSRMatrixNumNonzeros(A_diag);
+
+   /* Matrix G variables */
+   hypre_ParCSRMatrix     *G;
+   hypre_CSRMatrix        *G_diag;
+   HYPRE_Int              *G_i;
+   HYPRE_Int              *G_j;
+   HYPRE_Complex          *G_a;
+   HYPRE_Int              *P_i;
+
+   /* Local variables */
+   HYPRE_Int               i, num_blocks, same;
+
+   /* Check whether the cached pattern belongs to a matrix of the same sparsity */
+   if (P)
+   {
+      same = (hypre_CSRMatrixNumRows(P_A) == num_rows_diag_A &&
+              hypre_CSRMatrixNumNonzeros(P_A) == num_nnzs_diag_A);
+      for (i = 0; same && i <= num_rows_diag_A; i++)
+      {
+         same = (hypre_CSRMatrixI(P_A)[i] == A_i[i]);
+      }
+      for (i = 0; same && i < num_nnzs_diag_A; i++)
+      {
+         same = (hypre_CSRMatrixJ(P_A)[i] == A_j[i]);
+      }
+
+      if (!same)
+      {
+         hypre_CSRMatrixDestroy(P);
+         hypre_CSRMatrixDestroy(P_A);
+         P = P_A = NULL;
+      }
+   }
+
+   if (!P)
+   {
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "Pattern");
+      hypre_FSAIComputeStaticPattern(A_diag, num_levels, threshold, &P);
+
+      P_A = hypre_CSRMatrixClone_v2(A_diag, 0, HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixData(P_A), HYPRE_MEMORY_HOST);
+      HYPRE_ANNOTATE_REGION_END("%s", "Pattern");
+   }
+   hypre_ParFSAIDataStaticPattern(fsai_data)  = P;
+   hypre_ParFSAIDataStaticPatternA(fsai_data) = P_A;
+   P_i = hypre_CSRMatrixI(P);
+
+   /* Create G: the diagonal followed by the pattern in each row */
+   G = hypre_ParCSRMatrixCreate(hypre_ParCSRMatrixComm(A),
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixGlobalNumCols(A),
+                                hypre_ParCSRMatrixRowStarts(A),
+                                hypre_ParCSRMatrixColStarts(A),
+                                0, P_i[num_rows_diag_A] + num_rows_diag_A, 0);
+   hypre_ParCSRMatrixInitialize(G);
+   hypre_ParFSAIDataGmat(fsai_data) = G;
+
+   G_diag = hypre_ParCSRMatrixDiag(G);
+   G_i = hypre_CSRMatrixI(G_diag);
+   G_j = hypre_CSRMatrixJ(G_diag);
+   G_a = hypre_CSRMatrixData(G_diag);
+   for (i = 0; i <= num_rows_diag_A; i++)
+   {
+      G_i[i] = P_i[i] + i;
+   }
+
+   num_blocks = (num_rows_diag_A + FSAI_BATCH_SIZE - 1) / FSAI_BATCH_SIZE;
+
+   /* Compute the values of G */
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "MainLoop");
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      *marker;        /* Marker array with nonzeros pointing to P */
+      HYPRE_Int       k, ns;
+
+      marker = hypre_TAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
+      hypre_Memset(marker, -1, num_rows_diag_A * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for schedule(dynamic)
+#endif
+      for (k = 0; k < num_blocks; k++)
+      {
+         ns = k * FSAI_BATCH_SIZE;
+         hypre_FSAISetupStaticRowBlock(A_diag, P, ns,
+                                       hypre_min(ns + FSAI_BATCH_SIZE, num_rows_diag_A),
+                                       marker, G_i, G_j, G_a);
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   } /* end openmp region */
+   HYPRE_ANNOTATE_REGION_END("%s", "MainLoop");
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAISetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FSAISetup( void               *fsai_vdata,
+                 hypre_ParCSRMatrix *A,
+                 hypre_ParVector    *f,
                  hypre_ParVector    *u )
 {
    hypre_ParFSAIData       *fsai_data     = (hypre_ParFSAIData*) fsai_vdata;
@@ -954,6 +1787,14 @@ hypre_FSAISetup( void               *fsai_vdata,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   /* Free data from a previous setup */
+   hypre_ParCSRMatrixDestroy(hypre_ParFSAIDataGmat(fsai_data));
+   hypre_ParCSRMatrixDestroy(hypre_ParFSAIDataGTmat(fsai_data));
+   hypre_ParVectorDestroy(hypre_ParFSAIDataRWork(fsai_data));
+   hypre_ParVectorDestroy(hypre_ParFSAIDataZWork(fsai_data));
+   hypre_ParFSAIDataGmat(fsai_data)  = NULL;
+   hypre_ParFSAIDataGTmat(fsai_data) = NULL;
+
    /* Create and initialize work vectors used in the solve phase */
    r_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
    z_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
@@ -964,14 +1805,17 @@ hypre_FSAISetup( void               *fsai_vdata,
    hypre_ParFSAIDataRWork(fsai_data) = r_work;
    hypre_ParFSAIDataZWork(fsai_data) = z_work;
 
-   /* Create and initialize the matrix G */
-   max_nnzrow_diag_G   = max_steps * max_step_size + 1;
-   max_nonzeros_diag_G = num_rows_diag_A * max_nnzrow_diag_G;
-   G = hypre_ParCSRMatrixCreate(comm, num_rows_A, num_cols_A,
-                                row_starts_A, col_starts_A,
-                                0, max_nonzeros_diag_G, 0);
-   hypre_ParCSRMatrixInitialize(G);
-   hypre_ParFSAIDataGmat(fsai_data) = G;
+   /* Create and initialize the matrix G (the distributed and static setups create their own) */
+   if (algo_type != 3 && algo_type != 4)
+   {
+      max_nnzrow_diag_G   = max_steps * max_step_size + 1;
+      max_nonzeros_diag_G = num_rows_diag_A * max_nnzrow_diag_G;
+      G = hypre_ParCSRMatrixCreate(comm, num_rows_A, num_cols_A,
+                                   row_starts_A, col_starts_A,
+                                   0, max_nonzeros_diag_G, 0);
+      hypre_ParCSRMatrixInitialize(G);
+      hypre_ParFSAIDataGmat(fsai_data) = G;
+   }
 
    /* Compute G */
    switch (algo_type)
@@ -984,6 +1828,14 @@ hypre_FSAISetup( void               *fsai_vdata,
          hypre_FSAISetupOMPDyn(fsai_vdata, A, f, u);
          break;
 
+      case 3:
+         hypre_FSAISetupDistributed(fsai_vdata, A, f, u);
+         break;
+
+      case 4:
+         hypre_FSAISetupStaticPattern(fsai_vdata, A, f, u);
+         break;
+
       default:
          hypre_FSAISetupNative(fsai_vdata, A, f, u);
    }
@@ -16,6 +16,122 @@
  *
  *------------------------------------------------------------------------ */
 
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimFactor
+ *
+ * In-place LU factorization without pivoting of the row-major n x n matrix
+ * A.  The elimination steps are the same as in hypre_gselim.  As there,
+ * columns with a zero pivot are not eliminated, so their multipliers and
+ * their entries above the diagonal are cleared.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_GaussElimFactor( HYPRE_Real *A,
+                       HYPRE_Int   n )
+{
+   HYPRE_Int   j, k, m;
+   HYPRE_Real  factor, divA;
+
+   for (k = 0; k < n - 1; k++)
+   {
+      if (A[k * n + k] != 0.0)
+      {
+         divA = 1.0 / A[k * n + k];
+         for (j = k + 1; j < n; j++)
+         {
+            if (A[j * n + k] != 0.0)
+            {
+               factor = A[j * n + k] * divA;
+               for (m = k + 1; m < n; m++)
+               {
+                  A[j * n + m] -= factor * A[k * n + m];
+               }
+               A[j * n + k] = factor;
+            }
+         }
+      }
+      else
+      {
+         for (j = k + 1; j < n; j++)
+         {
+            A[j * n + k] = 0.0;
+         }
+      }
+   }
+
+   for (k = 1; k < n; k++)
+   {
+      if (A[k * n + k] == 0.0)
+      {
+         for (j = 0; j < k; j++)
+         {
+            A[j * n + k] = 0.0;
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimFactorSolve
+ *
+ * Overwrite x with the solution of A x = x, with A factored by
+ * hypre_GaussElimFactor.  Returns a nonzero value for a zero 1x1 matrix.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_GaussElimFactorSolve( HYPRE_Real *A,
+                            HYPRE_Real *x,
+                            HYPRE_Int   n )
+{
+   HYPRE_Int   j, k;
+   HYPRE_Real  sum;
+
+   if (n == 1)
+   {
+      if (A[0] == 0.0)
+      {
+         return 1;
+      }
+      x[0] /= A[0];
+
+      return 0;
+   }
+
+   /* forward substitution with the unit lower triangular factor */
+   for (k = 1; k < n; k++)
+   {
+      sum = x[k];
+      for (j = 0; j < k; j++)
+      {
+         sum -= A[k * n + j] * x[j];
+      }
+      x[k] = sum;
+   }
+
+   /* back substitution */
+   for (k = n - 1; k >= 0; k--)
+   {
+      sum = x[k];
+      for (j = k + 1; j < n; j++)
+      {
+         sum -= A[k * n + j] * x[j];
+      }
+      x[k] = (A[k * n + k] != 0.0) ? sum / A[k * n + k] : sum;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimSetup
+ *
+ * Gather the coarse matrix on all processes with rows and factor it once.
+ * The solve phase only does triangular solves (relax_type 9 and 99) or a
+ * multiplication with the local rows of the inverse (relax_type 199).
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
 {
 #ifdef HYPRE_PROFILE
@@ -125,11 +241,19 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
                AT_mat[i * global_num_rows + jj] = A_mat[i + jj * global_num_rows];
             }
          }
+         HYPRE_Int *piv = hypre_CTAlloc(HYPRE_Int, global_num_rows, HYPRE_MEMORY_HOST);
+         HYPRE_Int  my_info;
+
+         /* write over AT_mat with LU */
+         hypre_dgetrf(&global_num_rows, &global_num_rows, AT_mat, &global_num_rows, piv, &my_info);
+
          hypre_ParAMGDataAMat(amg_data) = AT_mat;
+         hypre_ParAMGDataAPiv(amg_data) = piv;
          hypre_TFree(A_mat, HYPRE_MEMORY_HOST);
       }
       else if (relax_type == 9)
       {
+         hypre_GaussElimFactor(A_mat, global_num_rows);
          hypre_ParAMGDataAMat(amg_data) = A_mat;
       }
       else if (relax_type == 199)
@@ -198,7 +322,12 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
    return hypre_error_flag;
 }
 
-/* relax_type = 9, 99, 199, see par_relax.c for 19 and 98 */
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimSolve
+ *
+ * relax_type = 9, 99, 199, see par_relax.c for 19 and 98
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
 {
 #ifdef HYPRE_PROFILE
@@ -267,39 +396,26 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
 
       if (relax_type == 9 || relax_type == 99)
       {
+         /* A_mat holds the LU factors computed in hypre_GaussElimSetup */
          HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
-         HYPRE_Real *A_tmp;
          HYPRE_Int   i, my_info;
 
-         A_tmp = hypre_CTAlloc(HYPRE_Real, n_global * n_global, HYPRE_MEMORY_HOST);
-         for (i = 0; i < n_global * n_global; i++)
-         {
-            A_tmp[i] = A_mat[i];
-         }
-
          if (relax_type == 9)
          {
-            hypre_gselim(A_tmp, b_vec, n_global, error_flag);
+            error_flag = hypre_GaussElimFactorSolve(A_mat, b_vec, n_global);
          }
          else if (relax_type == 99) /* use pivoting */
          {
-            HYPRE_Int *piv = hypre_CTAlloc(HYPRE_Int, n_global, HYPRE_MEMORY_HOST);
-
-            /* write over A with LU */
-            hypre_dgetrf(&n_global, &n_global, A_tmp, &n_global, piv, &my_info);
+            HYPRE_Int *piv = hypre_ParAMGDataAPiv(amg_data);
 
             /* now b_vec = inv(A)*b_vec */
-            hypre_dgetrs("N", &n_global, &one_i, A_tmp, &n_global, piv, b_vec, &n_global, &my_info);
-
-            hypre_TFree(piv, HYPRE_MEMORY_HOST);
+            hypre_dgetrs("N", &n_global, &one_i, A_mat, &n_global, piv, b_vec, &n_global, &my_info);
          }
 
          for (i = 0; i < n; i++)
          {
             u_data_host[i] = b_vec[first_row_index + i];
          }
-
-         hypre_TFree(A_tmp, HYPRE_MEMORY_HOST);
       }
       else if (relax_type == 199)
       {
@@ -37,28 +37,35 @@ hypre_BoomerAMGIndepSetInit( hypre_ParCSRMatrix *S,
    hypre_CSRMatrix *S_diag = hypre_ParCSRMatrixDiag(S);
    MPI_Comm         comm = hypre_ParCSRMatrixComm(S);
    HYPRE_Int        S_num_nodes = hypre_CSRMatrixNumRows(S_diag);
-   HYPRE_BigInt     big_i;
-   HYPRE_Int        i, my_id;
+   HYPRE_Int        seed, my_id;
    HYPRE_Int        ierr = 0;
 
    hypre_MPI_Comm_rank(comm, &my_id);
-   i = 2747 + my_id;
+   seed = 2747 + my_id;
    if (seq_rand)
    {
-      i = 2747;
+      /* continue the sequence where the previous process stopped */
+      seed = hypre_RandSkip(2747, hypre_ParCSRMatrixFirstRowIndex(S));
    }
-   hypre_SeedRand(i);
-   if (seq_rand)
+
+   /* each thread jumps ahead to its first node, so the measures do not
+      depend on the number of threads */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
    {
-      for (big_i = 0; big_i < hypre_ParCSRMatrixFirstRowIndex(S); big_i++)
+      HYPRE_Int i, i_begin, i_end, state;
+
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, S_num_nodes);
+      state = hypre_RandSkip(seed, (HYPRE_BigInt) i_begin);
+      for (i = i_begin; i < i_end; i++)
       {
-         hypre_Rand();
+         measure_array[i] += hypre_RandState(&state);
       }
    }
-   for (i = 0; i < S_num_nodes; i++)
-   {
-      measure_array[i] += hypre_Rand();
-   }
+
+   /* leave the global generator where the sequential loop would have */
+   hypre_SeedRand(hypre_RandSkip(seed, (HYPRE_BigInt) S_num_nodes));
 
    return (ierr);
 }
@@ -131,6 +138,9 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
       S_offd_j = hypre_CSRMatrixJ(S_offd);
    }
 
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_size; ig++)
    {
       i = graph_array[ig];
@@ -139,6 +149,9 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
          IS_marker[i] = 1;
       }
    }
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_offd_size; ig++)
    {
       i = graph_array_offd[ig];
@@ -149,9 +162,14 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
    }
 
    /*-------------------------------------------------------
-    * Remove nodes from the initial independent set
+    * Remove nodes from the initial independent set.  Only
+    * the measures are read and only zeros are written, so
+    * the result does not depend on the order of the nodes.
     *-------------------------------------------------------*/
 
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ig, i, jS, j, jj) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_size; ig++)
    {
       i = graph_array[ig];
@@ -133,6 +133,10 @@ hypre_MGRCreate()
 
    (mgr_data -> truncate_coarse_grid_threshold) = 0.0;
 
+   (mgr_data -> reuse_setup) = 0;
+   (mgr_data -> inner_setup_lag) = 0;
+   (mgr_data -> num_lagged_setups) = 0;
+
    return (void *) mgr_data;
 }
 
@@ -3673,6 +3677,190 @@ HYPRE_Int hypre_block_jacobi_scaling(hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *
    return (block_scaling_error);
 }
 
+/*--------------------------------------------------------------------------
+ * Global block relaxation
+ *
+ * The inverses of the diagonal blocks are stored by groups of
+ * MGR_BLOCK_BATCH_SIZE consecutive nodes, with entry (j,k) of all the nodes
+ * of a group next to each other:
+ *
+ *    diaginv[(g * nb2 + j * blk_size + k) * MGR_BLOCK_BATCH_SIZE + b]
+ *
+ * is entry (j,k) of the inverse for node g * MGR_BLOCK_BATCH_SIZE + b.  The
+ * last group is padded with identity blocks, and the inverse of the
+ * left-over block of left_size rows follows in row-major order.
+ *
+ * The dense kernels below loop innermost over the nodes of a group.  They
+ * are called with a constant block size for blk_size = 2,...,8, so that
+ * the loops over the block entries unroll and the loops over the nodes
+ * vectorize.
+ *--------------------------------------------------------------------------*/
+
+#define MGR_BLOCK_BATCH_SIZE 8
+
+/* Gauss-Jordan inversion of the blocks of a group, without pivoting and
+ * with the operation order of hypre_blas_mat_inv */
+static inline void
+hypre_MGRBlockInvBatch( HYPRE_Int   bs,
+                        HYPRE_Real *a )
+{
+   const HYPRE_Int  W = MGR_BLOCK_BATCH_SIZE;
+   HYPRE_Int        i, j, k, b;
+   HYPRE_Real       alinv[MGR_BLOCK_BATCH_SIZE];
+
+   for (k = 0; k < bs; k++)
+   {
+      for (b = 0; b < W; b++)
+      {
+         alinv[b] = 1.0 / a[(k * bs + k) * W + b];
+         a[(k * bs + k) * W + b] = alinv[b];
+      }
+      for (j = 0; j < bs; j++)
+      {
+         if (j != k)
+         {
+            for (b = 0; b < W; b++)
+            {
+               a[(k * bs + j) * W + b] *= alinv[b];
+            }
+         }
+      }
+      for (i = 0; i < bs; i++)
+      {
+         if (i == k)
+         {
+            continue;
+         }
+         for (j = 0; j < bs; j++)
+         {
+            if (j != k)
+            {
+               for (b = 0; b < W; b++)
+               {
+                  a[(i * bs + j) * W + b] -= a[(i * bs + k) * W + b] * a[(k * bs + j) * W + b];
+               }
+            }
+         }
+      }
+      for (i = 0; i < bs; i++)
+      {
+         if (i != k)
+         {
+            for (b = 0; b < W; b++)
+            {
+               a[(i * bs + k) * W + b] *= -alinv[b];
+            }
+         }
+      }
+   }
+}
+
+/* u_b += inv_b * res_b for all the nodes b of a group */
+static inline void
+hypre_MGRBlockApplyBatch( HYPRE_Int         bs,
+                          const HYPRE_Real *inv,
+                          const HYPRE_Real *res,
+                          HYPRE_Real       *u )
+{
+   const HYPRE_Int  W = MGR_BLOCK_BATCH_SIZE;
+   HYPRE_Int        j, k, b;
+
+   for (j = 0; j < bs; j++)
+   {
+      for (k = 0; k < bs; k++)
+      {
+         for (b = 0; b < W; b++)
+         {
+            u[j * W + b] += res[k * W + b] * inv[(j * bs + k) * W + b];
+         }
+      }
+   }
+}
+
+/* u += inv * res for a single node, inv pointing to its entry (0,0) */
+static inline void
+hypre_MGRBlockApplyNode( HYPRE_Int         bs,
+                         const HYPRE_Real *inv,
+                         const HYPRE_Real *res,
+                         HYPRE_Real       *u )
+{
+   const HYPRE_Int  W = MGR_BLOCK_BATCH_SIZE;
+   HYPRE_Int        j, k;
+
+   for (j = 0; j < bs; j++)
+   {
+      for (k = 0; k < bs; k++)
+      {
+         u[j] += res[k] * inv[(j * bs + k) * W];
+      }
+   }
+}
+
+static void
+hypre_MGRBlockInvGroup( HYPRE_Int   bs,
+                        HYPRE_Real *a )
+{
+   switch (bs)
+   {
+      case 2: hypre_MGRBlockInvBatch(2, a); break;
+      case 3: hypre_MGRBlockInvBatch(3, a); break;
+      case 4: hypre_MGRBlockInvBatch(4, a); break;
+      case 5: hypre_MGRBlockInvBatch(5, a); break;
+      case 6: hypre_MGRBlockInvBatch(6, a); break;
+      case 7: hypre_MGRBlockInvBatch(7, a); break;
+      case 8: hypre_MGRBlockInvBatch(8, a); break;
+      default: hypre_MGRBlockInvBatch(bs, a); break;
+   }
+}
+
+static void
+hypre_MGRBlockApplyGroup( HYPRE_Int         bs,
+                          const HYPRE_Real *inv,
+                          const HYPRE_Real *res,
+                          HYPRE_Real       *u )
+{
+   switch (bs)
+   {
+      case 2: hypre_MGRBlockApplyBatch(2, inv, res, u); break;
+      case 3: hypre_MGRBlockApplyBatch(3, inv, res, u); break;
+      case 4: hypre_MGRBlockApplyBatch(4, inv, res, u); break;
+      case 5: hypre_MGRBlockApplyBatch(5, inv, res, u); break;
+      case 6: hypre_MGRBlockApplyBatch(6, inv, res, u); break;
+      case 7: hypre_MGRBlockApplyBatch(7, inv, res, u); break;
+      case 8: hypre_MGRBlockApplyBatch(8, inv, res, u); break;
+      default: hypre_MGRBlockApplyBatch(bs, inv, res, u); break;
+   }
+}
+
+static void
+hypre_MGRBlockApplyOne( HYPRE_Int         bs,
+                        const HYPRE_Real *inv,
+                        const HYPRE_Real *res,
+                        HYPRE_Real       *u )
+{
+   switch (bs)
+   {
+      case 2: hypre_MGRBlockApplyNode(2, inv, res, u); break;
+      case 3: hypre_MGRBlockApplyNode(3, inv, res, u); break;
+      case 4: hypre_MGRBlockApplyNode(4, inv, res, u); break;
+      case 5: hypre_MGRBlockApplyNode(5, inv, res, u); break;
+      case 6: hypre_MGRBlockApplyNode(6, inv, res, u); break;
+      case 7: hypre_MGRBlockApplyNode(7, inv, res, u); break;
+      case 8: hypre_MGRBlockApplyNode(8, inv, res, u); break;
+      default: hypre_MGRBlockApplyNode(bs, inv, res, u); break;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_blockRelax_solve
+ *
+ * One block relaxation sweep with the inverses of hypre_blockRelax_setup.
+ * The couplings within the diag part are relaxed in Gauss-Seidel fashion
+ * for method 1, and in Jacobi fashion otherwise, in which case the groups
+ * of nodes are relaxed in parallel.  The off-processor couplings are
+ * always treated in Jacobi fashion.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int hypre_blockRelax_solve (hypre_ParCSRMatrix *A,
                                   hypre_ParVector    *f,
                                   hypre_ParVector    *u,
@@ -3707,73 +3895,68 @@ HYPRE_Int hypre_blockRelax_solve (hypre_ParCSRMatrix *A,
    hypre_Vector    *Vtemp_local = hypre_ParVectorLocalVector(Vtemp);
    HYPRE_Real      *Vtemp_data = hypre_VectorData(Vtemp_local);
    HYPRE_Real      *Vext_data = NULL;
-   HYPRE_Real      *v_buf_data;
-
-   HYPRE_Int        i, j, k;
-   HYPRE_Int        ii, jj;
-   HYPRE_Int        bidx, bidx1;
-   HYPRE_Int        relax_error = 0;
+   HYPRE_Real      *v_buf_data = NULL;
+   HYPRE_Real      *x_data;
+
+   const HYPRE_Int  W   = MGR_BLOCK_BATCH_SIZE;
+   const HYPRE_Int  bs  = (HYPRE_Int) blk_size;
+   const HYPRE_Int  nb2 = bs * bs;
+   HYPRE_Int        num_groups = (n_block + W - 1) / W;
+   HYPRE_Int        left_start = n_block * bs;
+   HYPRE_Real      *left_inv   = diaginv + (size_t) num_groups * W * nb2;
+
+   HYPRE_Int        i, j, k, g, b;
+   HYPRE_Int        jj, row;
    HYPRE_Int        num_sends;
-   HYPRE_Int        index, start;
-   HYPRE_Int        num_procs, my_id;
+   HYPRE_Int        num_procs;
    HYPRE_Real      *res;
 
-   const HYPRE_Int  nb2 = blk_size * blk_size;
-
    hypre_MPI_Comm_size(comm, &num_procs);
-   hypre_MPI_Comm_rank(comm, &my_id);
-   //   HYPRE_Int num_threads = hypre_NumThreads();
-
-   res = hypre_CTAlloc(HYPRE_Real,  blk_size, HYPRE_MEMORY_HOST);
-
-   if (!comm_pkg)
-   {
-      hypre_MatvecCommPkgCreate(A);
-      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
-   }
 
    if (num_procs > 1)
    {
-      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
-
-      v_buf_data = hypre_CTAlloc(HYPRE_Real,
-                                 hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-      Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-
-      if (num_cols_offd)
+      if (!comm_pkg)
       {
-         A_offd_j = hypre_CSRMatrixJ(A_offd);
-         A_offd_data = hypre_CSRMatrixData(A_offd);
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
       }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-      index = 0;
-      for (i = 0; i < num_sends; i++)
+      v_buf_data = hypre_TAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+      Vext_data = hypre_TAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
       {
-         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1); j++)
-            v_buf_data[index++]
-               = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         v_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
       }
 
-      comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data,
-                                                  Vext_data);
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
    }
 
    /*-----------------------------------------------------------------
-   * Copy current approximation into temporary vector.
-   *-----------------------------------------------------------------*/
+    * Copy current approximation into temporary vector for Jacobi.
+    *-----------------------------------------------------------------*/
 
-#if 0
+   if (method == 1)
+   {
+      x_data = u_data;
+   }
+   else
+   {
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-   for (i = 0; i < n; i++)
-   {
-      Vtemp_data[i] = u_data[i];
-      //printf("u_old[%d] = %e\n",i,Vtemp_data[i]);
+      for (i = 0; i < n; i++)
+      {
+         Vtemp_data[i] = u_data[i];
+      }
+      x_data = Vtemp_data;
    }
+
    if (num_procs > 1)
    {
       hypre_ParCSRCommHandleDestroy(comm_handle);
@@ -3781,63 +3964,121 @@ HYPRE_Int hypre_blockRelax_solve (hypre_ParCSRMatrix *A,
    }
 
    /*-----------------------------------------------------------------
-   * Relax points block by block
-   *-----------------------------------------------------------------*/
-   for (i = 0; i < n_block; i++)
+    * Relax points block by block
+    *-----------------------------------------------------------------*/
+
+   if (method == 1)
    {
-      for (j = 0; j < blk_size; j++)
+      res = hypre_TAlloc(HYPRE_Real, hypre_max(bs, left_size), HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < n_block; i++)
       {
-         bidx = i * blk_size + j;
-         res[j] = f_data[bidx];
-         for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
+         for (j = 0; j < bs; j++)
          {
-            ii = A_diag_j[jj];
-            if (method == 0)
-            {
-               // Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
-            }
-            else if (method == 1)
+            row = i * bs + j;
+            res[j] = f_data[row];
+            for (jj = A_diag_i[row]; jj < A_diag_i[row + 1]; jj++)
             {
-               // Gauss-Seidel for diagonal part
-               res[j] -= A_diag_data[jj] * u_data[ii];
+               res[j] -= A_diag_data[jj] * x_data[A_diag_j[jj]];
             }
-            else
+            for (jj = A_offd_i[row]; jj < A_offd_i[row + 1]; jj++)
             {
-               // Default do Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
+               res[j] -= A_offd_data[jj] * Vext_data[A_offd_j[jj]];
             }
-            //printf("%d: Au= %e * %e =%e\n",ii,A_diag_data[jj],Vtemp_data[ii], res[j]);
-         }
-         for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
-         {
-            // always do Jacobi for off-diagonal part
-            ii = A_offd_j[jj];
-            res[j] -= A_offd_data[jj] * Vext_data[ii];
          }
-         //printf("%d: res = %e\n",bidx,res[j]);
+         g = i / W;
+         hypre_MGRBlockApplyOne(bs, diaginv + (size_t) g * W * nb2 + (i - g * W), res,
+                                u_data + i * bs);
       }
-
-      for (j = 0; j < blk_size; j++)
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(g, b, i, j, jj, row, res)
+#endif
       {
-         bidx1 = i * blk_size + j;
-         for (k = 0; k < blk_size; k++)
+         HYPRE_Real *u_grp;
+
+         res   = hypre_TAlloc(HYPRE_Real, 2 * bs * W, HYPRE_MEMORY_HOST);
+         u_grp = res + bs * W;
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (g = 0; g < num_groups; g++)
          {
-            bidx  = i * nb2 + j * blk_size + k;
-            u_data[bidx1] += res[k] * diaginv[bidx];
-            //printf("u[%d] = %e, diaginv[%d] = %e\n",bidx1,u_data[bidx1],bidx,diaginv[bidx]);
+            /* gather residuals and current values of the group */
+            for (b = 0; b < W; b++)
+            {
+               i = g * W + b;
+               for (j = 0; j < bs; j++)
+               {
+                  if (i < n_block)
+                  {
+                     row = i * bs + j;
+                     res[j * W + b] = f_data[row];
+                     for (jj = A_diag_i[row]; jj < A_diag_i[row + 1]; jj++)
+                     {
+                        res[j * W + b] -= A_diag_data[jj] * x_data[A_diag_j[jj]];
+                     }
+                     for (jj = A_offd_i[row]; jj < A_offd_i[row + 1]; jj++)
+                     {
+                        res[j * W + b] -= A_offd_data[jj] * Vext_data[A_offd_j[jj]];
+                     }
+                     u_grp[j * W + b] = u_data[row];
+                  }
+                  else
+                  {
+                     res[j * W + b]   = 0.0;
+                     u_grp[j * W + b] = 0.0;
+                  }
+               }
+            }
+
+            hypre_MGRBlockApplyGroup(bs, diaginv + (size_t) g * W * nb2, res, u_grp);
+
+            for (b = 0; b < W && g * W + b < n_block; b++)
+            {
+               for (j = 0; j < bs; j++)
+               {
+                  u_data[(g * W + b) * bs + j] = u_grp[j * W + b];
+               }
+            }
          }
-         //printf("u[%d] = %e\n",bidx1,u_data[bidx1]);
+
+         hypre_TFree(res, HYPRE_MEMORY_HOST);
       }
+
+      res = hypre_TAlloc(HYPRE_Real, left_size, HYPRE_MEMORY_HOST);
    }
 
-   if (num_procs > 1)
+   /* left-over rows */
+   for (j = 0; j < left_size; j++)
+   {
+      row = left_start + j;
+      res[j] = f_data[row];
+      for (jj = A_diag_i[row]; jj < A_diag_i[row + 1]; jj++)
+      {
+         res[j] -= A_diag_data[jj] * x_data[A_diag_j[jj]];
+      }
+      for (jj = A_offd_i[row]; jj < A_offd_i[row + 1]; jj++)
+      {
+         res[j] -= A_offd_data[jj] * Vext_data[A_offd_j[jj]];
+      }
+   }
+   for (j = 0; j < left_size; j++)
    {
-      hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-      hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+      for (k = 0; k < left_size; k++)
+      {
+         u_data[left_start + j] += res[k] * left_inv[j * left_size + k];
+      }
    }
+
+   hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
    hypre_TFree(res, HYPRE_MEMORY_HOST);
-   return (relax_error);
+
+   return hypre_error_flag;
 }
 
 HYPRE_Int hypre_block_gs (hypre_ParCSRMatrix *A,
@@ -3849,284 +4090,152 @@ HYPRE_Int hypre_block_gs (hypre_ParCSRMatrix *A,
                           HYPRE_Real          *diaginv,
                           hypre_ParVector    *Vtemp)
 {
-   MPI_Comm     comm = hypre_ParCSRMatrixComm(A);
+   return hypre_blockRelax_solve(A, f, u, blk_size, n_block, left_size, 1, diaginv, Vtemp);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_blockRelax_setup
+ *
+ * Extracts and inverts the diagonal blocks of A for the block smoother, in
+ * the layout described above.  Diagonal entries below SMALLREAL are left
+ * out, and for blk_size = 1 a zero diagonal gives a zero inverse.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_blockRelax_setup(hypre_ParCSRMatrix *A,
+                       HYPRE_Int          blk_size,
+                       HYPRE_Int          reserved_coarse_size,
+                       HYPRE_Real        **diaginvptr)
+{
+   MPI_Comm      comm = hypre_ParCSRMatrixComm(A);
    hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
    HYPRE_Real     *A_diag_data  = hypre_CSRMatrixData(A_diag);
    HYPRE_Int            *A_diag_i     = hypre_CSRMatrixI(A_diag);
    HYPRE_Int            *A_diag_j     = hypre_CSRMatrixJ(A_diag);
-   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
-   HYPRE_Int            *A_offd_i     = hypre_CSRMatrixI(A_offd);
-   HYPRE_Real     *A_offd_data  = hypre_CSRMatrixData(A_offd);
-   HYPRE_Int            *A_offd_j     = hypre_CSRMatrixJ(A_offd);
-   hypre_ParCSRCommPkg  *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
-   hypre_ParCSRCommHandle *comm_handle;
-
    HYPRE_Int             n       = hypre_CSRMatrixNumRows(A_diag);
-   HYPRE_Int             num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
-
-   hypre_Vector   *u_local = hypre_ParVectorLocalVector(u);
-   HYPRE_Real     *u_data  = hypre_VectorData(u_local);
-
-   hypre_Vector   *f_local = hypre_ParVectorLocalVector(f);
-   HYPRE_Real     *f_data  = hypre_VectorData(f_local);
-
-   hypre_Vector   *Vtemp_local = hypre_ParVectorLocalVector(Vtemp);
-   HYPRE_Real    *Vtemp_data = hypre_VectorData(Vtemp_local);
-   HYPRE_Real    *Vext_data = NULL;
-   HYPRE_Real    *v_buf_data;
-
-   HYPRE_Int             i, j, k;
-   HYPRE_Int             ii, jj;
-   HYPRE_Int             bidx, bidx1;
-   HYPRE_Int             relax_error = 0;
-   HYPRE_Int      num_sends;
-   HYPRE_Int      index, start;
-   HYPRE_Int      num_procs, my_id;
-   HYPRE_Real      *res;
 
+   const HYPRE_Int     W   = MGR_BLOCK_BATCH_SIZE;
    const HYPRE_Int     nb2 = blk_size * blk_size;
+   HYPRE_Int           i, j, k, g, b;
+   HYPRE_Int           ii, jj, row;
+   HYPRE_Int           num_procs, my_id;
+   HYPRE_Int           n_block, num_groups;
+   HYPRE_Int           left_size, left_start;
+   size_t              inv_size;
+   HYPRE_Real         *diaginv = *diaginvptr;
+   HYPRE_Real         *blk, *left_inv;
+   HYPRE_Real          a4[16];
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
-   //HYPRE_Int num_threads = hypre_NumThreads();
-
-   res = hypre_CTAlloc(HYPRE_Real,  blk_size, HYPRE_MEMORY_HOST);
 
-   if (!comm_pkg)
+   if (my_id == num_procs)
    {
-      hypre_MatvecCommPkgCreate(A);
-      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      n_block   = (n - reserved_coarse_size) / blk_size;
+      left_size = n - blk_size * n_block;
    }
-
-   if (num_procs > 1)
+   else
    {
-      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
-
-      v_buf_data = hypre_CTAlloc(HYPRE_Real,
-                                 hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
-
-      Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-
-      if (num_cols_offd)
-      {
-         A_offd_j = hypre_CSRMatrixJ(A_offd);
-         A_offd_data = hypre_CSRMatrixData(A_offd);
-      }
+      n_block = n / blk_size;
+      left_size = n - blk_size * n_block;
+   }
+   num_groups = (n_block + W - 1) / W;
+   left_start = n_block * blk_size;
 
-      index = 0;
-      for (i = 0; i < num_sends; i++)
-      {
-         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1); j++)
-            v_buf_data[index++]
-               = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
-      }
+   inv_size = (size_t) num_groups * W * nb2 + left_size * left_size;
 
-      comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data,
-                                                  Vext_data);
-   }
+   hypre_TFree(diaginv, HYPRE_MEMORY_HOST);
+   diaginv  = hypre_CTAlloc(HYPRE_Real, inv_size, HYPRE_MEMORY_HOST);
+   left_inv = diaginv + (size_t) num_groups * W * nb2;
 
    /*-----------------------------------------------------------------
-    * Copy current approximation into temporary vector.
+    * Get and invert the diagonal sub-blocks, group by group
     *-----------------------------------------------------------------*/
 
-#if 0
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
+   #pragma omp parallel for private(g, b, i, j, k, ii, jj, row, blk, a4) HYPRE_SMP_SCHEDULE
 #endif
-   for (i = 0; i < n; i++)
-   {
-      Vtemp_data[i] = u_data[i];
-      //printf("u_old[%d] = %e\n",i,Vtemp_data[i]);
-   }
-   if (num_procs > 1)
+   for (g = 0; g < num_groups; g++)
    {
-      hypre_ParCSRCommHandleDestroy(comm_handle);
-      comm_handle = NULL;
-   }
+      blk = diaginv + (size_t) g * W * nb2;
 
-   /*-----------------------------------------------------------------
-    * Relax points block by block
-    *-----------------------------------------------------------------*/
-   for (i = 0; i < n_block; i++)
-   {
-      for (j = 0; j < blk_size; j++)
+      for (b = 0; b < W; b++)
       {
-         bidx = i * blk_size + j;
-         res[j] = f_data[bidx];
-         for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
+         i = g * W + b;
+         if (i >= n_block)
          {
-            ii = A_diag_j[jj];
-            //res[j] -= A_diag_data[jj] * Vtemp_data[ii];
-            //printf("my_id = %d, %d: Au = %e * %e\n",my_id,ii,A_diag_data[jj],Vtemp_data[ii]);
-            res[j] -= A_diag_data[jj] * u_data[ii];
-            //printf("%d: Au= %e * %e =%e\n",ii,A_diag_data[jj],Vtemp_data[ii], res[j]);
+            for (k = 0; k < blk_size; k++)
+            {
+               blk[(k * blk_size + k) * W + b] = 1.0;
+            }
+            continue;
          }
-         for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
+
+         for (k = 0; k < blk_size; k++)
          {
-            ii = A_offd_j[jj];
-            res[j] -= A_offd_data[jj] * Vext_data[ii];
+            row = i * blk_size + k;
+            for (ii = A_diag_i[row]; ii < A_diag_i[row + 1]; ii++)
+            {
+               jj = A_diag_j[ii] - i * blk_size;
+               if (jj >= 0 && jj < blk_size && fabs(A_diag_data[ii]) > SMALLREAL)
+               {
+                  blk[(k * blk_size + jj) * W + b] = A_diag_data[ii];
+               }
+            }
          }
-         //printf("%d: res = %e\n",bidx,res[j]);
       }
 
-      for (j = 0; j < blk_size; j++)
+      if (blk_size == 1)
       {
-         bidx1 = i * blk_size + j;
-         for (k = 0; k < blk_size; k++)
+         for (b = 0; b < W; b++)
+         {
+            // FIX-ME: zero-diagonal should be tested previously
+            blk[b] = (fabs(blk[b]) < SMALLREAL) ? 0.0 : 1.0 / blk[b];
+         }
+      }
+      else if (blk_size == 4)
+      {
+         /* keep the cofactor formula of hypre_blas_mat_inv for 4x4 blocks */
+         for (b = 0; b < W; b++)
          {
-            bidx  = i * nb2 + j * blk_size + k;
-            u_data[bidx1] += res[k] * diaginv[bidx];
-            //printf("u[%d] = %e, diaginv[%d] = %e\n",bidx1,u_data[bidx1],bidx,diaginv[bidx]);
+            for (k = 0; k < 16; k++)
+            {
+               a4[k] = blk[k * W + b];
+            }
+            hypre_blas_smat_inv_n4(a4);
+            for (k = 0; k < 16; k++)
+            {
+               blk[k * W + b] = a4[k];
+            }
          }
-         //printf("u[%d] = %e\n",bidx1,u_data[bidx1]);
+      }
+      else
+      {
+         hypre_MGRBlockInvGroup(blk_size, blk);
       }
    }
 
-   if (num_procs > 1)
+   /* left-over block */
+   for (j = 0; j < left_size; j++)
    {
-      hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
-      hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+      row = left_start + j;
+      for (ii = A_diag_i[row]; ii < A_diag_i[row + 1]; ii++)
+      {
+         jj = A_diag_j[ii] - left_start;
+         if (jj >= 0 && fabs(A_diag_data[ii]) > SMALLREAL)
+         {
+            left_inv[j * left_size + jj] = A_diag_data[ii];
+         }
+      }
    }
-   hypre_TFree(res, HYPRE_MEMORY_HOST);
-   return (relax_error);
-}
-
-/*Block smoother*/
-HYPRE_Int
-hypre_blockRelax_setup(hypre_ParCSRMatrix *A,
-                       HYPRE_Int          blk_size,
-                       HYPRE_Int          reserved_coarse_size,
-                       HYPRE_Real        **diaginvptr)
-{
-   MPI_Comm      comm = hypre_ParCSRMatrixComm(A);
-   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Real     *A_diag_data  = hypre_CSRMatrixData(A_diag);
-   HYPRE_Int            *A_diag_i     = hypre_CSRMatrixI(A_diag);
-   HYPRE_Int            *A_diag_j     = hypre_CSRMatrixJ(A_diag);
-   HYPRE_Int             n       = hypre_CSRMatrixNumRows(A_diag);
-
-   HYPRE_Int             i, j, k;
-   HYPRE_Int             ii, jj;
-   HYPRE_Int             bidx, bidxm1, bidxp1;
-   HYPRE_Int         num_procs, my_id;
-
-   const HYPRE_Int     nb2 = blk_size * blk_size;
-   HYPRE_Int           n_block;
-   HYPRE_Int           left_size, inv_size;
-   HYPRE_Real        *diaginv = *diaginvptr;
-
-
-   hypre_MPI_Comm_size(comm, &num_procs);
-   hypre_MPI_Comm_rank(comm, &my_id);
-   //HYPRE_Int num_threads = hypre_NumThreads();
-
-   if (my_id == num_procs)
-   {
-      n_block   = (n - reserved_coarse_size) / blk_size;
-      left_size = n - blk_size * n_block;
-   }
-   else
-   {
-      n_block = n / blk_size;
-      left_size = n - blk_size * n_block;
-   }
-
-   inv_size  = nb2 * n_block + left_size * left_size;
-
-   if (diaginv != NULL)
-   {
-      hypre_TFree(diaginv, HYPRE_MEMORY_HOST);
-      diaginv = hypre_CTAlloc(HYPRE_Real,  inv_size, HYPRE_MEMORY_HOST);
-   }
-   else
-   {
-      diaginv = hypre_CTAlloc(HYPRE_Real,  inv_size, HYPRE_MEMORY_HOST);
-   }
-
-   /*-----------------------------------------------------------------
-   * Get all the diagonal sub-blocks
-   *-----------------------------------------------------------------*/
-   for (i = 0; i < n_block; i++)
-   {
-      bidxm1 = i * blk_size;
-      bidxp1 = (i + 1) * blk_size;
-      //printf("bidxm1 = %d,bidxp1 = %d\n",bidxm1,bidxp1);
-
-      for (k = 0; k < blk_size; k++)
-      {
-         for (j = 0; j < blk_size; j++)
-         {
-            bidx = i * nb2 + k * blk_size + j;
-            diaginv[bidx] = 0.0;
-         }
-
-         for (ii = A_diag_i[bidxm1 + k]; ii < A_diag_i[bidxm1 + k + 1]; ii++)
-         {
-            jj = A_diag_j[ii];
-            if (jj >= bidxm1 && jj < bidxp1 && fabs(A_diag_data[ii]) > SMALLREAL)
-            {
-               bidx = i * nb2 + k * blk_size + jj - bidxm1;
-               //printf("jj = %d,val = %e, bidx = %d\n",jj,A_diag_data[ii],bidx);
-               diaginv[bidx] = A_diag_data[ii];
-            }
-         }
-      }
-   }
-
-   for (i = 0; i < left_size; i++)
-   {
-      bidxm1 = n_block * nb2 + i * blk_size;
-      bidxp1 = n_block * nb2 + (i + 1) * blk_size;
-      for (j = 0; j < left_size; j++)
-      {
-         bidx = n_block * nb2 + i * blk_size + j;
-         diaginv[bidx] = 0.0;
-      }
-
-      for (ii = A_diag_i[n_block * blk_size + i]; ii < A_diag_i[n_block * blk_size + i + 1]; ii++)
-      {
-         jj = A_diag_j[ii];
-         if (jj > n_block * blk_size)
-         {
-            bidx = n_block * nb2 + i * blk_size + jj - n_block * blk_size;
-            diaginv[bidx] = A_diag_data[ii];
-         }
-      }
-   }
-
-
-   /*-----------------------------------------------------------------
-   * compute the inverses of all the diagonal sub-blocks
-   *-----------------------------------------------------------------*/
-   if (blk_size > 1)
-   {
-      for (i = 0; i < n_block; i++)
-      {
-         hypre_blas_mat_inv(diaginv + i * nb2, blk_size);
-      }
-      hypre_blas_mat_inv(diaginv + (HYPRE_Int)(blk_size * nb2), left_size);
-   }
-   else
+   if (left_size)
    {
-      for (i = 0; i < n; i++)
-      {
-         // FIX-ME: zero-diagonal should be tested previously
-         if (fabs(diaginv[i]) < SMALLREAL)
-         {
-            diaginv[i] = 0.0;
-         }
-         else
-         {
-            diaginv[i] = 1.0 / diaginv[i];
-         }
-      }
+      hypre_blas_mat_inv(left_inv, left_size);
    }
 
    *diaginvptr = diaginv;
 
-   return 1;
+   return hypre_error_flag;
 }
 
 HYPRE_Int
@@ -4139,31 +4248,15 @@ hypre_blockRelax(hypre_ParCSRMatrix *A,
                  hypre_ParVector    *Vtemp,
                  hypre_ParVector    *Ztemp)
 {
-   MPI_Comm      comm = hypre_ParCSRMatrixComm(A);
-   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Real     *A_diag_data  = hypre_CSRMatrixData(A_diag);
-   HYPRE_Int            *A_diag_i     = hypre_CSRMatrixI(A_diag);
-   HYPRE_Int            *A_diag_j     = hypre_CSRMatrixJ(A_diag);
-   HYPRE_Int             n       = hypre_CSRMatrixNumRows(A_diag);
-
-   HYPRE_Int             i, j, k;
-   HYPRE_Int             ii, jj;
-
-   HYPRE_Int             bidx, bidxm1, bidxp1;
-   HYPRE_Int             relax_error = 0;
-
-   HYPRE_Int         num_procs, my_id;
-
-   const HYPRE_Int     nb2 = blk_size * blk_size;
-   HYPRE_Int           n_block;
-   HYPRE_Int           left_size, inv_size;
-   HYPRE_Real          *diaginv;
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int            n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int            num_procs, my_id;
+   HYPRE_Int            n_block, left_size;
+   HYPRE_Real          *diaginv = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
 
-   //HYPRE_Int num_threads = hypre_NumThreads();
-
    if (my_id == num_procs)
    {
       n_block   = (n - reserved_coarse_size) / blk_size;
@@ -4175,117 +4268,7 @@ hypre_blockRelax(hypre_ParCSRMatrix *A,
       left_size = n - blk_size * n_block;
    }
 
-   inv_size  = nb2 * n_block + left_size * left_size;
-
-   diaginv = hypre_CTAlloc(HYPRE_Real,  inv_size, HYPRE_MEMORY_HOST);
-   /*-----------------------------------------------------------------
-   * Get all the diagonal sub-blocks
-   *-----------------------------------------------------------------*/
-   for (i = 0; i < n_block; i++)
-   {
-      bidxm1 = i * blk_size;
-      bidxp1 = (i + 1) * blk_size;
-      //printf("bidxm1 = %d,bidxp1 = %d\n",bidxm1,bidxp1);
-
-      for (k = 0; k < blk_size; k++)
-      {
-         for (j = 0; j < blk_size; j++)
-         {
-            bidx = i * nb2 + k * blk_size + j;
-            diaginv[bidx] = 0.0;
-         }
-
-         for (ii = A_diag_i[bidxm1 + k]; ii < A_diag_i[bidxm1 + k + 1]; ii++)
-         {
-            jj = A_diag_j[ii];
-
-            if (jj >= bidxm1 && jj < bidxp1 && fabs(A_diag_data[ii]) > SMALLREAL)
-            {
-               bidx = i * nb2 + k * blk_size + jj - bidxm1;
-               //printf("jj = %d,val = %e, bidx = %d\n",jj,A_diag_data[ii],bidx);
-               diaginv[bidx] = A_diag_data[ii];
-            }
-         }
-      }
-   }
-
-   for (i = 0; i < left_size; i++)
-   {
-      bidxm1 = n_block * nb2 + i * blk_size;
-      bidxp1 = n_block * nb2 + (i + 1) * blk_size;
-      for (j = 0; j < left_size; j++)
-      {
-         bidx = n_block * nb2 + i * blk_size + j;
-         diaginv[bidx] = 0.0;
-      }
-
-      for (ii = A_diag_i[n_block * blk_size + i]; ii < A_diag_i[n_block * blk_size + i + 1]; ii++)
-      {
-         jj = A_diag_j[ii];
-         if (jj > n_block * blk_size)
-         {
-            bidx = n_block * nb2 + i * blk_size + jj - n_block * blk_size;
-            diaginv[bidx] = A_diag_data[ii];
-         }
-      }
-   }
-   /*
-   for (i = 0;i < n_block; i++)
-   {
-     for (j = 0;j < blk_size; j++)
-     {
-       for (k = 0;k < blk_size; k ++)
-       {
-         bidx = i*nb2 + j*blk_size + k;
-         printf("%e\t",diaginv[bidx]);
-       }
-       printf("\n");
-     }
-     printf("\n");
-   }
-   */
-   /*-----------------------------------------------------------------
-   * compute the inverses of all the diagonal sub-blocks
-   *-----------------------------------------------------------------*/
-   if (blk_size > 1)
-   {
-      for (i = 0; i < n_block; i++)
-      {
-         hypre_blas_mat_inv(diaginv + i * nb2, blk_size);
-      }
-      hypre_blas_mat_inv(diaginv + (HYPRE_Int)(blk_size * nb2), left_size);
-      /*
-      for (i = 0;i < n_block; i++)
-      {
-        for (j = 0;j < blk_size; j++)
-        {
-          for (k = 0;k < blk_size; k ++)
-          {
-            bidx = i*nb2 + j*blk_size + k;
-            printf("%e\t",diaginv[bidx]);
-          }
-          printf("\n");
-        }
-        printf("\n");
-      }
-      */
-   }
-   else
-   {
-      for (i = 0; i < n; i++)
-      {
-         // FIX-ME: zero-diagonal should be tested previously
-         if (fabs(diaginv[i]) < SMALLREAL)
-         {
-            diaginv[i] = 0.0;
-         }
-         else
-         {
-            diaginv[i] = 1.0 / diaginv[i];
-         }
-      }
-   }
-
+   hypre_blockRelax_setup(A, blk_size, reserved_coarse_size, &diaginv);
    hypre_blockRelax_solve(A, f, u, blk_size, n_block, left_size, method, diaginv, Vtemp);
 
    /*-----------------------------------------------------------------
@@ -4293,7 +4276,7 @@ hypre_blockRelax(hypre_ParCSRMatrix *A,
    *-----------------------------------------------------------------*/
    hypre_TFree(diaginv, HYPRE_MEMORY_HOST);
 
-   return (relax_error);
+   return hypre_error_flag;
 }
 
 /* set coarse grid solver */
@@ -4746,6 +4729,26 @@ hypre_MGRSetPMaxElmts( void *mgr_vdata, HYPRE_Int P_max_elmts)
    return hypre_error_flag;
 }
 
+/* Keep the CF splitting and the patterns of the operators in later setups,
+   and only recompute their values */
+HYPRE_Int
+hypre_MGRSetReuseSetup( void *mgr_vdata, HYPRE_Int reuse_setup )
+{
+   hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+   (mgr_data -> reuse_setup) = reuse_setup;
+   return hypre_error_flag;
+}
+
+/* Number of reused setups in a row that keep the setups of the F-relaxation,
+   coarse grid and global ILU solvers */
+HYPRE_Int
+hypre_MGRSetInnerSetupLag( void *mgr_vdata, HYPRE_Int lag )
+{
+   hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+   (mgr_data -> inner_setup_lag) = lag;
+   return hypre_error_flag;
+}
+
 /* Get number of iterations for MGR solver */
 HYPRE_Int
 hypre_MGRGetNumIterations( void *mgr_vdata, HYPRE_Int *num_iterations )
@@ -5301,6 +5304,349 @@ hypre_MGRBuildAff( hypre_ParCSRMatrix   *A,
    return (0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_MGRUpdateMatrixValues
+ *
+ * Copies the values of A_new into A, on the sparsity pattern of A.  Both
+ * matrices have the same row and column partitionings.  Entries of A_new
+ * outside the pattern of A are dropped, and entries of A not in A_new are
+ * set to zero.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MGRUpdateMatrixValues( hypre_ParCSRMatrix *A_new,
+                             hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix  *A_diag         = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int        *A_diag_i       = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        *A_diag_j       = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real       *A_diag_data    = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix  *A_offd         = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int        *A_offd_i       = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int        *A_offd_j       = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real       *A_offd_data    = hypre_CSRMatrixData(A_offd);
+   HYPRE_BigInt     *col_map_offd   = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int         num_rows       = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int         num_cols_diag  = hypre_CSRMatrixNumCols(A_diag);
+   HYPRE_Int         num_cols_offd  = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix  *N_diag         = hypre_ParCSRMatrixDiag(A_new);
+   HYPRE_Int        *N_diag_i       = hypre_CSRMatrixI(N_diag);
+   HYPRE_Int        *N_diag_j       = hypre_CSRMatrixJ(N_diag);
+   HYPRE_Real       *N_diag_data    = hypre_CSRMatrixData(N_diag);
+   hypre_CSRMatrix  *N_offd         = hypre_ParCSRMatrixOffd(A_new);
+   HYPRE_Int        *N_offd_i       = hypre_CSRMatrixI(N_offd);
+   HYPRE_Int        *N_offd_j       = hypre_CSRMatrixJ(N_offd);
+   HYPRE_Real       *N_offd_data    = hypre_CSRMatrixData(N_offd);
+   HYPRE_BigInt     *col_map_new    = hypre_ParCSRMatrixColMapOffd(A_new);
+   HYPRE_Int         num_cols_new   = hypre_CSRMatrixNumCols(N_offd);
+
+   HYPRE_Int        *offd_map;
+   HYPRE_Int         i, j, k, jj, pos;
+
+   hypre_assert(hypre_CSRMatrixNumRows(N_diag) == num_rows);
+   hypre_assert(hypre_CSRMatrixNumCols(N_diag) == num_cols_diag);
+
+   /* off-processor columns of A_new in A, both column maps are sorted */
+   offd_map = hypre_TAlloc(HYPRE_Int, num_cols_new, HYPRE_MEMORY_HOST);
+   k = 0;
+   for (j = 0; j < num_cols_new; j++)
+   {
+      while (k < num_cols_offd && col_map_offd[k] < col_map_new[j])
+      {
+         k++;
+      }
+      offd_map[j] = (k < num_cols_offd && col_map_offd[k] == col_map_new[j]) ? k : -1;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, j, jj, pos)
+#endif
+   {
+      HYPRE_Int *diag_marker = hypre_TAlloc(HYPRE_Int, num_cols_diag, HYPRE_MEMORY_HOST);
+      HYPRE_Int *offd_marker = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+
+      for (j = 0; j < num_cols_diag; j++)
+      {
+         diag_marker[j] = -1;
+      }
+      for (j = 0; j < num_cols_offd; j++)
+      {
+         offd_marker[j] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            diag_marker[A_diag_j[jj]] = jj;
+            A_diag_data[jj] = 0.0;
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            offd_marker[A_offd_j[jj]] = jj;
+            A_offd_data[jj] = 0.0;
+         }
+
+         for (jj = N_diag_i[i]; jj < N_diag_i[i + 1]; jj++)
+         {
+            pos = diag_marker[N_diag_j[jj]];
+            if (pos >= 0)
+            {
+               A_diag_data[pos] += N_diag_data[jj];
+            }
+         }
+         for (jj = N_offd_i[i]; jj < N_offd_i[i + 1]; jj++)
+         {
+            j = offd_map[N_offd_j[jj]];
+            if (j >= 0 && (pos = offd_marker[j]) >= 0)
+            {
+               A_offd_data[pos] += N_offd_data[jj];
+            }
+         }
+
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            diag_marker[A_diag_j[jj]] = -1;
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            offd_marker[A_offd_j[jj]] = -1;
+         }
+      }
+
+      hypre_TFree(diag_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(offd_marker, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(offd_map, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRComputeCoarseGridValues
+ *
+ * Computes the values of the Galerkin coarse grid for injection
+ * restriction, i.e. the rows of A P at the C-points, on the sparsity
+ * pattern of RAP.  Products outside the pattern are dropped.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MGRComputeCoarseGridValues( hypre_ParCSRMatrix *A,
+                                  HYPRE_Int          *CF_marker,
+                                  hypre_ParCSRMatrix *P,
+                                  hypre_ParCSRMatrix *RAP )
+{
+   MPI_Comm          comm            = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix  *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int        *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real       *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix  *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int        *A_offd_i        = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int        *A_offd_j        = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real       *A_offd_data     = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int         n_fine          = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix  *P_diag          = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int        *P_diag_i        = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int        *P_diag_j        = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Real       *P_diag_data     = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix  *P_offd          = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int        *P_offd_i        = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int        *P_offd_j        = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Real       *P_offd_data     = hypre_CSRMatrixData(P_offd);
+   HYPRE_BigInt     *col_map_P       = hypre_ParCSRMatrixColMapOffd(P);
+   HYPRE_Int         num_cols_P_offd = hypre_CSRMatrixNumCols(P_offd);
+
+   hypre_CSRMatrix  *C_diag          = hypre_ParCSRMatrixDiag(RAP);
+   HYPRE_Int        *C_diag_i        = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int        *C_diag_j        = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Real       *C_diag_data     = hypre_CSRMatrixData(C_diag);
+   hypre_CSRMatrix  *C_offd          = hypre_ParCSRMatrixOffd(RAP);
+   HYPRE_Int        *C_offd_i        = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int        *C_offd_j        = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Real       *C_offd_data     = hypre_CSRMatrixData(C_offd);
+   HYPRE_BigInt     *col_map_C       = hypre_ParCSRMatrixColMapOffd(RAP);
+   HYPRE_Int         n_coarse        = hypre_CSRMatrixNumRows(C_diag);
+   HYPRE_Int         num_cols_C_diag = hypre_CSRMatrixNumCols(C_diag);
+   HYPRE_Int         num_cols_C_offd = hypre_CSRMatrixNumCols(C_offd);
+   HYPRE_BigInt      first_col       = hypre_ParCSRMatrixFirstColDiag(RAP);
+
+   hypre_CSRMatrix  *P_ext           = NULL;
+   HYPRE_Int        *P_ext_i         = NULL;
+   HYPRE_BigInt     *P_ext_j         = NULL;
+   HYPRE_Real       *P_ext_data      = NULL;
+   HYPRE_Int        *P_ext_col       = NULL;
+   HYPRE_Int        *P_offd_col;
+   HYPRE_Int        *c_rows;
+
+   HYPRE_Int         num_procs;
+   HYPRE_Int         i, j, k, ic, jj, kk, pos;
+   HYPRE_BigInt      big_j;
+   HYPRE_Real        a_ij;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* rows of P for the off-processor columns of A, with their columns as
+      encoded positions in RAP: j >= 0 for diag column j, -k-2 for offd
+      column k, and -1 if the column is not in the pattern */
+   if (num_procs > 1)
+   {
+      P_ext      = hypre_ParCSRMatrixExtractBExt(P, A, 1);
+      P_ext_i    = hypre_CSRMatrixI(P_ext);
+      P_ext_j    = hypre_CSRMatrixBigJ(P_ext);
+      P_ext_data = hypre_CSRMatrixData(P_ext);
+      P_ext_col  = hypre_TAlloc(HYPRE_Int, hypre_CSRMatrixNumNonzeros(P_ext), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(jj, k, big_j) HYPRE_SMP_SCHEDULE
+#endif
+      for (jj = 0; jj < hypre_CSRMatrixNumNonzeros(P_ext); jj++)
+      {
+         big_j = P_ext_j[jj];
+         if (big_j >= first_col && big_j < first_col + num_cols_C_diag)
+         {
+            P_ext_col[jj] = (HYPRE_Int)(big_j - first_col);
+         }
+         else
+         {
+            k = hypre_BigBinarySearch(col_map_C, big_j, num_cols_C_offd);
+            P_ext_col[jj] = (k >= 0) ? -k - 2 : -1;
+         }
+      }
+   }
+
+   /* off-processor columns of P in RAP */
+   P_offd_col = hypre_TAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_cols_P_offd; k++)
+   {
+      P_offd_col[k] = hypre_BigBinarySearch(col_map_C, col_map_P[k], num_cols_C_offd);
+   }
+
+   /* fine grid rows of the coarse points */
+   c_rows = hypre_TAlloc(HYPRE_Int, n_coarse, HYPRE_MEMORY_HOST);
+   ic = 0;
+   for (i = 0; i < n_fine; i++)
+   {
+      if (CF_marker[i] >= 0)
+      {
+         c_rows[ic++] = i;
+      }
+   }
+   hypre_assert(ic == n_coarse);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(ic, i, j, k, jj, kk, pos, a_ij)
+#endif
+   {
+      HYPRE_Int *diag_marker = hypre_TAlloc(HYPRE_Int, num_cols_C_diag, HYPRE_MEMORY_HOST);
+      HYPRE_Int *offd_marker = hypre_TAlloc(HYPRE_Int, num_cols_C_offd, HYPRE_MEMORY_HOST);
+
+      for (j = 0; j < num_cols_C_diag; j++)
+      {
+         diag_marker[j] = -1;
+      }
+      for (j = 0; j < num_cols_C_offd; j++)
+      {
+         offd_marker[j] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (ic = 0; ic < n_coarse; ic++)
+      {
+         i = c_rows[ic];
+
+         for (kk = C_diag_i[ic]; kk < C_diag_i[ic + 1]; kk++)
+         {
+            diag_marker[C_diag_j[kk]] = kk;
+            C_diag_data[kk] = 0.0;
+         }
+         for (kk = C_offd_i[ic]; kk < C_offd_i[ic + 1]; kk++)
+         {
+            offd_marker[C_offd_j[kk]] = kk;
+            C_offd_data[kk] = 0.0;
+         }
+
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            j    = A_diag_j[jj];
+            a_ij = A_diag_data[jj];
+            for (kk = P_diag_i[j]; kk < P_diag_i[j + 1]; kk++)
+            {
+               pos = diag_marker[P_diag_j[kk]];
+               if (pos >= 0)
+               {
+                  C_diag_data[pos] += a_ij * P_diag_data[kk];
+               }
+            }
+            for (kk = P_offd_i[j]; kk < P_offd_i[j + 1]; kk++)
+            {
+               k = P_offd_col[P_offd_j[kk]];
+               if (k >= 0 && (pos = offd_marker[k]) >= 0)
+               {
+                  C_offd_data[pos] += a_ij * P_offd_data[kk];
+               }
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            j    = A_offd_j[jj];
+            a_ij = A_offd_data[jj];
+            for (kk = P_ext_i[j]; kk < P_ext_i[j + 1]; kk++)
+            {
+               k = P_ext_col[kk];
+               if (k >= 0)
+               {
+                  pos = diag_marker[k];
+               }
+               else
+               {
+                  pos = (k < -1) ? offd_marker[-k - 2] : -1;
+               }
+               if (pos >= 0)
+               {
+                  if (k >= 0)
+                  {
+                     C_diag_data[pos] += a_ij * P_ext_data[kk];
+                  }
+                  else
+                  {
+                     C_offd_data[pos] += a_ij * P_ext_data[kk];
+                  }
+               }
+            }
+         }
+
+         for (kk = C_diag_i[ic]; kk < C_diag_i[ic + 1]; kk++)
+         {
+            diag_marker[C_diag_j[kk]] = -1;
+         }
+         for (kk = C_offd_i[ic]; kk < C_offd_i[ic + 1]; kk++)
+         {
+            offd_marker[C_offd_j[kk]] = -1;
+         }
+      }
+
+      hypre_TFree(diag_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(offd_marker, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(c_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(P_offd_col, HYPRE_MEMORY_HOST);
+   hypre_TFree(P_ext_col, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(P_ext);
+
+   return hypre_error_flag;
+}
+
 /*********************************************************************************
  * This routine assumes that the 'toVector' is larger than the 'fromVector' and
  * the CF_marker is of the same length as the toVector. There must be n 'point_type'
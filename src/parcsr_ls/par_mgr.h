@@ -134,6 +134,11 @@ typedef struct
 
    HYPRE_Real  cg_convergence_factor;
 
+   /* reuse of the CF splitting and operator patterns in later setups */
+   HYPRE_Int   reuse_setup;
+   HYPRE_Int   inner_setup_lag;
+   HYPRE_Int   num_lagged_setups;
+
 } hypre_ParMGRData;
 
 
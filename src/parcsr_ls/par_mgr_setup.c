@@ -142,6 +142,24 @@ hypre_MGRSetup( void               *mgr_vdata,
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
 
+   /* Keep the CF splitting and operator patterns of the previous setup */
+   if ((mgr_data -> reuse_setup) && (mgr_data -> num_coarse_levels) > 0)
+   {
+      HYPRE_Int reuse = (exec == HYPRE_EXEC_HOST &&
+                         hypre_ParCSRMatrixNumRows(P_array[0]) == nloc &&
+                         hypre_ParCSRMatrixGlobalNumRows(P_array[0]) == hypre_ParCSRMatrixGlobalNumRows(A));
+      HYPRE_Int reuse_all;
+
+      hypre_MPI_Allreduce(&reuse, &reuse_all, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+      if (reuse_all)
+      {
+         hypre_MGRSetupReuse(mgr_data, A, f, u);
+         HYPRE_ANNOTATE_FUNC_END;
+
+         return hypre_error_flag;
+      }
+   }
+
    /* Trivial case: simply solve the coarse level problem */
    if ( block_size < 2 || (mgr_data -> max_num_coarse_levels) < 1)
    {
@@ -1324,6 +1342,255 @@ hypre_MGRSetup( void               *mgr_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_MGRSetupReuse
+ *
+ * Setup with the CF splitting and the operator patterns of the previous
+ * setup (see hypre_MGRSetReuseSetup).  Interpolation, restriction, coarse
+ * grid and F-relaxation matrices are updated in place, so that the solvers
+ * built on them see the new values.  Injection operators are left as they
+ * are, and the Galerkin product with injection restriction is computed
+ * directly on the coarse grid pattern.  The setups of the F-relaxation,
+ * coarse grid and global ILU solvers are redone only every
+ * inner_setup_lag + 1 calls.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MGRSetupReuse( void               *mgr_vdata,
+                     hypre_ParCSRMatrix *A,
+                     hypre_ParVector    *f,
+                     hypre_ParVector    *u )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParMGRData    *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+
+   HYPRE_Int            num_c_levels = (mgr_data -> num_coarse_levels);
+   hypre_ParCSRMatrix **A_array = (mgr_data -> A_array);
+   hypre_ParCSRMatrix **P_array = (mgr_data -> P_array);
+   hypre_ParCSRMatrix **RT_array = (mgr_data -> RT_array);
+   hypre_ParCSRMatrix **A_ff_array = (mgr_data -> A_ff_array);
+   hypre_IntArray     **CF_marker_array = (mgr_data -> CF_marker_array);
+   hypre_ParVector    **F_array = (mgr_data -> F_array);
+   hypre_ParVector    **U_array = (mgr_data -> U_array);
+   hypre_ParVector    **F_fine_array = (mgr_data -> F_fine_array);
+   hypre_ParVector    **U_fine_array = (mgr_data -> U_fine_array);
+   HYPRE_Solver       **aff_solver = (mgr_data -> aff_solver);
+   hypre_ParAMGData   **FrelaxVcycleData = (mgr_data -> FrelaxVcycleData);
+   hypre_Vector       **l1_norms = (mgr_data -> l1_norms);
+
+   HYPRE_Int           *interp_type = (mgr_data -> interp_type);
+   HYPRE_Int           *restrict_type = (mgr_data -> restrict_type);
+   HYPRE_Int           *Frelax_method = (mgr_data -> Frelax_method);
+   HYPRE_Int           *use_non_galerkin_cg = (mgr_data -> use_non_galerkin_cg);
+   HYPRE_Int           *block_num_coarse_indexes = (mgr_data -> block_num_coarse_indexes);
+   HYPRE_Int            block_size = (mgr_data -> block_size);
+   HYPRE_Int            set_c_points_method = (mgr_data -> set_c_points_method);
+   HYPRE_Int            reserved_coarse_size = (mgr_data -> reserved_coarse_size);
+   HYPRE_Int            num_interp_sweeps = (mgr_data -> num_interp_sweeps);
+   HYPRE_Int            num_restrict_sweeps = (mgr_data -> num_interp_sweeps);
+   HYPRE_Int            max_elmts = (mgr_data -> P_max_elmts);
+   HYPRE_Real           max_row_sum = (mgr_data -> max_row_sum);
+   HYPRE_Real           strong_threshold = (mgr_data -> strong_threshold);
+   HYPRE_Real           trunc_factor = (mgr_data -> trunc_factor);
+   HYPRE_Int            relax_type = (mgr_data -> relax_type);
+   HYPRE_Int            relax_order = (mgr_data -> relax_order);
+   HYPRE_Int            global_smooth_type = (mgr_data -> global_smooth_type);
+   HYPRE_Int            global_smooth_iters = (mgr_data -> global_smooth_iters);
+
+   HYPRE_Int (*fine_grid_solver_setup)(void*, void*, void*, void*) =
+      (mgr_data -> fine_grid_solver_setup);
+   HYPRE_Int (*coarse_grid_solver_setup)(void*, void*, void*, void*) =
+      (HYPRE_Int (*)(void*, void*, void*, void*)) (mgr_data -> coarse_grid_solver_setup);
+
+   hypre_ParCSRMatrix  *S, *ST, *P, *RT, *AP, *RAP, *RAP_new, *A_ff;
+   HYPRE_BigInt        *coarse_pnts_global;
+   HYPRE_Int           *CF_marker;
+   HYPRE_Int            lev, j, use_air, redo_inner;
+   HYPRE_Int            debug_flag = 0;
+
+   /* the inner setups are redone every inner_setup_lag + 1 setups */
+   if ((mgr_data -> num_lagged_setups) < (mgr_data -> inner_setup_lag))
+   {
+      (mgr_data -> num_lagged_setups)++;
+      redo_inner = 0;
+   }
+   else
+   {
+      (mgr_data -> num_lagged_setups) = 0;
+      redo_inner = 1;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   A_array[0] = A;
+   F_array[0] = f;
+   U_array[0] = u;
+
+   for (lev = 0; lev < num_c_levels; lev++)
+   {
+      CF_marker = hypre_IntArrayData(CF_marker_array[lev]);
+      coarse_pnts_global = hypre_ParCSRMatrixColStarts(P_array[lev]);
+      RAP = (lev < num_c_levels - 1) ? A_array[lev + 1] : (mgr_data -> RAP);
+      RAP_new = NULL;
+
+      /* Interpolation operator, injection does not depend on A */
+      if (interp_type[lev] != 0)
+      {
+         S = NULL;
+         if (interp_type[lev] > 2 && interp_type[lev] != 4)
+         {
+            hypre_BoomerAMGCreateS(A_array[lev], strong_threshold, max_row_sum, 1, NULL, &S);
+         }
+         hypre_MGRBuildInterp(A_array[lev], CF_marker, S, coarse_pnts_global, 1, NULL,
+                              debug_flag, trunc_factor, max_elmts, &P, interp_type[lev],
+                              num_interp_sweeps);
+         hypre_MGRUpdateMatrixValues(P, P_array[lev]);
+         hypre_ParCSRMatrixDestroy(P);
+         hypre_ParCSRMatrixDestroy(S);
+      }
+
+      /* Restriction operator and coarse grid */
+      use_air = (restrict_type[lev] == 4) ? 1 : ((restrict_type[lev] == 5) ? 2 : 0);
+      if (use_air)
+      {
+         hypre_BoomerAMGCreateSabs(A_array[lev], strong_threshold, 1.0, 1, NULL, &ST);
+         if (use_air == 1)
+         {
+            hypre_BoomerAMGBuildRestrAIR(A_array[lev], CF_marker, ST, coarse_pnts_global, 1,
+                                         NULL, 0.0, debug_flag, &RT, 0, 64);
+         }
+         else
+         {
+            hypre_BoomerAMGBuildRestrDist2AIR(A_array[lev], CF_marker, ST, coarse_pnts_global, 1,
+                                              NULL, debug_flag, 0.0, &RT, 1, 0, 64);
+         }
+         hypre_MGRUpdateMatrixValues(RT, RT_array[lev]);
+         hypre_ParCSRMatrixDestroy(RT);
+         hypre_ParCSRMatrixDestroy(ST);
+
+         AP = hypre_ParMatmul(A_array[lev], P_array[lev]);
+         RAP_new = hypre_ParMatmul(RT_array[lev], AP);
+         hypre_ParCSRMatrixDestroy(AP);
+      }
+      else
+      {
+         if (restrict_type[lev] != 0)
+         {
+            hypre_MGRBuildRestrict(A_array[lev], CF_marker, coarse_pnts_global, 1, NULL,
+                                   debug_flag, trunc_factor, max_elmts, strong_threshold,
+                                   max_row_sum, &RT, restrict_type[lev], num_restrict_sweeps);
+            hypre_MGRUpdateMatrixValues(RT, RT_array[lev]);
+            hypre_ParCSRMatrixDestroy(RT);
+         }
+
+         if (use_non_galerkin_cg[lev] != 0)
+         {
+            HYPRE_Int block_num_f_points = (lev == 0 ? block_size : block_num_coarse_indexes[lev - 1]) -
+                                           block_num_coarse_indexes[lev];
+            hypre_MGRComputeNonGalerkinCoarseGrid(A_array[lev], P_array[lev], RT_array[lev],
+                                                  block_num_f_points, set_c_points_method, 0,
+                                                  max_elmts, 0, CF_marker, &RAP_new);
+         }
+         else if (restrict_type[lev] == 0)
+         {
+            hypre_MGRComputeCoarseGridValues(A_array[lev], CF_marker, P_array[lev], RAP);
+         }
+         else
+         {
+            RAP_new = hypre_ParCSRMatrixRAPKT(RT_array[lev], A_array[lev], P_array[lev], 1);
+         }
+      }
+      if (RAP_new)
+      {
+         hypre_MGRUpdateMatrixValues(RAP_new, RAP);
+         hypre_ParCSRMatrixDestroy(RAP_new);
+      }
+
+      /* F-relaxation */
+      if (Frelax_method[lev] == 2 && A_ff_array[lev] && (mgr_data -> fsolver_mode) != 0)
+      {
+         hypre_MGRBuildAff(A_array[lev], CF_marker, debug_flag, &A_ff);
+         hypre_MGRUpdateMatrixValues(A_ff, A_ff_array[lev]);
+         hypre_ParCSRMatrixDestroy(A_ff);
+         if (redo_inner)
+         {
+            fine_grid_solver_setup(aff_solver[lev], A_ff_array[lev], F_fine_array[lev + 1],
+                                   U_fine_array[lev + 1]);
+         }
+      }
+      else if (Frelax_method[lev] == 1 && FrelaxVcycleData && FrelaxVcycleData[lev])
+      {
+         if (redo_inner)
+         {
+            hypre_MGRSetupFrelaxVcycleData(mgr_data, A_array[lev], F_array[lev], U_array[lev], lev);
+         }
+         else
+         {
+            (FrelaxVcycleData[lev] -> A_array)[0] = A_array[lev];
+            (FrelaxVcycleData[lev] -> F_array)[0] = F_array[lev];
+            (FrelaxVcycleData[lev] -> U_array)[0] = U_array[lev];
+         }
+      }
+   }
+
+   /* Coarse grid solver */
+   if (redo_inner)
+   {
+      coarse_grid_solver_setup((mgr_data -> coarse_grid_solver), (mgr_data -> RAP),
+                               F_array[num_c_levels], U_array[num_c_levels]);
+   }
+
+   /* Global smoother */
+   if (global_smooth_iters > 0)
+   {
+      if (global_smooth_type == 0)
+      {
+         hypre_blockRelax_setup(A, (set_c_points_method == 0) ? block_size : 1,
+                                reserved_coarse_size, &(mgr_data -> diaginv));
+      }
+      else if (global_smooth_type == 8 && redo_inner)
+      {
+         HYPRE_EuclidDestroy(mgr_data -> global_smoother);
+         HYPRE_EuclidCreate(comm, &(mgr_data -> global_smoother));
+         HYPRE_EuclidSetLevel(mgr_data -> global_smoother, 0);
+         HYPRE_EuclidSetBJ(mgr_data -> global_smoother, 1);
+         HYPRE_EuclidSetup(mgr_data -> global_smoother, A, f, u);
+      }
+      else if (global_smooth_type == 16 && redo_inner)
+      {
+         HYPRE_ILUDestroy(mgr_data -> global_smoother);
+         HYPRE_ILUCreate(&(mgr_data -> global_smoother));
+         HYPRE_ILUSetType(mgr_data -> global_smoother, 0);
+         HYPRE_ILUSetLevelOfFill(mgr_data -> global_smoother, 0);
+         HYPRE_ILUSetMaxIter(mgr_data -> global_smoother, global_smooth_iters);
+         HYPRE_ILUSetTol(mgr_data -> global_smoother, 0.0);
+         HYPRE_ILUSetup(mgr_data -> global_smoother, A, f, u);
+      }
+   }
+
+   /* l1 norms for the F-relaxation */
+   if (l1_norms)
+   {
+      for (j = 0; j < num_c_levels; j++)
+      {
+         HYPRE_Real *l1_norm_data = NULL;
+
+         CF_marker = relax_order ? hypre_IntArrayData(CF_marker_array[j]) : NULL;
+         hypre_ParCSRComputeL1Norms(A_array[j], (relax_type == 18) ? 1 : 4, CF_marker,
+                                    &l1_norm_data);
+
+         hypre_SeqVectorDestroy(l1_norms[j]);
+         l1_norms[j] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[j]));
+         hypre_VectorData(l1_norms[j]) = l1_norm_data;
+         hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /* Setup data for Frelax V-cycle */
 HYPRE_Int
 hypre_MGRSetupFrelaxVcycleData( void *mgr_vdata,
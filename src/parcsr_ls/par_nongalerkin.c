@@ -2346,3 +2346,274 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
 
    return ierr;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSparsifyCoarseOperator
+ *
+ * Sparsify a Galerkin coarse-grid operator so that it has at most max_nnz
+ * nonzeros (globally), with an automatically chosen drop tolerance.
+ *
+ * An off-diagonal entry a_ij is measured by
+ *
+ *    |a_ij| / min(m_i, m_j),   m_i = max_{k != i} |a_ik|,
+ *
+ * which is symmetric for symmetric A_H and at least 1 for the largest
+ * entry of each row.  The entries of all rows are binned by this measure
+ * on a logarithmic scale, and the smallest bin edge that removes enough
+ * entries is used as the drop tolerance, up to a maximum of max_tol.
+ * Dropped entries are added to the diagonal, which keeps the row sums.
+ * An entry is kept if adding it would remove or flip the sign of the
+ * diagonal.  Unused off-processor columns are removed.
+ *
+ * The tolerance that was used is returned in droptol_ptr (0 if nothing
+ * was dropped).
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SPARSIFY_BINS_PER_DECADE 8
+#define HYPRE_SPARSIFY_NUM_DECADES     6
+#define HYPRE_SPARSIFY_NUM_BINS        (HYPRE_SPARSIFY_BINS_PER_DECADE * HYPRE_SPARSIFY_NUM_DECADES)
+
+HYPRE_Int
+hypre_BoomerAMGSparsifyCoarseOperator( hypre_ParCSRMatrix *A_H,
+                                       HYPRE_Real          max_nnz,
+                                       HYPRE_Real          max_tol,
+                                       HYPRE_Real         *droptol_ptr )
+{
+   MPI_Comm                comm          = hypre_ParCSRMatrixComm(A_H);
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A_H);
+   hypre_ParCSRCommHandle *comm_handle;
+
+   hypre_CSRMatrix        *A_diag        = hypre_ParCSRMatrixDiag(A_H);
+   HYPRE_Int              *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real             *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix        *A_offd        = hypre_ParCSRMatrixOffd(A_H);
+   HYPRE_Int              *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real             *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int               num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_BigInt           *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A_H);
+
+   HYPRE_Real             *row_max, *row_max_offd = NULL, *buf_data;
+   HYPRE_Int              *offd_map = NULL;
+   HYPRE_Int              *diag_pos;
+   HYPRE_Real              hist[HYPRE_SPARSIFY_NUM_BINS + 1];
+   HYPRE_Real              global_hist[HYPRE_SPARSIFY_NUM_BINS + 1];
+   HYPRE_Real              local_nnz, global_nnz, excess, dropped, droptol, measure;
+   HYPRE_Int               i, j, jj, bin, num_sends, begin, end, cnt_diag, cnt_offd;
+   HYPRE_Int               num_cols_offd_new;
+
+   *droptol_ptr = 0.0;
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A_H)) == hypre_MEMORY_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Automatic non-Galerkin sparsification is only available on the host!\n");
+      return hypre_error_flag;
+   }
+
+   local_nnz = (HYPRE_Real) (A_diag_i[num_rows] + A_offd_i[num_rows]);
+   hypre_MPI_Allreduce(&local_nnz, &global_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   if (global_nnz <= max_nnz || max_tol <= 0.0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A_H);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A_H);
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   begin     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+   end       = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   /* largest off-diagonal magnitude of each row, also for the offd columns */
+   row_max  = hypre_CTAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   diag_pos = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_pos[i] = -1;
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         if (A_diag_j[jj] == i)
+         {
+            diag_pos[i] = jj;
+         }
+         else
+         {
+            row_max[i] = hypre_max(row_max[i], hypre_abs(A_diag_data[jj]));
+         }
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+      {
+         row_max[i] = hypre_max(row_max[i], hypre_abs(A_offd_data[jj]));
+      }
+   }
+
+   row_max_offd = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+   buf_data     = hypre_CTAlloc(HYPRE_Real, end - begin, HYPRE_MEMORY_HOST);
+   for (jj = begin; jj < end; jj++)
+   {
+      buf_data[jj - begin] = row_max[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, jj)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, buf_data, row_max_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   hypre_TFree(buf_data, HYPRE_MEMORY_HOST);
+
+   /* histogram of the measure; bin 0 holds everything below the smallest
+      edge, bin k >= 1 holds [10^((k-1)/B - D), 10^(k/B - D)) */
+#define hypre_SparsifyMeasure(a, mi, mj) \
+   ( ((mi) > 0.0 && (mj) > 0.0) ? hypre_abs(a) / hypre_min(mi, mj) : 1.0 )
+#define hypre_SparsifyBin(m) \
+   ( (m) >= 1.0 ? HYPRE_SPARSIFY_NUM_BINS : (m) <= 0.0 ? 0 : \
+     hypre_max(0, (HYPRE_Int) floor((log10(m) + HYPRE_SPARSIFY_NUM_DECADES) * \
+                                          HYPRE_SPARSIFY_BINS_PER_DECADE) + 1) )
+
+   for (bin = 0; bin <= HYPRE_SPARSIFY_NUM_BINS; bin++)
+   {
+      hist[bin] = 0.0;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      if (diag_pos[i] < 0)
+      {
+         continue;
+      }
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         j = A_diag_j[jj];
+         if (j == i)
+         {
+            continue;
+         }
+         measure = hypre_SparsifyMeasure(A_diag_data[jj], row_max[i], row_max[j]);
+         hist[hypre_min(hypre_SparsifyBin(measure), HYPRE_SPARSIFY_NUM_BINS)] += 1.0;
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+      {
+         j = A_offd_j[jj];
+         measure = hypre_SparsifyMeasure(A_offd_data[jj], row_max[i], row_max_offd[j]);
+         hist[hypre_min(hypre_SparsifyBin(measure), HYPRE_SPARSIFY_NUM_BINS)] += 1.0;
+      }
+   }
+   hypre_MPI_Allreduce(hist, global_hist, HYPRE_SPARSIFY_NUM_BINS + 1, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+
+   /* smallest bin edge that removes the excess, capped by max_tol */
+   excess  = global_nnz - max_nnz;
+   dropped = 0.0;
+   droptol = 0.0;
+   for (bin = 0; bin < HYPRE_SPARSIFY_NUM_BINS; bin++)
+   {
+      HYPRE_Real edge = pow(10.0, (HYPRE_Real) bin / HYPRE_SPARSIFY_BINS_PER_DECADE -
+                                  HYPRE_SPARSIFY_NUM_DECADES);
+      if (edge > max_tol)
+      {
+         break;
+      }
+      dropped += global_hist[bin];
+      droptol  = edge;
+      if (dropped >= excess)
+      {
+         break;
+      }
+   }
+
+   if (dropped > 0.0)
+   {
+      /* drop and lump; diag keeps the position of the diagonal */
+      cnt_diag = 0;
+      cnt_offd = 0;
+      offd_map = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Int  row_start_diag = A_diag_i[i];
+         HYPRE_Int  row_start_offd = A_offd_i[i];
+         HYPRE_Real diag = (diag_pos[i] >= 0) ? A_diag_data[diag_pos[i]] : 0.0;
+         HYPRE_Real lumped = 0.0;
+
+         A_diag_i[i] = cnt_diag;
+         A_offd_i[i] = cnt_offd;
+
+         for (jj = row_start_diag; jj < A_diag_i[i + 1]; jj++)
+         {
+            j = A_diag_j[jj];
+            if (diag_pos[i] >= 0 && j != i &&
+                hypre_SparsifyMeasure(A_diag_data[jj], row_max[i], row_max[j]) < droptol &&
+                diag * (diag + lumped + A_diag_data[jj]) > 0.0)
+            {
+               lumped += A_diag_data[jj];
+               continue;
+            }
+            if (j == i)
+            {
+               diag_pos[i] = cnt_diag;
+            }
+            A_diag_j[cnt_diag]    = j;
+            A_diag_data[cnt_diag] = A_diag_data[jj];
+            cnt_diag++;
+         }
+         for (jj = row_start_offd; jj < A_offd_i[i + 1]; jj++)
+         {
+            j = A_offd_j[jj];
+            if (diag_pos[i] >= 0 &&
+                hypre_SparsifyMeasure(A_offd_data[jj], row_max[i], row_max_offd[j]) < droptol &&
+                diag * (diag + lumped + A_offd_data[jj]) > 0.0)
+            {
+               lumped += A_offd_data[jj];
+               continue;
+            }
+            offd_map[j] = 1;
+            A_offd_j[cnt_offd]    = j;
+            A_offd_data[cnt_offd] = A_offd_data[jj];
+            cnt_offd++;
+         }
+         if (diag_pos[i] >= 0)
+         {
+            A_diag_data[diag_pos[i]] += lumped;
+         }
+      }
+      A_diag_i[num_rows] = cnt_diag;
+      A_offd_i[num_rows] = cnt_offd;
+      hypre_CSRMatrixNumNonzeros(A_diag) = cnt_diag;
+      hypre_CSRMatrixNumNonzeros(A_offd) = cnt_offd;
+
+      /* remove unused offd columns */
+      num_cols_offd_new = 0;
+      for (j = 0; j < num_cols_offd; j++)
+      {
+         if (offd_map[j])
+         {
+            col_map_offd[num_cols_offd_new] = col_map_offd[j];
+            offd_map[j] = num_cols_offd_new++;
+         }
+      }
+      for (jj = 0; jj < cnt_offd; jj++)
+      {
+         A_offd_j[jj] = offd_map[A_offd_j[jj]];
+      }
+      hypre_CSRMatrixNumCols(A_offd) = num_cols_offd_new;
+
+      /* the communication pattern is rebuilt on all processes */
+      hypre_MatvecCommPkgDestroy(comm_pkg);
+      hypre_ParCSRMatrixCommPkg(A_H) = NULL;
+      hypre_MatvecCommPkgCreate(A_H);
+
+      hypre_ParCSRMatrixSetNumNonzeros(A_H);
+      hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+
+      *droptol_ptr = droptol;
+   }
+
+#undef hypre_SparsifyMeasure
+#undef hypre_SparsifyBin
+
+   hypre_TFree(row_max, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_max_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(diag_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_map, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
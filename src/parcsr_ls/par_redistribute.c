@@ -0,0 +1,165 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Redistribution of coarse AMG levels onto fewer processes
+ *
+ * The rows of a coarse level keep their global numbering; only the row
+ * partitioning changes.  Groups of 'stride' consecutive processes are
+ * merged, and the first process of each group owns all rows of the group.
+ * The change of partitioning is an identity matrix M with the old coarse
+ * partitioning for its rows and the new one for its columns, which is
+ * multiplied into the interpolation (P M) and restriction (M^T R).  The
+ * Galerkin product then produces the coarse operator in the new layout,
+ * and the cycle needs no extra data movement.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRedistributeCoarse
+ *
+ * Redistribute the columns of P (and the rows of R, if given) when the
+ * average number of coarse rows per active process is below min_rows.
+ * On input, stride is the group size used for the finer levels; the new
+ * group size is a multiple of it, so processes that became idle on a finer
+ * level stay idle.  P and R are replaced, and stride is updated.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRedistributeCoarse( hypre_ParCSRMatrix **P_ptr,
+                                   hypre_ParCSRMatrix **R_ptr,
+                                   HYPRE_Int            min_rows,
+                                   HYPRE_Int           *stride_ptr )
+{
+   hypre_ParCSRMatrix   *P        = *P_ptr;
+   hypre_ParCSRMatrix   *R        = R_ptr ? *R_ptr : NULL;
+   MPI_Comm              comm     = hypre_ParCSRMatrixComm(P);
+   HYPRE_BigInt          n_coarse = hypre_ParCSRMatrixGlobalNumCols(P);
+   HYPRE_BigInt         *old_starts = hypre_ParCSRMatrixColStarts(P);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(P);
+
+   hypre_ParCSRMatrix   *M, *P_new, *R_new;
+   hypre_CSRMatrix      *M_diag, *M_offd;
+   HYPRE_Int            *M_diag_i, *M_diag_j, *M_offd_i, *M_offd_j;
+   HYPRE_Complex        *M_diag_data, *M_offd_data;
+   HYPRE_BigInt         *col_map_offd;
+   HYPRE_BigInt         *all_starts;
+   HYPRE_BigInt          new_starts[2], row;
+   HYPRE_Int             num_procs, my_id, stride, num_active;
+   HYPRE_Int             leader, next_leader;
+   HYPRE_Int             num_rows, nnz_diag, nnz_offd, i;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (min_rows <= 0 || num_procs == 1)
+   {
+      return hypre_error_flag;
+   }
+
+   /* new group size, a multiple of the current one */
+   num_active = (HYPRE_Int) hypre_max(1, n_coarse / (HYPRE_BigInt) min_rows);
+   stride = (num_procs + num_active - 1) / num_active;
+   stride = ((stride + *stride_ptr - 1) / *stride_ptr) * (*stride_ptr);
+   if (stride <= *stride_ptr)
+   {
+      return hypre_error_flag;
+   }
+
+   /* first coarse row of each process in the old partitioning */
+   all_starts = hypre_TAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&old_starts[0], 1, HYPRE_MPI_BIG_INT, all_starts, 1,
+                       HYPRE_MPI_BIG_INT, comm);
+   all_starts[num_procs] = n_coarse;
+
+   leader      = (my_id / stride) * stride;
+   next_leader = hypre_min(leader + stride, num_procs);
+   new_starts[1] = all_starts[next_leader];
+   new_starts[0] = (my_id == leader) ? all_starts[leader] : new_starts[1];
+   hypre_TFree(all_starts, HYPRE_MEMORY_HOST);
+
+   /* identity from the old to the new partitioning */
+   num_rows = (HYPRE_Int) (old_starts[1] - old_starts[0]);
+   nnz_diag = 0;
+   for (row = old_starts[0]; row < old_starts[1]; row++)
+   {
+      if (row >= new_starts[0] && row < new_starts[1])
+      {
+         nnz_diag++;
+      }
+   }
+   nnz_offd = num_rows - nnz_diag;
+
+   M = hypre_ParCSRMatrixCreate(comm, n_coarse, n_coarse, old_starts, new_starts,
+                                nnz_offd, nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(M, HYPRE_MEMORY_HOST);
+
+   M_diag       = hypre_ParCSRMatrixDiag(M);
+   M_offd       = hypre_ParCSRMatrixOffd(M);
+   M_diag_i     = hypre_CSRMatrixI(M_diag);
+   M_diag_j     = hypre_CSRMatrixJ(M_diag);
+   M_diag_data  = hypre_CSRMatrixData(M_diag);
+   M_offd_i     = hypre_CSRMatrixI(M_offd);
+   M_offd_j     = hypre_CSRMatrixJ(M_offd);
+   M_offd_data  = hypre_CSRMatrixData(M_offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(M);
+
+   nnz_diag = 0;
+   nnz_offd = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row = old_starts[0] + (HYPRE_BigInt) i;
+      M_diag_i[i] = nnz_diag;
+      M_offd_i[i] = nnz_offd;
+      if (row >= new_starts[0] && row < new_starts[1])
+      {
+         M_diag_j[nnz_diag]    = (HYPRE_Int) (row - new_starts[0]);
+         M_diag_data[nnz_diag] = 1.0;
+         nnz_diag++;
+      }
+      else
+      {
+         col_map_offd[nnz_offd] = row;
+         M_offd_j[nnz_offd]     = nnz_offd;
+         M_offd_data[nnz_offd]  = 1.0;
+         nnz_offd++;
+      }
+   }
+   M_diag_i[num_rows] = nnz_diag;
+   M_offd_i[num_rows] = nnz_offd;
+
+   hypre_ParCSRMatrixMigrate(M, memory_location);
+   hypre_MatvecCommPkgCreate(M);
+
+   P_new = hypre_ParCSRMatMat(P, M);
+   if (!hypre_ParCSRMatrixCommPkg(P_new))
+   {
+      hypre_MatvecCommPkgCreate(P_new);
+   }
+   hypre_ParCSRMatrixDestroy(P);
+   *P_ptr = P_new;
+
+   if (R)
+   {
+      R_new = hypre_ParCSRTMatMat(M, R);
+      if (!hypre_ParCSRMatrixCommPkg(R_new))
+      {
+         hypre_MatvecCommPkgCreate(R_new);
+      }
+      hypre_ParCSRMatrixDestroy(R);
+      *R_ptr = R_new;
+   }
+
+   hypre_ParCSRMatrixDestroy(M);
+
+   *stride_ptr = stride;
+
+   return hypre_error_flag;
+}
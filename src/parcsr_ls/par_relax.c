@@ -66,6 +66,8 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 18 -> L1-Jacobi [GPU-supported through call to relax7Jacobi]
     *     relax_type = 19 -> Direct Solve, (old version)
     *     relax_type = 20 -> Kaczmarz
+    *     relax_type = 88 -> multicolor Gauss-Seidel: Jacobi off-processor,
+    *                        Gauss-Seidel by colors on-processor
     *     relax_type = 29 -> Direct solve: use gaussian elimination & BLAS
     *                        (with pivoting) (old version)
     *     relax_type = 98 -> Direct solve, Gaussian elimination
@@ -155,6 +157,11 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          hypre_BoomerAMGRelaxKaczmarz(A, f, omega, l1_norms, u);
          break;
 
+      case 88: /* multicolor Gauss-Seidel, coloring computed on the fly */
+         hypre_BoomerAMGRelaxMulticolorGaussSeidel(A, f, cf_marker, relax_points, relax_weight,
+                                                   l1_norms, NULL, NULL, 0, u);
+         break;
+
       case 98: /* Direct solve: use gaussian elimination & BLAS (with pivoting) */
          relax_error = hypre_BoomerAMGRelax98GaussElimPivot(A, f, u);
          break;
@@ -0,0 +1,294 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Multicolor Gauss-Seidel relaxation
+ *
+ * The rows of the diag block are colored such that no two rows of the same
+ * color are coupled (distance-1 coloring of the symmetrized pattern).  A
+ * sweep relaxes the colors one after the other, and all rows of a color in
+ * parallel.  On-processor couplings are thus treated as in true
+ * Gauss-Seidel for any number of threads, and off-processor couplings as
+ * in Jacobi.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMulticolorSetup
+ *
+ * Greedy coloring of the diag block of A.  On return, color_rows holds the
+ * local rows ordered by color, and the rows of color c are
+ * color_rows[color_starts[c]] to color_rows[color_starts[c+1]-1].
+ *
+ * If l1_norm_ptr is not NULL, it returns the truncated l1 norms of the
+ * rows (option 4 of hypre_ParCSRComputeL1Norms).  Only the off-processor
+ * part enters, also with threads, since the couplings between the rows of
+ * a process are all relaxed in Gauss-Seidel fashion.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMulticolorSetup( hypre_ParCSRMatrix  *A,
+                                hypre_IntArray     **color_starts_ptr,
+                                hypre_IntArray     **color_rows_ptr,
+                                HYPRE_Real         **l1_norm_ptr )
+{
+   hypre_CSRMatrix  *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int        *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real       *A_diag_data = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix  *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int        *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real       *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix  *AT_diag;
+   HYPRE_Int        *AT_diag_i, *AT_diag_j;
+   hypre_IntArray   *color_starts, *color_rows;
+   HYPRE_Int        *color, *mark, *starts, *rows;
+   HYPRE_Int         num_colors, i, jj, c;
+   HYPRE_Real       *l1_norm, diag, diag_sign;
+
+   /* couplings in both directions have to be separated */
+   hypre_CSRMatrixTranspose(A_diag, &AT_diag, 0);
+   AT_diag_i = hypre_CSRMatrixI(AT_diag);
+   AT_diag_j = hypre_CSRMatrixJ(AT_diag);
+
+   color = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   mark  = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_rows; i++)
+   {
+      mark[i] = -1;
+   }
+
+   /* first color not taken by an already colored neighbor */
+   num_colors = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         if (A_diag_j[jj] < i)
+         {
+            mark[color[A_diag_j[jj]]] = i;
+         }
+      }
+      for (jj = AT_diag_i[i]; jj < AT_diag_i[i + 1]; jj++)
+      {
+         if (AT_diag_j[jj] < i)
+         {
+            mark[color[AT_diag_j[jj]]] = i;
+         }
+      }
+      for (c = 0; mark[c] == i; c++);
+      color[i]   = c;
+      num_colors = hypre_max(num_colors, c + 1);
+   }
+
+   /* rows sorted by color */
+   color_starts = hypre_IntArrayCreate(num_colors + 1);
+   color_rows   = hypre_IntArrayCreate(num_rows);
+   hypre_IntArrayInitialize_v2(color_starts, HYPRE_MEMORY_HOST);
+   hypre_IntArrayInitialize_v2(color_rows, HYPRE_MEMORY_HOST);
+   starts = hypre_IntArrayData(color_starts);
+   rows   = hypre_IntArrayData(color_rows);
+
+   for (c = 0; c <= num_colors; c++)
+   {
+      starts[c] = 0;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      starts[color[i] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      starts[c + 1] += starts[c];
+      mark[c] = starts[c];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      rows[mark[color[i]]++] = i;
+   }
+
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(mark, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(AT_diag);
+
+   *color_starts_ptr = color_starts;
+   *color_rows_ptr   = color_rows;
+
+   if (l1_norm_ptr)
+   {
+      l1_norm = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,jj,diag,diag_sign) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         diag      = 0.0;
+         diag_sign = 1.0;
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            if (A_diag_j[jj] == i)
+            {
+               diag      = fabs(A_diag_data[jj]);
+               diag_sign = (A_diag_data[jj] < 0.0) ? -1.0 : 1.0;
+            }
+         }
+         l1_norm[i] = diag;
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            l1_norm[i] += 0.5 * fabs(A_offd_data[jj]);
+         }
+         if (l1_norm[i] <= 4.0 / 3.0 * diag)
+         {
+            l1_norm[i] = diag;
+         }
+
+         /* Handle negative definite matrices */
+         l1_norm[i] *= diag_sign;
+      }
+
+      *l1_norm_ptr = l1_norm;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorGaussSeidel
+ *
+ * One Gauss-Seidel sweep over the colors, in reverse color order if
+ * reverse is nonzero (so that a forward down sweep and a reverse up sweep
+ * give a symmetric cycle):
+ *    u_i = u_i + w (f - A u)_i / d_i,
+ * with d_i the l1 norm of row i if l1_norms is given, and the diagonal
+ * otherwise.  If the coloring is not given, it is computed here.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorGaussSeidel( hypre_ParCSRMatrix *A,
+                                           hypre_ParVector    *f,
+                                           HYPRE_Int          *cf_marker,
+                                           HYPRE_Int           relax_points,
+                                           HYPRE_Real          relax_weight,
+                                           HYPRE_Real         *l1_norms,
+                                           hypre_IntArray     *color_starts,
+                                           hypre_IntArray     *color_rows,
+                                           HYPRE_Int           reverse,
+                                           hypre_ParVector    *u )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Real          *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real          *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_IntArray         *own_starts = NULL, *own_rows = NULL;
+   HYPRE_Real             *v_ext_data = NULL, *v_buf_data = NULL;
+   HYPRE_Int              *starts, *rows;
+   HYPRE_Int               num_procs, num_sends, num_colors, k, c, i, ii, jj;
+   HYPRE_Real              res, diag;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (!color_starts || !color_rows)
+   {
+      hypre_BoomerAMGMulticolorSetup(A, &own_starts, &own_rows, NULL);
+      color_starts = own_starts;
+      color_rows   = own_rows;
+   }
+   starts     = hypre_IntArrayData(color_starts);
+   rows       = hypre_IntArrayData(color_rows);
+   num_colors = hypre_IntArraySize(color_starts) - 1;
+
+   /* off-processor values of u */
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      v_buf_data = hypre_TAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_TAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+      {
+         v_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   for (k = 0; k < num_colors; k++)
+   {
+      c = reverse ? num_colors - 1 - k : k;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii,i,jj,res,diag) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = starts[c]; ii < starts[c + 1]; ii++)
+      {
+         i = rows[ii];
+         if (relax_points != 0 && cf_marker[i] != relax_points)
+         {
+            continue;
+         }
+
+         res  = f_data[i];
+         diag = 0.0;
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+            if (A_diag_j[jj] == i)
+            {
+               diag = A_diag_data[jj];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            res -= A_offd_data[jj] * v_ext_data[A_offd_j[jj]];
+         }
+
+         if (l1_norms)
+         {
+            diag = l1_norms[i];
+         }
+         if (diag != 0.0)
+         {
+            u_data[i] += relax_weight * res / diag;
+         }
+      }
+   }
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_IntArrayDestroy(own_starts);
+   hypre_IntArrayDestroy(own_rows);
+
+   return hypre_error_flag;
+}
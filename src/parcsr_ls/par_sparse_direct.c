@@ -0,0 +1,877 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Sparse direct solver for the coarsest AMG level (relax_type 39)
+ *
+ * The coarse matrix is gathered on the first of the processes that own
+ * rows, reordered with nested dissection on the pattern of A + A^T, and
+ * factored once there with an up-looking sparse LU without pivoting.  The
+ * structure of L is computed from the elimination tree, and U has the
+ * transposed structure of L.  Each solve gathers the right-hand side on that
+ * process, does two sparse triangular solves, and scatters the solution.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/* ranges with at most this many rows are not dissected further */
+#define HYPRE_SPARSE_DIRECT_ND_LEAF 64
+
+typedef struct
+{
+   MPI_Comm     new_comm;   /* processes that own rows */
+   HYPRE_Int   *comm_info;  /* row counts and displacements on new_comm */
+   HYPRE_Int    n;          /* global number of rows */
+
+   /* the rest is only set on process 0 of new_comm */
+   HYPRE_Int   *perm;       /* perm[k]  = original index of row k */
+   HYPRE_Int   *iperm;      /* iperm[i] = new index of original row i */
+
+   HYPRE_Int   *L_i;        /* row pointers of L = column pointers of U */
+   HYPRE_Int   *L_j;        /* sorted pattern shared by L and U^T */
+   HYPRE_Real  *L_data;     /* strictly lower part, unit diagonal */
+   HYPRE_Real  *U_data;     /* strictly upper part, by columns */
+   HYPRE_Real  *D;          /* diagonal of U */
+
+   HYPRE_Real  *b_vec;      /* gathered right-hand side, then solution */
+   HYPRE_Real  *x_vec;      /* permuted work vector */
+
+} hypre_SparseDirectData;
+
+/*--------------------------------------------------------------------------
+ * hypre_SparseDirectBFS
+ *
+ * Breadth-first search from root within the vertices v with mark[v] = stamp.
+ * On return queue[0:num_reached) holds the reached vertices by level, and
+ * level[v] their level.  Returns the number of levels.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SparseDirectBFS( HYPRE_Int  *S_i,
+                       HYPRE_Int  *S_j,
+                       HYPRE_Int   root,
+                       HYPRE_Int   stamp,
+                       HYPRE_Int  *mark,
+                       HYPRE_Int  *level,
+                       HYPRE_Int  *queue,
+                       HYPRE_Int  *num_reached_ptr )
+{
+   HYPRE_Int  head, tail, v, u, jj, num_levels;
+
+   head = 0;
+   tail = 0;
+   queue[tail++] = root;
+   level[root] = 0;
+   mark[root] = -stamp;
+   num_levels = 1;
+
+   while (head < tail)
+   {
+      v = queue[head++];
+      for (jj = S_i[v]; jj < S_i[v + 1]; jj++)
+      {
+         u = S_j[jj];
+         if (mark[u] == stamp)
+         {
+            mark[u] = -stamp;
+            level[u] = level[v] + 1;
+            num_levels = level[u] + 1;
+            queue[tail++] = u;
+         }
+      }
+   }
+
+   /* reset the marks so the search can be repeated */
+   for (head = 0; head < tail; head++)
+   {
+      mark[queue[head]] = stamp;
+   }
+
+   *num_reached_ptr = tail;
+
+   return num_levels;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SparseDirectNDOrder
+ *
+ * Nested dissection ordering of the symmetric graph (S_i, S_j).  Level
+ * structures rooted at a pseudo-peripheral vertex are split at the middle
+ * level, and the separator is numbered after both halves.  Disconnected
+ * ranges are split into components.  perm[k] is the vertex numbered k.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SparseDirectNDOrder( HYPRE_Int   n,
+                           HYPRE_Int  *S_i,
+                           HYPRE_Int  *S_j,
+                           HYPRE_Int  *perm )
+{
+   HYPRE_Int  *mark, *level, *queue, *work, *stack;
+   HYPRE_Int   stack_size, stamp;
+   HYPRE_Int   lo, hi, size, root, num_levels, num_reached;
+   HYPRE_Int   new_root, new_num_levels, new_num_reached;
+   HYPRE_Int   sep_level, count, num_a, num_b, num_s;
+   HYPRE_Int   i, jj, v, u, iter, min_degree, in_b;
+
+   if (n == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   mark  = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   queue = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   work  = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   stack = hypre_TAlloc(HYPRE_Int, 4 * n + 2, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n; i++)
+   {
+      perm[i] = i;
+   }
+
+   stamp = 0;
+   stack_size = 0;
+   stack[stack_size++] = 0;
+   stack[stack_size++] = n;
+
+   while (stack_size > 0)
+   {
+      hi = stack[--stack_size];
+      lo = stack[--stack_size];
+      size = hi - lo;
+
+      if (size <= HYPRE_SPARSE_DIRECT_ND_LEAF)
+      {
+         hypre_qsort0(perm, lo, hi - 1);
+         continue;
+      }
+
+      stamp++;
+      for (i = lo; i < hi; i++)
+      {
+         mark[perm[i]] = stamp;
+      }
+
+      /* find a pseudo-peripheral root */
+      root = perm[lo];
+      num_levels = hypre_SparseDirectBFS(S_i, S_j, root, stamp, mark, level, queue,
+                                         &num_reached);
+      for (iter = 0; iter < 5; iter++)
+      {
+         new_root = queue[num_reached - 1];
+         min_degree = S_i[new_root + 1] - S_i[new_root];
+         for (i = num_reached - 1; i >= 0 && level[queue[i]] == num_levels - 1; i--)
+         {
+            v = queue[i];
+            if (S_i[v + 1] - S_i[v] < min_degree)
+            {
+               new_root = v;
+               min_degree = S_i[v + 1] - S_i[v];
+            }
+         }
+         new_num_levels = hypre_SparseDirectBFS(S_i, S_j, new_root, stamp, mark, level, queue,
+                                                &new_num_reached);
+         if (new_num_levels <= num_levels)
+         {
+            /* restore the level structure of the current root */
+            num_levels = hypre_SparseDirectBFS(S_i, S_j, root, stamp, mark, level, queue,
+                                               &num_reached);
+            break;
+         }
+         root = new_root;
+         num_levels = new_num_levels;
+      }
+
+      if (num_reached < size)
+      {
+         /* split off the component of root */
+         for (i = 0; i < num_reached; i++)
+         {
+            mark[queue[i]] = -stamp;
+         }
+         count = lo;
+         for (i = 0; i < num_reached; i++)
+         {
+            work[i] = queue[i];
+         }
+         num_b = num_reached;
+         for (i = lo; i < hi; i++)
+         {
+            if (mark[perm[i]] == stamp)
+            {
+               work[num_b++] = perm[i];
+            }
+         }
+         for (i = 0; i < size; i++)
+         {
+            perm[count++] = work[i];
+         }
+
+         stack[stack_size++] = lo;
+         stack[stack_size++] = lo + num_reached;
+         stack[stack_size++] = lo + num_reached;
+         stack[stack_size++] = hi;
+         continue;
+      }
+
+      if (num_levels < 3)
+      {
+         hypre_qsort0(perm, lo, hi - 1);
+         continue;
+      }
+
+      /* separator: the level that splits the vertices in half */
+      count = 0;
+      sep_level = 0;
+      for (i = 0; i < num_reached; i++)
+      {
+         if (2 * (count + 1) > size)
+         {
+            sep_level = level[queue[i]];
+            break;
+         }
+         count++;
+      }
+      sep_level = hypre_max(1, hypre_min(sep_level, num_levels - 2));
+
+      /* separator vertices without neighbors beyond the separator move to A */
+      num_a = 0;
+      num_b = 0;
+      num_s = 0;
+      for (i = 0; i < num_reached; i++)
+      {
+         v = queue[i];
+         if (level[v] < sep_level)
+         {
+            perm[lo + num_a++] = v;
+         }
+         else if (level[v] == sep_level)
+         {
+            in_b = 0;
+            for (jj = S_i[v]; jj < S_i[v + 1]; jj++)
+            {
+               u = S_j[jj];
+               if (mark[u] == stamp && level[u] > sep_level)
+               {
+                  in_b = 1;
+                  break;
+               }
+            }
+            if (in_b)
+            {
+               work[num_s++] = v;
+            }
+            else
+            {
+               perm[lo + num_a++] = v;
+            }
+         }
+      }
+      for (i = 0; i < num_reached; i++)
+      {
+         v = queue[i];
+         if (level[v] > sep_level)
+         {
+            perm[lo + num_a + num_b++] = v;
+         }
+      }
+      for (i = 0; i < num_s; i++)
+      {
+         perm[lo + num_a + num_b + i] = work[i];
+      }
+      hypre_qsort0(perm, lo + num_a + num_b, hi - 1);
+
+      stack[stack_size++] = lo;
+      stack[stack_size++] = lo + num_a;
+      stack[stack_size++] = lo + num_a;
+      stack[stack_size++] = lo + num_a + num_b;
+   }
+
+   hypre_TFree(mark,  HYPRE_MEMORY_HOST);
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+   hypre_TFree(queue, HYPRE_MEMORY_HOST);
+   hypre_TFree(work,  HYPRE_MEMORY_HOST);
+   hypre_TFree(stack, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SparseDirectFactor
+ *
+ * Symbolic and numeric factorization of the gathered matrix A_all in the
+ * ordering of data->perm.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SparseDirectFactor( hypre_SparseDirectData *data,
+                          hypre_CSRMatrix        *A_all,
+                          HYPRE_Int              *S_i,
+                          HYPRE_Int              *S_j )
+{
+   HYPRE_Int         n     = data->n;
+   HYPRE_Int        *perm  = data->perm;
+   HYPRE_Int        *iperm = data->iperm;
+
+   HYPRE_Int        *A_i    = hypre_CSRMatrixI(A_all);
+   HYPRE_Int        *A_j    = hypre_CSRMatrixJ(A_all);
+   HYPRE_Real       *A_data = hypre_CSRMatrixData(A_all);
+   hypre_CSRMatrix  *AT;
+   HYPRE_Int        *AT_i, *AT_j;
+   HYPRE_Real       *AT_data;
+
+   HYPRE_Int        *parent, *ancestor, *flag, *stack;
+   HYPRE_Int        *L_i, *L_j;
+   HYPRE_Real       *L_data, *U_data, *D, *wl, *wu;
+   HYPRE_Int         i, j, k, m, jj, kk, top, len, next, pass;
+   HYPRE_Real        diag, sum_l, sum_u;
+
+   parent   = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   ancestor = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   flag     = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   stack    = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   L_i      = hypre_CTAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+
+   /* elimination tree of the permuted pattern */
+   for (k = 0; k < n; k++)
+   {
+      parent[k]   = -1;
+      ancestor[k] = -1;
+      for (jj = S_i[perm[k]]; jj < S_i[perm[k] + 1]; jj++)
+      {
+         for (i = iperm[S_j[jj]]; i != -1 && i < k; i = next)
+         {
+            next = ancestor[i];
+            ancestor[i] = k;
+            if (next == -1)
+            {
+               parent[i] = k;
+            }
+         }
+      }
+   }
+
+   /* the pattern of row k of L is the set of vertices reached in the
+      elimination tree from the pattern of row k; count, then fill */
+   L_j = NULL;
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (k = 0; k < n; k++)
+      {
+         flag[k] = -1;
+      }
+      for (k = 0; k < n; k++)
+      {
+         top = n;
+         flag[k] = k;
+         for (jj = S_i[perm[k]]; jj < S_i[perm[k] + 1]; jj++)
+         {
+            len = 0;
+            for (i = iperm[S_j[jj]]; i < k && flag[i] != k; i = parent[i])
+            {
+               stack[len++] = i;
+               flag[i] = k;
+            }
+            while (len > 0)
+            {
+               ancestor[--top] = stack[--len];
+            }
+         }
+
+         if (pass == 0)
+         {
+            L_i[k + 1] = L_i[k] + (n - top);
+         }
+         else
+         {
+            for (i = top; i < n; i++)
+            {
+               L_j[L_i[k] + i - top] = ancestor[i];
+            }
+            hypre_qsort0(L_j, L_i[k], L_i[k + 1] - 1);
+         }
+      }
+
+      if (pass == 0)
+      {
+         L_j = hypre_TAlloc(HYPRE_Int, L_i[n], HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_TFree(parent,   HYPRE_MEMORY_HOST);
+   hypre_TFree(ancestor, HYPRE_MEMORY_HOST);
+   hypre_TFree(flag,     HYPRE_MEMORY_HOST);
+   hypre_TFree(stack,    HYPRE_MEMORY_HOST);
+
+   /* up-looking numeric factorization: row k of L and column k of U */
+   hypre_CSRMatrixTranspose(A_all, &AT, 1);
+   AT_i    = hypre_CSRMatrixI(AT);
+   AT_j    = hypre_CSRMatrixJ(AT);
+   AT_data = hypre_CSRMatrixData(AT);
+
+   L_data = hypre_TAlloc(HYPRE_Real, L_i[n], HYPRE_MEMORY_HOST);
+   U_data = hypre_TAlloc(HYPRE_Real, L_i[n], HYPRE_MEMORY_HOST);
+   D      = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   wl     = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   wu     = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+
+   for (k = 0; k < n; k++)
+   {
+      diag = 0.0;
+      for (jj = A_i[perm[k]]; jj < A_i[perm[k] + 1]; jj++)
+      {
+         j = iperm[A_j[jj]];
+         if (j < k)
+         {
+            wl[j] += A_data[jj];
+         }
+         else if (j == k)
+         {
+            diag += A_data[jj];
+         }
+      }
+      for (jj = AT_i[perm[k]]; jj < AT_i[perm[k] + 1]; jj++)
+      {
+         j = iperm[AT_j[jj]];
+         if (j < k)
+         {
+            wu[j] += AT_data[jj];
+         }
+      }
+
+      for (kk = L_i[k]; kk < L_i[k + 1]; kk++)
+      {
+         i = L_j[kk];
+         sum_u = wu[i];
+         sum_l = wl[i];
+         for (jj = L_i[i]; jj < L_i[i + 1]; jj++)
+         {
+            m = L_j[jj];
+            sum_u -= L_data[jj] * wu[m];
+            sum_l -= wl[m] * U_data[jj];
+         }
+         wu[i] = sum_u;
+         /* columns with a zero pivot are not eliminated */
+         wl[i] = (D[i] != 0.0) ? sum_l / D[i] : 0.0;
+      }
+
+      for (kk = L_i[k]; kk < L_i[k + 1]; kk++)
+      {
+         i = L_j[kk];
+         diag -= wl[i] * wu[i];
+         L_data[kk] = wl[i];
+         U_data[kk] = wu[i];
+         wl[i] = 0.0;
+         wu[i] = 0.0;
+      }
+      D[k] = diag;
+
+      if (diag == 0.0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Zero pivot in sparse direct coarse solver!\n");
+      }
+   }
+
+   hypre_CSRMatrixDestroy(AT);
+   hypre_TFree(wl, HYPRE_MEMORY_HOST);
+   hypre_TFree(wu, HYPRE_MEMORY_HOST);
+
+   data->L_i    = L_i;
+   data->L_j    = L_j;
+   data->L_data = L_data;
+   data->U_data = U_data;
+   data->D      = D;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SparseDirectSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SparseDirectSetup( void               **solver_ptr,
+                         hypre_ParCSRMatrix  *A,
+                         HYPRE_Int            print_level )
+{
+   MPI_Comm                 comm     = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int                num_rows = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int                n        = (HYPRE_Int) hypre_ParCSRMatrixGlobalNumRows(A);
+
+   hypre_SparseDirectData  *data;
+   hypre_ParCSRMatrix      *A_host;
+   hypre_CSRMatrix         *A_diag, *A_offd;
+   HYPRE_Int               *A_diag_i, *A_diag_j, *A_offd_i, *A_offd_j;
+   HYPRE_Real              *A_diag_data, *A_offd_data;
+   HYPRE_BigInt            *col_map_offd;
+   HYPRE_Int                first_row;
+   HYPRE_Int               *A_tmp_i = NULL, *A_tmp_j;
+   HYPRE_Real              *A_tmp_data;
+   HYPRE_Int                num_nonzeros;
+   hypre_CSRMatrix         *A_all = NULL;
+   HYPRE_Int               *A_i = NULL, *A_j = NULL;
+   HYPRE_Real              *A_all_data = NULL;
+   HYPRE_Int               *S_i, *S_j, *marker;
+   HYPRE_Int               *info, *displs, *info2 = NULL, *displs2 = NULL;
+   HYPRE_Int                new_num_procs, my_id;
+   HYPRE_Int                i, j, jj, cnt;
+
+   data = hypre_CTAlloc(hypre_SparseDirectData, 1, HYPRE_MEMORY_HOST);
+   data->n = n;
+
+   /* Generate sub communicator: processes that have nonzero num_rows */
+   hypre_GenerateSubComm(comm, num_rows, &(data->new_comm));
+
+   if (!num_rows)
+   {
+      *solver_ptr = (void *) data;
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(data->new_comm, &new_num_procs);
+   hypre_MPI_Comm_rank(data->new_comm, &my_id);
+
+   data->comm_info = hypre_CTAlloc(HYPRE_Int, 2 * new_num_procs + 1, HYPRE_MEMORY_HOST);
+   info   = &(data->comm_info[0]);
+   displs = &(data->comm_info[new_num_procs]);
+
+   hypre_MPI_Allgather(&num_rows, 1, HYPRE_MPI_INT, info, 1, HYPRE_MPI_INT, data->new_comm);
+   displs[0] = 0;
+   for (i = 0; i < new_num_procs; i++)
+   {
+      displs[i + 1] = displs[i] + info[i];
+   }
+
+   /*-----------------------------------------------------------------------
+    * Gather the rows of A with global column indices on process 0
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      A_host = hypre_ParCSRMatrixClone_v2(A, 1, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      A_host = A;
+   }
+
+   A_diag       = hypre_ParCSRMatrixDiag(A_host);
+   A_offd       = hypre_ParCSRMatrixOffd(A_host);
+   A_diag_i     = hypre_CSRMatrixI(A_diag);
+   A_diag_j     = hypre_CSRMatrixJ(A_diag);
+   A_diag_data  = hypre_CSRMatrixData(A_diag);
+   A_offd_i     = hypre_CSRMatrixI(A_offd);
+   A_offd_j     = hypre_CSRMatrixJ(A_offd);
+   A_offd_data  = hypre_CSRMatrixData(A_offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(A_host);
+   first_row    = (HYPRE_Int) hypre_ParCSRMatrixFirstRowIndex(A_host);
+
+   num_nonzeros = A_diag_i[num_rows] + A_offd_i[num_rows];
+   A_tmp_i      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   A_tmp_j      = hypre_TAlloc(HYPRE_Int, num_nonzeros, HYPRE_MEMORY_HOST);
+   A_tmp_data   = hypre_TAlloc(HYPRE_Real, num_nonzeros, HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         A_tmp_j[cnt] = A_diag_j[jj] + first_row;
+         A_tmp_data[cnt++] = A_diag_data[jj];
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+      {
+         A_tmp_j[cnt] = (HYPRE_Int) col_map_offd[A_offd_j[jj]];
+         A_tmp_data[cnt++] = A_offd_data[jj];
+      }
+      A_tmp_i[i] = A_diag_i[i + 1] - A_diag_i[i] + A_offd_i[i + 1] - A_offd_i[i];
+   }
+
+   if (A_host != A)
+   {
+      hypre_ParCSRMatrixDestroy(A_host);
+   }
+
+   if (my_id == 0)
+   {
+      A_i = hypre_CTAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gatherv(A_tmp_i, num_rows, HYPRE_MPI_INT, (A_i) ? &A_i[1] : NULL,
+                     info, displs, HYPRE_MPI_INT, 0, data->new_comm);
+
+   if (my_id == 0)
+   {
+      for (i = 0; i < n; i++)
+      {
+         A_i[i + 1] += A_i[i];
+      }
+      info2   = hypre_TAlloc(HYPRE_Int, new_num_procs, HYPRE_MEMORY_HOST);
+      displs2 = hypre_TAlloc(HYPRE_Int, new_num_procs, HYPRE_MEMORY_HOST);
+      for (i = 0; i < new_num_procs; i++)
+      {
+         displs2[i] = A_i[displs[i]];
+         info2[i]   = A_i[displs[i + 1]] - displs2[i];
+      }
+
+      A_all = hypre_CSRMatrixCreate(n, n, A_i[n]);
+      hypre_CSRMatrixI(A_all) = A_i;
+      hypre_CSRMatrixInitialize_v2(A_all, 0, HYPRE_MEMORY_HOST);
+      A_j        = hypre_CSRMatrixJ(A_all);
+      A_all_data = hypre_CSRMatrixData(A_all);
+   }
+   hypre_MPI_Gatherv(A_tmp_j, num_nonzeros, HYPRE_MPI_INT, A_j,
+                     info2, displs2, HYPRE_MPI_INT, 0, data->new_comm);
+   hypre_MPI_Gatherv(A_tmp_data, num_nonzeros, HYPRE_MPI_REAL, A_all_data,
+                     info2, displs2, HYPRE_MPI_REAL, 0, data->new_comm);
+
+   hypre_TFree(A_tmp_i,    HYPRE_MEMORY_HOST);
+   hypre_TFree(A_tmp_j,    HYPRE_MEMORY_HOST);
+   hypre_TFree(A_tmp_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(info2,      HYPRE_MEMORY_HOST);
+   hypre_TFree(displs2,    HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Order and factor on process 0
+    *-----------------------------------------------------------------------*/
+
+   if (my_id == 0)
+   {
+      /* pattern of A + A^T without the diagonal */
+      S_i    = hypre_CTAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+      S_j    = hypre_TAlloc(HYPRE_Int, 2 * A_i[n], HYPRE_MEMORY_HOST);
+      marker = hypre_TAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i < n; i++)
+      {
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            j = A_j[jj];
+            if (j != i)
+            {
+               S_i[i + 1]++;
+               S_i[j + 1]++;
+            }
+         }
+      }
+      for (i = 0; i < n; i++)
+      {
+         S_i[i + 1] += S_i[i];
+         marker[i] = S_i[i];
+      }
+      for (i = 0; i < n; i++)
+      {
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            j = A_j[jj];
+            if (j != i)
+            {
+               S_j[marker[i]++] = j;
+               S_j[marker[j]++] = i;
+            }
+         }
+      }
+
+      /* remove duplicates */
+      for (i = 0; i < n; i++)
+      {
+         marker[i] = -1;
+      }
+      cnt = 0;
+      for (i = 0; i < n; i++)
+      {
+         jj = S_i[i];
+         S_i[i] = cnt;
+         for (; jj < S_i[i + 1]; jj++)
+         {
+            j = S_j[jj];
+            if (marker[j] != i)
+            {
+               marker[j] = i;
+               S_j[cnt++] = j;
+            }
+         }
+      }
+      S_i[n] = cnt;
+
+      data->perm  = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+      data->iperm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+      hypre_SparseDirectNDOrder(n, S_i, S_j, data->perm);
+      for (i = 0; i < n; i++)
+      {
+         data->iperm[data->perm[i]] = i;
+      }
+
+      hypre_SparseDirectFactor(data, A_all, S_i, S_j);
+
+      data->b_vec = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+      data->x_vec = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+
+      if (print_level > 0)
+      {
+         hypre_printf("Sparse direct coarse solver: n = %d, nnz(A) = %d, nnz(L+U) = %d\n",
+                      n, A_i[n], 2 * data->L_i[n] + n);
+      }
+
+      hypre_TFree(S_i,    HYPRE_MEMORY_HOST);
+      hypre_TFree(S_j,    HYPRE_MEMORY_HOST);
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(A_all);
+   }
+
+   *solver_ptr = (void *) data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SparseDirectSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SparseDirectSolve( void            *solver,
+                         hypre_ParVector *f,
+                         hypre_ParVector *u )
+{
+   hypre_SparseDirectData *data = (hypre_SparseDirectData *) solver;
+
+   HYPRE_Int    num_rows = hypre_VectorSize(hypre_ParVectorLocalVector(f));
+   HYPRE_Real  *f_data   = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real  *u_data   = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real  *f_data_host, *u_data_host;
+
+   HYPRE_Int    n, new_num_procs, my_id;
+   HYPRE_Int   *perm, *iperm, *L_i, *L_j, *info, *displs;
+   HYPRE_Real  *L_data, *U_data, *D, *b_vec, *x_vec;
+   HYPRE_Real   sum;
+   HYPRE_Int    i, k, jj;
+
+   if (!num_rows)
+   {
+      return hypre_error_flag;
+   }
+
+   n      = data->n;
+   perm   = data->perm;
+   iperm  = data->iperm;
+   L_i    = data->L_i;
+   L_j    = data->L_j;
+   L_data = data->L_data;
+   U_data = data->U_data;
+   D      = data->D;
+   b_vec  = data->b_vec;
+   x_vec  = data->x_vec;
+
+   hypre_MPI_Comm_size(data->new_comm, &new_num_procs);
+   hypre_MPI_Comm_rank(data->new_comm, &my_id);
+   info   = &(data->comm_info[0]);
+   displs = &(data->comm_info[new_num_procs]);
+
+   if (hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(f)) != hypre_MEMORY_HOST)
+   {
+      f_data_host = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(f_data_host, f_data, HYPRE_Real, num_rows, HYPRE_MEMORY_HOST,
+                    hypre_ParVectorMemoryLocation(f));
+   }
+   else
+   {
+      f_data_host = f_data;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(u)) != hypre_MEMORY_HOST)
+   {
+      u_data_host = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      u_data_host = u_data;
+   }
+
+   hypre_MPI_Gatherv(f_data_host, num_rows, HYPRE_MPI_REAL, b_vec, info,
+                     displs, HYPRE_MPI_REAL, 0, data->new_comm);
+
+   if (f_data_host != f_data)
+   {
+      hypre_TFree(f_data_host, HYPRE_MEMORY_HOST);
+   }
+
+   if (my_id == 0)
+   {
+      /* forward substitution with L, by rows */
+      for (k = 0; k < n; k++)
+      {
+         sum = b_vec[perm[k]];
+         for (jj = L_i[k]; jj < L_i[k + 1]; jj++)
+         {
+            sum -= L_data[jj] * x_vec[L_j[jj]];
+         }
+         x_vec[k] = sum;
+      }
+
+      /* backward substitution with U, by columns */
+      for (k = n - 1; k >= 0; k--)
+      {
+         if (D[k] != 0.0)
+         {
+            x_vec[k] /= D[k];
+         }
+         for (jj = L_i[k]; jj < L_i[k + 1]; jj++)
+         {
+            x_vec[L_j[jj]] -= U_data[jj] * x_vec[k];
+         }
+      }
+
+      /* back to the original ordering */
+      for (i = 0; i < n; i++)
+      {
+         b_vec[i] = x_vec[iperm[i]];
+      }
+   }
+
+   hypre_MPI_Scatterv(b_vec, info, displs, HYPRE_MPI_REAL, u_data_host, num_rows,
+                      HYPRE_MPI_REAL, 0, data->new_comm);
+
+   if (u_data_host != u_data)
+   {
+      hypre_TMemcpy(u_data, u_data_host, HYPRE_Real, num_rows, hypre_ParVectorMemoryLocation(u),
+                    HYPRE_MEMORY_HOST);
+      hypre_TFree(u_data_host, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SparseDirectDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SparseDirectDestroy( void *solver )
+{
+   hypre_SparseDirectData *data = (hypre_SparseDirectData *) solver;
+
+   if (data)
+   {
+      if (data->new_comm != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&(data->new_comm));
+      }
+      hypre_TFree(data->comm_info, HYPRE_MEMORY_HOST);
+      hypre_TFree(data->perm,      HYPRE_MEMORY_HOST);
+      hypre_TFree(data->iperm,     HYPRE_MEMORY_HOST);
+      hypre_TFree(data->L_i,       HYPRE_MEMORY_HOST);
+      hypre_TFree(data->L_j,       HYPRE_MEMORY_HOST);
+      hypre_TFree(data->L_data,    HYPRE_MEMORY_HOST);
+      hypre_TFree(data->U_data,    HYPRE_MEMORY_HOST);
+      hypre_TFree(data->D,         HYPRE_MEMORY_HOST);
+      hypre_TFree(data->b_vec,     HYPRE_MEMORY_HOST);
+      hypre_TFree(data->x_vec,     HYPRE_MEMORY_HOST);
+      hypre_TFree(data,            HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
@@ -71,6 +71,8 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
    HYPRE_Int      agg_interp_type;
    HYPRE_Int      measure_type;
    HYPRE_Int      agg_num_levels;
+   HYPRE_Int      sa_first, sa_last, sa_all;
+   HYPRE_Real     sa_jacobi_weight;
    HYPRE_Real   global_nonzeros;
 
    HYPRE_Real  *send_buff;
@@ -195,6 +197,17 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
 
    block_mode = hypre_ParAMGDataBlockMode(amg_data);
 
+   /* levels coarsened by smoothed aggregation (see hypre_BoomerAMGSetup) */
+   sa_jacobi_weight = hypre_ParAMGDataSAJacobiWeight(amg_data);
+   sa_first = agg_num_levels;
+   sa_last  = hypre_min(hypre_ParAMGDataSANumLevels(amg_data), num_levels - 1) - 1;
+   if (hypre_ParAMGDataNodal(amg_data) < -1 || block_mode || restri_type ||
+       hypre_ParAMGDataGSMG(amg_data))
+   {
+      sa_last = -1;
+   }
+   sa_all = (sa_first == 0 && sa_last == num_levels - 2);
+
    send_buff     = hypre_CTAlloc(HYPRE_Real,  6, HYPRE_MEMORY_HOST);
    gather_buff = hypre_CTAlloc(HYPRE_Real, 6, HYPRE_MEMORY_HOST);
 
@@ -212,7 +225,16 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       hypre_printf(" Maximum Row Sum Threshold for Dependency Weakening = %f\n\n",
                    hypre_ParAMGDataMaxRowSum(amg_data));
 
-      if (coarsen_type == 0)
+      if (sa_last >= sa_first && !sa_all)
+      {
+         hypre_printf(" Smoothed aggregation on levels %d to %d, otherwise:\n", sa_first, sa_last);
+      }
+
+      if (sa_all)
+      {
+         hypre_printf(" Coarsening Type = smoothed aggregation\n");
+      }
+      else if (coarsen_type == 0)
       {
          hypre_printf(" Coarsening Type = Cleary-Luby-Jones-Plassman\n");
       }
@@ -295,13 +317,17 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       }
 
 
-      if (coarsen_type)
+      if (coarsen_type && !sa_all)
          hypre_printf(" measures are determined %s\n\n",
                       (measure_type ? "globally" : "locally"));
 
       hypre_printf( "\n No global partition option chosen.\n\n");
 
-      if (interp_type == 0)
+      if (sa_all)
+      {
+         hypre_printf(" Interpolation = smoothed aggregation\n");
+      }
+      else if (interp_type == 0)
       {
          hypre_printf(" Interpolation = modified classical interpolation\n");
       }
@@ -384,6 +410,24 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
          hypre_printf(" Interpolation = one-point interpolation \n");
       }
 
+      if (sa_last >= sa_first)
+      {
+         if (sa_jacobi_weight < 0.0)
+         {
+            hypre_printf(" Smoothed aggregation prolongator smoothing = Jacobi,\n");
+            hypre_printf("                 weight 4/3 / rho(D^-1 A_filtered)\n");
+         }
+         else if (sa_jacobi_weight > 0.0)
+         {
+            hypre_printf(" Smoothed aggregation prolongator smoothing = Jacobi, weight %f\n",
+                         sa_jacobi_weight);
+         }
+         else
+         {
+            hypre_printf(" Smoothed aggregation prolongator smoothing = none (plain aggregation)\n");
+         }
+      }
+
       if (restri_type == 1)
       {
          hypre_printf(" Restriction = local approximate ideal restriction (AIR-1)\n");
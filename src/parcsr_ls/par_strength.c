@@ -114,7 +114,7 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    HYPRE_Int          *S_offd_j = NULL;
    /* HYPRE_Real         *S_offd_data; */
 
-   HYPRE_Real          diag, row_scale, row_sum;
+   HYPRE_Real          diag, row_scale, row_sum, threshold;
    HYPRE_Int           i, jA, jS;
 
    HYPRE_Int           ierr = 0;
@@ -154,24 +154,22 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
 
    S_diag = hypre_ParCSRMatrixDiag(S);
    hypre_CSRMatrixI(S_diag) = hypre_CTAlloc(HYPRE_Int, num_variables + 1, memory_location);
-   hypre_CSRMatrixJ(S_diag) = hypre_CTAlloc(HYPRE_Int, num_nonzeros_diag, HYPRE_MEMORY_HOST);
    S_offd = hypre_ParCSRMatrixOffd(S);
    hypre_CSRMatrixI(S_offd) = hypre_CTAlloc(HYPRE_Int, num_variables + 1, memory_location);
 
    S_diag_i = hypre_CSRMatrixI(S_diag);
-   HYPRE_Int *S_temp_diag_j = hypre_CSRMatrixJ(S_diag);
    S_offd_i = hypre_CSRMatrixI(S_offd);
 
-   S_diag_j = hypre_TAlloc(HYPRE_Int, num_nonzeros_diag, memory_location);
-   HYPRE_Int *S_temp_offd_j = NULL;
+   /* one byte per nonzero of A: 1 if the connection is strong */
+   char *S_diag_mask = hypre_TAlloc(char, num_nonzeros_diag, HYPRE_MEMORY_HOST);
+   char *S_offd_mask = NULL;
 
    dof_func_offd = NULL;
 
    if (num_cols_offd)
    {
       A_offd_data = hypre_CSRMatrixData(A_offd);
-      hypre_CSRMatrixJ(S_offd) = hypre_CTAlloc(HYPRE_Int, num_nonzeros_offd, HYPRE_MEMORY_HOST);
-      S_temp_offd_j = hypre_CSRMatrixJ(S_offd);
+      S_offd_mask = hypre_TAlloc(char, num_nonzeros_offd, HYPRE_MEMORY_HOST);
       HYPRE_BigInt *col_map_offd_S = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
       hypre_ParCSRMatrixColMapOffd(S) = col_map_offd_S;
       if (num_functions > 1)
@@ -179,8 +177,6 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
          dof_func_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
       }
 
-      S_offd_j = hypre_TAlloc(HYPRE_Int, num_nonzeros_offd, memory_location);
-
       HYPRE_BigInt *col_map_offd_A = hypre_ParCSRMatrixColMapOffd(A);
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
@@ -225,9 +221,9 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    /*HYPRE_Int prefix_sum_workspace[2*(hypre_NumThreads() + 1)];*/
    prefix_sum_workspace = hypre_TAlloc(HYPRE_Int,  2 * (hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
 
-   /* give S same nonzero structure as A */
+   /* mark the strong entries of each row of A, then compress them into S */
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel private(i,diag,row_scale,row_sum,jA,jS)
+   #pragma omp parallel private(i,diag,row_scale,row_sum,threshold,jA,jS)
 #endif
    {
       HYPRE_Int start, stop;
@@ -318,152 +314,104 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
             } /* diag >= 0*/
          } /* num_functions <= 1 */
 
-         jS_diag += A_diag_i[i + 1] - A_diag_i[i] - 1;
-         jS_offd += A_offd_i[i + 1] - A_offd_i[i];
-
-         /* compute row entries of S */
-         S_temp_diag_j[A_diag_i[i]] = -1;
+         /* compute the strength mask of row i; the branch-free loops
+            below are the bulk of the work and vectorize */
+         threshold = strength_threshold * row_scale;
+         S_diag_mask[A_diag_i[i]] = 0;
          if ((fabs(row_sum) > fabs(diag)*max_row_sum) && (max_row_sum < 1.0))
          {
             /* make all dependencies weak */
             for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
             {
-               S_temp_diag_j[jA] = -1;
+               S_diag_mask[jA] = 0;
             }
-            jS_diag -= A_diag_i[i + 1] - (A_diag_i[i] + 1);
-
             for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
             {
-               S_temp_offd_j[jA] = -1;
+               S_offd_mask[jA] = 0;
             }
-            jS_offd -= A_offd_i[i + 1] - A_offd_i[i];
          }
+         else if (num_functions > 1)
+         {
+            if (diag < 0)
+            {
+               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+               {
+                  S_diag_mask[jA] = (A_diag_data[jA] > threshold) &&
+                                    (dof_func[i] == dof_func[A_diag_j[jA]]);
+                  jS_diag += S_diag_mask[jA];
+               }
+               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+               {
+                  S_offd_mask[jA] = (A_offd_data[jA] > threshold) &&
+                                    (dof_func[i] == dof_func_offd[A_offd_j[jA]]);
+                  jS_offd += S_offd_mask[jA];
+               }
+            }
+            else
+            {
+               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+               {
+                  S_diag_mask[jA] = (A_diag_data[jA] < threshold) &&
+                                    (dof_func[i] == dof_func[A_diag_j[jA]]);
+                  jS_diag += S_diag_mask[jA];
+               }
+               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+               {
+                  S_offd_mask[jA] = (A_offd_data[jA] < threshold) &&
+                                    (dof_func[i] == dof_func_offd[A_offd_j[jA]]);
+                  jS_offd += S_offd_mask[jA];
+               }
+            } /* diag >= 0 */
+         } /* num_functions > 1 */
          else
          {
-            if (num_functions > 1)
+            if (diag < 0)
             {
-               if (diag < 0)
+               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                {
-                  for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-                  {
-                     if (A_diag_data[jA] <= strength_threshold * row_scale
-                         || dof_func[i] != dof_func[A_diag_j[jA]])
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
-                     }
-                  }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-                  {
-                     if (A_offd_data[jA] <= strength_threshold * row_scale
-                         || dof_func[i] != dof_func_offd[A_offd_j[jA]])
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
-                     {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
-                     }
-                  }
+                  S_diag_mask[jA] = (A_diag_data[jA] > threshold);
+                  jS_diag += S_diag_mask[jA];
                }
-               else
+               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
                {
-                  for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-                  {
-                     if (A_diag_data[jA] >= strength_threshold * row_scale
-                         || dof_func[i] != dof_func[A_diag_j[jA]])
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
-                     }
-                  }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-                  {
-                     if (A_offd_data[jA] >= strength_threshold * row_scale
-                         || dof_func[i] != dof_func_offd[A_offd_j[jA]])
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
-                     {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
-                     }
-                  }
-               } /* diag >= 0 */
-            } /* num_functions > 1 */
+                  S_offd_mask[jA] = (A_offd_data[jA] > threshold);
+                  jS_offd += S_offd_mask[jA];
+               }
+            }
             else
             {
-               if (diag < 0)
+               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                {
-                  for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-                  {
-                     if (A_diag_data[jA] <= strength_threshold * row_scale)
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
-                     }
-                  }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-                  {
-                     if (A_offd_data[jA] <= strength_threshold * row_scale)
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
-                     {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
-                     }
-                  }
+                  S_diag_mask[jA] = (A_diag_data[jA] < threshold);
+                  jS_diag += S_diag_mask[jA];
                }
-               else
+               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
                {
-                  for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-                  {
-                     if (A_diag_data[jA] >= strength_threshold * row_scale)
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
-                     }
-                  }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-                  {
-                     if (A_offd_data[jA] >= strength_threshold * row_scale)
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
-                     {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
-                     }
-                  }
-               } /* diag >= 0 */
-            } /* num_functions <= 1 */
-         } /* !((row_sum > max_row_sum) && (max_row_sum < 1.0)) */
+                  S_offd_mask[jA] = (A_offd_data[jA] < threshold);
+                  jS_offd += S_offd_mask[jA];
+               }
+            } /* diag >= 0 */
+         } /* num_functions <= 1 */
       } /* for each variable */
 
       hypre_prefix_sum_pair(&jS_diag, S_diag_i + num_variables, &jS_offd, S_offd_i + num_variables,
                             prefix_sum_workspace);
 
+      /* the number of strong connections is known now: allocate S exactly */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp master
+#endif
+      {
+         S_diag_j = hypre_TAlloc(HYPRE_Int, S_diag_i[num_variables], memory_location);
+         if (num_cols_offd)
+         {
+            S_offd_j = hypre_TAlloc(HYPRE_Int, S_offd_i[num_variables], memory_location);
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
       /*--------------------------------------------------------------
        * "Compress" the strength matrix.
        *
@@ -482,9 +430,9 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
          jS = S_diag_i[i];
          for (jA = A_diag_i[i]; jA < A_diag_i[i + 1]; jA++)
          {
-            if (S_temp_diag_j[jA] > -1)
+            if (S_diag_mask[jA])
             {
-               S_diag_j[jS]    = S_temp_diag_j[jA];
+               S_diag_j[jS] = A_diag_j[jA];
                jS++;
             }
          }
@@ -492,9 +440,9 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
          jS = S_offd_i[i];
          for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
          {
-            if (S_temp_offd_j[jA] > -1)
+            if (S_offd_mask[jA])
             {
-               S_offd_j[jS]    = S_temp_offd_j[jA];
+               S_offd_j[jS] = A_offd_j[jA];
                jS++;
             }
          }
@@ -516,8 +464,8 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
 
    hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
    hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
-   hypre_TFree(S_temp_diag_j, HYPRE_MEMORY_HOST);
-   hypre_TFree(S_temp_offd_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_diag_mask, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_offd_mask, HYPRE_MEMORY_HOST);
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_CREATES] += hypre_MPI_Wtime();
@@ -1258,7 +1206,7 @@ hypre_BoomerAMGCreateSabsHost(hypre_ParCSRMatrix    *A,
    HYPRE_Int          *S_offd_j = NULL;
    /* HYPRE_Real         *S_offd_data; */
 
-   HYPRE_Real          diag, row_scale, row_sum;
+   HYPRE_Real          diag, row_scale, row_sum, threshold;
    HYPRE_Int           i, jA, jS;
 
    HYPRE_Int           ierr = 0;
@@ -1268,6 +1216,8 @@ hypre_BoomerAMGCreateSabsHost(hypre_ParCSRMatrix    *A,
    HYPRE_Int          *int_buf_data;
    HYPRE_Int           index, start, j;
 
+   HYPRE_Int          *prefix_sum_workspace;
+
    HYPRE_MemoryLocation memory_location = hypre_ParCSRMatrixMemoryLocation(A);
 
    /*--------------------------------------------------------------
@@ -1293,29 +1243,40 @@ hypre_BoomerAMGCreateSabsHost(hypre_ParCSRMatrix    *A,
 
    S_diag = hypre_ParCSRMatrixDiag(S);
    hypre_CSRMatrixI(S_diag) = hypre_CTAlloc(HYPRE_Int, num_variables + 1, memory_location);
-   hypre_CSRMatrixJ(S_diag) = hypre_CTAlloc(HYPRE_Int, num_nonzeros_diag, memory_location);
    S_offd = hypre_ParCSRMatrixOffd(S);
    hypre_CSRMatrixI(S_offd) = hypre_CTAlloc(HYPRE_Int, num_variables + 1, memory_location);
 
    S_diag_i = hypre_CSRMatrixI(S_diag);
-   S_diag_j = hypre_CSRMatrixJ(S_diag);
    S_offd_i = hypre_CSRMatrixI(S_offd);
 
    hypre_CSRMatrixMemoryLocation(S_diag) = memory_location;
    hypre_CSRMatrixMemoryLocation(S_offd) = memory_location;
 
+   /* one byte per nonzero of A: 1 if the connection is strong */
+   char *S_diag_mask = hypre_TAlloc(char, num_nonzeros_diag, HYPRE_MEMORY_HOST);
+   char *S_offd_mask = NULL;
+
    dof_func_offd = NULL;
 
    if (num_cols_offd)
    {
       A_offd_data = hypre_CSRMatrixData(A_offd);
-      hypre_CSRMatrixJ(S_offd) = hypre_CTAlloc(HYPRE_Int, num_nonzeros_offd, memory_location);
-      S_offd_j = hypre_CSRMatrixJ(S_offd);
-      hypre_ParCSRMatrixColMapOffd(S) = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+      S_offd_mask = hypre_TAlloc(char, num_nonzeros_offd, HYPRE_MEMORY_HOST);
+      HYPRE_BigInt *col_map_offd_S = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixColMapOffd(S) = col_map_offd_S;
       if (num_functions > 1)
       {
          dof_func_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
       }
+
+      HYPRE_BigInt *col_map_offd_A = hypre_ParCSRMatrixColMapOffd(A);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         col_map_offd_S[i] = col_map_offd_A[i];
+      }
    }
 
    /*-------------------------------------------------------------------
@@ -1350,155 +1311,173 @@ hypre_BoomerAMGCreateSabsHost(hypre_ParCSRMatrix    *A,
       hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
    }
 
-   /* give S same nonzero structure as A */
-   hypre_ParCSRMatrixCopy(A, S, 0);
+   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int,  2 * (hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
 
+   /* mark the strong entries of each row of A, then compress them into S */
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i,diag,row_scale,row_sum,jA) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel private(i,diag,row_scale,row_sum,threshold,jA,jS)
 #endif
-   for (i = 0; i < num_variables; i++)
    {
-      diag = A_diag_data[A_diag_i[i]];
+      HYPRE_Int start, stop;
+      hypre_GetSimpleThreadPartition(&start, &stop, num_variables);
+      HYPRE_Int jS_diag = 0, jS_offd = 0;
 
-      /* compute scaling factor and row sum */
-      row_scale = 0.0;
-      row_sum = fabs(diag);
-      if (num_functions > 1)
+      for (i = start; i < stop; i++)
       {
-         for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+         S_diag_i[i] = jS_diag;
+         S_offd_i[i] = jS_offd;
+
+         diag = A_diag_data[A_diag_i[i]];
+
+         /* compute scaling factor and row sum */
+         row_scale = 0.0;
+         row_sum = fabs(diag);
+         if (num_functions > 1)
          {
-            if (dof_func[i] == dof_func[A_diag_j[jA]])
+            for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
             {
-               row_scale = hypre_max(row_scale, fabs(A_diag_data[jA]));
-               row_sum += fabs(A_diag_data[jA]);
+               if (dof_func[i] == dof_func[A_diag_j[jA]])
+               {
+                  row_scale = hypre_max(row_scale, fabs(A_diag_data[jA]));
+                  row_sum += fabs(A_diag_data[jA]);
+               }
+            }
+            for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+            {
+               if (dof_func[i] == dof_func_offd[A_offd_j[jA]])
+               {
+                  row_scale = hypre_max(row_scale, fabs(A_offd_data[jA]));
+                  row_sum += fabs(A_offd_data[jA]);
+               }
             }
          }
-         for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+         else
          {
-            if (dof_func[i] == dof_func_offd[A_offd_j[jA]])
+            for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+            {
+               row_scale = hypre_max(row_scale, fabs(A_diag_data[jA]));
+               row_sum += fabs(A_diag_data[jA]);
+            }
+            for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
             {
                row_scale = hypre_max(row_scale, fabs(A_offd_data[jA]));
                row_sum += fabs(A_offd_data[jA]);
             }
          }
-      }
-      else
-      {
-         for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-         {
-            row_scale = hypre_max(row_scale, fabs(A_diag_data[jA]));
-            row_sum += fabs(A_diag_data[jA]);
-         }
-         for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-         {
-            row_scale = hypre_max(row_scale, fabs(A_offd_data[jA]));
-            row_sum += fabs(A_offd_data[jA]);
-         }
-      }
 
-      /* compute row entries of S */
-      S_diag_j[A_diag_i[i]] = -1; /* reject diag entry */
-      if ( fabs(row_sum) < fabs(diag) * (2.0 - max_row_sum) && max_row_sum < 1.0 )
-      {
-         /* make all dependencies weak */
-         for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-         {
-            S_diag_j[jA] = -1;
-         }
-         for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+         /* compute the strength mask of row i */
+         threshold = strength_threshold * row_scale;
+         S_diag_mask[A_diag_i[i]] = 0; /* reject diag entry */
+         if ( fabs(row_sum) < fabs(diag) * (2.0 - max_row_sum) && max_row_sum < 1.0 )
          {
-            S_offd_j[jA] = -1;
+            /* make all dependencies weak */
+            for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+            {
+               S_diag_mask[jA] = 0;
+            }
+            for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+            {
+               S_offd_mask[jA] = 0;
+            }
          }
-      }
-      else
-      {
-         if (num_functions > 1)
+         else if (num_functions > 1)
          {
             for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
             {
-               if (fabs(A_diag_data[jA]) <= strength_threshold * row_scale
-                   || dof_func[i] != dof_func[A_diag_j[jA]])
-               {
-                  S_diag_j[jA] = -1;
-               }
+               S_diag_mask[jA] = (fabs(A_diag_data[jA]) > threshold) &&
+                                 (dof_func[i] == dof_func[A_diag_j[jA]]);
+               jS_diag += S_diag_mask[jA];
             }
             for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
             {
-               if (fabs(A_offd_data[jA]) <= strength_threshold * row_scale
-                   || dof_func[i] != dof_func_offd[A_offd_j[jA]])
-               {
-                  S_offd_j[jA] = -1;
-               }
+               S_offd_mask[jA] = (fabs(A_offd_data[jA]) > threshold) &&
+                                 (dof_func[i] == dof_func_offd[A_offd_j[jA]]);
+               jS_offd += S_offd_mask[jA];
             }
          }
          else
          {
             for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
             {
-               if (fabs(A_diag_data[jA]) <= strength_threshold * row_scale)
-               {
-                  S_diag_j[jA] = -1;
-               }
+               S_diag_mask[jA] = (fabs(A_diag_data[jA]) > threshold);
+               jS_diag += S_diag_mask[jA];
             }
             for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
             {
-               if (fabs(A_offd_data[jA]) <= strength_threshold * row_scale)
-               {
-                  S_offd_j[jA] = -1;
-               }
+               S_offd_mask[jA] = (fabs(A_offd_data[jA]) > threshold);
+               jS_offd += S_offd_mask[jA];
             }
          }
-      }
-   }
+      } /* for each variable */
 
-   /*--------------------------------------------------------------
-    * "Compress" the strength matrix.
-    *
-    * NOTE: S has *NO DIAGONAL ELEMENT* on any row.  Caveat Emptor!
-    *
-    * NOTE: This "compression" section of code may be removed, and
-    * coarsening will still be done correctly.  However, the routine
-    * that builds interpolation would have to be modified first.
-    *----------------------------------------------------------------*/
+      hypre_prefix_sum_pair(&jS_diag, S_diag_i + num_variables, &jS_offd, S_offd_i + num_variables,
+                            prefix_sum_workspace);
 
-   /* RDF: not sure if able to thread this loop */
-   jS = 0;
-   for (i = 0; i < num_variables; i++)
-   {
-      S_diag_i[i] = jS;
-      for (jA = A_diag_i[i]; jA < A_diag_i[i + 1]; jA++)
+      /* the number of strong connections is known now: allocate S exactly */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp master
+#endif
       {
-         if (S_diag_j[jA] > -1)
+         S_diag_j = hypre_TAlloc(HYPRE_Int, S_diag_i[num_variables], memory_location);
+         if (num_cols_offd)
          {
-            S_diag_j[jS] = S_diag_j[jA];
-            jS++;
+            S_offd_j = hypre_TAlloc(HYPRE_Int, S_offd_i[num_variables], memory_location);
          }
       }
-   }
-   S_diag_i[num_variables] = jS;
-   hypre_CSRMatrixNumNonzeros(S_diag) = jS;
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
 
-   /* RDF: not sure if able to thread this loop */
-   jS = 0;
-   for (i = 0; i < num_variables; i++)
-   {
-      S_offd_i[i] = jS;
-      for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+      /*--------------------------------------------------------------
+       * "Compress" the strength matrix.
+       *
+       * NOTE: S has *NO DIAGONAL ELEMENT* on any row.  Caveat Emptor!
+       *
+       * NOTE: This "compression" section of code may be removed, and
+       * coarsening will still be done correctly.  However, the routine
+       * that builds interpolation would have to be modified first.
+       *----------------------------------------------------------------*/
+
+      for (i = start; i < stop; i++)
       {
-         if (S_offd_j[jA] > -1)
+         S_diag_i[i] += jS_diag;
+         S_offd_i[i] += jS_offd;
+
+         jS = S_diag_i[i];
+         for (jA = A_diag_i[i]; jA < A_diag_i[i + 1]; jA++)
          {
-            S_offd_j[jS]    = S_offd_j[jA];
-            jS++;
+            if (S_diag_mask[jA])
+            {
+               S_diag_j[jS] = A_diag_j[jA];
+               jS++;
+            }
          }
-      }
-   }
-   S_offd_i[num_variables] = jS;
-   hypre_CSRMatrixNumNonzeros(S_offd) = jS;
+
+         jS = S_offd_i[i];
+         for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+         {
+            if (S_offd_mask[jA])
+            {
+               S_offd_j[jS] = A_offd_j[jA];
+               jS++;
+            }
+         }
+      } /* for each variable */
+
+   } /* omp parallel */
+
+   hypre_CSRMatrixNumNonzeros(S_diag) = S_diag_i[num_variables];
+   hypre_CSRMatrixNumNonzeros(S_offd) = S_offd_i[num_variables];
+   hypre_CSRMatrixJ(S_diag) = S_diag_j;
+   hypre_CSRMatrixJ(S_offd) = S_offd_j;
    hypre_ParCSRMatrixCommPkg(S) = NULL;
 
    *S_ptr = S;
 
+   hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
    hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_diag_mask, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_offd_mask, HYPRE_MEMORY_HOST);
 
    return (ierr);
 }
@@ -1792,6 +1771,11 @@ hypre_BoomerAMGCreateSCommPkg(hypre_ParCSRMatrix *A,
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGCreate2ndS : creates strength matrix on coarse points
  * for second coarsening pass in aggressive coarsening (S*S+2S)
+ *
+ * Unlike in hypre_BoomerAMGCreateSHost, the pattern of the result is not a
+ * subset of the pattern of the input, but that of a product with path
+ * counts, so no byte mask over S applies.  It is built with marker arrays in
+ * a threaded count pass and a threaded fill pass instead.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
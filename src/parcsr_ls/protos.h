@@ -178,6 +178,8 @@ HYPRE_Int hypre_AMSSetProjectionFrequency ( void *solver, HYPRE_Int projection_f
 HYPRE_Int hypre_AMSSetMaxIter ( void *solver, HYPRE_Int maxit );
 HYPRE_Int hypre_AMSSetTol ( void *solver, HYPRE_Real tol );
 HYPRE_Int hypre_AMSSetCycleType ( void *solver, HYPRE_Int cycle_type );
+HYPRE_Int hypre_AMSSetConcurrentSubspaces ( void *solver, HYPRE_Int concurrent_subspaces );
+HYPRE_Int hypre_AMSSetMatrixFreePi ( void *solver, HYPRE_Int matrix_free_Pi );
 HYPRE_Int hypre_AMSSetPrintLevel ( void *solver, HYPRE_Int print_level );
 HYPRE_Int hypre_AMSSetSmoothingOptions ( void *solver, HYPRE_Int A_relax_type,
                                          HYPRE_Int A_relax_times, HYPRE_Real A_relax_weight, HYPRE_Real A_omega );
@@ -198,16 +200,37 @@ HYPRE_Int hypre_AMSComputePixyz ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *G,
                                   hypre_ParCSRMatrix **Piy_ptr, hypre_ParCSRMatrix **Piz_ptr );
 HYPRE_Int hypre_AMSComputeGPi ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *G, hypre_ParVector *Gx,
                                 hypre_ParVector *Gy, hypre_ParVector *Gz, HYPRE_Int dim, hypre_ParCSRMatrix **GPi_ptr );
+HYPRE_Int hypre_AMSMatrixFreePiSetup ( void *solver );
+HYPRE_Int hypre_AMSMatrixFreePiMatvec ( void *solver, HYPRE_Int subspace, HYPRE_Int trans,
+                                        HYPRE_Complex alpha, hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
+HYPRE_Int hypre_AMSMatrixFreePiRAP ( void *solver, HYPRE_Int subspace, hypre_ParCSRMatrix *A,
+                                     hypre_ParCSRMatrix **A_Pi_ptr );
 HYPRE_Int hypre_AMSSetup ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
+HYPRE_Int hypre_AMSCycleString ( void *solver, char *cycle );
 HYPRE_Int hypre_AMSSolve ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
 HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0, HYPRE_Int A0_relax_type,
                                      HYPRE_Int A0_relax_times, HYPRE_Real *A0_l1_norms, HYPRE_Real A0_relax_weight, HYPRE_Real A0_omega,
                                      HYPRE_Real A0_max_eig_est, HYPRE_Real A0_min_eig_est, HYPRE_Int A0_cheby_order,
                                      HYPRE_Real A0_cheby_fraction, hypre_ParCSRMatrix **A, HYPRE_Solver *B, HYPRE_PtrToSolverFcn *HB,
-                                     hypre_ParCSRMatrix **P, hypre_ParVector **r, hypre_ParVector **g, hypre_ParVector *x,
-                                     hypre_ParVector *y, hypre_ParVector *r0, hypre_ParVector *g0, char *cycle, hypre_ParVector *z );
+                                     hypre_ParCSRMatrix **P, HYPRE_Int (*Pfcn)(void *, HYPRE_Int, HYPRE_Int, HYPRE_Complex,
+                                                                               hypre_ParVector *, HYPRE_Complex, hypre_ParVector *), void *Pdata,
+                                     hypre_ParVector **r, hypre_ParVector **g, hypre_ParVector *x,
+                                     hypre_ParVector *y, hypre_ParVector *r0, hypre_ParVector *g0, char *cycle, hypre_ParVector *z,
+                                     void *groups_vdata );
+void *hypre_ParCSRSubspaceGroupsCreate ( MPI_Comm comm, char *cycle, HYPRE_Int num_subspaces,
+                                         HYPRE_Int *eligible );
+HYPRE_Int hypre_ParCSRSubspaceGroupsDestroy ( void *groups_vdata );
+HYPRE_Int hypre_ParCSRSubspaceGroupsConcurrent ( void *groups_vdata, HYPRE_Int i );
+hypre_ParCSRMatrix *hypre_ParCSRSubspaceGroupsRedistribution ( MPI_Comm comm,
+                                                               HYPRE_BigInt global_size, HYPRE_BigInt *starts, HYPRE_Int first, HYPRE_Int last,
+                                                               HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_ParCSRSubspaceGroupsSetup ( void *groups_vdata, hypre_ParCSRMatrix **A,
+                                            HYPRE_Solver *B, hypre_ParCSRMatrix **P );
+HYPRE_Int hypre_ParCSRSubspaceGroupsSolve ( void *groups_vdata, char *first, char *last,
+                                            HYPRE_Solver *B, HYPRE_PtrToSolverFcn *HB, hypre_ParVector *r0, hypre_ParVector *g0,
+                                            hypre_ParVector *y );
 HYPRE_Int hypre_AMSGetNumIterations ( void *solver, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_AMSGetFinalRelativeResidualNorm ( void *solver, HYPRE_Real *rel_resid_norm );
 HYPRE_Int hypre_AMSProjectOutGradients ( void *solver, hypre_ParVector *x );
@@ -350,6 +373,8 @@ HYPRE_Int HYPRE_AMSSetProjectionFrequency ( HYPRE_Solver solver, HYPRE_Int proje
 HYPRE_Int HYPRE_AMSSetMaxIter ( HYPRE_Solver solver, HYPRE_Int maxit );
 HYPRE_Int HYPRE_AMSSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_AMSSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
+HYPRE_Int HYPRE_AMSSetConcurrentSubspaces ( HYPRE_Solver solver, HYPRE_Int concurrent_subspaces );
+HYPRE_Int HYPRE_AMSSetMatrixFreePi ( HYPRE_Solver solver, HYPRE_Int matrix_free_Pi );
 HYPRE_Int HYPRE_AMSSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int print_level );
 HYPRE_Int HYPRE_AMSSetSmoothingOptions ( HYPRE_Solver solver, HYPRE_Int relax_type,
                                          HYPRE_Int relax_times, HYPRE_Real relax_weight, HYPRE_Real omega );
@@ -384,6 +409,9 @@ HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPR
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                   HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGAutotune ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
+                                    HYPRE_ParVector x, HYPRE_Int max_trials, const char *filename );
+HYPRE_Int HYPRE_BoomerAMGReadAutotune ( HYPRE_Solver solver, const char *filename );
 HYPRE_Int HYPRE_BoomerAMGSetRestriction ( HYPRE_Solver solver, HYPRE_Int restr_par );
 HYPRE_Int HYPRE_BoomerAMGSetIsTriangular ( HYPRE_Solver solver, HYPRE_Int is_triangular );
 HYPRE_Int HYPRE_BoomerAMGSetGMRESSwitchR ( HYPRE_Solver solver, HYPRE_Int gmres_switch );
@@ -395,6 +423,8 @@ HYPRE_Int HYPRE_BoomerAMGSetMinCoarseSize ( HYPRE_Solver solver, HYPRE_Int min_c
 HYPRE_Int HYPRE_BoomerAMGGetMinCoarseSize ( HYPRE_Solver solver, HYPRE_Int *min_coarse_size );
 HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int seq_threshold );
 HYPRE_Int HYPRE_BoomerAMGGetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int *seq_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetRedistThreshold ( HYPRE_Solver solver, HYPRE_Int redist_threshold );
+HYPRE_Int HYPRE_BoomerAMGGetRedistThreshold ( HYPRE_Solver solver, HYPRE_Int *redist_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver, HYPRE_Int redundant );
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver, HYPRE_Int *redundant );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
@@ -521,6 +551,8 @@ HYPRE_Int HYPRE_BoomerAMGSetKeepSameSign ( HYPRE_Solver solver, HYPRE_Int keep_s
 HYPRE_Int HYPRE_BoomerAMGSetDofFunc ( HYPRE_Solver solver, HYPRE_Int *dof_func );
 HYPRE_Int HYPRE_BoomerAMGSetNumPaths ( HYPRE_Solver solver, HYPRE_Int num_paths );
 HYPRE_Int HYPRE_BoomerAMGSetAggNumLevels ( HYPRE_Solver solver, HYPRE_Int agg_num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetSANumLevels ( HYPRE_Solver solver, HYPRE_Int sa_num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetSAJacobiWeight ( HYPRE_Solver solver, HYPRE_Real sa_jacobi_weight );
 HYPRE_Int HYPRE_BoomerAMGSetAggInterpType ( HYPRE_Solver solver, HYPRE_Int agg_interp_type );
 HYPRE_Int HYPRE_BoomerAMGSetAggTruncFactor ( HYPRE_Solver solver, HYPRE_Real agg_trunc_factor );
 HYPRE_Int HYPRE_BoomerAMGSetAddTruncFactor ( HYPRE_Solver solver, HYPRE_Real add_trunc_factor );
@@ -574,6 +606,9 @@ HYPRE_Int HYPRE_BoomerAMGSetLevelNonGalerkinTol ( HYPRE_Solver solver, HYPRE_Rea
                                                   HYPRE_Int level );
 HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongalerk_num_tol,
                                            HYPRE_Real *nongalerk_tol );
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinOpComplexity ( HYPRE_Solver solver, HYPRE_Real op_complexity );
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinStencilGrowth ( HYPRE_Solver solver,
+                                                       HYPRE_Real stencil_growth );
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
@@ -832,6 +867,16 @@ HYPRE_Int HYPRE_ParCSRMultiVectorPrint ( void *x_, const char *fileName );
 void *HYPRE_ParCSRMultiVectorRead ( MPI_Comm comm, void *ii_, const char *fileName );
 HYPRE_Int aux_maskCount ( HYPRE_Int n, HYPRE_Int *mask );
 void aux_indexFromMask ( HYPRE_Int n, HYPRE_Int *mask, HYPRE_Int *index );
+HYPRE_Int hypre_ParCSRMultiVectorCollect ( void *x_, hypre_ParVector **px );
+void hypre_ParCSRMultiVectorInnerProdLocal ( void *x_, void *y_, HYPRE_Int xyGHeight,
+                                             HYPRE_Int xyHeight, HYPRE_Int xyWidth, HYPRE_Real *xyVal );
+HYPRE_Int hypre_ParCSRMultiVectorGlobalSum ( void *x_, HYPRE_Int n, HYPRE_Real *val );
+void hypre_ParCSRMultiVectorInnerProd ( void *x_, void *y_, HYPRE_Int xyGHeight, HYPRE_Int xyHeight,
+                                        HYPRE_Int xyWidth, HYPRE_Real *xyVal );
+void hypre_ParCSRMultiVectorInnerProdDiag ( void *x_, void *y_, HYPRE_Int *mask, HYPRE_Int n,
+                                            HYPRE_Real *diag );
+HYPRE_Int hypre_ParCSRMultiVectorMatvec ( void *matvec_data, HYPRE_Complex alpha, void *A_,
+                                          void *x_, HYPRE_Complex beta, void *y_ );
 HYPRE_Int HYPRE_TempParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupMatvec ( HYPRE_MatvecFunctions *mv );
@@ -912,6 +957,10 @@ HYPRE_Int HYPRE_FSAISetMaxStepSize ( HYPRE_Solver solver, HYPRE_Int max_step_siz
 HYPRE_Int HYPRE_FSAIGetMaxStepSize ( HYPRE_Solver solver, HYPRE_Int *max_step_size );
 HYPRE_Int HYPRE_FSAISetKapTolerance ( HYPRE_Solver solver, HYPRE_Real  kap_tolerance );
 HYPRE_Int HYPRE_FSAIGetKapTolerance ( HYPRE_Solver solver, HYPRE_Real *kap_tolerance );
+HYPRE_Int HYPRE_FSAISetNumLevels ( HYPRE_Solver solver, HYPRE_Int num_levels );
+HYPRE_Int HYPRE_FSAIGetNumLevels ( HYPRE_Solver solver, HYPRE_Int *num_levels );
+HYPRE_Int HYPRE_FSAISetThreshold ( HYPRE_Solver solver, HYPRE_Real threshold );
+HYPRE_Int HYPRE_FSAIGetThreshold ( HYPRE_Solver solver, HYPRE_Real *threshold );
 HYPRE_Int HYPRE_FSAISetTolerance ( HYPRE_Solver solver, HYPRE_Real tolerance );
 HYPRE_Int HYPRE_FSAIGetTolerance ( HYPRE_Solver solver, HYPRE_Real *tolerance );
 HYPRE_Int HYPRE_FSAISetOmega ( HYPRE_Solver solver, HYPRE_Real omega );
@@ -987,6 +1036,11 @@ HYPRE_Int hypre_BoomerAMGAdditiveCycle ( void *amg_vdata );
 HYPRE_Int hypre_CreateLambda ( void *amg_vdata );
 HYPRE_Int hypre_CreateDinv ( void *amg_vdata );
 
+/* par_amg_autotune.c */
+HYPRE_Int hypre_BoomerAMGAutotune ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                    hypre_ParVector *u, HYPRE_Int max_trials, const char *filename );
+HYPRE_Int hypre_BoomerAMGReadAutotune ( void *amg_vdata, const char *filename );
+
 /* par_amg.c */
 void *hypre_BoomerAMGCreate ( void );
 HYPRE_Int hypre_BoomerAMGDestroy ( void *data );
@@ -1001,6 +1055,8 @@ HYPRE_Int hypre_BoomerAMGSetMinCoarseSize ( void *data, HYPRE_Int min_coarse_siz
 HYPRE_Int hypre_BoomerAMGGetMinCoarseSize ( void *data, HYPRE_Int *min_coarse_size );
 HYPRE_Int hypre_BoomerAMGSetSeqThreshold ( void *data, HYPRE_Int seq_threshold );
 HYPRE_Int hypre_BoomerAMGGetSeqThreshold ( void *data, HYPRE_Int *seq_threshold );
+HYPRE_Int hypre_BoomerAMGSetRedistThreshold ( void *data, HYPRE_Int redist_threshold );
+HYPRE_Int hypre_BoomerAMGGetRedistThreshold ( void *data, HYPRE_Int *redist_threshold );
 HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data, HYPRE_Int redundant );
@@ -1098,6 +1154,8 @@ HYPRE_Int hypre_BoomerAMGSetNodalDiag ( void *data, HYPRE_Int nodal );
 HYPRE_Int hypre_BoomerAMGSetKeepSameSign ( void *data, HYPRE_Int keep_same_sign );
 HYPRE_Int hypre_BoomerAMGSetNumPaths ( void *data, HYPRE_Int num_paths );
 HYPRE_Int hypre_BoomerAMGSetAggNumLevels ( void *data, HYPRE_Int agg_num_levels );
+HYPRE_Int hypre_BoomerAMGSetSANumLevels ( void *data, HYPRE_Int sa_num_levels );
+HYPRE_Int hypre_BoomerAMGSetSAJacobiWeight ( void *data, HYPRE_Real sa_jacobi_weight );
 HYPRE_Int hypre_BoomerAMGSetAggInterpType ( void *data, HYPRE_Int agg_interp_type );
 HYPRE_Int hypre_BoomerAMGSetAggPMaxElmts ( void *data, HYPRE_Int agg_P_max_elmts );
 HYPRE_Int hypre_BoomerAMGSetMultAddPMaxElmts ( void *data, HYPRE_Int add_P_max_elmts );
@@ -1176,6 +1234,8 @@ HYPRE_Int hypre_BoomerAMGSetLevelNonGalerkinTol ( void *data, HYPRE_Real nongale
                                                   HYPRE_Int level );
 HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_tol,
                                            HYPRE_Real *nongalerk_tol );
+HYPRE_Int hypre_BoomerAMGSetNonGalerkinOpComplexity ( void *data, HYPRE_Real op_complexity );
+HYPRE_Int hypre_BoomerAMGSetNonGalerkinStencilGrowth ( void *data, HYPRE_Real stencil_growth );
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
@@ -1611,6 +1671,8 @@ HYPRE_Int hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RA
                                                          hypre_ParCSRMatrix *AP, HYPRE_Real strong_threshold, HYPRE_Real max_row_sum,
                                                          HYPRE_Int num_functions, HYPRE_Int * dof_func_value, HYPRE_Int * CF_marker, HYPRE_Real droptol,
                                                          HYPRE_Int sym_collapse, HYPRE_Real lump_percent, HYPRE_Int collapse_beta );
+HYPRE_Int hypre_BoomerAMGSparsifyCoarseOperator ( hypre_ParCSRMatrix *A_H, HYPRE_Real max_nnz,
+                                                  HYPRE_Real max_tol, HYPRE_Real *droptol_ptr );
 
 /* par_rap.c */
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
@@ -1624,6 +1686,20 @@ HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT, hypre_ParCSRM
 HYPRE_Int hypre_GenerateSendMapAndCommPkg ( MPI_Comm comm, HYPRE_Int num_sends, HYPRE_Int num_recvs,
                                             HYPRE_Int *recv_procs, HYPRE_Int *send_procs, HYPRE_Int *recv_vec_starts, hypre_ParCSRMatrix *A );
 
+/* par_aggregation.c */
+HYPRE_Int hypre_BoomerAMGCoarsenAggregates ( hypre_ParCSRMatrix *S, hypre_IntArray **CF_marker_ptr,
+                                             HYPRE_BigInt **aggregates_ptr, HYPRE_Int *num_aggregates_ptr );
+HYPRE_Int hypre_BoomerAMGBuildSAInterp ( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
+                                         hypre_ParCSRMatrix *S, HYPRE_BigInt *aggregates, HYPRE_Int num_aggregates,
+                                         HYPRE_Int num_functions, HYPRE_Int *dof_func, HYPRE_Int num_vectors,
+                                         HYPRE_Real *nullspace, HYPRE_Real jacobi_weight, HYPRE_Int debug_flag,
+                                         HYPRE_Real trunc_factor, HYPRE_Int max_elmts, hypre_ParCSRMatrix **P_ptr,
+                                         hypre_IntArray **coarse_dof_func_ptr, HYPRE_Real **coarse_nullspace_ptr );
+
+/* par_redistribute.c */
+HYPRE_Int hypre_BoomerAMGRedistributeCoarse ( hypre_ParCSRMatrix **P_ptr,
+                                              hypre_ParCSRMatrix **R_ptr, HYPRE_Int min_rows, HYPRE_Int *stride_ptr );
+
 /* par_relax.c */
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                  HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
@@ -1723,6 +1799,14 @@ HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HY
                                    HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp,
                                    hypre_ParVector *Ztemp );
 
+/* par_relax_multicolor.c */
+HYPRE_Int hypre_BoomerAMGMulticolorSetup ( hypre_ParCSRMatrix *A, hypre_IntArray **color_starts_ptr,
+                                           hypre_IntArray **color_rows_ptr, HYPRE_Real **l1_norm_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorGaussSeidel ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                      HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight,
+                                                      HYPRE_Real *l1_norms, hypre_IntArray *color_starts, hypre_IntArray *color_rows,
+                                                      HYPRE_Int reverse, hypre_ParVector *u );
+
 /* par_relax_more.c */
 HYPRE_Int hypre_ParCSRMaxEigEstimate ( hypre_ParCSRMatrix *A, HYPRE_Int scale, HYPRE_Real *max_eig,
                                        HYPRE_Real *min_eig );
@@ -1780,6 +1864,12 @@ HYPRE_Int hypre_SchwarzSetScale ( void *data, HYPRE_Real *scale );
 HYPRE_Int hypre_SchwarzReScale ( void *data, HYPRE_Int size, HYPRE_Real value );
 HYPRE_Int hypre_SchwarzSetDofFunc ( void *data, HYPRE_Int *dof_func );
 
+/* par_sparse_direct.c */
+HYPRE_Int hypre_SparseDirectSetup ( void **solver_ptr, hypre_ParCSRMatrix *A,
+                                    HYPRE_Int print_level );
+HYPRE_Int hypre_SparseDirectSolve ( void *solver, hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_SparseDirectDestroy ( void *solver );
+
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
@@ -2058,6 +2148,8 @@ HYPRE_Int hypre_MGRSetFSolver( void  *mgr_vdata, HYPRE_Int  (*fine_grid_solver_s
                                                                                       void*, void*), HYPRE_Int  (*fine_grid_solver_setup)(void*, void*, void*, void*), void  *fsolver );
 HYPRE_Int hypre_MGRSetup( void *mgr_vdata, hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                           hypre_ParVector    *u );
+HYPRE_Int hypre_MGRSetupReuse( void *mgr_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                               hypre_ParVector *u );
 HYPRE_Int hypre_MGRSolve( void *mgr_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                           hypre_ParVector  *u );
 HYPRE_Int hypre_block_jacobi_scaling(hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **B_ptr,
@@ -2078,6 +2170,9 @@ HYPRE_Int hypre_MGRGetSubBlock( hypre_ParCSRMatrix *A, HYPRE_Int *row_cf_marker,
                                 HYPRE_Int *col_cf_marker, HYPRE_Int debug_flag, hypre_ParCSRMatrix **A_ff_ptr );
 HYPRE_Int hypre_MGRBuildAff( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker, HYPRE_Int debug_flag,
                              hypre_ParCSRMatrix **A_ff_ptr );
+HYPRE_Int hypre_MGRUpdateMatrixValues( hypre_ParCSRMatrix *A_new, hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_MGRComputeCoarseGridValues( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
+                                            hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *RAP );
 HYPRE_Int hypre_MGRApproximateInverse(hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **A_inv);
 HYPRE_Int hypre_MGRAddVectorP ( hypre_IntArray *CF_marker, HYPRE_Int point_type, HYPRE_Real a,
                                 hypre_ParVector *fromVector, HYPRE_Real b, hypre_ParVector **toVector );
@@ -2114,6 +2209,8 @@ HYPRE_Int hypre_MGRSetTruncateCoarseGridThreshold( void *mgr_vdata, HYPRE_Real t
 HYPRE_Int hypre_MGRSetLogging( void *mgr_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_MGRSetMaxIter( void *mgr_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_MGRSetPMaxElmts( void *mgr_vdata, HYPRE_Int P_max_elmts);
+HYPRE_Int hypre_MGRSetReuseSetup( void *mgr_vdata, HYPRE_Int reuse_setup );
+HYPRE_Int hypre_MGRSetInnerSetupLag( void *mgr_vdata, HYPRE_Int lag );
 HYPRE_Int hypre_MGRSetTol( void *mgr_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_MGRSetAffInv( void *mgr_vdata, hypre_ParCSRMatrix *A_ff_inv);
 #ifdef HYPRE_USING_DSUPERLU
@@ -2338,12 +2435,14 @@ HYPRE_Int hypre_BoomerAMGDDGetAMG ( void *data, void **amg_solver );
 HYPRE_Int hypre_BoomerAMGDDSolve ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                                    hypre_ParVector *x );
 HYPRE_Int hypre_BoomerAMGDD_Cycle ( hypre_ParAMGDDData *amgdd_data );
+HYPRE_Int hypre_BoomerAMGDD_ResidualCommunicationSetup ( hypre_ParAMGDDData *amgdd_data );
+HYPRE_Int hypre_BoomerAMGDD_ResidualCommunicationStart ( hypre_ParAMGDDData *amgdd_data );
 HYPRE_Int hypre_BoomerAMGDD_ResidualCommunication ( hypre_ParAMGDDData *amgdd_data );
-HYPRE_Complex* hypre_BoomerAMGDD_PackResidualBuffer ( hypre_AMGDDCompGrid **compGrid,
-                                                      hypre_AMGDDCommPkg *compGridCommPkg, HYPRE_Int current_level, HYPRE_Int proc );
-HYPRE_Int hypre_BoomerAMGDD_UnpackResidualBuffer ( HYPRE_Complex *buffer,
-                                                   hypre_AMGDDCompGrid **compGrid, hypre_AMGDDCommPkg *compGridCommPkg, HYPRE_Int current_level,
-                                                   HYPRE_Int proc );
+HYPRE_Int hypre_BoomerAMGDD_ResidualCommunicationWait ( hypre_ParAMGDDData *amgdd_data );
+HYPRE_Int hypre_BoomerAMGDD_PackResidual ( hypre_AMGDDCompGrid **compGrid,
+                                           hypre_AMGDDCommPkg *compGridCommPkg, HYPRE_Int current_level, HYPRE_Int nonowned );
+HYPRE_Int hypre_BoomerAMGDD_UnpackResidual ( hypre_AMGDDCompGrid **compGrid,
+                                             hypre_AMGDDCommPkg *compGridCommPkg, HYPRE_Int current_level );
 
 /* par_amgdd_setup.c */
 HYPRE_Int hypre_BoomerAMGDDSetup ( void *amgdd_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *b,
@@ -2379,6 +2478,10 @@ HYPRE_Int hypre_BoomerAMGDD_FAC_CFL1JacobiDevice ( void *amgdd_vdata, HYPRE_Int
 /* par_amgdd_comp_grid.c */
 hypre_AMGDDCompGridMatrix* hypre_AMGDDCompGridMatrixCreate();
 HYPRE_Int hypre_AMGDDCompGridMatrixDestroy ( hypre_AMGDDCompGridMatrix *matrix );
+HYPRE_Int hypre_AMGDDCompGridMatrixSetupComposite ( hypre_AMGDDCompGridMatrix *A,
+                                                   HYPRE_Int num_owned, HYPRE_Int num_nonowned );
+HYPRE_Int hypre_AMGDDCompGridMatrixCompositeGather ( hypre_AMGDDCompGridMatrix *A,
+                                                    hypre_AMGDDCompGridVector *x );
 HYPRE_Int hypre_AMGDDCompGridMatvec ( HYPRE_Complex alpha, hypre_AMGDDCompGridMatrix *A,
                                       hypre_AMGDDCompGridVector *x, HYPRE_Complex beta, hypre_AMGDDCompGridVector *y );
 HYPRE_Int hypre_AMGDDCompGridRealMatvec ( HYPRE_Complex alpha, hypre_AMGDDCompGridMatrix *A,
@@ -2460,6 +2563,9 @@ HYPRE_Int hypre_FSAISetAlgoType ( void *data, HYPRE_Int algo_type );
 HYPRE_Int hypre_FSAISetMaxSteps ( void *data, HYPRE_Int max_steps );
 HYPRE_Int hypre_FSAISetMaxStepSize ( void *data, HYPRE_Int max_step_size );
 HYPRE_Int hypre_FSAISetKapTolerance ( void *data, HYPRE_Real kap_tolerance );
+HYPRE_Int hypre_FSAISetNumLevels ( void *data, HYPRE_Int num_levels );
+HYPRE_Int hypre_FSAISetThreshold ( void *data, HYPRE_Real threshold );
+HYPRE_Int hypre_FSAIClearStaticPattern ( void *data );
 HYPRE_Int hypre_FSAISetMaxIterations ( void *data, HYPRE_Int max_iterations );
 HYPRE_Int hypre_FSAISetEigMaxIters ( void *data, HYPRE_Int eig_max_iters );
 HYPRE_Int hypre_FSAISetZeroGuess ( void *data, HYPRE_Int zero_guess );
@@ -2472,6 +2578,8 @@ HYPRE_Int hypre_FSAIGetAlgoType ( void *data, HYPRE_Int *algo_type );
 HYPRE_Int hypre_FSAIGetMaxSteps ( void *data, HYPRE_Int *max_steps );
 HYPRE_Int hypre_FSAIGetMaxStepSize ( void *data, HYPRE_Int *max_step_size );
 HYPRE_Int hypre_FSAIGetKapTolerance ( void *data, HYPRE_Real *kap_tolerance );
+HYPRE_Int hypre_FSAIGetNumLevels ( void *data, HYPRE_Int *num_levels );
+HYPRE_Int hypre_FSAIGetThreshold ( void *data, HYPRE_Real *threshold );
 HYPRE_Int hypre_FSAIGetMaxIterations ( void *data, HYPRE_Int *max_iterations );
 HYPRE_Int hypre_FSAIGetEigMaxIters ( void *data, HYPRE_Int *eig_max_iters );
 HYPRE_Int hypre_FSAIGetZeroGuess ( void *data, HYPRE_Int *zero_guess );
@@ -2491,6 +2599,17 @@ HYPRE_Int hypre_FindKapGrad ( hypre_CSRMatrix *A_diag, hypre_Vector *kaporin_gra
                               HYPRE_Int max_row_size, HYPRE_Int row_num, HYPRE_Int *kg_marker );
 HYPRE_Int hypre_AddToPattern ( hypre_Vector *kaporin_gradient, HYPRE_Int *kap_grad_nonzeros,
                                HYPRE_Int *S_Pattern, HYPRE_Int *S_nnz, HYPRE_Int *kg_marker, HYPRE_Int max_step_size );
+HYPRE_Int hypre_DenseSPDSystemSolveBatch ( HYPRE_Int n, HYPRE_Int nb, HYPRE_Complex *mat,
+                                           HYPRE_Complex *rhs, HYPRE_Int *info );
+HYPRE_Int hypre_FSAISetupRowBlock ( hypre_CSRMatrix *A, HYPRE_Int shift, HYPRE_Int ns, HYPRE_Int ne,
+                                    HYPRE_Int max_steps, HYPRE_Int max_step_size, HYPRE_Real kap_tolerance,
+                                    HYPRE_Int max_cand_size, HYPRE_Int *kg_marker, HYPRE_Int *marker,
+                                    HYPRE_Int *G_j, HYPRE_Complex *G_a, HYPRE_Int *G_nnzcnt );
+HYPRE_Int hypre_FSAIComputeStaticPattern ( hypre_CSRMatrix *A, HYPRE_Int num_levels,
+                                           HYPRE_Real threshold, hypre_CSRMatrix **P_ptr );
+HYPRE_Int hypre_FSAISetupStaticRowBlock ( hypre_CSRMatrix *A, hypre_CSRMatrix *P, HYPRE_Int ns,
+                                          HYPRE_Int ne, HYPRE_Int *marker, HYPRE_Int *G_i,
+                                          HYPRE_Int *G_j, HYPRE_Complex *G_a );
 HYPRE_Int hypre_FSAISetup ( void *fsai_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                             hypre_ParVector *u );
 HYPRE_Int hypre_FSAIPrintStats ( void *fsai_vdata, hypre_ParCSRMatrix *A );
@@ -389,6 +389,62 @@ hypre_F90_IFACE(hypre_structpfmggetskiprelax, HYPRE_STRUCTPFMGGETSKIPRELAX)
                 hypre_F90_PassIntRef (skip_relax) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPFMGSetConstantTol, HYPRE_StructPFMGGetConstantTol
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_structpfmgsetconstanttol, HYPRE_STRUCTPFMGSETCONSTANTTOL)
+( hypre_F90_Obj *solver,
+  hypre_F90_Real *constant_tol,
+  hypre_F90_Int *ierr           )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPFMGSetConstantTol(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassReal (constant_tol) ) );
+}
+
+void
+hypre_F90_IFACE(hypre_structpfmggetconstanttol, HYPRE_STRUCTPFMGGETCONSTANTTOL)
+( hypre_F90_Obj *solver,
+  hypre_F90_Real *constant_tol,
+  hypre_F90_Int *ierr           )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPFMGGetConstantTol(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassRealRef (constant_tol) ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPFMGSetRBColorLayout, HYPRE_StructPFMGGetRBColorLayout
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_structpfmgsetrbcolorlayout, HYPRE_STRUCTPFMGSETRBCOLORLAYOUT)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *rb_color_layout,
+  hypre_F90_Int *ierr           )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPFMGSetRBColorLayout(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassInt (rb_color_layout) ) );
+}
+
+void
+hypre_F90_IFACE(hypre_structpfmggetrbcolorlayout, HYPRE_STRUCTPFMGGETRBCOLORLAYOUT)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *rb_color_layout,
+  hypre_F90_Int *ierr           )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPFMGGetRBColorLayout(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassIntRef (rb_color_layout) ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructPFMGSetDxyz
  *--------------------------------------------------------------------------*/
@@ -172,6 +172,11 @@ HYPRE_Int HYPRE_StructJacobiGetFinalRelativeResidualNorm(HYPRE_StructSolver  sol
  * is not a power-of-two, then \f$M\f$ should be as small as possible.  Large
  * values of \f$M\f$ will generally result in slower convergence rates.
  *
+ * PFMG accepts matrix-free matrices (see \ref HYPRE_StructMatrixSetCoeffFcn).
+ * Their coefficients are evaluated once during setup to build the coarse
+ * grids.  Red/black Gauss-Seidel is switched to weighted Jacobi on the fine
+ * grid only; the coarse grids are stored and still use red/black.
+ *
  * @{
  **/
 
@@ -265,6 +270,9 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *
+ * For a matrix-free matrix, types 2 and 3 fall back to weighted Jacobi on the
+ * fine grid and use Red/Black Gauss-Seidel on the stored coarse grids.
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                        HYPRE_Int          relax_type);
@@ -328,6 +336,37 @@ HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax(HYPRE_StructSolver solver,
                                        HYPRE_Int *skip_relax);
 
+/**
+ * (Optional) Store the coarse-grid operators as constant-coefficient matrices
+ * when the coefficients of a variable-coefficient matrix \e A are spatially
+ * constant to within the relative tolerance \e constant_tol.  This is only done
+ * when no stencil coefficient couples to a point outside of the grid (e.g., for
+ * periodic problems), so that the coarse-grid operators are unchanged.  With
+ * the non-Galerkin coarse-grid operator, a variable diagonal is also allowed.
+ * This greatly reduces the setup time and memory of the multigrid hierarchy.
+ * Operators that are only constant away from a non-periodic boundary (e.g.,
+ * with eliminated Dirichlet conditions) are left as they are.  The default is
+ * 0.0, which turns this off.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetConstantTol(HYPRE_StructSolver solver,
+                                         HYPRE_Real         constant_tol);
+
+HYPRE_Int HYPRE_StructPFMGGetConstantTol(HYPRE_StructSolver solver,
+                                         HYPRE_Real *constant_tol);
+
+/**
+ * (Optional) Store the variable coefficients of each level by color for the
+ * red/black Gauss-Seidel relaxation (relaxation types 2 and 3).  The half
+ * sweeps then read the matrix with unit stride, at the cost of an extra copy
+ * of the coefficients.  This is only available on the host.  The default is
+ * 0, which turns this off.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetRBColorLayout(HYPRE_StructSolver solver,
+                                           HYPRE_Int          rb_color_layout);
+
+HYPRE_Int HYPRE_StructPFMGGetRBColorLayout(HYPRE_StructSolver solver,
+                                           HYPRE_Int *rb_color_layout);
+
 /*
  * RE-VISIT
  **/
@@ -174,6 +174,11 @@ HYPRE_StructDiagScaleSetup( HYPRE_StructSolver solver,
                             HYPRE_StructVector y,
                             HYPRE_StructVector x      )
 {
+   if (hypre_StructMatrixCoeffFcn((hypre_StructMatrix *) A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Diagonal scaling does not support matrix-free matrices");
+   }
+
    return hypre_error_flag;
 }
 
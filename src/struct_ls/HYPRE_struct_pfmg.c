@@ -250,6 +250,40 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return ( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetConstantTol( HYPRE_StructSolver solver,
+                                HYPRE_Real         constant_tol )
+{
+   return ( hypre_PFMGSetConstantTol( (void *) solver, constant_tol) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetConstantTol( HYPRE_StructSolver solver,
+                                HYPRE_Real       * constant_tol )
+{
+   return ( hypre_PFMGGetConstantTol( (void *) solver, constant_tol) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetRBColorLayout( HYPRE_StructSolver solver,
+                                  HYPRE_Int          rb_color_layout )
+{
+   return ( hypre_PFMGSetRBColorLayout( (void *) solver, rb_color_layout) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetRBColorLayout( HYPRE_StructSolver solver,
+                                  HYPRE_Int        * rb_color_layout )
+{
+   return ( hypre_PFMGGetRBColorLayout( (void *) solver, rb_color_layout) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -231,6 +231,10 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata, HYPRE_Int num_post_relax
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata, HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata, HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata, HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetConstantTol ( void *pfmg_vdata, HYPRE_Real constant_tol );
+HYPRE_Int hypre_PFMGGetConstantTol ( void *pfmg_vdata, HYPRE_Real *constant_tol );
+HYPRE_Int hypre_PFMGSetRBColorLayout ( void *pfmg_vdata, HYPRE_Int rb_color_layout );
+HYPRE_Int hypre_PFMGGetRBColorLayout ( void *pfmg_vdata, HYPRE_Int *rb_color_layout );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata, HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata, HYPRE_Int *logging );
@@ -250,6 +254,7 @@ HYPRE_Int hypre_PFMGRelaxSetup ( void *pfmg_relax_vdata, hypre_StructMatrix *A,
                                  hypre_StructVector *b, hypre_StructVector *x );
 HYPRE_Int hypre_PFMGRelaxSetType ( void *pfmg_relax_vdata, HYPRE_Int relax_type );
 HYPRE_Int hypre_PFMGRelaxSetJacobiWeight ( void *pfmg_relax_vdata, HYPRE_Real weight );
+HYPRE_Int hypre_PFMGRelaxSetColorLayout ( void *pfmg_relax_vdata, HYPRE_Int color_layout );
 HYPRE_Int hypre_PFMGRelaxSetPreRelax ( void *pfmg_relax_vdata );
 HYPRE_Int hypre_PFMGRelaxSetPostRelax ( void *pfmg_relax_vdata );
 HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata, HYPRE_Real tol );
@@ -275,12 +280,16 @@ HYPRE_Int hypre_PFMGComputeDxyz_SS19( HYPRE_Int bi, hypre_StructMatrix *A, HYPRE
 HYPRE_Int hypre_PFMGComputeDxyz_SS27( HYPRE_Int bi, hypre_StructMatrix *A, HYPRE_Real *cxyz,
                                       HYPRE_Real *sqcxyz);
 HYPRE_Int hypre_ZeroDiagonal ( hypre_StructMatrix *A );
+hypre_StructMatrix *hypre_PFMGCreateConstantOp ( hypre_StructMatrix *A, HYPRE_Real tol,
+                                                 HYPRE_Int var_diag );
 
 /* pfmg_setup_interp.c */
 hypre_StructMatrix *hypre_PFMGCreateInterpOp ( hypre_StructMatrix *A, hypre_StructGrid *cgrid,
                                                HYPRE_Int cdir, HYPRE_Int rap_type );
 HYPRE_Int hypre_PFMGSetupInterpOp ( hypre_StructMatrix *A, HYPRE_Int cdir, hypre_Index findex,
                                     hypre_Index stride, hypre_StructMatrix *P, HYPRE_Int rap_type );
+HYPRE_Int hypre_PFMGComputeInterpOp ( hypre_StructMatrix *A, HYPRE_Int cdir, hypre_Index findex,
+                                      hypre_Index stride, hypre_StructMatrix *P, HYPRE_Int rap_type );
 HYPRE_Int hypre_PFMGSetupInterpOp_CC0 ( HYPRE_Int i, hypre_StructMatrix *A, hypre_Box *A_dbox,
                                         HYPRE_Int cdir, hypre_Index stride, hypre_Index stridec, hypre_Index start, hypre_IndexRef startc,
                                         hypre_Index loop_size, hypre_Box *P_dbox, HYPRE_Int Pstenc0, HYPRE_Int Pstenc1, HYPRE_Real *Pp0,
@@ -349,6 +358,9 @@ hypre_StructMatrix *hypre_PFMGCreateRAPOp ( hypre_StructMatrix *R, hypre_StructM
 HYPRE_Int hypre_PFMGSetupRAPOp ( hypre_StructMatrix *R, hypre_StructMatrix *A,
                                  hypre_StructMatrix *P, HYPRE_Int cdir, hypre_Index cindex, hypre_Index cstride, HYPRE_Int rap_type,
                                  hypre_StructMatrix *Ac );
+HYPRE_Int hypre_PFMGSetupRAPOpMatrixFree ( hypre_StructMatrix *R, hypre_StructMatrix *A,
+                                           hypre_StructMatrix *P, HYPRE_Int cdir, hypre_Index cindex, hypre_Index findex,
+                                           hypre_Index cstride, HYPRE_Int rap_type, hypre_StructMatrix *Ac );
 
 /* pfmg_solve.c */
 HYPRE_Int hypre_PFMGSolve ( void *pfmg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -365,6 +377,10 @@ HYPRE_Int hypre_PointRelax_core0 ( void *relax_vdata, hypre_StructMatrix *A,
                                    HYPRE_Int constant_coefficient, hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp,
                                    HYPRE_Real *tp, HYPRE_Int boxarray_id, hypre_Box *A_data_box, hypre_Box *b_data_box,
                                    hypre_Box *x_data_box, hypre_Box *t_data_box, hypre_IndexRef stride );
+HYPRE_Int hypre_PointRelax_coreMF ( void *relax_vdata, hypre_StructMatrix *A,
+                                    hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp, HYPRE_Real *tp,
+                                    hypre_Box *b_data_box, hypre_Box *x_data_box, hypre_Box *t_data_box,
+                                    hypre_IndexRef stride );
 HYPRE_Int hypre_PointRelax_core12 ( void *relax_vdata, hypre_StructMatrix *A,
                                     HYPRE_Int constant_coefficient, hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp,
                                     HYPRE_Real *tp, HYPRE_Int boxarray_id, hypre_Box *A_data_box, hypre_Box *b_data_box,
@@ -396,6 +412,11 @@ HYPRE_Int hypre_RedBlackConstantCoefGS ( void *relax_vdata, hypre_StructMatrix *
 /* red_black_gs.c */
 void *hypre_RedBlackGSCreate ( MPI_Comm comm );
 HYPRE_Int hypre_RedBlackGSDestroy ( void *relax_vdata );
+HYPRE_Int hypre_RedBlackGSSetupColors ( void *relax_vdata, hypre_StructMatrix *A );
+HYPRE_Int hypre_RedBlackGSDestroyColors ( void *relax_vdata );
+HYPRE_Int hypre_RedBlackGSColorBox ( void *relax_vdata, HYPRE_Int i, hypre_IndexRef start,
+                                     HYPRE_Int color, HYPRE_Real **cp_ptr, hypre_Index coffset, HYPRE_Int *cni_ptr,
+                                     HYPRE_Int *cnj_ptr, HYPRE_Int *csize_ptr );
 HYPRE_Int hypre_RedBlackGSSetup ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
                                   hypre_StructVector *x );
 HYPRE_Int hypre_RedBlackGS ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -405,6 +426,7 @@ HYPRE_Int hypre_RedBlackGSSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_RedBlackGSSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_RedBlackGSSetStartRed ( void *relax_vdata );
 HYPRE_Int hypre_RedBlackGSSetStartBlack ( void *relax_vdata );
+HYPRE_Int hypre_RedBlackGSSetColorLayout ( void *relax_vdata, HYPRE_Int color_layout );
 
 /* semi.c */
 HYPRE_Int hypre_StructInterpAssemble ( hypre_StructMatrix *A, hypre_StructMatrix *P,
@@ -417,6 +439,10 @@ HYPRE_Int hypre_SemiInterpSetup ( void *interp_vdata, hypre_StructMatrix *P,
                                   hypre_Index findex, hypre_Index stride );
 HYPRE_Int hypre_SemiInterp ( void *interp_vdata, hypre_StructMatrix *P, hypre_StructVector *xc,
                              hypre_StructVector *e );
+HYPRE_Int hypre_SemiInterpCorrectSetup ( void *interp_vdata, hypre_StructVector *xc,
+                                         hypre_StructVector *e );
+HYPRE_Int hypre_SemiInterpCorrect ( void *interp_vdata, hypre_StructMatrix *P,
+                                    hypre_StructVector *xc, hypre_StructVector *e, hypre_StructVector *x );
 HYPRE_Int hypre_SemiInterpDestroy ( void *interp_vdata );
 
 /* semi_restrict.c */
@@ -426,6 +452,11 @@ HYPRE_Int hypre_SemiRestrictSetup ( void *restrict_vdata, hypre_StructMatrix *R,
                                     hypre_Index findex, hypre_Index stride );
 HYPRE_Int hypre_SemiRestrict ( void *restrict_vdata, hypre_StructMatrix *R, hypre_StructVector *r,
                                hypre_StructVector *rc );
+HYPRE_Int hypre_SemiResidualRestrictSetup ( void *restrict_vdata, hypre_StructMatrix *A,
+                                            hypre_StructVector *x );
+HYPRE_Int hypre_SemiResidualRestrict ( void *restrict_vdata, hypre_StructMatrix *A,
+                                       hypre_StructVector *x, hypre_StructVector *b, hypre_StructMatrix *R,
+                                       hypre_StructVector *r, hypre_StructVector *rc );
 HYPRE_Int hypre_SemiRestrictDestroy ( void *restrict_vdata );
 
 /* semi_setup_rap.c */
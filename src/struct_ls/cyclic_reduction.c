@@ -505,6 +505,12 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
    HYPRE_MemoryLocation    data_location = HYPRE_MEMORY_DEVICE;
 #endif
 
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Cyclic reduction does not support matrix-free matrices");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -37,6 +37,8 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)    = 1;
    (pfmg_data -> num_post_relax)   = 1;
    (pfmg_data -> skip_relax)       = 1;
+   (pfmg_data -> constant_tol)     = 0.0;
+   (pfmg_data -> rb_color_layout)  = 0;
    (pfmg_data -> logging)          = 0;
    (pfmg_data -> print_level)      = 0;
 
@@ -404,6 +406,56 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetConstantTol( void       *pfmg_vdata,
+                          HYPRE_Real  constant_tol )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> constant_tol) = constant_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetConstantTol( void       *pfmg_vdata,
+                          HYPRE_Real *constant_tol )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *constant_tol = (pfmg_data -> constant_tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetRBColorLayout( void      *pfmg_vdata,
+                            HYPRE_Int  rb_color_layout )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> rb_color_layout) = rb_color_layout;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetRBColorLayout( void      *pfmg_vdata,
+                            HYPRE_Int *rb_color_layout )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *rb_color_layout = (pfmg_data -> rb_color_layout);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
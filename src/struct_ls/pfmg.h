@@ -36,6 +36,8 @@ typedef struct
    HYPRE_Int             num_pre_relax;  /* number of pre relaxation sweeps */
    HYPRE_Int             num_post_relax; /* number of post relaxation sweeps */
    HYPRE_Int             skip_relax;     /* flag to allow skipping relaxation */
+   HYPRE_Real            constant_tol;   /* tolerance for constant coarse ops */
+   HYPRE_Int             rb_color_layout; /* R/B GS coefficients by color */
    HYPRE_Real            relax_weight;
    HYPRE_Real            dxyz[3];     /* parameters used to determine cdir */
 
@@ -64,6 +66,7 @@ typedef struct
    void                **matvec_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   HYPRE_Int             fuse_transfer; /* fuse residual/restrict and interp/correct */
 
    /* log info (always logged) */
    HYPRE_Int             num_iterations;
@@ -174,6 +174,20 @@ hypre_PFMGRelaxSetJacobiWeight(void  *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetColorLayout( void      *pfmg_relax_vdata,
+                               HYPRE_Int  color_layout )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_RedBlackGSSetColorLayout((pfmg_relax_data -> rb_relax_data), color_layout);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -74,6 +74,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
+   HYPRE_Real            constant_tol =     (pfmg_data -> constant_tol);
+   HYPRE_Int             rb_color_layout =  (pfmg_data -> rb_color_layout);
    HYPRE_Int             rap_type;
 
    HYPRE_Int             max_iter;
@@ -101,6 +103,9 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Real            alpha, beta;
 
    hypre_StructMatrix  **A_l;
+   hypre_StructMatrix   *A_cc = NULL;
+   hypre_StructMatrix   *A_0;
+   hypre_StructMatrix   *A_op;
    hypre_StructMatrix  **P_l;
    hypre_StructMatrix  **RT_l;
    hypre_StructVector  **b_l;
@@ -126,6 +131,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             d, l;
    HYPRE_Int             dxyz_flag;
 
+   HYPRE_Int             fuse_transfer;
+
    HYPRE_Int             b_num_ghost[]  = {0, 0, 0, 0, 0, 0};
    HYPRE_Int             x_num_ghost[]  = {1, 1, 1, 1, 1, 1};
 
@@ -144,6 +151,29 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   /* The fused residual/restriction and interpolation/correction kernels in
+    * semi_restrict.c and semi_interp.c are host-only */
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   fuse_transfer = 0;
+#else
+   fuse_transfer = 1;
+#endif
+
+   /*-----------------------------------------------------
+    * A matrix-free A is evaluated a slab of planes at a
+    * time wherever setup needs its coefficients, so only
+    * the coarse levels are stored.  Red-black Gauss-Seidel
+    * and the fused transfer kernels read stored
+    * coefficients, so the fine grid is relaxed with
+    * weighted Jacobi instead (see below).
+    *-----------------------------------------------------*/
+
+   A_0 = A;
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      fuse_transfer = 0;
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -171,7 +201,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    {
       mean = hypre_CTAlloc(HYPRE_Real, 3, HYPRE_MEMORY_HOST);
       deviation = hypre_CTAlloc(HYPRE_Real, 3, HYPRE_MEMORY_HOST);
-      hypre_PFMGComputeDxyz(A, dxyz, mean, deviation);
+      hypre_PFMGComputeDxyz(A_0, dxyz, mean, deviation);
 
       for (d = 0; d < ndim; d++)
       {
@@ -393,6 +423,25 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
    rap_type = (pfmg_data -> rap_type);
 
+   /*-----------------------------------------------------
+    * If A is spatially constant, build the coarse grid
+    * operators from a constant-coefficient copy of A so
+    * that they are stored without per-point coefficients.
+    * A variable diagonal is only allowed for rap_type 1,
+    * since with Galerkin coarsening it makes all of the
+    * coarse operators variable anyway.
+    *-----------------------------------------------------*/
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if ((constant_tol > 0.0) && (num_levels > 1) && (rap_type < 2))
+   {
+      A_cc = hypre_PFMGCreateConstantOp(A_0, constant_tol, (rap_type == 1));
+   }
+   if (A_cc)
+   {
+      A_0 = A_cc;
+   }
+#endif
+
    A_l  = hypre_TAlloc(hypre_StructMatrix *, num_levels, HYPRE_MEMORY_HOST);
    P_l  = hypre_TAlloc(hypre_StructMatrix *, num_levels - 1, HYPRE_MEMORY_HOST);
    RT_l = hypre_TAlloc(hypre_StructMatrix *, num_levels - 1, HYPRE_MEMORY_HOST);
@@ -416,7 +465,9 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    {
       cdir = cdir_l[l];
 
-      P_l[l]  = hypre_PFMGCreateInterpOp(A_l[l], P_grid_l[l + 1], cdir, rap_type);
+      A_op = (l == 0) ? A_0 : A_l[l];
+
+      P_l[l]  = hypre_PFMGCreateInterpOp(A_op, P_grid_l[l + 1], cdir, rap_type);
       hypre_StructMatrixInitializeShell(P_l[l]);
       data_size += hypre_StructMatrixDataSize(P_l[l]);
       data_size_const += hypre_StructMatrixDataConstSize(P_l[l]);
@@ -438,7 +489,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 #endif
       }
 
-      A_l[l + 1] = hypre_PFMGCreateRAPOp(RT_l[l], A_l[l], P_l[l],
+      A_l[l + 1] = hypre_PFMGCreateRAPOp(RT_l[l], A_op, P_l[l],
                                          grid_l[l + 1], cdir, rap_type);
       hypre_StructMatrixInitializeShell(A_l[l + 1]);
       data_size += hypre_StructMatrixDataSize(A_l[l + 1]);
@@ -600,8 +651,19 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGSetFIndex(cdir, findex);
       hypre_PFMGSetStride(cdir, stride);
 
+      A_op = (l == 0) ? A_0 : A_l[l];
+
       /* set up interpolation operator */
-      hypre_PFMGSetupInterpOp(A_l[l], cdir, findex, stride, P_l[l], rap_type);
+      if (hypre_StructMatrixCoeffFcn(A_op))
+      {
+         /* this also sets up the coarse grid operator */
+         hypre_PFMGSetupRAPOpMatrixFree(RT_l[l], A_op, P_l[l], cdir, cindex, findex,
+                                        stride, rap_type, A_l[l + 1]);
+      }
+      else
+      {
+         hypre_PFMGSetupInterpOp(A_op, cdir, findex, stride, P_l[l], rap_type);
+      }
 
       /* set up the restriction operator */
 #if 0
@@ -612,18 +674,29 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 #endif
 
       /* set up the coarse grid operator */
-      hypre_PFMGSetupRAPOp(RT_l[l], A_l[l], P_l[l],
-                           cdir, cindex, stride, rap_type, A_l[l + 1]);
+      if (!hypre_StructMatrixCoeffFcn(A_op))
+      {
+         hypre_PFMGSetupRAPOp(RT_l[l], A_op, P_l[l],
+                              cdir, cindex, stride, rap_type, A_l[l + 1]);
+      }
 
       /* set up the interpolation routine */
       interp_data_l[l] = hypre_SemiInterpCreate();
       hypre_SemiInterpSetup(interp_data_l[l], P_l[l], 0, x_l[l + 1], e_l[l],
                             cindex, findex, stride);
+      if (fuse_transfer)
+      {
+         hypre_SemiInterpCorrectSetup(interp_data_l[l], x_l[l + 1], e_l[l]);
+      }
 
       /* set up the restriction routine */
       restrict_data_l[l] = hypre_SemiRestrictCreate();
       hypre_SemiRestrictSetup(restrict_data_l[l], RT_l[l], 1, r_l[l], b_l[l + 1],
                               cindex, findex, stride);
+      if (fuse_transfer)
+      {
+         hypre_SemiResidualRestrictSetup(restrict_data_l[l], A_l[l], x_l[l]);
+      }
    }
 
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -643,11 +716,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
     * point.
     *-----------------------------------------------------*/
 
-   if ( hypre_ZeroDiagonal(A_l[l]))
+   if ( hypre_ZeroDiagonal((l == 0) ? A_0 : A_l[l]))
    {
       active_l[l] = 0;
    }
 
+   hypre_StructMatrixDestroy(A_cc);
+
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    if (hypre_StructGridDataLocation(grid) != HYPRE_MEMORY_HOST)
    {
@@ -665,7 +740,16 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    {
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
-   hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   if (hypre_StructMatrixCoeffFcn(A) && (relax_type == 2 || relax_type == 3))
+   {
+      /* red-black gs needs stored coefficients; coarse levels keep it */
+      hypre_PFMGRelaxSetType(relax_data_l[0], 1);
+   }
+   else
+   {
+      hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   }
+   hypre_PFMGRelaxSetColorLayout(relax_data_l[0], rb_color_layout);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
@@ -686,6 +770,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            hypre_PFMGRelaxSetColorLayout(relax_data_l[l], rb_color_layout);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
          }
       }
@@ -731,6 +816,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    (pfmg_data -> matvec_data_l)   = matvec_data_l;
    (pfmg_data -> restrict_data_l) = restrict_data_l;
    (pfmg_data -> interp_data_l)   = interp_data_l;
+   (pfmg_data -> fuse_transfer)   = fuse_transfer;
 
    /*-----------------------------------------------------
     * Allocate space for log info
@@ -760,6 +846,52 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Add the contributions of box i of A to cxyz and sqcxyz
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGComputeDxyzBox( HYPRE_Int           i,
+                          hypre_StructMatrix *A,
+                          HYPRE_Real         *cxyz,
+                          HYPRE_Real         *sqcxyz )
+{
+   HYPRE_Int  stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+
+   /* all coefficients constant or variable diagonal */
+   if ( hypre_StructMatrixConstantCoefficient(A) )
+   {
+      hypre_PFMGComputeDxyz_CS(i, A, cxyz, sqcxyz);
+   }
+   /* constant_coefficient==0, all coefficients vary with space */
+   else
+   {
+      switch (stencil_size)
+      {
+         case 5:
+            hypre_PFMGComputeDxyz_SS5 (i, A, cxyz, sqcxyz);
+            break;
+         case 9:
+            hypre_PFMGComputeDxyz_SS9 (i, A, cxyz, sqcxyz);
+            break;
+         case 7:
+            hypre_PFMGComputeDxyz_SS7 (i, A, cxyz, sqcxyz);
+            break;
+         case 19:
+            hypre_PFMGComputeDxyz_SS19(i, A, cxyz, sqcxyz);
+            break;
+         case 27:
+            hypre_PFMGComputeDxyz_SS27(i, A, cxyz, sqcxyz);
+            break;
+         default:
+            hypre_printf("hypre error: unsupported stencil size %d\n", stencil_size);
+            hypre_MPI_Abort(hypre_MPI_COMM_WORLD, 1);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -773,19 +905,12 @@ hypre_PFMGComputeDxyz( hypre_StructMatrix *A,
    HYPRE_Real             cxyz[3], sqcxyz[3], tcxyz[3];
    HYPRE_Real             cxyz_max;
    HYPRE_Int              tot_size;
-   hypre_StructStencil   *stencil;
-   //hypre_Index           *stencil_shape;
-   HYPRE_Int              stencil_size;
    HYPRE_Int              constant_coefficient;
+   hypre_StructMatrix    *A_s;
+   hypre_Box             *bbox;
+   HYPRE_Int              sd, nplanes, k;
    HYPRE_Int              i, d;
 
-   /*----------------------------------------------------------
-    * Initialize some things
-    *----------------------------------------------------------*/
-   stencil       = hypre_StructMatrixStencil(A);
-   //stencil_shape = hypre_StructStencilShape(stencil);
-   stencil_size  = hypre_StructStencilSize(stencil);
-
    /*----------------------------------------------------------
     * Compute cxyz (use arithmetic mean)
     *----------------------------------------------------------*/
@@ -796,37 +921,28 @@ hypre_PFMGComputeDxyz( hypre_StructMatrix *A,
    compute_boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
    tot_size = hypre_StructGridGlobalSize(hypre_StructMatrixGrid(A));
 
-   hypre_ForBoxI(i, compute_boxes)
+   if (hypre_StructMatrixCoeffFcn(A))
    {
-      /* all coefficients constant or variable diagonal */
-      if ( constant_coefficient )
+      /* evaluate a matrix-free A one slab of planes at a time */
+      sd = hypre_StructMatrixNDim(A) - 1;
+      bbox = hypre_StructGridBoundingBox(hypre_StructMatrixGrid(A));
+      nplanes = hypre_StructMatrixCoeffSlabSize(A, sd);
+      for (k = hypre_BoxIMinD(bbox, sd); k <= hypre_BoxIMaxD(bbox, sd); k += nplanes)
       {
-         hypre_PFMGComputeDxyz_CS(i, A, cxyz, sqcxyz);
-      }
-      /* constant_coefficient==0, all coefficients vary with space */
-      else
-      {
-         switch (stencil_size)
+         A_s = hypre_StructMatrixCreateSlab(A, sd, k, k + nplanes - 1);
+         compute_boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A_s));
+         hypre_ForBoxI(i, compute_boxes)
          {
-            case 5:
-               hypre_PFMGComputeDxyz_SS5 (i, A, cxyz, sqcxyz);
-               break;
-            case 9:
-               hypre_PFMGComputeDxyz_SS9 (i, A, cxyz, sqcxyz);
-               break;
-            case 7:
-               hypre_PFMGComputeDxyz_SS7 (i, A, cxyz, sqcxyz);
-               break;
-            case 19:
-               hypre_PFMGComputeDxyz_SS19(i, A, cxyz, sqcxyz);
-               break;
-            case 27:
-               hypre_PFMGComputeDxyz_SS27(i, A, cxyz, sqcxyz);
-               break;
-            default:
-               hypre_printf("hypre error: unsupported stencil size %d\n", stencil_size);
-               hypre_MPI_Abort(hypre_MPI_COMM_WORLD, 1);
+            hypre_PFMGComputeDxyzBox(i, A_s, cxyz, sqcxyz);
          }
+         hypre_StructMatrixDestroy(A_s);
+      }
+   }
+   else
+   {
+      hypre_ForBoxI(i, compute_boxes)
+      {
+         hypre_PFMGComputeDxyzBox(i, A, cxyz, sqcxyz);
       }
    }
 
@@ -2179,6 +2295,9 @@ hypre_ZeroDiagonal( hypre_StructMatrix *A )
    HYPRE_Int              zero_diag = 0;
 
    HYPRE_Int              constant_coefficient;
+   hypre_StructMatrix    *A_s;
+   hypre_Box             *bbox;
+   HYPRE_Int              sd, nplanes, k;
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_Int              data_location = hypre_StructGridDataLocation(hypre_StructMatrixGrid(A));
 #endif
@@ -2187,6 +2306,25 @@ hypre_ZeroDiagonal( hypre_StructMatrix *A )
     * Initialize some things
     *----------------------------------------------------------*/
 
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      /* evaluate a matrix-free A one slab of planes at a time */
+      sd = hypre_StructMatrixNDim(A) - 1;
+      bbox = hypre_StructGridBoundingBox(hypre_StructMatrixGrid(A));
+      nplanes = hypre_StructMatrixCoeffSlabSize(A, sd);
+      for (k = hypre_BoxIMinD(bbox, sd); k <= hypre_BoxIMaxD(bbox, sd); k += nplanes)
+      {
+         A_s = hypre_StructMatrixCreateSlab(A, sd, k, k + nplanes - 1);
+         if (hypre_ZeroDiagonal(A_s))
+         {
+            zero_diag = 1;
+         }
+         hypre_StructMatrixDestroy(A_s);
+      }
+
+      return zero_diag;
+   }
+
    hypre_SetIndex3(stride, 1, 1, 1);
    hypre_SetIndex3(diag_index, 0, 0, 0);
 
@@ -2257,3 +2395,213 @@ hypre_ZeroDiagonal( hypre_StructMatrix *A )
 
    return zero_diag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGCreateConstantOp
+ *
+ * If the variable-coefficient matrix A is spatially constant to within the
+ * relative tolerance tol, return a constant-coefficient copy of A, otherwise
+ * return NULL.  If var_diag is set, a copy with constant off-diagonal
+ * coefficients and variable diagonal (constant_coefficient = 2) is returned
+ * when only the diagonal varies.  This is used to build the coarse operators
+ * with constant-coefficient storage.
+ *
+ * The constant-coefficient interpolation and coarse operators ignore the
+ * physical boundary, so they are only equivalent to the variable-coefficient
+ * ones when no stencil coefficient couples to a point outside of the grid
+ * (e.g., for periodic problems).  Otherwise, NULL is returned.  Matrix-free
+ * matrices are not checked.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_PFMGCreateConstantOp( hypre_StructMatrix *A,
+                            HYPRE_Real          tol,
+                            HYPRE_Int           var_diag )
+{
+   MPI_Comm               comm    = hypre_StructMatrixComm(A);
+   HYPRE_Int              ndim    = hypre_StructMatrixNDim(A);
+   hypre_StructGrid      *grid    = hypre_StructMatrixGrid(A);
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   hypre_BoxArray        *grid_boxes    = hypre_StructGridBoxes(grid);
+
+   hypre_StructMatrix    *A_cc = NULL;
+   hypre_BoxArray        *boundary;
+   hypre_Box             *grid_box;
+   hypre_Box             *A_dbox;
+   hypre_Box             *Acc_dbox;
+   hypre_Index            loop_size;
+   hypre_IndexRef         start;
+   hypre_Index            stride;
+   hypre_Index            diag_index;
+   hypre_Index            offset;
+   hypre_IndexRef         periodic = hypre_StructGridPeriodic(grid);
+
+   HYPRE_Real            *Ap, *Accp;
+   HYPRE_Real            *minmax, *gminmax, *values;
+   HYPRE_Int             *entries;
+   HYPRE_Real             amin, amax;
+   HYPRE_Int              diag_rank, diag_constant;
+   HYPRE_Int              constant_coefficient, num_constant;
+   HYPRE_Int              i, j, d, s;
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0 || hypre_StructMatrixCoeffFcn(A))
+   {
+      return NULL;
+   }
+
+   hypre_SetIndex(stride, 1);
+   hypre_SetIndex(diag_index, 0);
+   diag_rank = hypre_StructStencilElementRank(stencil, diag_index);
+
+   /*----------------------------------------------------------
+    * Compute the global range of each stencil coefficient.  The
+    * maxima are negated so that a single MIN reduction suffices.
+    * The last entry is negative if the stencil reaches outside
+    * of the grid.
+    *----------------------------------------------------------*/
+
+   minmax  = hypre_TAlloc(HYPRE_Real, 2 * stencil_size + 1, HYPRE_MEMORY_HOST);
+   gminmax = hypre_TAlloc(HYPRE_Real, 2 * stencil_size + 1, HYPRE_MEMORY_HOST);
+   for (s = 0; s < 2 * stencil_size; s++)
+   {
+      minmax[s] = HYPRE_REAL_MAX;
+   }
+   minmax[2 * stencil_size] = 0.0;
+
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      grid_box = hypre_BoxArrayBox(grid_boxes, i);
+      A_dbox   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      start    = hypre_BoxIMin(grid_box);
+      hypre_BoxGetSize(grid_box, loop_size);
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         /* couplings in periodic directions wrap around and are ignored */
+         hypre_CopyIndex(stencil_shape[s], offset);
+         for (d = 0; d < ndim; d++)
+         {
+            if (hypre_IndexD(periodic, d))
+            {
+               hypre_IndexD(offset, d) = 0;
+            }
+         }
+         if (!hypre_IndexEqual(offset, 0, ndim))
+         {
+            boundary = hypre_BoxArrayCreate(0, ndim);
+            hypre_GeneralBoxBoundaryIntersect(grid_box, grid, offset, boundary);
+            hypre_ForBoxI(j, boundary)
+            {
+               if (hypre_BoxVolume(hypre_BoxArrayBox(boundary, j)) > 0)
+               {
+                  minmax[2 * stencil_size] = -1.0;
+               }
+            }
+            hypre_BoxArrayDestroy(boundary);
+         }
+
+         Ap = hypre_StructMatrixBoxData(A, i, s);
+         amin =  minmax[2 * s];
+         amax = -minmax[2 * s + 1];
+         hypre_SerialBoxLoop1Begin(ndim, loop_size, A_dbox, start, stride, Ai);
+         {
+            amin = hypre_min(amin, Ap[Ai]);
+            amax = hypre_max(amax, Ap[Ai]);
+         }
+         hypre_SerialBoxLoop1End(Ai);
+         minmax[2 * s]     =  amin;
+         minmax[2 * s + 1] = -amax;
+      }
+   }
+
+   hypre_MPI_Allreduce(minmax, gminmax, 2 * stencil_size + 1, HYPRE_MPI_REAL,
+                       hypre_MPI_MIN, comm);
+
+   /*----------------------------------------------------------
+    * Decide on the constant entries
+    *----------------------------------------------------------*/
+
+   values  = hypre_TAlloc(HYPRE_Real, stencil_size, HYPRE_MEMORY_HOST);
+   entries = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   num_constant  = 0;
+   diag_constant = 0;
+   for (s = 0; s < stencil_size; s++)
+   {
+      amin =  gminmax[2 * s];
+      amax = -gminmax[2 * s + 1];
+      values[s] = amin;
+      if ((amax - amin) <= tol * hypre_max(hypre_abs(amin), hypre_abs(amax)))
+      {
+         entries[num_constant++] = s;
+         if (s == diag_rank)
+         {
+            diag_constant = 1;
+         }
+      }
+   }
+
+   if (gminmax[2 * stencil_size] < 0.0)
+   {
+      constant_coefficient = 0;
+   }
+   else if (num_constant == stencil_size)
+   {
+      constant_coefficient = 1;
+   }
+   else if (var_diag && (num_constant == stencil_size - 1) && !diag_constant)
+   {
+      constant_coefficient = 2;
+   }
+   else
+   {
+      constant_coefficient = 0;
+   }
+
+   /*----------------------------------------------------------
+    * Create the constant-coefficient copy of A
+    *----------------------------------------------------------*/
+
+   if (constant_coefficient)
+   {
+      A_cc = hypre_StructMatrixCreate(comm, grid, hypre_StructMatrixUserStencil(A));
+      hypre_StructMatrixSymmetric(A_cc) = hypre_StructMatrixSymmetric(A);
+      hypre_StructMatrixSetNumGhost(A_cc, hypre_StructMatrixNumGhost(A));
+      hypre_StructMatrixSetConstantCoefficient(A_cc, constant_coefficient);
+      hypre_StructMatrixInitialize(A_cc);
+
+      hypre_StructMatrixSetConstantValues(A_cc, num_constant, entries, values, 0);
+
+      if (constant_coefficient == 2)
+      {
+         hypre_ForBoxI(i, grid_boxes)
+         {
+            grid_box = hypre_BoxArrayBox(grid_boxes, i);
+            start    = hypre_BoxIMin(grid_box);
+            A_dbox   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+            Acc_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A_cc), i);
+            Ap   = hypre_StructMatrixBoxData(A, i, diag_rank);
+            Accp = hypre_StructMatrixBoxData(A_cc, i, diag_rank);
+            hypre_BoxGetSize(grid_box, loop_size);
+
+            hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                      A_dbox, start, stride, Ai,
+                                      Acc_dbox, start, stride, Acci);
+            {
+               Accp[Acci] = Ap[Ai];
+            }
+            hypre_SerialBoxLoop2End(Ai, Acci);
+         }
+      }
+
+      hypre_StructMatrixAssemble(A_cc);
+   }
+
+   hypre_TFree(minmax, HYPRE_MEMORY_HOST);
+   hypre_TFree(gminmax, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+
+   return A_cc;
+}
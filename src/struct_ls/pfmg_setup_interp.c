@@ -91,6 +91,31 @@ hypre_PFMGSetupInterpOp( hypre_StructMatrix *A,
                          hypre_Index         stride,
                          hypre_StructMatrix *P,
                          HYPRE_Int           rap_type )
+{
+   hypre_PFMGComputeInterpOp(A, cdir, findex, stride, P, rap_type);
+
+#if 0
+   hypre_StructMatrixAssemble(P);
+#else
+   hypre_StructInterpAssemble(A, P, 0, cdir, findex, stride);
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGComputeInterpOp
+ * Compute the coefficients of P on its grid boxes without assembling P.  The
+ * boxes of P and A are matched by box number.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGComputeInterpOp( hypre_StructMatrix *A,
+                           HYPRE_Int           cdir,
+                           hypre_Index         findex,
+                           hypre_Index         stride,
+                           hypre_StructMatrix *P,
+                           HYPRE_Int           rap_type )
 {
    hypre_BoxArray        *compute_boxes;
    hypre_Box             *compute_box;
@@ -261,12 +286,6 @@ hypre_PFMGSetupInterpOp( hypre_StructMatrix *A,
       }
    }
 
-#if 0
-   hypre_StructMatrixAssemble(P);
-#else
-   hypre_StructInterpAssemble(A, P, 0, cdir, findex, stride);
-#endif
-
    return hypre_error_flag;
 }
 
@@ -89,23 +89,11 @@ hypre_PFMGCreateRAPOp( hypre_StructMatrix *R,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_PFMGSetupRAPOp
- *
- * Wrapper for 2 and 3d, symmetric and non-symmetric routines to calculate
- * entries in RAP. Incomplete error handling at the moment.
- *
- *   The parameter rap_type controls which lower level routines are
- *   used.
- *      rap_type = 0   Use optimized code for computing Galerkin operators
- *                     for special, common stencil patterns: 5 & 9 pt in
- *                     2d and 7, 19 & 27 in 3d.
- *      rap_type = 1   Use PARFLOW formula for coarse grid operator. Used
- *                     only with 5pt in 2d and 7pt in 3d.
- *      rap_type = 2   General purpose Galerkin code.
+ * Compute the entries of Ac on its grid boxes (see hypre_PFMGSetupRAPOp)
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
+static HYPRE_Int
+hypre_PFMGBuildRAPOp( hypre_StructMatrix *R,
                       hypre_StructMatrix *A,
                       hypre_StructMatrix *P,
                       HYPRE_Int           cdir,
@@ -117,27 +105,6 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
    HYPRE_Int              P_stored_as_transpose = 0;
    hypre_StructStencil   *stencil;
 
-   hypre_StructMatrix    *Ac_tmp;
-
-#if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-   HYPRE_MemoryLocation data_location_A = hypre_StructGridDataLocation(hypre_StructMatrixGrid(A));
-   HYPRE_MemoryLocation data_location_Ac = hypre_StructGridDataLocation(hypre_StructMatrixGrid(Ac));
-   HYPRE_Int constant_coefficient = hypre_StructMatrixConstantCoefficient(Ac);
-   if ( data_location_A != data_location_Ac )
-   {
-      Ac_tmp = hypre_PFMGCreateRAPOp(R, A, P, hypre_StructMatrixGrid(Ac), cdir, rap_type);
-      hypre_StructMatrixSymmetric(Ac_tmp) = hypre_StructMatrixSymmetric(Ac);
-      hypre_StructMatrixConstantCoefficient(Ac_tmp) = hypre_StructMatrixConstantCoefficient(Ac);
-      hypre_StructGridDataLocation(hypre_StructMatrixGrid(Ac)) = data_location_A;
-      HYPRE_StructMatrixInitialize(Ac_tmp);
-   }
-   else
-   {
-      Ac_tmp = Ac;
-   }
-#else
-   Ac_tmp = Ac;
-#endif
    stencil = hypre_StructMatrixStencil(A);
 
    if (rap_type == 0)
@@ -148,14 +115,14 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
             /*--------------------------------------------------------------------
              *    Set lower triangular (+ diagonal) coefficients
              *--------------------------------------------------------------------*/
-            hypre_PFMG2BuildRAPSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
+            hypre_PFMG2BuildRAPSym(A, P, R, cdir, cindex, cstride, Ac);
 
             /*--------------------------------------------------------------------
-             *    For non-symmetric A, set upper triangular coefficients as well
+             *    For non-symmetric A (Ac), set upper triangular coefficients as well
              *--------------------------------------------------------------------*/
-            if (!hypre_StructMatrixSymmetric(A))
+            if (!hypre_StructMatrixSymmetric(Ac))
             {
-               hypre_PFMG2BuildRAPNoSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
+               hypre_PFMG2BuildRAPNoSym(A, P, R, cdir, cindex, cstride, Ac);
             }
 
             break;
@@ -165,14 +132,14 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
             /*--------------------------------------------------------------------
              *    Set lower triangular (+ diagonal) coefficients
              *--------------------------------------------------------------------*/
-            hypre_PFMG3BuildRAPSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
+            hypre_PFMG3BuildRAPSym(A, P, R, cdir, cindex, cstride, Ac);
 
             /*--------------------------------------------------------------------
-             *    For non-symmetric A, set upper triangular coefficients as well
+             *    For non-symmetric A (Ac), set upper triangular coefficients as well
              *--------------------------------------------------------------------*/
-            if (!hypre_StructMatrixSymmetric(A))
+            if (!hypre_StructMatrixSymmetric(Ac))
             {
-               hypre_PFMG3BuildRAPNoSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
+               hypre_PFMG3BuildRAPNoSym(A, P, R, cdir, cindex, cstride, Ac);
             }
 
             break;
@@ -184,11 +151,11 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
       switch (hypre_StructStencilNDim(stencil))
       {
          case 2:
-            hypre_PFMGBuildCoarseOp5(A, P, R, cdir, cindex, cstride, Ac_tmp);
+            hypre_PFMGBuildCoarseOp5(A, P, R, cdir, cindex, cstride, Ac);
             break;
 
          case 3:
-            hypre_PFMGBuildCoarseOp7(A, P, R, cdir, cindex, cstride, Ac_tmp);
+            hypre_PFMGBuildCoarseOp7(A, P, R, cdir, cindex, cstride, Ac);
             break;
       }
    }
@@ -196,9 +163,61 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
    else if (rap_type == 2)
    {
       hypre_SemiBuildRAP(A, P, R, cdir, cindex, cstride,
-                         P_stored_as_transpose, Ac_tmp);
+                         P_stored_as_transpose, Ac);
    }
 
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGSetupRAPOp
+ *
+ * Wrapper for 2 and 3d, symmetric and non-symmetric routines to calculate
+ * entries in RAP. Incomplete error handling at the moment.
+ *
+ *   The parameter rap_type controls which lower level routines are
+ *   used.
+ *      rap_type = 0   Use optimized code for computing Galerkin operators
+ *                     for special, common stencil patterns: 5 & 9 pt in
+ *                     2d and 7, 19 & 27 in 3d.
+ *      rap_type = 1   Use PARFLOW formula for coarse grid operator. Used
+ *                     only with 5pt in 2d and 7pt in 3d.
+ *      rap_type = 2   General purpose Galerkin code.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
+                      hypre_StructMatrix *A,
+                      hypre_StructMatrix *P,
+                      HYPRE_Int           cdir,
+                      hypre_Index         cindex,
+                      hypre_Index         cstride,
+                      HYPRE_Int           rap_type,
+                      hypre_StructMatrix *Ac      )
+{
+   hypre_StructMatrix    *Ac_tmp;
+
+#if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   HYPRE_MemoryLocation data_location_A = hypre_StructGridDataLocation(hypre_StructMatrixGrid(A));
+   HYPRE_MemoryLocation data_location_Ac = hypre_StructGridDataLocation(hypre_StructMatrixGrid(Ac));
+   HYPRE_Int constant_coefficient = hypre_StructMatrixConstantCoefficient(Ac);
+   if ( data_location_A != data_location_Ac )
+   {
+      Ac_tmp = hypre_PFMGCreateRAPOp(R, A, P, hypre_StructMatrixGrid(Ac), cdir, rap_type);
+      hypre_StructMatrixSymmetric(Ac_tmp) = hypre_StructMatrixSymmetric(Ac);
+      hypre_StructMatrixConstantCoefficient(Ac_tmp) = hypre_StructMatrixConstantCoefficient(Ac);
+      hypre_StructGridDataLocation(hypre_StructMatrixGrid(Ac)) = data_location_A;
+      HYPRE_StructMatrixInitialize(Ac_tmp);
+   }
+   else
+   {
+      Ac_tmp = Ac;
+   }
+#else
+   Ac_tmp = Ac;
+#endif
+   hypre_PFMGBuildRAPOp(R, A, P, cdir, cindex, cstride, rap_type, Ac_tmp);
+
    hypre_StructMatrixAssemble(Ac_tmp);
 
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -238,3 +257,72 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PFMGSetupRAPOpMatrixFree
+ *
+ * Set up P and the coarse operator Ac for a matrix-free A.  The coefficients
+ * of A are evaluated one slab of planes at a time (see
+ * hypre_StructMatrixCreateSlab) and each slab is freed once it has been used,
+ * so that A is never stored.  The slabs are cut across a dimension other than
+ * cdir, since P and RAP only couple the rows of A in direction cdir.  The
+ * coarse operator uses the values of P across the slab sides, so P is
+ * assembled first and A is evaluated twice.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetupRAPOpMatrixFree( hypre_StructMatrix *R,
+                                hypre_StructMatrix *A,
+                                hypre_StructMatrix *P,
+                                HYPRE_Int           cdir,
+                                hypre_Index         cindex,
+                                hypre_Index         findex,
+                                hypre_Index         cstride,
+                                HYPRE_Int           rap_type,
+                                hypre_StructMatrix *Ac      )
+{
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   hypre_Box             *bbox = hypre_StructGridBoundingBox(hypre_StructMatrixGrid(A));
+
+   hypre_StructMatrix    *A_s;
+   hypre_StructMatrix    *P_s;
+   hypre_StructMatrix    *Ac_s;
+   HYPRE_Int              sd, nplanes, lo, hi, k;
+
+   sd = (cdir == ndim - 1) ? ndim - 2 : ndim - 1;
+   if (sd < 0)
+   {
+      /* one-dimensional: use a single slab */
+      sd = 0;
+      nplanes = hypre_max(hypre_BoxSizeD(bbox, sd), 1);
+   }
+   else
+   {
+      nplanes = hypre_StructMatrixCoeffSlabSize(A, sd);
+   }
+   lo = hypre_BoxIMinD(bbox, sd);
+   hi = hypre_BoxIMaxD(bbox, sd);
+
+   /* interpolation */
+   for (k = lo; k <= hi; k += nplanes)
+   {
+      A_s = hypre_StructMatrixCreateSlab(A, sd, k, k + nplanes - 1);
+      P_s = hypre_StructMatrixCreateSlabView(P, sd, k, k + nplanes - 1);
+      hypre_PFMGComputeInterpOp(A_s, cdir, findex, cstride, P_s, rap_type);
+      hypre_StructMatrixDestroy(P_s);
+      hypre_StructMatrixDestroy(A_s);
+   }
+   hypre_StructInterpAssemble(A, P, 0, cdir, findex, cstride);
+
+   /* coarse grid operator */
+   for (k = lo; k <= hi; k += nplanes)
+   {
+      A_s  = hypre_StructMatrixCreateSlab(A, sd, k, k + nplanes - 1);
+      Ac_s = hypre_StructMatrixCreateSlabView(Ac, sd, k, k + nplanes - 1);
+      hypre_PFMGBuildRAPOp(R, A_s, P, cdir, cindex, cstride, rap_type, Ac_s);
+      hypre_StructMatrixDestroy(Ac_s);
+      hypre_StructMatrixDestroy(A_s);
+   }
+   hypre_StructMatrixAssemble(Ac);
+
+   return hypre_error_flag;
+}
@@ -57,12 +57,14 @@ hypre_PFMGSolve( void               *pfmg_vdata,
    HYPRE_Real           *norms           = (pfmg_data -> norms);
    HYPRE_Real           *rel_norms       = (pfmg_data -> rel_norms);
    HYPRE_Int            *active_l        = (pfmg_data -> active_l);
+   HYPRE_Int             fuse_transfer   = (pfmg_data -> fuse_transfer);
 
    HYPRE_Real            b_dot_b = 0, r_dot_r, eps = 0;
    HYPRE_Real            e_dot_e = 0.0, x_dot_x = 1.0;
 
    HYPRE_Int             i, l;
    HYPRE_Int             constant_coefficient;
+   HYPRE_Int             fuse_residual, fuse_interp;
 
 #if DEBUG
    char                  filename[255];
@@ -76,6 +78,12 @@ hypre_PFMGSolve( void               *pfmg_vdata,
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
 
+   /* On the finest grid, the full residual is needed for the convergence check
+    * and the full error is needed for the relative change check, so the fused
+    * transfer kernels can only be used there when these are turned off */
+   fuse_residual = (fuse_transfer && !(tol > 0.0));
+   fuse_interp   = (fuse_transfer && !((tol > 0.0) && rel_change));
+
    hypre_StructMatrixDestroy(A_l[0]);
    hypre_StructVectorDestroy(b_l[0]);
    hypre_StructVectorDestroy(x_l[0]);
@@ -150,9 +158,12 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       zero_guess = 0;
 
       /* compute fine grid residual (b - Ax) */
-      hypre_StructCopy(b_l[0], r_l[0]);
-      hypre_StructMatvecCompute(matvec_data_l[0],
-                                -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      if (!(fuse_residual && (num_levels > 1)))
+      {
+         hypre_StructCopy(b_l[0], r_l[0]);
+         hypre_StructMatvecCompute(matvec_data_l[0],
+                                   -1.0, A_l[0], x_l[0], 1.0, r_l[0]);
+      }
 
       /* convergence check */
       if (tol > 0.0)
@@ -186,7 +197,15 @@ hypre_PFMGSolve( void               *pfmg_vdata,
       if (num_levels > 1)
       {
          /* restrict fine grid residual */
-         hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         if (fuse_residual)
+         {
+            hypre_SemiResidualRestrict(restrict_data_l[0], A_l[0], x_l[0], b_l[0],
+                                       RT_l[0], r_l[0], b_l[1]);
+         }
+         else
+         {
+            hypre_SemiRestrict(restrict_data_l[0], RT_l[0], r_l[0], b_l[1]);
+         }
 #if DEBUG
          hypre_sprintf(filename, "zout_xdown.%02d", 0);
          hypre_StructVectorPrint(filename, x_l[0], 0);
@@ -220,20 +239,29 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_PFMGRelaxSetZeroGuess(relax_data_l[l], 1);
                hypre_PFMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
-               /* compute residual (b - Ax) */
-               hypre_StructCopy(b_l[l], r_l[l]);
-               hypre_StructMatvecCompute(matvec_data_l[l],
-                                         -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+               /* compute and restrict residual (b - Ax) */
+               if (fuse_transfer)
+               {
+                  hypre_SemiResidualRestrict(restrict_data_l[l], A_l[l], x_l[l], b_l[l],
+                                             RT_l[l], r_l[l], b_l[l + 1]);
+               }
+               else
+               {
+                  hypre_StructCopy(b_l[l], r_l[l]);
+                  hypre_StructMatvecCompute(matvec_data_l[l],
+                                            -1.0, A_l[l], x_l[l], 1.0, r_l[l]);
+                  hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l + 1]);
+               }
             }
             else
             {
                /* inactive level, set x=0, so r=(b-Ax)=b */
                hypre_StructVectorSetConstantValues(x_l[l], 0.0);
                hypre_StructCopy(b_l[l], r_l[l]);
-            }
 
-            /* restrict residual */
-            hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l + 1]);
+               /* restrict residual */
+               hypre_SemiRestrict(restrict_data_l[l], RT_l[l], r_l[l], b_l[l + 1]);
+            }
 #if DEBUG
             hypre_printf("Level %d: b_l = %.30e\n", l + 1, hypre_StructInnerProd(b_l[l + 1], b_l[l + 1]));
             hypre_sprintf(filename, "zout_xdown.%02d", l);
@@ -284,8 +312,15 @@ hypre_PFMGSolve( void               *pfmg_vdata,
                hypre_StructVectorClearAllValues(e_l[l]);
             }
             /* interpolate error and correct (x = x + Pe_c) */
-            hypre_SemiInterp(interp_data_l[l], P_l[l], x_l[l + 1], e_l[l]);
-            hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            if (fuse_transfer)
+            {
+               hypre_SemiInterpCorrect(interp_data_l[l], P_l[l], x_l[l + 1], e_l[l], x_l[l]);
+            }
+            else
+            {
+               hypre_SemiInterp(interp_data_l[l], P_l[l], x_l[l + 1], e_l[l]);
+               hypre_StructAxpy(1.0, e_l[l], x_l[l]);
+            }
             HYPRE_ANNOTATE_MGLEVEL_END(l + 1);
 #if DEBUG
             hypre_sprintf(filename, "zout_eup.%02d", l);
@@ -316,8 +351,15 @@ hypre_PFMGSolve( void               *pfmg_vdata,
             hypre_StructVectorClearAllValues(e_l[0]);
          }
          /* interpolate error and correct on fine grid (x = x + Pe_c) */
-         hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
-         hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         if (fuse_interp)
+         {
+            hypre_SemiInterpCorrect(interp_data_l[0], P_l[0], x_l[1], e_l[0], x_l[0]);
+         }
+         else
+         {
+            hypre_SemiInterp(interp_data_l[0], P_l[0], x_l[1], e_l[0]);
+            hypre_StructAxpy(1.0, e_l[0], x_l[0]);
+         }
          HYPRE_ANNOTATE_MGLEVEL_END(1);
 #if DEBUG
          hypre_printf("Level 0: x_l = %.15e\n", hypre_StructInnerProd(x_l[0], x_l[0]));
@@ -395,6 +395,14 @@ hypre_PointRelax( void               *relax_vdata,
       bsumsq = hypre_StructInnerProd( b, b );
    }
 
+   /* the zero_guess iteration needs the diagonal, which is not stored
+    * for matrix-free matrices, so do a regular iteration instead */
+   if (zero_guess && hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_StructVectorSetConstantValues(x, 0.0);
+      zero_guess = 0;
+   }
+
    /*----------------------------------------------------------
     * Do zero_guess iteration
     *----------------------------------------------------------*/
@@ -568,6 +576,15 @@ hypre_PointRelax( void               *relax_vdata,
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
+               if (hypre_StructMatrixCoeffFcn(A))
+               {
+                  hypre_PointRelax_coreMF(
+                     relax_vdata, A, compute_box, bp, xp, tp,
+                     b_data_box, x_data_box, t_data_box, stride
+                  );
+                  continue;
+               }
+
                if ( constant_coefficient == 1 || constant_coefficient == 2 )
                {
                   hypre_PointRelax_core12(
@@ -908,6 +925,113 @@ hypre_PointRelax_core0( void               *relax_vdata,
 }
 
 
+/* for matrix-free matrices, the coefficients are computed a few planes at a
+ * time, and the result is divided by the diagonal ...*/
+HYPRE_Int
+hypre_PointRelax_coreMF( void               *relax_vdata,
+                         hypre_StructMatrix *A,
+                         hypre_Box          *compute_box,
+                         HYPRE_Real         *bp,
+                         HYPRE_Real         *xp,
+                         HYPRE_Real         *tp,
+                         hypre_Box          *b_data_box,
+                         hypre_Box          *x_data_box,
+                         hypre_Box          *t_data_box,
+                         hypre_IndexRef      stride
+                       )
+{
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free relaxation is not supported on GPUs");
+#else
+   hypre_PointRelaxData  *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   HYPRE_Int              ndim             = hypre_StructMatrixNDim(A);
+   HYPRE_Int              diag_rank        = (relax_data -> diag_rank);
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+   HYPRE_Int             *xoff;
+
+   hypre_Box             *slab_box;
+   hypre_Box             *v_data_box;
+   HYPRE_Real            *vp;
+   hypre_Index            v_start;
+   hypre_Index            v_stride;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   HYPRE_Int              nplanes, kmax, k, s;
+
+   if (hypre_BoxVolume(compute_box) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   for (s = 0; s < stencil_size; s++)
+   {
+      xoff[s] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[s]);
+   }
+
+   nplanes  = hypre_StructMatrixCoeffNumPlanes(A, compute_box, stride);
+   kmax     = hypre_BoxIMaxD(compute_box, ndim - 1);
+   slab_box = hypre_BoxDuplicate(compute_box);
+   hypre_BoxIMaxD(slab_box, ndim - 1) = hypre_BoxIMinD(slab_box, ndim - 1) + nplanes - 1;
+   vp = hypre_TAlloc(HYPRE_Real, stencil_size * hypre_BoxVolume(slab_box), HYPRE_MEMORY_HOST);
+   v_data_box = hypre_BoxCreate(ndim);
+   hypre_CopyIndex(stride, v_stride);
+   hypre_IndexD(v_stride, 0) *= stencil_size;
+
+   for (k = hypre_BoxIMinD(compute_box, ndim - 1); k <= kmax; k += nplanes)
+   {
+      hypre_BoxIMinD(slab_box, ndim - 1) = k;
+      hypre_BoxIMaxD(slab_box, ndim - 1) = hypre_min(k + nplanes - 1, kmax);
+      hypre_StructMatrixComputeCoeffs(A, slab_box, vp);
+
+      /* view the coefficients as a box stencil_size times wider */
+      hypre_CopyBox(slab_box, v_data_box);
+      hypre_BoxIMinD(v_data_box, 0) *= stencil_size;
+      hypre_BoxIMaxD(v_data_box, 0) *= stencil_size;
+      hypre_BoxIMaxD(v_data_box, 0) += stencil_size - 1;
+
+      start = hypre_BoxIMin(slab_box);
+      hypre_BoxGetStrideSize(slab_box, stride, loop_size);
+      hypre_CopyIndex(start, v_start);
+      hypre_IndexD(v_start, 0) *= stencil_size;
+      hypre_BoxLoop4Begin(ndim, loop_size,
+                          v_data_box, v_start, v_stride, vi,
+                          b_data_box, start, stride, bi,
+                          x_data_box, start, stride, xi,
+                          t_data_box, start, stride, ti);
+      {
+         HYPRE_Int   ss;
+         HYPRE_Real  sum = bp[bi];
+
+         for (ss = 0; ss < stencil_size; ss++)
+         {
+            if (ss != diag_rank)
+            {
+               sum -= vp[vi + ss] * xp[xi + xoff[ss]];
+            }
+         }
+         tp[ti] = sum / vp[vi + diag_rank];
+      }
+      hypre_BoxLoop4End(vi, bi, xi, ti);
+   }
+
+   hypre_TFree(vp, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(slab_box);
+   hypre_BoxDestroy(v_data_box);
+#endif
+
+   return hypre_error_flag;
+}
+
+
 /* for constant_coefficient==1 or 2, all offdiagonal coefficients constant over space ...*/
 HYPRE_Int
 hypre_PointRelax_core12( void               *relax_vdata,
@@ -44,7 +44,7 @@ hypre_RedBlackConstantCoefGS( void               *relax_vdata,
    HYPRE_Int              Ai, Astart, Ani, Anj;
    HYPRE_Int              bstart, bni, bnj;
    HYPRE_Int              xstart, xni, xnj;
-   HYPRE_Int              xoff0, xoff1, xoff2, xoff3, xoff4, xoff5;
+   HYPRE_Int              xoff0 = 0, xoff1 = 0, xoff2 = 0, xoff3 = 0, xoff4 = 0, xoff5 = 0;
 
    HYPRE_Real            *Ap;
    HYPRE_Real            *App;
@@ -53,7 +53,8 @@ hypre_RedBlackConstantCoefGS( void               *relax_vdata,
 
    /* constant coefficient */
    HYPRE_Int              constant_coeff = hypre_StructMatrixConstantCoefficient(A);
-   HYPRE_Real             App0, App1, App2, App3, App4, App5, AApd;
+   HYPRE_Real             App0 = 0.0, App1 = 0.0, App2 = 0.0, App3 = 0.0, App4 = 0.0, App5 = 0.0;
+   HYPRE_Real             AApd;
 
    hypre_IndexRef         start;
    hypre_Index            loop_size;
@@ -67,12 +68,22 @@ hypre_RedBlackConstantCoefGS( void               *relax_vdata,
    HYPRE_Int              compute_i, i, j;
    HYPRE_Int              ni, nj, nk;
 
+   HYPRE_Real            *cp;
+   hypre_Index            coffset;
+   HYPRE_Int              cni, cnj, csize;
+
    /*----------------------------------------------------------
     * Initialize some things and deal with special cases
     *----------------------------------------------------------*/
 
    hypre_BeginTiming(relax_data -> time_index);
 
+   /* the color layout is only valid for the matrix passed to setup */
+   if (A != (relax_data -> A))
+   {
+      hypre_RedBlackGSDestroyColors(relax_data);
+   }
+
    hypre_StructMatrixDestroy(relax_data -> A);
    hypre_StructVectorDestroy(relax_data -> b);
    hypre_StructVectorDestroy(relax_data -> x);
@@ -203,6 +214,25 @@ hypre_RedBlackConstantCoefGS( void               *relax_vdata,
 #undef DEVICE_VAR
                }
 
+#ifdef HYPRE_REDBLACK_COLOR_LAYOUT
+               else if (relax_data -> color_data)
+               {
+                  hypre_RedBlackGSColorBox(relax_data, i, start, rb,
+                                           &cp, coffset, &cni, &cnj, &csize);
+
+                  hypre_RedBlackLoopInit();
+                  hypre_RedBlackColorLoopBegin(ni, nj, nk, redblack,
+                                               coffset[0], coffset[1], coffset[2],
+                                               cni, cnj, ci,
+                                               bstart, bni, bnj, bi,
+                                               xstart, xni, xnj, xi);
+                  {
+                     xp[xi] = bp[bi] / cp[ci];
+                  }
+                  hypre_RedBlackColorLoopEnd();
+               }
+#endif
+
                else      /* variable coefficient diag */
                {
                   Astart = hypre_BoxIndexRank(A_dbox, start);
@@ -400,6 +430,71 @@ hypre_RedBlackConstantCoefGS( void               *relax_vdata,
 
                }  /* if (constant_coeff == 1) */
 
+#ifdef HYPRE_REDBLACK_COLOR_LAYOUT
+               else if (relax_data -> color_data)
+               {
+                  hypre_RedBlackGSColorBox(relax_data, i, start, rb,
+                                           &cp, coffset, &cni, &cnj, &csize);
+
+                  switch (stencil_size)
+                  {
+                     case 7:
+                        hypre_RedBlackLoopInit();
+                        hypre_RedBlackColorLoopBegin(ni, nj, nk, redblack,
+                                                     coffset[0], coffset[1], coffset[2],
+                                                     cni, cnj, ci,
+                                                     bstart, bni, bnj, bi,
+                                                     xstart, xni, xnj, xi);
+                        {
+                           xp[xi] =
+                              (bp[bi] -
+                               App0 * xp[xi + xoff0] -
+                               App1 * xp[xi + xoff1] -
+                               App2 * xp[xi + xoff2] -
+                               App3 * xp[xi + xoff3] -
+                               App4 * xp[xi + xoff4] -
+                               App5 * xp[xi + xoff5]) / cp[ci];
+                        }
+                        hypre_RedBlackColorLoopEnd();
+                        break;
+
+                     case 5:
+                        hypre_RedBlackLoopInit();
+                        hypre_RedBlackColorLoopBegin(ni, nj, nk, redblack,
+                                                     coffset[0], coffset[1], coffset[2],
+                                                     cni, cnj, ci,
+                                                     bstart, bni, bnj, bi,
+                                                     xstart, xni, xnj, xi);
+                        {
+                           xp[xi] =
+                              (bp[bi] -
+                               App0 * xp[xi + xoff0] -
+                               App1 * xp[xi + xoff1] -
+                               App2 * xp[xi + xoff2] -
+                               App3 * xp[xi + xoff3]) / cp[ci];
+                        }
+                        hypre_RedBlackColorLoopEnd();
+                        break;
+
+                     case 3:
+                        hypre_RedBlackLoopInit();
+                        hypre_RedBlackColorLoopBegin(ni, nj, nk, redblack,
+                                                     coffset[0], coffset[1], coffset[2],
+                                                     cni, cnj, ci,
+                                                     bstart, bni, bnj, bi,
+                                                     xstart, xni, xnj, xi);
+                        {
+                           xp[xi] =
+                              (bp[bi] -
+                               App0 * xp[xi + xoff0] -
+                               App1 * xp[xi + xoff1]) / cp[ci];
+                        }
+                        hypre_RedBlackColorLoopEnd();
+                        break;
+                  }
+               }
+#endif
+
                else /* variable diagonal */
                {
                   Astart = hypre_BoxIndexRank(A_dbox, start);
@@ -39,6 +39,9 @@ hypre_RedBlackGSCreate( MPI_Comm  comm )
    (relax_data -> b)           = NULL;
    (relax_data -> x)           = NULL;
    (relax_data -> compute_pkg) = NULL;
+   (relax_data -> color_nvar)  = 0;
+   (relax_data -> color_data)  = NULL;
+   (relax_data -> color_layout) = 0;
 
    return (void *) relax_data;
 }
@@ -53,6 +56,7 @@ hypre_RedBlackGSDestroy( void *relax_vdata )
 
    if (relax_data)
    {
+      hypre_RedBlackGSDestroyColors(relax_data);
       hypre_StructMatrixDestroy(relax_data -> A);
       hypre_StructVectorDestroy(relax_data -> b);
       hypre_StructVectorDestroy(relax_data -> x);
@@ -65,6 +69,177 @@ hypre_RedBlackGSDestroy( void *relax_vdata )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackGSSetupColors
+ *
+ * Copy the variable coefficients of A into a layout where the points of each
+ * color are stored contiguously, so that the coefficient loads in a half
+ * sweep have unit stride instead of stride two.  For grid box i, the values
+ * of variable coefficient e at the points of color c (points whose index sum
+ * has parity c) are stored in
+ *
+ *    color_data[i][(c*nvar + e)*csize + (k*cnj + j)*cni + ii/2]
+ *
+ * where (ii,j,k) is the point relative to the grid box, cni = (ni+1)/2, and
+ * csize = cni*nj*nk.  The rows are padded with zeros to length cni.  For
+ * constant_coefficient = 0 all stencil entries are stored (in stencil order),
+ * for constant_coefficient = 2 only the diagonal, and for
+ * constant_coefficient = 1 nothing is stored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSetupColors( void               *relax_vdata,
+                             hypre_StructMatrix *A )
+{
+   hypre_RedBlackGSData  *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   HYPRE_Int              diag_rank = (relax_data -> diag_rank);
+   HYPRE_Int              ndim      = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coefficient;
+
+   hypre_BoxArray        *grid_boxes;
+   hypre_Box             *grid_box;
+   hypre_Box             *A_dbox;
+   hypre_StructStencil   *stencil;
+   HYPRE_Int              stencil_size;
+
+   HYPRE_Real           **color_data;
+   HYPRE_Real            *cp;
+   HYPRE_Real            *Ap;
+   HYPRE_Int              nvar, csize, cni, ni, nj, nk, Ani, Anj;
+   HYPRE_Int              Astart, par, ii, i, c, e, d, j, k, h;
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   stencil      = hypre_StructMatrixStencil(A);
+   stencil_size = hypre_StructStencilSize(stencil);
+
+   if (constant_coefficient == 1)
+   {
+      return hypre_error_flag;
+   }
+   nvar = (constant_coefficient == 2) ? 1 : stencil_size;
+
+   grid_boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   color_data = hypre_CTAlloc(HYPRE_Real *, hypre_BoxArraySize(grid_boxes),
+                              HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      grid_box = hypre_BoxArrayBox(grid_boxes, i);
+      A_dbox   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+
+      ni  = hypre_BoxSizeX(grid_box);
+      nj  = (ndim > 1) ? hypre_BoxSizeY(grid_box) : 1;
+      nk  = (ndim > 2) ? hypre_BoxSizeZ(grid_box) : 1;
+      Ani = hypre_BoxSizeX(A_dbox);
+      Anj = hypre_BoxSizeY(A_dbox);
+      cni = (ni + 1) / 2;
+      csize = cni * nj * nk;
+
+      Astart = hypre_BoxIndexRank(A_dbox, hypre_BoxIMin(grid_box));
+      par = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         par += hypre_BoxIMinD(grid_box, d);
+      }
+
+      color_data[i] = hypre_CTAlloc(HYPRE_Real, 2 * nvar * csize, HYPRE_MEMORY_HOST);
+      for (c = 0; c < 2; c++)
+      {
+         for (e = 0; e < nvar; e++)
+         {
+            Ap = hypre_StructMatrixBoxData(A, i, (nvar == 1) ? diag_rank : e);
+            cp = color_data[i] + (c * nvar + e) * csize;
+            for (k = 0; k < nk; k++)
+            {
+               for (j = 0; j < nj; j++)
+               {
+                  /* first point of color c in this row */
+                  ii = hypre_abs(c + par + j + k) % 2;
+                  for (h = ii / 2; ii < ni; h++, ii += 2)
+                  {
+                     cp[(k * nj + j) * cni + h] = Ap[Astart + k * Anj * Ani + j * Ani + ii];
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   (relax_data -> color_nvar) = nvar;
+   (relax_data -> color_data) = color_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSDestroyColors( void *relax_vdata )
+{
+   hypre_RedBlackGSData  *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+   HYPRE_Real           **color_data = (relax_data -> color_data);
+   HYPRE_Int              i;
+
+   if (color_data)
+   {
+      hypre_ForBoxI(i, hypre_StructGridBoxes(hypre_StructMatrixGrid(relax_data -> A)))
+      {
+         hypre_TFree(color_data[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(color_data, HYPRE_MEMORY_HOST);
+      (relax_data -> color_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackGSColorBox
+ *
+ * Get the color layout data of the given color for grid box i, along with
+ * the offset of the loop box starting at index start in the grid box.  The
+ * data for variable coefficient e starts at (*cp_ptr) + e*(*csize_ptr).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSColorBox( void           *relax_vdata,
+                          HYPRE_Int       i,
+                          hypre_IndexRef  start,
+                          HYPRE_Int       color,
+                          HYPRE_Real    **cp_ptr,
+                          hypre_Index     coffset,
+                          HYPRE_Int      *cni_ptr,
+                          HYPRE_Int      *cnj_ptr,
+                          HYPRE_Int      *csize_ptr )
+{
+   hypre_RedBlackGSData  *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+   hypre_StructMatrix    *A          = (relax_data -> A);
+   HYPRE_Int              ndim       = hypre_StructMatrixNDim(A);
+   hypre_Box             *grid_box;
+   HYPRE_Int              cni, cnj, cnk, d;
+
+   grid_box = hypre_BoxArrayBox(hypre_StructGridBoxes(hypre_StructMatrixGrid(A)), i);
+
+   cni = (hypre_BoxSizeX(grid_box) + 1) / 2;
+   cnj = (ndim > 1) ? hypre_BoxSizeY(grid_box) : 1;
+   cnk = (ndim > 2) ? hypre_BoxSizeZ(grid_box) : 1;
+
+   hypre_SetIndex3(coffset, 0, 0, 0);
+   for (d = 0; d < ndim; d++)
+   {
+      hypre_IndexD(coffset, d) = hypre_IndexD(start, d) - hypre_BoxIMinD(grid_box, d);
+   }
+
+   *cp_ptr    = (relax_data -> color_data)[i] + color * (relax_data -> color_nvar) * cni * cnj * cnk;
+   *cni_ptr   = cni;
+   *cnj_ptr   = cnj;
+   *csize_ptr = cni * cnj * cnk;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -84,6 +259,12 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    hypre_Index            diag_index;
    hypre_ComputeInfo     *compute_info;
 
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Red/black Gauss-Seidel does not support matrix-free matrices");
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------------------------
     * Find the matrix diagonal
     *----------------------------------------------------------*/
@@ -106,12 +287,18 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
     * Set up the relax data structure
     *----------------------------------------------------------*/
 
+   hypre_RedBlackGSDestroyColors(relax_data);
    (relax_data -> A) = hypre_StructMatrixRef(A);
    (relax_data -> x) = hypre_StructVectorRef(x);
    (relax_data -> b) = hypre_StructVectorRef(b);
    (relax_data -> diag_rank) = diag_rank;
    (relax_data -> compute_pkg) = compute_pkg;
 
+   if (relax_data -> color_layout)
+   {
+      hypre_RedBlackGSSetupColors(relax_data, A);
+   }
+
    return hypre_error_flag;
 }
 
@@ -165,12 +352,22 @@ hypre_RedBlackGS( void               *relax_vdata,
    HYPRE_Int              compute_i, i, j;
    HYPRE_Int              ni, nj, nk;
 
+   HYPRE_Real            *cp;
+   hypre_Index            coffset;
+   HYPRE_Int              cni, cnj, csize;
+
    /*----------------------------------------------------------
     * Initialize some things and deal with special cases
     *----------------------------------------------------------*/
 
    hypre_BeginTiming(relax_data -> time_index);
 
+   /* the color layout is only valid for the matrix passed to setup */
+   if (A != (relax_data -> A))
+   {
+      hypre_RedBlackGSDestroyColors(relax_data);
+   }
+
    hypre_StructMatrixDestroy(relax_data -> A);
    hypre_StructVectorDestroy(relax_data -> b);
    hypre_StructVectorDestroy(relax_data -> x);
@@ -284,6 +481,28 @@ hypre_RedBlackGS( void               *relax_vdata,
                   }
                }
 
+#ifdef HYPRE_REDBLACK_COLOR_LAYOUT
+               if (relax_data -> color_data)
+               {
+                  hypre_RedBlackGSColorBox(relax_data, i, start, rb,
+                                           &cp, coffset, &cni, &cnj, &csize);
+                  Ap = cp + diag_rank * csize;
+
+                  hypre_RedBlackLoopInit();
+                  hypre_RedBlackColorLoopBegin(ni, nj, nk, redblack,
+                                               coffset[0], coffset[1], coffset[2],
+                                               cni, cnj, Ai,
+                                               bstart, bni, bnj, bi,
+                                               xstart, xni, xnj, xi);
+                  {
+                     xp[xi] = bp[bi] / Ap[Ai];
+                  }
+                  hypre_RedBlackColorLoopEnd();
+
+                  continue;
+               }
+#endif
+
                hypre_RedBlackLoopInit();
 #define DEVICE_VAR is_device_ptr(xp,bp,Ap)
                hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
@@ -405,6 +624,92 @@ hypre_RedBlackGS( void               *relax_vdata,
                      break;
                }
 
+#ifdef HYPRE_REDBLACK_COLOR_LAYOUT
+               if (relax_data -> color_data)
+               {
+                  hypre_RedBlackGSColorBox(relax_data, i, start, rb,
+                                           &cp, coffset, &cni, &cnj, &csize);
+                  Ap = cp + diag_rank * csize;
+
+                  switch (stencil_size)
+                  {
+                     case 7:
+                        Ap5 = cp + offd[5] * csize;
+                        Ap4 = cp + offd[4] * csize;
+                     /* fall through */
+
+                     case 5:
+                        Ap3 = cp + offd[3] * csize;
+                        Ap2 = cp + offd[2] * csize;
+                     /* fall through */
+
+                     case 3:
+                        Ap1 = cp + offd[1] * csize;
+                        Ap0 = cp + offd[0] * csize;
+                        break;
+                  }
+
+                  switch (stencil_size)
+                  {
+                     case 7:
+                        hypre_RedBlackLoopInit();
+                        hypre_RedBlackColorLoopBegin(ni, nj, nk, redblack,
+                                                     coffset[0], coffset[1], coffset[2],
+                                                     cni, cnj, Ai,
+                                                     bstart, bni, bnj, bi,
+                                                     xstart, xni, xnj, xi);
+                        {
+                           xp[xi] =
+                              (bp[bi] -
+                               Ap0[Ai] * xp[xi + xoff0] -
+                               Ap1[Ai] * xp[xi + xoff1] -
+                               Ap2[Ai] * xp[xi + xoff2] -
+                               Ap3[Ai] * xp[xi + xoff3] -
+                               Ap4[Ai] * xp[xi + xoff4] -
+                               Ap5[Ai] * xp[xi + xoff5]) / Ap[Ai];
+                        }
+                        hypre_RedBlackColorLoopEnd();
+                        break;
+
+                     case 5:
+                        hypre_RedBlackLoopInit();
+                        hypre_RedBlackColorLoopBegin(ni, nj, nk, redblack,
+                                                     coffset[0], coffset[1], coffset[2],
+                                                     cni, cnj, Ai,
+                                                     bstart, bni, bnj, bi,
+                                                     xstart, xni, xnj, xi);
+                        {
+                           xp[xi] =
+                              (bp[bi] -
+                               Ap0[Ai] * xp[xi + xoff0] -
+                               Ap1[Ai] * xp[xi + xoff1] -
+                               Ap2[Ai] * xp[xi + xoff2] -
+                               Ap3[Ai] * xp[xi + xoff3]) / Ap[Ai];
+                        }
+                        hypre_RedBlackColorLoopEnd();
+                        break;
+
+                     case 3:
+                        hypre_RedBlackLoopInit();
+                        hypre_RedBlackColorLoopBegin(ni, nj, nk, redblack,
+                                                     coffset[0], coffset[1], coffset[2],
+                                                     cni, cnj, Ai,
+                                                     bstart, bni, bnj, bi,
+                                                     xstart, xni, xnj, xi);
+                        {
+                           xp[xi] =
+                              (bp[bi] -
+                               Ap0[Ai] * xp[xi + xoff0] -
+                               Ap1[Ai] * xp[xi + xoff1]) / Ap[Ai];
+                        }
+                        hypre_RedBlackColorLoopEnd();
+                        break;
+                  }
+
+                  continue;
+               }
+#endif
+
                switch (stencil_size)
                {
                   case 7:
@@ -553,3 +858,34 @@ hypre_RedBlackGSSetStartBlack( void *relax_vdata )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Store the variable coefficients of A by color (see
+ * hypre_RedBlackGSSetupColors).  This takes an extra copy of the variable
+ * coefficients, so it is off by default, and turning it off frees the copy.
+ * The option is ignored where the color loops are not available.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSetColorLayout( void      *relax_vdata,
+                                HYPRE_Int  color_layout )
+{
+   hypre_RedBlackGSData *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+#ifdef HYPRE_REDBLACK_COLOR_LAYOUT
+   (relax_data -> color_layout) = (color_layout != 0);
+#else
+   (relax_data -> color_layout) = 0;
+#endif
+
+   if (!(relax_data -> color_layout))
+   {
+      hypre_RedBlackGSDestroyColors(relax_data);
+   }
+   else if ((relax_data -> A) && !(relax_data -> color_data))
+   {
+      hypre_RedBlackGSSetupColors(relax_data, (relax_data -> A));
+   }
+
+   return hypre_error_flag;
+}
+
@@ -27,6 +27,11 @@ typedef struct
 
    hypre_ComputePkg       *compute_pkg;
 
+   /* variable coefficients of A stored by color (see hypre_RedBlackGSSetupColors) */
+   HYPRE_Int               color_layout;
+   HYPRE_Int               color_nvar;         /* number of variable coeffs */
+   HYPRE_Real            **color_data;         /* color_data[box] */
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
@@ -410,4 +415,37 @@ typedef struct
       }\
    }\
 }
+
+/* Same as hypre_RedBlackLoopBegin, but with the coefficients of A taken from
+ * the color layout.  The index ci has unit stride and is relative to the grid
+ * box, with (oi,oj,ok) the offset of the loop box in the grid box, cni the
+ * number of points of one color in a grid box row, and cnj the number of grid
+ * box rows in a plane.  HYPRE_REDBLACK_COLOR_LAYOUT only says that the color
+ * loops are available; the layout is turned on with
+ * hypre_RedBlackGSSetColorLayout. */
+#define HYPRE_REDBLACK_COLOR_LAYOUT 1
+
+#define hypre_RedBlackColorLoopBegin(ni,nj,nk,redblack,   \
+                                     oi,oj,ok,cni,cnj,ci, \
+                                     bstart,bni,bnj,bi,   \
+                                     xstart,xni,xnj,xi)   \
+   OMPRB1 \
+   for (hypre__kk = 0; hypre__kk < nk; hypre__kk++)\
+   {\
+      HYPRE_Int ii,jj,hh,hn,ci,bi,xi;\
+      for (jj = 0; jj < nj; jj++)\
+      {\
+         ii = (hypre__kk + jj + redblack) % 2;\
+         hn = (ni - ii + 1) / 2;\
+         ci = ((ok + hypre__kk)*cnj + oj + jj)*cni + (oi + ii) / 2;\
+         bi = bstart + hypre__kk*bnj*bni + jj*bni + ii;\
+         xi = xstart + hypre__kk*xnj*xni + jj*xni + ii;\
+         for (hh = 0; hh < hn; hh++, ci++, bi+=2, xi+=2)\
+         {
+
+#define hypre_RedBlackColorLoopEnd()\
+         }\
+      }\
+   }\
+}
 #endif
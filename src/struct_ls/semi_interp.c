@@ -16,6 +16,9 @@ typedef struct
    hypre_StructMatrix *P;
    HYPRE_Int           P_stored_as_transpose;
    hypre_ComputePkg   *compute_pkg;
+   hypre_ComputePkg   *correct_compute_pkg;  /* for hypre_SemiInterpCorrect */
+   HYPRE_Int           correct_full;         /* use hypre_SemiInterp instead */
+   HYPRE_Int           cdir;                 /* coarsening direction */
    hypre_Index         cindex;
    hypre_Index         findex;
    hypre_Index         stride;
@@ -340,6 +343,403 @@ hypre_SemiInterp( void               *interp_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SemiInterpCorrectSetup
+ *
+ * Sets up the data used by hypre_SemiInterpCorrect.  This must be called
+ * after hypre_SemiInterpSetup.  Note that this is collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiInterpCorrectSetup( void               *interp_vdata,
+                              hypre_StructVector *xc,
+                              hypre_StructVector *e )
+{
+   hypre_SemiInterpData   *interp_data = (hypre_SemiInterpData   *)interp_vdata;
+
+   hypre_IndexRef          stride = (interp_data -> stride);
+   hypre_StructGrid       *fgrid  = hypre_StructVectorGrid(e);
+   hypre_StructGrid       *cgrid  = hypre_StructVectorGrid(xc);
+   HYPRE_Int              *num_ghost = hypre_StructVectorNumGhost(xc);
+   hypre_Box              *bounding_box = hypre_StructGridBoundingBox(fgrid);
+   hypre_IndexRef          periodic = hypre_StructGridPeriodic(fgrid);
+   HYPRE_Int               ndim   = hypre_StructVectorNDim(e);
+
+   hypre_StructStencil    *stencil;
+   hypre_Index            *stencil_shape;
+   hypre_ComputeInfo      *compute_info;
+   hypre_ComputePkg       *compute_pkg;
+
+   HYPRE_Int               correct_full, local_full, cdir, d;
+
+   /*----------------------------------------------------------
+    * The coarse-grid values next to each F-point are read directly
+    * from xc, so every fine grid box needs a coarse grid box, and xc
+    * needs ghost values in the coarsening direction.  Also, the C-points
+    * and F-points must be well-defined, which is not the case in a
+    * periodic direction whose period is not a multiple of the stride
+    * or is smaller than the extent of the grid.
+    *----------------------------------------------------------*/
+
+   cdir = -1;
+   local_full = 0;
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(stride, d) > 1)
+      {
+         local_full = (cdir > -1) ? 1 : local_full;
+         cdir = d;
+      }
+      if ( hypre_IndexD(periodic, d) &&
+           ( (hypre_IndexD(periodic, d) % hypre_IndexD(stride, d)) ||
+             (hypre_IndexD(periodic, d) < hypre_BoxSizeD(bounding_box, d)) ) )
+      {
+         local_full = 1;
+      }
+   }
+   if ( (cdir < 0) || (hypre_IndexD(stride, cdir) != 2) ||
+        (num_ghost[2 * cdir] < 1) || (num_ghost[2 * cdir + 1] < 1) ||
+        (hypre_BoxArraySize(hypre_StructGridBoxes(fgrid)) !=
+         hypre_BoxArraySize(hypre_StructGridBoxes(cgrid))) )
+   {
+      local_full = 1;
+   }
+   hypre_MPI_Allreduce(&local_full, &correct_full, 1, HYPRE_MPI_INT, hypre_MPI_MAX,
+                       hypre_StructVectorComm(e));
+
+   /*----------------------------------------------------------
+    * Set up the compute package for the exchange of xc
+    *----------------------------------------------------------*/
+
+   compute_pkg = NULL;
+   if (!correct_full)
+   {
+      stencil_shape = hypre_CTAlloc(hypre_Index, 2, HYPRE_MEMORY_HOST);
+      hypre_IndexD(stencil_shape[0], cdir) = -1;
+      hypre_IndexD(stencil_shape[1], cdir) =  1;
+      stencil = hypre_StructStencilCreate(ndim, 2, stencil_shape);
+
+      hypre_CreateComputeInfo(cgrid, stencil, &compute_info);
+      hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(xc), 1,
+                             cgrid, &compute_pkg);
+
+      hypre_StructStencilDestroy(stencil);
+   }
+
+   hypre_ComputePkgDestroy(interp_data -> correct_compute_pkg);
+   (interp_data -> correct_compute_pkg) = compute_pkg;
+   (interp_data -> correct_full)        = correct_full;
+   (interp_data -> cdir)                = cdir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiInterpCorrect
+ *
+ * Computes x = x + P xc.  This fuses hypre_SemiInterp with the subsequent
+ * correction of x, so the fine-grid error e is never formed.  After the ghost
+ * values of xc are exchanged, each C-point and the F-point after it in the
+ * coarsening direction are corrected together, so x is read and written once.
+ *
+ * If hypre_SemiInterpCorrectSetup found that the transfer can not be fused,
+ * e is computed with hypre_SemiInterp and added to x.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiInterpCorrect( void               *interp_vdata,
+                         hypre_StructMatrix *P,
+                         hypre_StructVector *xc,
+                         hypre_StructVector *e,
+                         hypre_StructVector *x            )
+{
+   hypre_SemiInterpData   *interp_data = (hypre_SemiInterpData   *)interp_vdata;
+
+   HYPRE_Int               P_stored_as_transpose;
+   hypre_ComputePkg       *compute_pkg;
+   HYPRE_Int               cdir;
+   hypre_IndexRef          cindex;
+   hypre_IndexRef          findex;
+   hypre_IndexRef          stride;
+
+   hypre_StructGrid       *fgrid;
+   hypre_BoxArray         *fgrid_boxes;
+   HYPRE_Int              *fgrid_ids;
+   hypre_StructGrid       *cgrid;
+   hypre_BoxArray         *cgrid_boxes;
+   HYPRE_Int              *cgrid_ids;
+
+   hypre_CommHandle       *comm_handle;
+
+   hypre_Box              *fgrid_box;
+   hypre_Box              *cgrid_box;
+   hypre_Box              *part_box;
+
+   hypre_Box              *P_dbox;
+   hypre_Box              *xc_dbox;
+   hypre_Box              *x_dbox;
+
+   HYPRE_Int               Pi;
+   HYPRE_Int               constant_coefficient;
+
+   HYPRE_Real             *Pp0, *Pp1;
+   HYPRE_Real             *xcp;
+   HYPRE_Real             *xp;
+
+   hypre_Index             loop_size;
+   hypre_Index             start;
+   hypre_Index             startc;
+   hypre_Index             startp;
+   hypre_Index             stridec;
+   hypre_Index             offset;
+
+   hypre_StructStencil    *stencil;
+   hypre_Index            *stencil_shape;
+
+   HYPRE_Int               Pp1_offset, xcp0_offset, xcp1_offset, xf_offset;
+   HYPRE_Int               fmin, fmax, imin, imax;
+   HYPRE_Int               fi, ci, k;
+
+   /*-----------------------------------------------------------------------
+    * Initialize some things
+    *-----------------------------------------------------------------------*/
+
+   if (interp_data -> correct_full)
+   {
+      hypre_SemiInterp(interp_vdata, P, xc, e);
+      hypre_StructAxpy(1.0, e, x);
+
+      return hypre_error_flag;
+   }
+
+   hypre_BeginTiming(interp_data -> time_index);
+
+   P_stored_as_transpose = (interp_data -> P_stored_as_transpose);
+   compute_pkg   = (interp_data -> correct_compute_pkg);
+   cdir          = (interp_data -> cdir);
+   cindex        = (interp_data -> cindex);
+   findex        = (interp_data -> findex);
+   stride        = (interp_data -> stride);
+
+   stencil       = hypre_StructMatrixStencil(P);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(P);
+   hypre_assert( constant_coefficient == 0 || constant_coefficient == 1 );
+
+   hypre_SetIndex3(stridec, 1, 1, 1);
+
+   /*-----------------------------------------------------------------------
+    * Exchange the ghost values of xc (zero on the domain boundary)
+    *-----------------------------------------------------------------------*/
+
+   hypre_StructVectorClearBoundGhostValues(xc, 0);
+
+   xcp = hypre_StructVectorData(xc);
+   hypre_InitializeIndtComputations(compute_pkg, xcp, &comm_handle);
+   hypre_FinalizeIndtComputations(comm_handle);
+
+   /*-----------------------------------------------------------------------
+    * Correct x.  On each box, part 0 is the C-points with the F-point after
+    * them, part 1 is a last C-point without one, and part 2 is a first
+    * F-point that precedes all C-points.
+    *-----------------------------------------------------------------------*/
+
+   fgrid = hypre_StructVectorGrid(x);
+   fgrid_boxes = hypre_StructGridBoxes(fgrid);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+   cgrid = hypre_StructVectorGrid(xc);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
+
+   part_box = hypre_BoxCreate(hypre_StructVectorNDim(x));
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      fgrid_box = hypre_BoxArrayBox(fgrid_boxes, fi);
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      P_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(P), fi);
+      x_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+      xc_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(xc), ci);
+
+      //RL:PTROFFSET
+      Pp1_offset = 0;
+      if (P_stored_as_transpose)
+      {
+         Pp0 = hypre_StructMatrixBoxData(P, fi, 1);
+         Pp1 = hypre_StructMatrixBoxData(P, fi, 0);
+         if ( constant_coefficient )
+         {
+            Pp1_offset = -hypre_CCBoxOffsetDistance(P_dbox, stencil_shape[0]);
+         }
+         else
+         {
+            Pp1_offset = -hypre_BoxOffsetDistance(P_dbox, stencil_shape[0]);
+         }
+      }
+      else
+      {
+         Pp0 = hypre_StructMatrixBoxData(P, fi, 0);
+         Pp1 = hypre_StructMatrixBoxData(P, fi, 1);
+      }
+      xp  = hypre_StructVectorBoxData(x, fi);
+      xcp = hypre_StructVectorBoxData(xc, ci);
+
+      /* the F-point after C-point c has neighbors c and c+1 in xc */
+      hypre_SetIndex(offset, 0);
+      hypre_IndexD(offset, cdir) = (hypre_IndexD(stencil_shape[0], cdir) + 1) / 2;
+      xcp0_offset = hypre_BoxOffsetDistance(xc_dbox, offset);
+      hypre_IndexD(offset, cdir) = (hypre_IndexD(stencil_shape[1], cdir) + 1) / 2;
+      xcp1_offset = hypre_BoxOffsetDistance(xc_dbox, offset);
+      hypre_SetIndex(offset, 0);
+      hypre_IndexD(offset, cdir) = 1;
+      xf_offset = hypre_BoxOffsetDistance(x_dbox, offset);
+
+      imin = hypre_BoxIMinD(fgrid_box, cdir);
+      imax = hypre_BoxIMaxD(fgrid_box, cdir);
+      fmin = hypre_IndexD(cindex, cdir) + 2 * hypre_BoxIMinD(cgrid_box, cdir);
+      fmax = hypre_IndexD(cindex, cdir) + 2 * hypre_BoxIMaxD(cgrid_box, cdir);
+
+      for (k = 0; k < 3; k++)
+      {
+         hypre_CopyBox(cgrid_box, part_box);
+         switch (k)
+         {
+            case 0:
+               hypre_BoxIMaxD(part_box, cdir) -= (fmax + 1 > imax);
+               break;
+
+            case 1:
+               hypre_BoxIMinD(part_box, cdir) = hypre_BoxIMaxD(part_box, cdir) +
+                                                (fmax + 1 <= imax);
+               break;
+
+            case 2:
+               hypre_BoxIMinD(part_box, cdir) -= 1;
+               hypre_BoxIMaxD(part_box, cdir) = hypre_BoxIMinD(part_box, cdir) -
+                                                (fmin - 1 < imin);
+               break;
+         }
+
+         if (hypre_BoxVolume(part_box) == 0)
+         {
+            continue;
+         }
+
+         hypre_CopyIndex(hypre_BoxIMin(part_box), startc);
+         hypre_StructMapCoarseToFine(startc, cindex, stride, start);
+         hypre_BoxGetSize(part_box, loop_size);
+
+         if (k == 1)
+         {
+#define DEVICE_VAR is_device_ptr(xp,xcp)
+            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(P), loop_size,
+                                x_dbox,  start,  stride,  xi,
+                                xc_dbox, startc, stridec, xci);
+            {
+               xp[xi] += xcp[xci];
+            }
+            hypre_BoxLoop2End(xi, xci);
+#undef DEVICE_VAR
+            continue;
+         }
+
+         /* index of the F-point after start */
+         hypre_IndexD(start, cdir) += 1;
+         hypre_StructMapFineToCoarse(start, findex, stride, startp);
+         if (k == 0)
+         {
+            hypre_IndexD(start, cdir) -= 1;
+         }
+
+         if ( constant_coefficient )
+         {
+            HYPRE_Complex Pp0val, Pp1val;
+            Pi = hypre_CCBoxIndexRank( P_dbox, startp );
+            Pp0val = Pp0[Pi];
+            Pp1val = Pp1[Pi + Pp1_offset];
+
+            if (k == 0)
+            {
+#define DEVICE_VAR is_device_ptr(xp,xcp)
+               hypre_BoxLoop2Begin(hypre_StructMatrixNDim(P), loop_size,
+                                   x_dbox,  start,  stride,  xi,
+                                   xc_dbox, startc, stridec, xci);
+               {
+                  xp[xi] += xcp[xci];
+                  xp[xi + xf_offset] += (Pp0val * xcp[xci + xcp0_offset] +
+                                         Pp1val * xcp[xci + xcp1_offset]);
+               }
+               hypre_BoxLoop2End(xi, xci);
+#undef DEVICE_VAR
+            }
+            else
+            {
+#define DEVICE_VAR is_device_ptr(xp,xcp)
+               hypre_BoxLoop2Begin(hypre_StructMatrixNDim(P), loop_size,
+                                   x_dbox,  start,  stride,  xi,
+                                   xc_dbox, startc, stridec, xci);
+               {
+                  xp[xi] += (Pp0val * xcp[xci + xcp0_offset] +
+                             Pp1val * xcp[xci + xcp1_offset]);
+               }
+               hypre_BoxLoop2End(xi, xci);
+#undef DEVICE_VAR
+            }
+         }
+         else
+         {
+            if (k == 0)
+            {
+#define DEVICE_VAR is_device_ptr(xp,xcp,Pp0,Pp1)
+               hypre_BoxLoop3Begin(hypre_StructMatrixNDim(P), loop_size,
+                                   P_dbox,  startp, stridec, Pi,
+                                   x_dbox,  start,  stride,  xi,
+                                   xc_dbox, startc, stridec, xci);
+               {
+                  xp[xi] += xcp[xci];
+                  xp[xi + xf_offset] += (Pp0[Pi]              * xcp[xci + xcp0_offset] +
+                                         Pp1[Pi + Pp1_offset] * xcp[xci + xcp1_offset]);
+               }
+               hypre_BoxLoop3End(Pi, xi, xci);
+#undef DEVICE_VAR
+            }
+            else
+            {
+#define DEVICE_VAR is_device_ptr(xp,xcp,Pp0,Pp1)
+               hypre_BoxLoop3Begin(hypre_StructMatrixNDim(P), loop_size,
+                                   P_dbox,  startp, stridec, Pi,
+                                   x_dbox,  start,  stride,  xi,
+                                   xc_dbox, startc, stridec, xci);
+               {
+                  xp[xi] += (Pp0[Pi]              * xcp[xci + xcp0_offset] +
+                             Pp1[Pi + Pp1_offset] * xcp[xci + xcp1_offset]);
+               }
+               hypre_BoxLoop3End(Pi, xi, xci);
+#undef DEVICE_VAR
+            }
+         }
+      }
+   }
+
+   hypre_BoxDestroy(part_box);
+
+   /*-----------------------------------------------------------------------
+    * Return
+    *-----------------------------------------------------------------------*/
+
+   hypre_IncFLOPCount(5 * hypre_StructVectorGlobalSize(xc));
+   hypre_EndTiming(interp_data -> time_index);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -352,6 +752,7 @@ hypre_SemiInterpDestroy( void *interp_vdata )
    {
       hypre_StructMatrixDestroy(interp_data -> P);
       hypre_ComputePkgDestroy(interp_data -> compute_pkg);
+      hypre_ComputePkgDestroy(interp_data -> correct_compute_pkg);
       hypre_FinalizeTiming(interp_data -> time_index);
       hypre_TFree(interp_data, HYPRE_MEMORY_HOST);
    }
@@ -16,6 +16,8 @@ typedef struct
    hypre_StructMatrix *R;
    HYPRE_Int           R_stored_as_transpose;
    hypre_ComputePkg   *compute_pkg;
+   hypre_ComputePkg   *resid_compute_pkg;  /* for hypre_SemiResidualRestrict */
+   HYPRE_Int           resid_cdir;         /* < 0: residual is formed in r */
    hypre_Index         cindex;
    hypre_Index         stride;
 
@@ -311,6 +313,866 @@ hypre_SemiRestrict( void               *restrict_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SemiResidualRestrictSetup
+ *
+ * Sets up the compute package used by hypre_SemiResidualRestrict.  This must
+ * be called after hypre_SemiRestrictSetup.
+ *
+ * The residual is restricted plane by plane without forming it in r when the
+ * grid is coarsened by two in a single direction cdir with a two-point
+ * restriction stencil.  Periodic directions whose period is not a multiple
+ * of the stride or is smaller than the extent of the grid are excluded, since
+ * the exchange of x may then overwrite points of the grid.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiResidualRestrictSetup( void               *restrict_vdata,
+                                 hypre_StructMatrix *A,
+                                 hypre_StructVector *x )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   hypre_StructGrid       *grid;
+   hypre_StructStencil    *stencil;
+
+   hypre_ComputeInfo      *compute_info;
+   hypre_ComputePkg       *compute_pkg;
+
+   hypre_StructStencil    *R_stencil;
+   hypre_Index            *R_shape;
+   hypre_IndexRef          stride;
+   hypre_IndexRef          periodic;
+   hypre_Box              *bounding_box;
+   HYPRE_Int               ndim, cdir, planes, d;
+
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The fused residual restriction does not support matrix-free matrices");
+      return hypre_error_flag;
+   }
+
+   grid    = hypre_StructMatrixGrid(A);
+   stencil = hypre_StructMatrixStencil(A);
+
+   /* check for a restriction by two in a single direction cdir */
+   ndim         = hypre_StructMatrixNDim(A);
+   R_stencil    = hypre_StructMatrixStencil(restrict_data -> R);
+   R_shape      = hypre_StructStencilShape(R_stencil);
+   stride       = (restrict_data -> stride);
+   periodic     = hypre_StructGridPeriodic(grid);
+   bounding_box = hypre_StructGridBoundingBox(grid);
+
+   cdir   = -1;
+   planes = (ndim > 1) && (hypre_StructStencilSize(R_stencil) == 2);
+   for (d = 0; (d < ndim) && planes; d++)
+   {
+      if (hypre_IndexD(R_shape[0], d) != 0)
+      {
+         planes = (cdir < 0) && (hypre_IndexD(stride, d) == 2) &&
+                 (hypre_abs(hypre_IndexD(R_shape[0], d)) == 1) &&
+                 (hypre_IndexD(R_shape[1], d) == -hypre_IndexD(R_shape[0], d));
+         cdir  = d;
+      }
+      else
+      {
+         planes = (hypre_IndexD(stride, d) == 1) && (hypre_IndexD(R_shape[1], d) == 0);
+      }
+
+      if ( hypre_IndexD(periodic, d) &&
+           ( (hypre_IndexD(periodic, d) % hypre_IndexD(stride, d)) ||
+             (hypre_IndexD(periodic, d) < hypre_BoxSizeD(bounding_box, d)) ) )
+      {
+         planes = 0;
+      }
+   }
+   (restrict_data -> resid_cdir) = planes ? cdir : -1;
+
+   hypre_CreateComputeInfo(grid, stencil, &compute_info);
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+                          grid, &compute_pkg);
+
+   hypre_ComputePkgDestroy(restrict_data -> resid_compute_pkg);
+   (restrict_data -> resid_compute_pkg) = compute_pkg;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiResidualSplit
+ *
+ * Splits the stencil entries of A on box fi into variable (Avp) and constant
+ * (Acv) coefficients, with the corresponding offsets into the data of x.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SemiResidualSplit( hypre_StructMatrix *A,
+                         hypre_StructVector *x,
+                         HYPRE_Int           fi,
+                         HYPRE_Real        **Avp,
+                         HYPRE_Real         *Acv,
+                         HYPRE_Int          *xvoff,
+                         HYPRE_Int          *xcoff,
+                         HYPRE_Int          *nvar_ptr,
+                         HYPRE_Int          *ncon_ptr )
+{
+   hypre_StructStencil *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int            constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   hypre_Box           *x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+
+   hypre_Index          center;
+   HYPRE_Int            center_rank, nvar, ncon, si;
+
+   hypre_SetIndex(center, 0);
+   center_rank = hypre_StructStencilElementRank(stencil, center);
+
+   nvar = ncon = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      if ( (constant_coefficient == 0) ||
+           ((constant_coefficient == 2) && (si == center_rank)) )
+      {
+         Avp[nvar]   = hypre_StructMatrixBoxData(A, fi, si);
+         xvoff[nvar] = hypre_BoxOffsetDistance(x_dbox, stencil_shape[si]);
+         nvar++;
+      }
+      else
+      {
+         Acv[ncon]   = hypre_StructMatrixBoxData(A, fi, si)[hypre_CCBoxIndexRank_noargs()];
+         xcoff[ncon] = hypre_BoxOffsetDistance(x_dbox, stencil_shape[si]);
+         ncon++;
+      }
+   }
+
+   *nvar_ptr = nvar;
+   *ncon_ptr = ncon;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiResidualBox
+ *
+ * Computes r = b - Ax on a box, where r has data rp on box r_dbox (the data
+ * of a vector or a scratch buffer).  The stencil entries of A are split into
+ * variable (Avp) and constant (Acv) coefficients so that all constant
+ * coefficient types are handled.  As in the struct matvec, the stencil is
+ * unrolled in chunks of up to MAX_DEPTH entries, so stencils of up to
+ * MAX_DEPTH entries are done in a single pass over r.
+ *--------------------------------------------------------------------------*/
+
+#ifdef MAX_DEPTH
+#undef MAX_DEPTH
+#endif
+#define MAX_DEPTH 7
+
+#define hypre_SemiResidualVar(k) Ap[k][Ai] * xp[xi + xo[k]]
+#define hypre_SemiResidualCon(k) Ac[k] * xp[xi + xo[k]]
+
+#define hypre_SemiResidualSum1(T) T(0)
+#define hypre_SemiResidualSum2(T) hypre_SemiResidualSum1(T) + T(1)
+#define hypre_SemiResidualSum3(T) hypre_SemiResidualSum2(T) + T(2)
+#define hypre_SemiResidualSum4(T) hypre_SemiResidualSum3(T) + T(3)
+#define hypre_SemiResidualSum5(T) hypre_SemiResidualSum4(T) + T(4)
+#define hypre_SemiResidualSum6(T) hypre_SemiResidualSum5(T) + T(5)
+#define hypre_SemiResidualSum7(T) hypre_SemiResidualSum6(T) + T(6)
+
+/* r = s - chunk, where s is b for the first chunk and r for later chunks */
+#define hypre_SemiResidualLoop(SUM, T)                                       \
+   hypre_BoxLoop4Begin(ndim, loop_size,                                      \
+                       A_dbox, start, stride, Ai,                            \
+                       x_dbox, start, stride, xi,                            \
+                       s_dbox, start, stride, sj,                            \
+                       r_dbox, start, stride, ri);                           \
+   {                                                                         \
+      rp[ri] = sp[sj] - (SUM(T));                                            \
+   }                                                                         \
+   hypre_BoxLoop4End(Ai, xi, sj, ri)
+
+#define hypre_SemiResidualChunk(T)                                           \
+   switch (depth)                                                           \
+   {                                                                        \
+      case 7: hypre_SemiResidualLoop(hypre_SemiResidualSum7, T); break;     \
+      case 6: hypre_SemiResidualLoop(hypre_SemiResidualSum6, T); break;     \
+      case 5: hypre_SemiResidualLoop(hypre_SemiResidualSum5, T); break;     \
+      case 4: hypre_SemiResidualLoop(hypre_SemiResidualSum4, T); break;     \
+      case 3: hypre_SemiResidualLoop(hypre_SemiResidualSum3, T); break;     \
+      case 2: hypre_SemiResidualLoop(hypre_SemiResidualSum2, T); break;     \
+      case 1: hypre_SemiResidualLoop(hypre_SemiResidualSum1, T); break;     \
+   }
+
+static void
+hypre_SemiResidualBox( hypre_StructMatrix *A,
+                       hypre_StructVector *x,
+                       hypre_StructVector *b,
+                       HYPRE_Int           fi,
+                       hypre_Box          *compute_box,
+                       hypre_Box          *r_dbox,
+                       HYPRE_Real         *rp,
+                       HYPRE_Real        **Avp,
+                       HYPRE_Real         *Acv,
+                       HYPRE_Int          *xvoff,
+                       HYPRE_Int          *xcoff )
+{
+   HYPRE_Int            ndim          = hypre_StructMatrixNDim(A);
+
+   hypre_Box           *A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+   hypre_Box           *x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+   hypre_Box           *b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), fi);
+   HYPRE_Real          *xp     = hypre_StructVectorBoxData(x, fi);
+   HYPRE_Real          *bp     = hypre_StructVectorBoxData(b, fi);
+
+   HYPRE_Real          *Ap[MAX_DEPTH];
+   HYPRE_Real           Ac[MAX_DEPTH];
+   HYPRE_Int            xo[MAX_DEPTH];
+
+   hypre_Index          loop_size;
+   hypre_IndexRef       start;
+   hypre_Index          stride;
+   hypre_Box           *s_dbox;
+   HYPRE_Real          *sp;
+
+   HYPRE_Int            nvar, ncon, si, k, depth;
+
+   /* split the stencil into variable and constant coefficients */
+   hypre_SemiResidualSplit(A, x, fi, Avp, Acv, xvoff, xcoff, &nvar, &ncon);
+
+   start = hypre_BoxIMin(compute_box);
+   hypre_BoxGetSize(compute_box, loop_size);
+   hypre_SetIndex(stride, 1);
+
+   s_dbox = b_dbox;
+   sp     = bp;
+
+   for (si = 0; si < nvar; si += MAX_DEPTH)
+   {
+      depth = hypre_min(MAX_DEPTH, (nvar - si));
+      for (k = 0; k < depth; k++)
+      {
+         Ap[k] = Avp[si + k];
+         xo[k] = xvoff[si + k];
+      }
+
+#define DEVICE_VAR is_device_ptr(rp,xp,sp)
+      hypre_SemiResidualChunk(hypre_SemiResidualVar);
+#undef DEVICE_VAR
+
+      s_dbox = r_dbox;
+      sp     = rp;
+   }
+
+   for (si = 0; si < ncon; si += MAX_DEPTH)
+   {
+      depth = hypre_min(MAX_DEPTH, (ncon - si));
+      for (k = 0; k < depth; k++)
+      {
+         Ac[k] = Acv[si + k];
+         xo[k] = xcoff[si + k];
+      }
+
+#define DEVICE_VAR is_device_ptr(rp,xp,sp)
+      hypre_SemiResidualChunk(hypre_SemiResidualCon);
+#undef DEVICE_VAR
+
+      s_dbox = r_dbox;
+      sp     = rp;
+   }
+}
+
+#undef hypre_SemiResidualChunk
+#undef hypre_SemiResidualLoop
+#undef hypre_SemiResidualSum1
+#undef hypre_SemiResidualSum2
+#undef hypre_SemiResidualSum3
+#undef hypre_SemiResidualSum4
+#undef hypre_SemiResidualSum5
+#undef hypre_SemiResidualSum6
+#undef hypre_SemiResidualSum7
+#undef hypre_SemiResidualVar
+#undef hypre_SemiResidualCon
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiResidualRestrictPlanes
+ *
+ * Computes rc = R (b - Ax) without forming r on the interior of the boxes.
+ *
+ * Each coarse point needs the residual at its fine point f and at the two
+ * neighbors f-1 and f+1 in the coarsening direction.  The boxes are visited
+ * plane by plane in the slowest direction, so that each fine residual is
+ * computed once into a plane-sized buffer that stays in cache:
+ *
+ * - When coarsening in the slowest direction, the residual on the fine planes
+ *   f and f+1 is computed for each coarse plane, and the buffer for f+1 is
+ *   reused as the one for f-1 of the next coarse plane.
+ * - Otherwise, the residual on a fine plane is computed and then restricted
+ *   within the plane.
+ *
+ * The residual is only stored in r on the first and last fine plane (in the
+ * coarsening direction) of each box, which are the values needed by the
+ * coarse points of the neighboring boxes.  Those are exchanged while the
+ * coarse points that do not need them are computed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SemiResidualRestrictPlanes( hypre_SemiRestrictData *restrict_data,
+                                  hypre_StructMatrix     *A,
+                                  hypre_StructVector     *x,
+                                  hypre_StructVector     *b,
+                                  hypre_StructMatrix     *R,
+                                  hypre_StructVector     *r,
+                                  hypre_StructVector     *rc,
+                                  HYPRE_Int               cdir,
+                                  HYPRE_Real            **Avp,
+                                  HYPRE_Real             *Acv,
+                                  HYPRE_Int              *xvoff,
+                                  HYPRE_Int              *xcoff )
+{
+   HYPRE_Int               ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int               R_stored_as_transpose = (restrict_data -> R_stored_as_transpose);
+   hypre_IndexRef          cindex = (restrict_data -> cindex);
+   hypre_IndexRef          stride = (restrict_data -> stride);
+   HYPRE_Int               R_constant = hypre_StructMatrixConstantCoefficient(R);
+
+   hypre_StructStencil    *R_stencil = hypre_StructMatrixStencil(R);
+   hypre_Index            *R_shape   = hypre_StructStencilShape(R_stencil);
+
+   hypre_StructGrid       *fgrid;
+   hypre_BoxArray         *fgrid_boxes;
+   HYPRE_Int              *fgrid_ids;
+   hypre_StructGrid       *cgrid;
+   hypre_BoxArray         *cgrid_boxes;
+   HYPRE_Int              *cgrid_ids;
+
+   hypre_CommHandle       *comm_handle;
+   hypre_BoxArrayArray    *compute_box_aa;
+   hypre_BoxArray         *compute_box_a;
+   hypre_Box              *compute_box;
+   hypre_Box              *fgrid_box;
+   hypre_Box              *bounding_box;
+   HYPRE_Int               periodic_cdir;
+   HYPRE_Int               lo_needed, hi_needed;
+   hypre_Box              *plane_box;
+   hypre_Box              *slab_box;
+   hypre_Box              *res_box;
+
+   hypre_Box              *R_dbox, *r_dbox, *rc_dbox;
+   HYPRE_Real             *rp, *rcp;
+   HYPRE_Real             *Rlo, *Rhi;
+   HYPRE_Int               Rlo_offset, Rhi_offset;
+
+   HYPRE_Real             *buf_data;
+   HYPRE_Real             *slab_data;
+   HYPRE_Real             *buf_lo, *buf_c, *buf_hi, *buf_tmp;
+   HYPRE_Int               buf_size, plane_size;
+
+   hypre_Index             loop_size;
+   hypre_IndexRef          start;
+   hypre_Index             startc;
+   hypre_Index             stridec;
+   hypre_Index             unit_stride;
+   hypre_Index             pstart;
+   HYPRE_Int               lo_ghost, hi_ghost, nc, k;
+   HYPRE_Int               compute_i, fi, ci, j, lo, hi;
+
+   if (hypre_StructMatrixConstantCoefficient(A))
+   {
+      hypre_StructVectorClearBoundGhostValues(x, 0);
+   }
+
+   fgrid       = hypre_StructVectorGrid(r);
+   fgrid_boxes = hypre_StructGridBoxes(fgrid);
+   fgrid_ids   = hypre_StructGridIDs(fgrid);
+   cgrid       = hypre_StructVectorGrid(rc);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids   = hypre_StructGridIDs(cgrid);
+
+   bounding_box  = hypre_StructGridBoundingBox(fgrid);
+   periodic_cdir = hypre_IndexD(hypre_StructGridPeriodic(fgrid), cdir);
+
+   hypre_SetIndex(stridec, 1);
+   hypre_SetIndex(unit_stride, 1);
+
+   plane_box = hypre_BoxCreate(ndim);
+   slab_box  = hypre_BoxCreate(ndim);
+   res_box   = hypre_BoxCreate(ndim);
+
+   /*--------------------------------------------------------------------
+    * Exchange x and store the residual on the first and last fine plane
+    * (in the coarsening direction) of each box.  Planes on the boundary of
+    * a non-periodic domain are not needed by other boxes.
+    *--------------------------------------------------------------------*/
+
+   hypre_InitializeIndtComputations((restrict_data -> resid_compute_pkg),
+                                    hypre_StructVectorData(x), &comm_handle);
+   hypre_FinalizeIndtComputations(comm_handle);
+
+   buf_size = 0;
+   hypre_ForBoxI(fi, fgrid_boxes)
+   {
+      fgrid_box = hypre_BoxArrayBox(fgrid_boxes, fi);
+      r_dbox    = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r), fi);
+      rp        = hypre_StructVectorBoxData(r, fi);
+      lo = hypre_BoxIMinD(fgrid_box, cdir);
+      hi = hypre_BoxIMaxD(fgrid_box, cdir);
+
+      lo_needed = periodic_cdir || (lo > hypre_BoxIMinD(bounding_box, cdir));
+      hi_needed = periodic_cdir || (hi < hypre_BoxIMaxD(bounding_box, cdir));
+
+      hypre_CopyBox(fgrid_box, plane_box);
+      hypre_BoxIMaxD(plane_box, cdir) = lo;
+      if (lo_needed || ((hi == lo) && hi_needed))
+      {
+         hypre_SemiResidualBox(A, x, b, fi, plane_box, r_dbox, rp, Avp, Acv, xvoff, xcoff);
+      }
+      if ((hi > lo) && hi_needed)
+      {
+         hypre_BoxIMinD(plane_box, cdir) = hi;
+         hypre_BoxIMaxD(plane_box, cdir) = hi;
+         hypre_SemiResidualBox(A, x, b, fi, plane_box, r_dbox, rp, Avp, Acv, xvoff, xcoff);
+      }
+
+      buf_size = hypre_max(buf_size, hypre_BoxVolume(plane_box));
+   }
+
+   if (R_constant)
+   {
+      hypre_StructVectorClearBoundGhostValues(r, 0);
+   }
+
+   /* plane buffers for the residual at f-1, f and f+1 */
+   buf_data = hypre_TAlloc(HYPRE_Real, 3 * buf_size, HYPRE_MEMORY_HOST);
+
+   /*--------------------------------------------------------------------
+    * Restrict the residual computed plane by plane (overlapped with the
+    * exchange of r)
+    *--------------------------------------------------------------------*/
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch (compute_i)
+      {
+         case 0:
+         {
+            rp = hypre_StructVectorData(r);
+            hypre_InitializeIndtComputations((restrict_data -> compute_pkg), rp, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(restrict_data -> compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(restrict_data -> compute_pkg);
+         }
+         break;
+      }
+
+      fi = 0;
+      hypre_ForBoxI(ci, cgrid_boxes)
+      {
+         while (fgrid_ids[fi] != cgrid_ids[ci])
+         {
+            fi++;
+         }
+
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, fi);
+         fgrid_box     = hypre_BoxArrayBox(fgrid_boxes, fi);
+
+         R_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R),  fi);
+         r_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r),  fi);
+         rc_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(rc), ci);
+         rp      = hypre_StructVectorBoxData(r, fi);
+         rcp     = hypre_StructVectorBoxData(rc, ci);
+
+         /* restriction weights of the lower and upper fine neighbors */
+         if (R_stored_as_transpose)
+         {
+            Rlo = hypre_StructMatrixBoxData(R, fi, 1);
+            Rhi = hypre_StructMatrixBoxData(R, fi, 0);
+            if (R_constant)
+            {
+               Rlo_offset = -hypre_CCBoxOffsetDistance(R_dbox, R_shape[1]);
+            }
+            else
+            {
+               Rlo_offset = -hypre_BoxOffsetDistance(R_dbox, R_shape[1]);
+            }
+         }
+         else
+         {
+            Rlo = hypre_StructMatrixBoxData(R, fi, 0);
+            Rhi = hypre_StructMatrixBoxData(R, fi, 1);
+            Rlo_offset = 0;
+         }
+         Rhi_offset = 0;
+         if (hypre_IndexD(R_shape[0], cdir) > 0)
+         {
+            buf_tmp    = Rlo;
+            Rlo        = Rhi;
+            Rhi        = buf_tmp;
+            Rhi_offset = Rlo_offset;
+            Rlo_offset = 0;
+         }
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+            start = hypre_BoxIMin(compute_box);
+            hypre_StructMapFineToCoarse(start, cindex, stride, startc);
+            hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+            nc = hypre_IndexD(loop_size, cdir);
+            if ((nc < 1) || (hypre_BoxVolume(compute_box) < 1))
+            {
+               continue;
+            }
+
+            /* fine neighbors outside of the box at the ends are taken from r */
+            lo_ghost = (hypre_IndexD(start, cdir) - 1 <
+                        hypre_BoxIMinD(fgrid_box, cdir));
+            hi_ghost = (hypre_IndexD(start, cdir) + 2 * (nc - 1) + 1 >
+                        hypre_BoxIMaxD(fgrid_box, cdir));
+
+            if (cdir == ndim - 1)
+            {
+               /* the buffers hold one fine plane of the compute box, and the
+                * box loops run over the coarse points of one plane */
+               hypre_IndexD(loop_size, cdir) = 1;
+               hypre_CopyBox(compute_box, plane_box);
+               plane_size = hypre_BoxVolume(plane_box) / hypre_BoxSizeD(plane_box, cdir);
+               hypre_CopyIndex(start, pstart);
+
+               buf_lo = buf_data;
+               buf_c  = buf_data + buf_size;
+               buf_hi = buf_data + 2 * buf_size;
+               hypre_assert(plane_size <= buf_size);
+
+#define hypre_SemiResidualPlane(c)                                           \
+               hypre_IndexD(pstart, cdir) = (c);                                \
+               hypre_BoxIMinD(plane_box, cdir) = (c);                           \
+               hypre_BoxIMaxD(plane_box, cdir) = (c)
+
+#define hypre_SemiResidualCopyGhost(buf)                                     \
+               hypre_BoxLoop2Begin(ndim, loop_size,                             \
+                                   r_dbox,    pstart, unit_stride, ri,         \
+                                   plane_box, pstart, unit_stride, pi);        \
+               {                                                                \
+                  buf[pi] = rp[ri];                                             \
+               }                                                                \
+               hypre_BoxLoop2End(ri, pi)
+
+               /* residual at the fine plane below the first coarse plane */
+               hypre_SemiResidualPlane(hypre_IndexD(start, cdir) - 1);
+               if (lo_ghost)
+               {
+                  hypre_SemiResidualCopyGhost(buf_lo);
+               }
+               else
+               {
+                  hypre_SemiResidualBox(A, x, b, fi, plane_box, plane_box, buf_lo,
+                                        Avp, Acv, xvoff, xcoff);
+               }
+
+               for (k = 0; k < nc; k++)
+               {
+                  /* residual at the coarse point and at the fine plane above */
+                  hypre_SemiResidualPlane(hypre_IndexD(start, cdir) + 2 * k);
+                  hypre_SemiResidualBox(A, x, b, fi, plane_box, plane_box, buf_c,
+                                        Avp, Acv, xvoff, xcoff);
+
+                  hypre_SemiResidualPlane(hypre_IndexD(start, cdir) + 2 * k + 1);
+                  if (hi_ghost && (k == nc - 1))
+                  {
+                     hypre_SemiResidualCopyGhost(buf_hi);
+                  }
+                  else
+                  {
+                     hypre_SemiResidualBox(A, x, b, fi, plane_box, plane_box, buf_hi,
+                                           Avp, Acv, xvoff, xcoff);
+                  }
+
+                  /* restrict */
+                  hypre_IndexD(startc, cdir) = hypre_IndexD(startc, cdir) + (k > 0);
+                  if (R_constant)
+                  {
+                     HYPRE_Real Rloval, Rhival;
+                     HYPRE_Int  Ri = hypre_CCBoxIndexRank(R_dbox, startc);
+
+                     Rloval = Rlo[Ri + Rlo_offset];
+                     Rhival = Rhi[Ri + Rhi_offset];
+                     hypre_BoxLoop2Begin(ndim, loop_size,
+                                         plane_box, pstart, unit_stride, pi,
+                                         rc_dbox,   startc, stridec,     rci);
+                     {
+                        rcp[rci] = buf_c[pi] + (Rloval * buf_lo[pi] + Rhival * buf_hi[pi]);
+                     }
+                     hypre_BoxLoop2End(pi, rci);
+                  }
+                  else
+                  {
+                     hypre_BoxLoop3Begin(ndim, loop_size,
+                                         plane_box, pstart, unit_stride, pi,
+                                         R_dbox,    startc, stridec,     Ri,
+                                         rc_dbox,   startc, stridec,     rci);
+                     {
+                        rcp[rci] = buf_c[pi] + (Rlo[Ri + Rlo_offset] * buf_lo[pi] +
+                                                Rhi[Ri + Rhi_offset] * buf_hi[pi]);
+                     }
+                     hypre_BoxLoop3End(pi, Ri, rci);
+                  }
+
+                  buf_tmp = buf_lo;
+                  buf_lo  = buf_hi;
+                  buf_hi  = buf_tmp;
+               }
+
+#undef hypre_SemiResidualCopyGhost
+#undef hypre_SemiResidualPlane
+            }
+            else
+            {
+               /* the buffer holds the fine points of one slab (a single index
+                * in the slowest direction) of the compute box, together with
+                * the neighbors of its coarse points in the coarsening direction */
+               HYPRE_Int   odir    = ndim - 1;
+               HYPRE_Int   f_first = hypre_IndexD(start, cdir);
+               HYPRE_Int   f_last  = f_first + 2 * (nc - 1);
+               HYPRE_Int   o_first = hypre_IndexD(start, odir);
+               HYPRE_Int   oc_first = hypre_IndexD(startc, odir);
+               HYPRE_Int   no, o, pd;
+               hypre_Index slab_size;
+               hypre_Index gstart;
+
+               no = hypre_IndexD(loop_size, odir);
+               hypre_IndexD(loop_size, odir) = 1;
+
+               hypre_CopyBox(compute_box, slab_box);
+               hypre_BoxIMinD(slab_box, cdir) = f_first - 1;
+               hypre_BoxIMaxD(slab_box, cdir) = f_last + 1;
+               hypre_BoxIMaxD(slab_box, odir) = hypre_BoxIMinD(slab_box, odir);
+               hypre_CopyBox(slab_box, res_box);
+               hypre_BoxIMinD(res_box, cdir) = f_first - (lo_ghost ? 0 : 1);
+               hypre_BoxIMaxD(res_box, cdir) = f_last + (hi_ghost ? 0 : 1);
+               hypre_BoxGetSize(slab_box, slab_size);
+               hypre_IndexD(slab_size, cdir) = 1;
+
+               hypre_SetIndex(unit_stride, 0);
+               hypre_IndexD(unit_stride, cdir) = 1;
+               pd = hypre_BoxOffsetDistance(slab_box, unit_stride);
+               hypre_SetIndex(unit_stride, 1);
+
+               slab_data = hypre_TAlloc(HYPRE_Real, hypre_BoxVolume(slab_box), HYPRE_MEMORY_HOST);
+
+               hypre_CopyIndex(start, pstart);
+               hypre_CopyIndex(start, gstart);
+               for (o = 0; o < no; o++)
+               {
+                  hypre_IndexD(pstart, odir)  = o_first + o;
+                  hypre_IndexD(gstart, odir)  = o_first + o;
+                  hypre_IndexD(startc, odir)  = oc_first + o;
+                  hypre_BoxIMinD(slab_box, odir) = o_first + o;
+                  hypre_BoxIMaxD(slab_box, odir) = o_first + o;
+                  hypre_BoxIMinD(res_box, odir)  = o_first + o;
+                  hypre_BoxIMaxD(res_box, odir)  = o_first + o;
+
+                  /* residual of the slab, with the neighbors outside of the
+                   * box taken from r */
+                  hypre_SemiResidualBox(A, x, b, fi, res_box, slab_box, slab_data,
+                                        Avp, Acv, xvoff, xcoff);
+                  if (lo_ghost || hi_ghost)
+                  {
+                     for (k = 0; k < 2; k++)
+                     {
+                        if ((k == 0) ? !lo_ghost : !hi_ghost)
+                        {
+                           continue;
+                        }
+                        hypre_IndexD(gstart, cdir) = (k == 0) ? (f_first - 1) : (f_last + 1);
+                        hypre_BoxLoop2Begin(ndim, slab_size,
+                                            r_dbox,   gstart, unit_stride, ri,
+                                            slab_box, gstart, unit_stride, pi);
+                        {
+                           slab_data[pi] = rp[ri];
+                        }
+                        hypre_BoxLoop2End(ri, pi);
+                     }
+                  }
+
+                  /* restrict */
+                  if (R_constant)
+                  {
+                     HYPRE_Real Rloval, Rhival;
+                     HYPRE_Int  Ri = hypre_CCBoxIndexRank(R_dbox, startc);
+
+                     Rloval = Rlo[Ri + Rlo_offset];
+                     Rhival = Rhi[Ri + Rhi_offset];
+                     hypre_BoxLoop2Begin(ndim, loop_size,
+                                         slab_box, pstart, stride,  pi,
+                                         rc_dbox,  startc, stridec, rci);
+                     {
+                        rcp[rci] = slab_data[pi] + (Rloval * slab_data[pi - pd] +
+                                                    Rhival * slab_data[pi + pd]);
+                     }
+                     hypre_BoxLoop2End(pi, rci);
+                  }
+                  else
+                  {
+                     hypre_BoxLoop3Begin(ndim, loop_size,
+                                         slab_box, pstart, stride,  pi,
+                                         R_dbox,   startc, stridec, Ri,
+                                         rc_dbox,  startc, stridec, rci);
+                     {
+                        rcp[rci] = slab_data[pi] + (Rlo[Ri + Rlo_offset] * slab_data[pi - pd] +
+                                                    Rhi[Ri + Rhi_offset] * slab_data[pi + pd]);
+                     }
+                     hypre_BoxLoop3End(pi, Ri, rci);
+                  }
+               }
+
+               hypre_TFree(slab_data, HYPRE_MEMORY_HOST);
+            }
+         }
+      }
+   }
+
+   hypre_TFree(buf_data, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(plane_box);
+   hypre_BoxDestroy(slab_box);
+   hypre_BoxDestroy(res_box);
+
+   hypre_IncFLOPCount(2 * hypre_StructMatrixGlobalSize(A));
+   hypre_IncFLOPCount(4 * hypre_StructVectorGlobalSize(rc));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SemiResidualRestrict
+ *
+ * Computes rc = R (b - Ax), using r as workspace for the fine-grid residual.
+ *
+ * This replaces a copy of b into r, a matvec, and hypre_SemiRestrict.  When
+ * the grid is coarsened by two in a single direction (the PFMG and SMG case),
+ * the residual is restricted as it is computed and is only stored in r where
+ * it is needed by neighboring boxes (see hypre_SemiResidualRestrictPlanes).
+ * Otherwise, the residual is computed in a single sweep over r (for stencils
+ * of up to MAX_DEPTH entries) that overlaps the exchange of x, and is then
+ * restricted.
+ *
+ * This uses host-side pointer arrays in the box loops, so it is only called
+ * when the data resides in host memory.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SemiResidualRestrict( void               *restrict_vdata,
+                            hypre_StructMatrix *A,
+                            hypre_StructVector *x,
+                            hypre_StructVector *b,
+                            hypre_StructMatrix *R,
+                            hypre_StructVector *r,
+                            hypre_StructVector *rc             )
+{
+   hypre_SemiRestrictData *restrict_data = (hypre_SemiRestrictData *)restrict_vdata;
+
+   hypre_ComputePkg       *compute_pkg;
+   hypre_CommHandle       *comm_handle;
+
+   hypre_BoxArrayArray    *compute_box_aa;
+   hypre_BoxArray         *compute_box_a;
+
+   HYPRE_Real            **Avp;
+   HYPRE_Real             *Acv;
+   HYPRE_Int              *xvoff;
+   HYPRE_Int              *xcoff;
+   HYPRE_Int               stencil_size;
+
+   HYPRE_Real             *xp;
+   HYPRE_Int               cdir, compute_i, i, j;
+
+   hypre_BeginTiming(restrict_data -> time_index);
+
+   compute_pkg  = (restrict_data -> resid_compute_pkg);
+   stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+   cdir         = (restrict_data -> resid_cdir);
+
+   Avp   = hypre_TAlloc(HYPRE_Real *, stencil_size, HYPRE_MEMORY_HOST);
+   Acv   = hypre_TAlloc(HYPRE_Real,   stencil_size, HYPRE_MEMORY_HOST);
+   xvoff = hypre_TAlloc(HYPRE_Int,    stencil_size, HYPRE_MEMORY_HOST);
+   xcoff = hypre_TAlloc(HYPRE_Int,    stencil_size, HYPRE_MEMORY_HOST);
+
+   if (cdir >= 0)
+   {
+      hypre_SemiResidualRestrictPlanes(restrict_data, A, x, b, R, r, rc, cdir,
+                                       Avp, Acv, xvoff, xcoff);
+
+      hypre_TFree(Avp, HYPRE_MEMORY_HOST);
+      hypre_TFree(Acv, HYPRE_MEMORY_HOST);
+      hypre_TFree(xvoff, HYPRE_MEMORY_HOST);
+      hypre_TFree(xcoff, HYPRE_MEMORY_HOST);
+
+      hypre_EndTiming(restrict_data -> time_index);
+
+      return hypre_error_flag;
+   }
+
+   if (hypre_StructMatrixConstantCoefficient(A))
+   {
+      hypre_StructVectorClearBoundGhostValues(x, 0);
+   }
+
+   /*--------------------------------------------------------------------
+    * Compute the residual (overlapped with the exchange of x)
+    *--------------------------------------------------------------------*/
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch (compute_i)
+      {
+         case 0:
+         {
+            xp = hypre_StructVectorData(x);
+            hypre_InitializeIndtComputations(compute_pkg, xp, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+         }
+         break;
+      }
+
+      hypre_ForBoxArrayI(i, compute_box_aa)
+      {
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            hypre_SemiResidualBox(A, x, b, i, hypre_BoxArrayBox(compute_box_a, j),
+                                  hypre_BoxArrayBox(hypre_StructVectorDataSpace(r), i),
+                                  hypre_StructVectorBoxData(r, i), Avp, Acv, xvoff, xcoff);
+         }
+      }
+   }
+
+   hypre_TFree(Avp, HYPRE_MEMORY_HOST);
+   hypre_TFree(Acv, HYPRE_MEMORY_HOST);
+   hypre_TFree(xvoff, HYPRE_MEMORY_HOST);
+   hypre_TFree(xcoff, HYPRE_MEMORY_HOST);
+
+   hypre_IncFLOPCount(2 * hypre_StructMatrixGlobalSize(A));
+   hypre_EndTiming(restrict_data -> time_index);
+
+   /*--------------------------------------------------------------------
+    * Restrict the residual
+    *--------------------------------------------------------------------*/
+
+   return hypre_SemiRestrict(restrict_vdata, R, r, rc);
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -323,6 +1185,7 @@ hypre_SemiRestrictDestroy( void *restrict_vdata )
    {
       hypre_StructMatrixDestroy(restrict_data -> R);
       hypre_ComputePkgDestroy(restrict_data -> compute_pkg);
+      hypre_ComputePkgDestroy(restrict_data -> resid_compute_pkg);
       hypre_FinalizeTiming(restrict_data -> time_index);
       hypre_TFree(restrict_data, HYPRE_MEMORY_HOST);
    }
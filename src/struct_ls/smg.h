@@ -61,6 +61,7 @@ typedef struct
    void                **residual_data_l;
    void                **restrict_data_l;
    void                **interp_data_l;
+   HYPRE_Int             fuse_transfer; /* fuse residual and restriction */
 
    /* log info (always logged) */
    HYPRE_Int             num_iterations;
@@ -74,6 +74,12 @@ hypre_SMGResidualSetup( void               *residual_vdata,
    hypre_ComputeInfo      *compute_info;
    hypre_ComputePkg       *compute_pkg;
 
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The SMG residual does not support matrix-free matrices");
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------------------------
     * Set up base points and the compute package
     *----------------------------------------------------------*/
@@ -74,6 +74,7 @@ hypre_SMGSetup( void               *smg_vdata,
 
    hypre_Box            *cbox;
 
+   HYPRE_Int             fuse_transfer;
    HYPRE_Int             i, l;
 
    HYPRE_Int             b_num_ghost[]  = {0, 0, 0, 0, 0, 0};
@@ -89,12 +90,27 @@ hypre_SMGSetup( void               *smg_vdata,
    HYPRE_Int             max_box_size  = 0;
    HYPRE_Int             device_level  = (smg_data -> devicelevel);
 #endif
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "SMG does not support matrix-free matrices");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------
     * Set up coarsening direction
     *-----------------------------------------------------*/
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   /* The fused residual/restriction kernel in semi_restrict.c is host-only.
+    * Interpolation is not fused here because the relaxation reuses e_l as
+    * workspace (see hypre_SemiInterpCorrect). */
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   fuse_transfer = 0;
+#else
+   fuse_transfer = 1;
+#endif
+
    cdir = hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) - 1;
    (smg_data -> cdir) = cdir;
 
@@ -514,6 +530,11 @@ hypre_SMGSetup( void               *smg_vdata,
       restrict_data_l[l] = hypre_SemiRestrictCreate();
       hypre_SemiRestrictSetup(restrict_data_l[l], R_l[l], 0, r_l[l], b_l[l + 1],
                               cindex, findex, stride);
+      if (fuse_transfer && (l > 0))
+      {
+         /* not used on the finest grid, where the residual uses base_index */
+         hypre_SemiResidualRestrictSetup(restrict_data_l[l], A_l[l], x_l[l]);
+      }
 
       /* set up the coarse grid operator */
       hypre_SMGSetupRAPOp(R_l[l], A_l[l], PT_l[l], A_l[l + 1],
@@ -559,6 +580,7 @@ hypre_SMGSetup( void               *smg_vdata,
    (smg_data -> residual_data_l)   = residual_data_l;
    (smg_data -> restrict_data_l)   = restrict_data_l;
    (smg_data -> interp_data_l)     = interp_data_l;
+   (smg_data -> fuse_transfer)     = fuse_transfer;
 
    /*-----------------------------------------------------
     * Allocate space for log info
@@ -71,6 +71,7 @@ hypre_SMGSolve( void               *smg_vdata,
    void                **residual_data_l = (smg_data -> residual_data_l);
    void                **restrict_data_l = (smg_data -> restrict_data_l);
    void                **interp_data_l   = (smg_data -> interp_data_l);
+   HYPRE_Int             fuse_transfer   = (smg_data -> fuse_transfer);
    HYPRE_Int             logging         = (smg_data -> logging);
    HYPRE_Real           *norms           = (smg_data -> norms);
    HYPRE_Real           *rel_norms       = (smg_data -> rel_norms);
@@ -222,12 +223,18 @@ hypre_SMGSolve( void               *smg_vdata,
             hypre_SMGRelaxSetZeroGuess(relax_data_l[l], 1);
             hypre_SMGRelax(relax_data_l[l], A_l[l], b_l[l], x_l[l]);
 
-            /* compute residual (b - Ax) */
-            hypre_SMGResidual(residual_data_l[l],
-                              A_l[l], x_l[l], b_l[l], r_l[l]);
-
-            /* restrict residual */
-            hypre_SemiRestrict(restrict_data_l[l], R_l[l], r_l[l], b_l[l + 1]);
+            /* compute and restrict residual (b - Ax) */
+            if (fuse_transfer)
+            {
+               hypre_SemiResidualRestrict(restrict_data_l[l], A_l[l], x_l[l], b_l[l],
+                                          R_l[l], r_l[l], b_l[l + 1]);
+            }
+            else
+            {
+               hypre_SMGResidual(residual_data_l[l],
+                                 A_l[l], x_l[l], b_l[l], r_l[l]);
+               hypre_SemiRestrict(restrict_data_l[l], R_l[l], r_l[l], b_l[l + 1]);
+            }
 #if DEBUG
             if (hypre_StructStencilNDim(hypre_StructMatrixStencil(A)) == 3)
             {
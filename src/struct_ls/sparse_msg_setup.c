@@ -116,6 +116,12 @@ hypre_SparseMSGSetup( void               *smsg_vdata,
 #endif
 
 
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "SparseMSG does not support matrix-free matrices");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
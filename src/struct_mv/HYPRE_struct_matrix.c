@@ -378,6 +378,17 @@ HYPRE_Int  HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix  matrix,
    return hypre_StructMatrixSetConstantEntries( matrix, nentries, entries );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixSetCoeffFcn( HYPRE_StructMatrix          matrix,
+                               HYPRE_StructMatrixCoeffFcn  coeff_fcn,
+                               void                       *coeff_data )
+{
+   return hypre_StructMatrixSetCoeffFcn( matrix, coeff_fcn, coeff_data );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -345,6 +345,37 @@ HYPRE_Int HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix matrix,
                                                 HYPRE_Int          nentries,
                                                 HYPRE_Int         *entries );
 
+/**
+ * The coefficient callback for matrix-free matrices.  It must fill \e values
+ * with the coefficients of the stencil entries \e entries on the box
+ * [\e ilower, \e iupper], ordered as in \ref HYPRE_StructMatrixSetBoxValues.
+ * The box is always contained in one box of the grid.
+ **/
+typedef HYPRE_Int (*HYPRE_StructMatrixCoeffFcn)(void          *data,
+                                                HYPRE_Int     *ilower,
+                                                HYPRE_Int     *iupper,
+                                                HYPRE_Int      nentries,
+                                                HYPRE_Int     *entries,
+                                                HYPRE_Complex *values);
+
+/**
+ * (Optional) Make the matrix matrix-free.  Instead of storing coefficients, the
+ * function \e coeff_fcn is called (with \e coeff_data as its first argument)
+ * to compute them a few grid planes at a time whenever they are needed.  This
+ * must be called before \ref HYPRE_StructMatrixInitialize, and values may then
+ * not be set, read, or printed.  Matrix-free matrices are not stored
+ * symmetrically and must have variable coefficients.
+ *
+ * Presently supported: matrix-vector products, and PFMG with Jacobi relaxation
+ * (which evaluates the coefficients a slab of planes at a time during setup to
+ * build the coarse grids).  Red-black Gauss-Seidel relaxation, SMG, SparseMSG,
+ * cyclic reduction, and diagonal scaling return an error.  Not supported on
+ * GPUs.
+ **/
+HYPRE_Int HYPRE_StructMatrixSetCoeffFcn( HYPRE_StructMatrix          matrix,
+                                         HYPRE_StructMatrixCoeffFcn  coeff_fcn,
+                                         void                       *coeff_data );
+
 /**
  * Set the ghost layer in the matrix
  **/
@@ -1217,6 +1217,11 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* reused for all communications after the first one */
+   struct hypre_CommHandle_struct *persistent_handle;
+#endif
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -1243,6 +1248,12 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   HYPRE_Int          persistent;  /* owned by comm_pkg, requests are persistent */
+   HYPRE_Int          in_use;
+   HYPRE_Int          tag;
+#endif
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1336,6 +1347,10 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+#define hypre_CommPkgPersistentHandle(comm_pkg)           (comm_pkg -> persistent_handle)
+#endif
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1352,6 +1367,12 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_device)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_device)
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
+#define hypre_CommHandleInUse(comm_handle)                (comm_handle -> in_use)
+#define hypre_CommHandleTag(comm_handle)                  (comm_handle -> tag)
+#endif
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -1481,10 +1502,17 @@ typedef struct hypre_StructMatrix_struct
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   HYPRE_StructMatrixCoeffFcn  coeff_fcn;           /* Coefficient callback for matrix-free
+                                                       matrices (no data is stored) */
+   void                 *coeff_data;                /* User data passed to coeff_fcn */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
 
+/* Max number of coefficients computed at once for matrix-free matrices */
+#define HYPRE_STRUCT_COEFF_CHUNK 65536
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_StructMatrix
  *--------------------------------------------------------------------------*/
@@ -1509,6 +1537,8 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
+#define hypre_StructMatrixCoeffFcn(matrix)            ((matrix) -> coeff_fcn)
+#define hypre_StructMatrixCoeffData(matrix)           ((matrix) -> coeff_data)
 
 #define hypre_StructMatrixNDim(matrix) \
 hypre_StructGridNDim(hypre_StructMatrixGrid(matrix))
@@ -1894,9 +1924,13 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommPkgPackSendBuffers ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
+                                         HYPRE_Complex **send_buffers );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
+hypre_CommHandle *hypre_CommHandleCreatePersistent ( hypre_CommPkg *comm_pkg, HYPRE_Int tag );
+HYPRE_Int hypre_CommHandleDestroyPersistent ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                     HYPRE_Complex *recv_data, HYPRE_Int action );
 HYPRE_Int hypre_CommPkgDestroy ( hypre_CommPkg *comm_pkg );
@@ -1977,6 +2011,17 @@ HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix, HYPRE_Int nentries,
                                                  HYPRE_Int *entries );
+HYPRE_Int hypre_StructMatrixSetCoeffFcn ( hypre_StructMatrix *matrix,
+                                          HYPRE_StructMatrixCoeffFcn coeff_fcn, void *coeff_data );
+HYPRE_Int hypre_StructMatrixCoeffNumPlanes ( hypre_StructMatrix *matrix, hypre_Box *box,
+                                             hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatrixComputeCoeffs ( hypre_StructMatrix *matrix, hypre_Box *box,
+                                            HYPRE_Complex *values );
+HYPRE_Int hypre_StructMatrixCoeffSlabSize ( hypre_StructMatrix *matrix, HYPRE_Int d );
+hypre_StructMatrix *hypre_StructMatrixCreateSlab ( hypre_StructMatrix *matrix, HYPRE_Int d,
+                                                   HYPRE_Int lo, HYPRE_Int hi );
+hypre_StructMatrix *hypre_StructMatrixCreateSlabView ( hypre_StructMatrix *matrix, HYPRE_Int d,
+                                                       HYPRE_Int lo, HYPRE_Int hi );
 HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrintData ( FILE *file, hypre_StructMatrix *matrix, HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixReadData ( FILE *file, hypre_StructMatrix *matrix );
@@ -2004,6 +2049,8 @@ HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hy
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMF ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                 hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
@@ -288,9 +288,13 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommPkgPackSendBuffers ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
+                                         HYPRE_Complex **send_buffers );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
+hypre_CommHandle *hypre_CommHandleCreatePersistent ( hypre_CommPkg *comm_pkg, HYPRE_Int tag );
+HYPRE_Int hypre_CommHandleDestroyPersistent ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                     HYPRE_Complex *recv_data, HYPRE_Int action );
 HYPRE_Int hypre_CommPkgDestroy ( hypre_CommPkg *comm_pkg );
@@ -371,6 +375,17 @@ HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix, HYPRE_Int nentries,
                                                  HYPRE_Int *entries );
+HYPRE_Int hypre_StructMatrixSetCoeffFcn ( hypre_StructMatrix *matrix,
+                                          HYPRE_StructMatrixCoeffFcn coeff_fcn, void *coeff_data );
+HYPRE_Int hypre_StructMatrixCoeffNumPlanes ( hypre_StructMatrix *matrix, hypre_Box *box,
+                                             hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatrixComputeCoeffs ( hypre_StructMatrix *matrix, hypre_Box *box,
+                                            HYPRE_Complex *values );
+HYPRE_Int hypre_StructMatrixCoeffSlabSize ( hypre_StructMatrix *matrix, HYPRE_Int d );
+hypre_StructMatrix *hypre_StructMatrixCreateSlab ( hypre_StructMatrix *matrix, HYPRE_Int d,
+                                                   HYPRE_Int lo, HYPRE_Int hi );
+hypre_StructMatrix *hypre_StructMatrixCreateSlabView ( hypre_StructMatrix *matrix, HYPRE_Int d,
+                                                       HYPRE_Int lo, HYPRE_Int hi );
 HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrintData ( FILE *file, hypre_StructMatrix *matrix, HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixReadData ( FILE *file, hypre_StructMatrix *matrix );
@@ -398,6 +413,8 @@ HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hy
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMF ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                 hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
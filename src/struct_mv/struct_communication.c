@@ -762,6 +762,93 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Pack send_data into the send buffers of comm_pkg.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgPackSendBuffers( hypre_CommPkg  *comm_pkg,
+                              HYPRE_Complex  *send_data,
+                              HYPRE_Complex **send_buffers )
+{
+   HYPRE_Int            ndim       = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_sends  = hypre_CommPkgNumSends(comm_pkg);
+
+   hypre_CommType      *comm_type;
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int            num_entries;
+
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array, unitst_array[HYPRE_MAXDIM + 1];
+   HYPRE_Int           *order;
+
+   HYPRE_Complex       *dptr, *kptr, *lptr;
+
+   HYPRE_Int            i, j, d, ll;
+   HYPRE_Int            size;
+
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      num_entries = hypre_CommTypeNumEntries(comm_type);
+
+      dptr = (HYPRE_Complex *) send_buffers[i];
+      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      {
+         dptr += hypre_CommPrefixSize(num_entries);
+      }
+
+      for (j = 0; j < num_entries; j++)
+      {
+         comm_entry = hypre_CommTypeEntry(comm_type, j);
+         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+         order = hypre_CommEntryTypeOrder(comm_entry);
+         unitst_array[0] = 1;
+         for (d = 1; d <= ndim; d++)
+         {
+            unitst_array[d] = unitst_array[d - 1] * length_array[d - 1];
+         }
+
+         lptr = send_data + hypre_CommEntryTypeOffset(comm_entry);
+         for (ll = 0; ll < num_values; ll++)
+         {
+            if (order[ll] > -1)
+            {
+               kptr = lptr + order[ll] * stride_array[ndim];
+
+#define DEVICE_VAR is_device_ptr(dptr,kptr)
+               hypre_BasicBoxLoop2Begin(ndim, length_array,
+                                        stride_array, ki,
+                                        unitst_array, di);
+               {
+                  dptr[di] = kptr[ki];
+               }
+               hypre_BoxLoop2End(ki, di);
+#undef DEVICE_VAR
+
+               dptr += unitst_array[ndim];
+            }
+            else
+            {
+               size = 1;
+               for (d = 0; d < ndim; d++)
+               {
+                  size *= length_array[d];
+               }
+
+               hypre_Memset(dptr, 0, size * sizeof(HYPRE_Complex), HYPRE_MEMORY_DEVICE);
+
+               dptr += size;
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
@@ -809,9 +896,49 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    HYPRE_Complex       *dptr, *kptr, *lptr;
    HYPRE_Int           *qptr;
 
-   HYPRE_Int            i, j, d, ll;
+   HYPRE_Int            i, j;
    HYPRE_Int            size;
 
+#if defined(HYPRE_USING_PERSISTENT_COMM) && !defined(HYPRE_USING_GPU) && \
+    !defined(HYPRE_USING_DEVICE_OPENMP)
+   /*--------------------------------------------------------------------
+    * after the first communication, the message sizes are fixed, so the
+    * buffers and persistent requests of comm_pkg can be reused (device
+    * data is packed into device buffers, so this is host-only)
+    *--------------------------------------------------------------------*/
+
+   if ( !hypre_CommPkgFirstComm(comm_pkg) )
+   {
+      comm_handle = hypre_CommPkgPersistentHandle(comm_pkg);
+      if (comm_handle == NULL)
+      {
+         comm_handle = hypre_CommHandleCreatePersistent(comm_pkg, tag);
+         hypre_CommPkgPersistentHandle(comm_pkg) = comm_handle;
+      }
+
+      if ( !hypre_CommHandleInUse(comm_handle) && (hypre_CommHandleTag(comm_handle) == tag) )
+      {
+         hypre_CommPkgPackSendBuffers(comm_pkg, send_data,
+                                      hypre_CommHandleSendBuffers(comm_handle));
+         if (hypre_CommHandleNumRequests(comm_handle))
+         {
+            hypre_MPI_Startall(hypre_CommHandleNumRequests(comm_handle),
+                               hypre_CommHandleRequests(comm_handle));
+         }
+         hypre_ExchangeLocalData(comm_pkg, send_data, recv_data, action);
+
+         hypre_CommHandleSendData(comm_handle) = send_data;
+         hypre_CommHandleRecvData(comm_handle) = recv_data;
+         hypre_CommHandleAction(comm_handle)   = action;
+         hypre_CommHandleInUse(comm_handle)    = 1;
+
+         *comm_handle_ptr = comm_handle;
+
+         return hypre_error_flag;
+      }
+   }
+#endif
+
    /*--------------------------------------------------------------------
     * allocate requests and status
     *--------------------------------------------------------------------*/
@@ -933,63 +1060,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
     * pack send buffers
     *--------------------------------------------------------------------*/
 
-   for (i = 0; i < num_sends; i++)
-   {
-      comm_type = hypre_CommPkgSendType(comm_pkg, i);
-      num_entries = hypre_CommTypeNumEntries(comm_type);
-
-      dptr = (HYPRE_Complex *) send_buffers_device[i];
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
-      {
-         dptr += hypre_CommPrefixSize(num_entries);
-      }
-
-      for (j = 0; j < num_entries; j++)
-      {
-         comm_entry = hypre_CommTypeEntry(comm_type, j);
-         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
-         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
-         order = hypre_CommEntryTypeOrder(comm_entry);
-         unitst_array[0] = 1;
-         for (d = 1; d <= ndim; d++)
-         {
-            unitst_array[d] = unitst_array[d - 1] * length_array[d - 1];
-         }
-
-         lptr = send_data + hypre_CommEntryTypeOffset(comm_entry);
-         for (ll = 0; ll < num_values; ll++)
-         {
-            if (order[ll] > -1)
-            {
-               kptr = lptr + order[ll] * stride_array[ndim];
-
-#define DEVICE_VAR is_device_ptr(dptr,kptr)
-               hypre_BasicBoxLoop2Begin(ndim, length_array,
-                                        stride_array, ki,
-                                        unitst_array, di);
-               {
-                  dptr[di] = kptr[ki];
-               }
-               hypre_BoxLoop2End(ki, di);
-#undef DEVICE_VAR
-
-               dptr += unitst_array[ndim];
-            }
-            else
-            {
-               size = 1;
-               for (d = 0; d < ndim; d++)
-               {
-                  size *= length_array[d];
-               }
-
-               hypre_Memset(dptr, 0, size * sizeof(HYPRE_Complex), HYPRE_MEMORY_DEVICE);
-
-               dptr += size;
-            }
-         }
-      }
-   }
+   hypre_CommPkgPackSendBuffers(comm_pkg, send_data, send_buffers_device);
 
    /* Copy buffer data from Device to Host */
    if (num_sends > 0 && alloc_dev_buffer)
@@ -1091,7 +1162,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
     * set up comm_handle and return
     *--------------------------------------------------------------------*/
 
-   comm_handle = hypre_TAlloc(hypre_CommHandle, 1, HYPRE_MEMORY_HOST);
+   comm_handle = hypre_CTAlloc(hypre_CommHandle, 1, HYPRE_MEMORY_HOST);
 
    hypre_CommHandleCommPkg(comm_handle)     = comm_pkg;
    hypre_CommHandleSendData(comm_handle)    = send_data;
@@ -1301,6 +1372,14 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
 
    hypre_CommPkgFirstComm(comm_pkg) = 0;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      hypre_CommHandleInUse(comm_handle) = 0;
+      return hypre_error_flag;
+   }
+#endif
+
    /*--------------------------------------------------------------------
     * Free up communication handle
     *--------------------------------------------------------------------*/
@@ -1340,6 +1419,127 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
    return hypre_error_flag;
 }
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+
+/*--------------------------------------------------------------------------
+ * Create a persistent communication handle for comm_pkg.  The buffers and
+ * the MPI requests are set up once here and reused by every exchange with
+ * the same tag.  This must be called after the first communication, since
+ * the message sizes change after it.
+ *--------------------------------------------------------------------------*/
+
+hypre_CommHandle *
+hypre_CommHandleCreatePersistent( hypre_CommPkg *comm_pkg,
+                                  HYPRE_Int      tag )
+{
+   HYPRE_Int            num_sends  = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs  = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm       = hypre_CommPkgComm(comm_pkg);
+
+   hypre_CommHandle    *comm_handle;
+   hypre_CommType      *comm_type;
+   hypre_MPI_Request   *requests;
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+   HYPRE_Int            num_requests, i, j;
+
+   num_requests = num_sends + num_recvs;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+   if (num_sends > 0)
+   {
+      send_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgSendBufsize(comm_pkg),
+                                      HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
+         send_buffers[i] = send_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+   recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+   if (num_recvs > 0)
+   {
+      recv_buffers[0] = hypre_TAlloc(HYPRE_Complex, hypre_CommPkgRecvBufsize(comm_pkg),
+                                     HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
+         recv_buffers[i] = recv_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(recv_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(send_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+
+   comm_handle = hypre_CTAlloc(hypre_CommHandle, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CommHandleCommPkg(comm_handle)     = comm_pkg;
+   hypre_CommHandleNumRequests(comm_handle) = num_requests;
+   hypre_CommHandleRequests(comm_handle)    = requests;
+   hypre_CommHandleStatus(comm_handle)      =
+      hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+   hypre_CommHandleSendBuffers(comm_handle) = send_buffers;
+   hypre_CommHandleRecvBuffers(comm_handle) = recv_buffers;
+   hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers;
+   hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers;
+   hypre_CommHandlePersistent(comm_handle)  = 1;
+   hypre_CommHandleInUse(comm_handle)       = 0;
+   hypre_CommHandleTag(comm_handle)         = tag;
+
+   return comm_handle;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommHandleDestroyPersistent( hypre_CommHandle *comm_handle )
+{
+   HYPRE_Int  i;
+
+   if (comm_handle)
+   {
+      for (i = 0; i < hypre_CommHandleNumRequests(comm_handle); i++)
+      {
+         hypre_MPI_Request_free(&hypre_CommHandleRequests(comm_handle)[i]);
+      }
+      hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
+      if (hypre_CommPkgNumSends(hypre_CommHandleCommPkg(comm_handle)) > 0)
+      {
+         hypre_TFree(hypre_CommHandleSendBuffers(comm_handle)[0], HYPRE_MEMORY_HOST);
+      }
+      if (hypre_CommPkgNumRecvs(hypre_CommHandleCommPkg(comm_handle)) > 0)
+      {
+         hypre_TFree(hypre_CommHandleRecvBuffers(comm_handle)[0], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_CommHandleSendBuffers(comm_handle), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommHandleRecvBuffers(comm_handle), HYPRE_MEMORY_HOST);
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+#endif
+
 /*--------------------------------------------------------------------------
  * Execute local data exchanges.
  *--------------------------------------------------------------------------*/
@@ -1437,6 +1637,10 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
    if (comm_pkg)
    {
+#ifdef HYPRE_USING_PERSISTENT_COMM
+      hypre_CommHandleDestroyPersistent(hypre_CommPkgPersistentHandle(comm_pkg));
+#endif
+
       /* note that entries are allocated in two stages for To/Recv */
       if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
       {
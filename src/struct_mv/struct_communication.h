@@ -118,6 +118,11 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* reused for all communications after the first one */
+   struct hypre_CommHandle_struct *persistent_handle;
+#endif
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -144,6 +149,12 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   HYPRE_Int          persistent;  /* owned by comm_pkg, requests are persistent */
+   HYPRE_Int          in_use;
+   HYPRE_Int          tag;
+#endif
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -237,6 +248,10 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+#define hypre_CommPkgPersistentHandle(comm_pkg)           (comm_pkg -> persistent_handle)
+#endif
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -253,4 +268,10 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_device)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_device)
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
+#define hypre_CommHandleInUse(comm_handle)                (comm_handle -> in_use)
+#define hypre_CommHandleTag(comm_handle)                  (comm_handle -> tag)
+#endif
+
 #endif
@@ -173,7 +173,7 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
    {
       user_stencil = hypre_StructMatrixUserStencil(matrix);
 
-      if (hypre_StructMatrixSymmetric(matrix))
+      if (hypre_StructMatrixSymmetric(matrix) && !hypre_StructMatrixCoeffFcn(matrix))
       {
          /* store only symmetric stencil entry data */
          hypre_StructStencilSymmetrize(user_stencil, &stencil, &symm_elements);
@@ -532,6 +532,12 @@ hypre_StructMatrixInitialize( hypre_StructMatrix *matrix )
 
    hypre_StructMatrixInitializeShell(matrix);
 
+   /* matrix-free matrices store no coefficients */
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_StructMatrixDataSize(matrix) = 0;
+   }
+
    data = hypre_CTAlloc(HYPRE_Complex, hypre_StructMatrixDataSize(matrix), HYPRE_MEMORY_DEVICE);
    data_const = hypre_CTAlloc(HYPRE_Complex, hypre_StructMatrixDataConstSize(matrix),
                               HYPRE_MEMORY_HOST);
@@ -574,6 +580,12 @@ hypre_StructMatrixSetValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -726,6 +738,12 @@ hypre_StructMatrixSetBoxValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -916,6 +934,12 @@ hypre_StructMatrixSetConstantValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int           i, s;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
 
@@ -1075,6 +1099,12 @@ hypre_StructMatrixClearValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -1149,6 +1179,12 @@ hypre_StructMatrixClearBoxValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -1268,6 +1304,12 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
    HYPRE_Int              num_entries;
    /* End - variables for ghost layer identity code below */
 
+   /* there are no stored coefficients to communicate */
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient( matrix );
 
    /*-----------------------------------------------------------------------
@@ -1545,6 +1587,303 @@ HYPRE_Int  hypre_StructMatrixSetConstantEntries( hypre_StructMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixSetCoeffFcn
+ * Make the matrix matrix-free: no coefficients are stored, and coeff_fcn is
+ * called to compute them when they are needed.  This must be called before
+ * the matrix is initialized.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixSetCoeffFcn( hypre_StructMatrix         *matrix,
+                               HYPRE_StructMatrixCoeffFcn  coeff_fcn,
+                               void                       *coeff_data )
+{
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free struct matrices are not supported on GPUs");
+#else
+   if (hypre_StructMatrixStencil(matrix) != NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Coefficient function set after Initialize");
+      return hypre_error_flag;
+   }
+   if (hypre_StructMatrixConstantCoefficient(matrix) != 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices must have variable coefficients");
+      return hypre_error_flag;
+   }
+
+   hypre_StructMatrixCoeffFcn(matrix)  = coeff_fcn;
+   hypre_StructMatrixCoeffData(matrix) = coeff_data;
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCoeffNumPlanes
+ * Returns the number of planes in the slowest dimension of box for which the
+ * coefficients of a matrix-free matrix are computed at once.  This is the
+ * largest multiple of stride that keeps the coefficient buffer under
+ * HYPRE_STRUCT_COEFF_CHUNK values, but at least one (strided) plane.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixCoeffNumPlanes( hypre_StructMatrix *matrix,
+                                  hypre_Box          *box,
+                                  hypre_IndexRef      stride )
+{
+   HYPRE_Int  ndim = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int  stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+   HYPRE_Int  plane_size, nplanes, d;
+
+   plane_size = stencil_size;
+   for (d = 0; d < ndim - 1; d++)
+   {
+      plane_size *= hypre_BoxSizeD(box, d);
+   }
+   nplanes = HYPRE_STRUCT_COEFF_CHUNK / hypre_max(plane_size, 1);
+   nplanes = hypre_max(nplanes / stride[ndim - 1], 1) * stride[ndim - 1];
+
+   return hypre_min(nplanes, hypre_BoxSizeD(box, ndim - 1));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixComputeCoeffs
+ * Compute all stencil coefficients of a matrix-free matrix on box, which
+ * must be contained in a grid box.  The values are ordered as in
+ * hypre_StructMatrixSetBoxValues.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixComputeCoeffs( hypre_StructMatrix *matrix,
+                                 hypre_Box          *box,
+                                 HYPRE_Complex      *values )
+{
+   HYPRE_Int   stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+   HYPRE_Int  *entries;
+   HYPRE_Int   s;
+
+   entries = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   for (s = 0; s < stencil_size; s++)
+   {
+      entries[s] = s;
+   }
+
+   if ((hypre_StructMatrixCoeffFcn(matrix))(hypre_StructMatrixCoeffData(matrix),
+                                            hypre_BoxIMin(box), hypre_BoxIMax(box),
+                                            stencil_size, entries, values))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix coefficient function failed");
+   }
+
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCoeffSlabSize
+ * Returns the number of planes in dimension d of the slabs used to evaluate a
+ * matrix-free matrix with hypre_StructMatrixCreateSlab.  A slab of any local
+ * box holds at most HYPRE_STRUCT_COEFF_CHUNK values, but at least one plane.
+ * The value is the same on all processes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixCoeffSlabSize( hypre_StructMatrix *matrix,
+                                 HYPRE_Int           d )
+{
+   hypre_BoxArray  *boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   HYPRE_Int        stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+   hypre_Box       *box;
+   HYPRE_Int        nplanes, gnplanes, plane_size, i;
+
+   nplanes = HYPRE_STRUCT_COEFF_CHUNK;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxSizeD(box, d) > 0)
+      {
+         plane_size = stencil_size * (hypre_BoxVolume(box) / hypre_BoxSizeD(box, d));
+         nplanes = hypre_min(nplanes, HYPRE_STRUCT_COEFF_CHUNK / hypre_max(plane_size, 1));
+      }
+   }
+   nplanes = hypre_max(nplanes, 1);
+   hypre_MPI_Allreduce(&nplanes, &gnplanes, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_StructMatrixComm(matrix));
+
+   return gnplanes;
+}
+
+/*--------------------------------------------------------------------------
+ * Create the grid of the planes lo <= i_d <= hi of the matrix grid.  It has the
+ * boxes of the matrix grid clipped to the planes with the same ids, so that box
+ * numbers and ids refer to the same boxes in both grids.  Boxes outside of the
+ * planes are made empty enough that their ghost layers are empty too, since
+ * empty boxes are not known to the other processes when communicating.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructMatrixCreateSlabGrid( hypre_StructMatrix *matrix,
+                                  HYPRE_Int           d,
+                                  HYPRE_Int           lo,
+                                  HYPRE_Int           hi,
+                                  hypre_StructGrid  **slab_grid_ptr )
+{
+   hypre_StructGrid  *grid  = hypre_StructMatrixGrid(matrix);
+   HYPRE_Int          ndim  = hypre_StructGridNDim(grid);
+   HYPRE_Int         *num_ghost = hypre_StructMatrixNumGhost(matrix);
+   hypre_BoxArray    *boxes = hypre_BoxArrayDuplicate(hypre_StructGridBoxes(grid));
+   HYPRE_Int         *ids;
+   hypre_StructGrid  *slab_grid;
+   hypre_Box         *box;
+   hypre_Index        periodic;
+   HYPRE_Int          i;
+
+   ids = hypre_TAlloc(HYPRE_Int, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      hypre_BoxIMinD(box, d) = hypre_max(hypre_BoxIMinD(box, d), lo);
+      hypre_BoxIMaxD(box, d) = hypre_min(hypre_BoxIMaxD(box, d), hi);
+      if (hypre_BoxSizeD(box, d) == 0)
+      {
+         hypre_BoxIMaxD(box, d) = hypre_BoxIMinD(box, d) - 1 -
+                                  num_ghost[2 * d] - num_ghost[2 * d + 1];
+      }
+      ids[i] = hypre_StructGridIDs(grid)[i];
+   }
+
+   /* the slab is not periodic in dimension d */
+   hypre_CopyIndex(hypre_StructGridPeriodic(grid), periodic);
+   hypre_IndexD(periodic, d) = 0;
+
+   hypre_StructGridCreate(hypre_StructGridComm(grid), ndim, &slab_grid);
+   hypre_StructGridSetBoxes(slab_grid, boxes);
+   hypre_StructGridSetIDs(slab_grid, ids);
+   hypre_StructGridSetPeriodic(slab_grid, periodic);
+   hypre_StructGridAssemble(slab_grid);
+
+   *slab_grid_ptr = slab_grid;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCreateSlab
+ * Create an assembled matrix that stores the coefficients of a matrix-free
+ * matrix on the planes lo <= i_d <= hi.  Its grid is made of the boxes of the
+ * matrix grid clipped to the planes, with the same box numbers and ids.  All
+ * stencil entries are stored, since with symmetric storage the upper entries
+ * of plane hi would live in plane hi + 1.  Ghost values across the sides of
+ * the slab are not set.  This is collective.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixCreateSlab( hypre_StructMatrix *matrix,
+                              HYPRE_Int           d,
+                              HYPRE_Int           lo,
+                              HYPRE_Int           hi )
+{
+   hypre_StructStencil  *stencil = hypre_StructMatrixStencil(matrix);
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(stencil);
+
+   hypre_StructGrid     *slab_grid;
+   hypre_StructMatrix   *smatrix;
+   hypre_BoxArray       *boxes;
+   hypre_Box            *box;
+   HYPRE_Complex        *values;
+   HYPRE_Int            *entries;
+   HYPRE_Int             i, s;
+
+   hypre_StructMatrixCreateSlabGrid(matrix, d, lo, hi, &slab_grid);
+   smatrix = hypre_StructMatrixCreate(hypre_StructMatrixComm(matrix), slab_grid,
+                                      hypre_StructMatrixUserStencil(matrix));
+   hypre_StructGridDestroy(slab_grid);
+   hypre_StructMatrixSetNumGhost(smatrix, hypre_StructMatrixNumGhost(matrix));
+   hypre_StructMatrixInitialize(smatrix);
+
+   entries = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   for (s = 0; s < stencil_size; s++)
+   {
+      entries[s] = s;
+   }
+
+   boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(smatrix));
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxVolume(box) > 0)
+      {
+         values = hypre_TAlloc(HYPRE_Complex, stencil_size * hypre_BoxVolume(box),
+                               HYPRE_MEMORY_HOST);
+         hypre_StructMatrixComputeCoeffs(matrix, box, values);
+         hypre_StructMatrixSetBoxValues(smatrix, box, box, stencil_size, entries,
+                                        values, 0, i, 0);
+         hypre_TFree(values, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+
+   hypre_StructMatrixAssemble(smatrix);
+
+   return smatrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCreateSlabView
+ * Create a matrix on the planes lo <= i_d <= hi of the grid of matrix (see
+ * hypre_StructMatrixCreateSlab) that shares the coefficients of matrix, as in
+ * hypre_StructMatrixCreateMask.  Setting its values sets those of matrix.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixCreateSlabView( hypre_StructMatrix *matrix,
+                                  HYPRE_Int           d,
+                                  HYPRE_Int           lo,
+                                  HYPRE_Int           hi )
+{
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+   hypre_BoxArray       *data_space   = hypre_StructMatrixDataSpace(matrix);
+   HYPRE_Int             num_boxes    = hypre_BoxArraySize(data_space);
+
+   hypre_StructGrid     *slab_grid;
+   hypre_StructMatrix   *view;
+   HYPRE_Int           **data_indices;
+   HYPRE_Int             i, s;
+
+   hypre_StructMatrixCreateSlabGrid(matrix, d, lo, hi, &slab_grid);
+   view = hypre_StructMatrixCreate(hypre_StructMatrixComm(matrix), slab_grid,
+                                   hypre_StructMatrixUserStencil(matrix));
+   hypre_StructGridDestroy(slab_grid);
+   hypre_StructMatrixSymmetric(view) = hypre_StructMatrixSymmetric(matrix);
+   hypre_StructMatrixConstantCoefficient(view) = hypre_StructMatrixConstantCoefficient(matrix);
+   hypre_StructMatrixSetNumGhost(view, hypre_StructMatrixNumGhost(matrix));
+
+   data_indices = hypre_TAlloc(HYPRE_Int *, num_boxes, HYPRE_MEMORY_HOST);
+   if (num_boxes > 0)
+   {
+      data_indices[0] = hypre_TAlloc(HYPRE_Int, stencil_size * num_boxes, HYPRE_MEMORY_HOST);
+   }
+   for (i = 0; i < num_boxes; i++)
+   {
+      data_indices[i] = data_indices[0] + stencil_size * i;
+      for (s = 0; s < stencil_size; s++)
+      {
+         data_indices[i][s] = hypre_StructMatrixDataIndices(matrix)[i][s];
+      }
+   }
+   hypre_StructMatrixDataSpace(view)   = hypre_BoxArrayDuplicate(data_space);
+   hypre_StructMatrixDataIndices(view) = data_indices;
+
+   hypre_StructMatrixInitializeShell(view);
+   hypre_StructMatrixInitializeData(view, hypre_StructMatrixData(matrix),
+                                    hypre_StructMatrixDataConst(matrix));
+
+   return view;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1568,6 +1907,12 @@ hypre_StructMatrixClearGhostValues( hypre_StructMatrix *matrix )
 
    HYPRE_Int             i, j, s;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Set the matrix coefficients
     *-----------------------------------------------------------------------*/
@@ -1641,6 +1986,12 @@ hypre_StructMatrixPrintData( FILE               *file,
    HYPRE_Int             center_rank;
    HYPRE_Complex        *h_data;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /* Allocate/Point to data on the host memory */
    if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
    {
@@ -1781,6 +2132,12 @@ hypre_StructMatrixPrint( const char         *filename,
    HYPRE_Int             i, j, d;
    HYPRE_Int             myid;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------
     * Open file
     *----------------------------------------*/
@@ -1976,6 +2333,12 @@ hypre_StructMatrixMigrate( hypre_StructMatrix *from_matrix,
    HYPRE_Complex         *matrix_data_comm_from = matrix_data_from;
    HYPRE_Complex         *matrix_data_comm_to = matrix_data_to;
 
+   if (hypre_StructMatrixCoeffFcn(from_matrix) || hypre_StructMatrixCoeffFcn(to_matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /*------------------------------------------------------
     * Set up hypre_CommPkg
     *------------------------------------------------------*/
@@ -2068,6 +2431,12 @@ hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix)
 
    HYPRE_Int           i, i2, j;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Set the matrix coefficients
     *-----------------------------------------------------------------------*/
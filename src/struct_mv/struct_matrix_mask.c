@@ -56,6 +56,12 @@ hypre_StructMatrixCreateMask( hypre_StructMatrix *matrix,
    stencil_size  = hypre_StructStencilSize(stencil);
    stencil_data  = hypre_StructMatrixStencilData(matrix);
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free matrices store no coefficients");
+      return NULL;
+   }
+
    mask = hypre_CTAlloc(hypre_StructMatrix,  1, HYPRE_MEMORY_HOST);
 
    hypre_StructMatrixComm(mask) = hypre_StructMatrixComm(matrix);
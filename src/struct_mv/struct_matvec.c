@@ -248,6 +248,12 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
        * y += A*x
        *--------------------------------------------------------------------*/
 
+      if (hypre_StructMatrixCoeffFcn(A))
+      {
+         hypre_StructMatvecMF( alpha, A, x, y, compute_box_aa, stride );
+         continue;
+      }
+
       switch ( constant_coefficient )
       {
          case 0:
@@ -1373,6 +1379,151 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecMF
+ * core of struct matvec computation for matrix-free matrices.  The
+ * coefficients are computed a few planes of each compute box at a time.
+ * As in hypre_StructMatvecCC0, y has been scaled by beta/alpha.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_StructMatvecMF( HYPRE_Complex       alpha,
+                                hypre_StructMatrix *A,
+                                hypre_StructVector *x,
+                                hypre_StructVector *y,
+                                hypre_BoxArrayArray     *compute_box_aa,
+                                hypre_IndexRef           stride
+                              )
+{
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free struct matvec is not supported on GPUs");
+#else
+   HYPRE_Int                i, j, k, s;
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *slab_box;
+   hypre_Box               *v_data_box;
+
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+   HYPRE_Int               *xoff;
+
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   HYPRE_Complex           *vp = NULL;
+   HYPRE_Int                vp_size = 0;
+   hypre_Index              v_start;
+   hypre_Index              v_stride;
+   HYPRE_Int                nplanes, kmax;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   slab_box   = hypre_BoxCreate(ndim);
+   v_data_box = hypre_BoxCreate(ndim);
+
+   /* the coefficients of each point are stored contiguously, so view them as
+    * a box that is stencil_size times wider in the first dimension */
+   hypre_CopyIndex(stride, v_stride);
+   hypre_IndexD(v_stride, 0) *= stencil_size;
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         xoff[s] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[s]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         if (hypre_BoxVolume(compute_box) == 0)
+         {
+            continue;
+         }
+
+         nplanes = hypre_StructMatrixCoeffNumPlanes(A, compute_box, stride);
+         kmax    = hypre_BoxIMaxD(compute_box, ndim - 1);
+         hypre_CopyBox(compute_box, slab_box);
+         hypre_BoxIMaxD(slab_box, ndim - 1) = hypre_BoxIMinD(slab_box, ndim - 1) + nplanes - 1;
+         if (stencil_size * hypre_BoxVolume(slab_box) > vp_size)
+         {
+            vp_size = stencil_size * hypre_BoxVolume(slab_box);
+            hypre_TFree(vp, HYPRE_MEMORY_HOST);
+            vp = hypre_TAlloc(HYPRE_Complex, vp_size, HYPRE_MEMORY_HOST);
+         }
+
+         for (k = hypre_BoxIMinD(compute_box, ndim - 1); k <= kmax; k += nplanes)
+         {
+            hypre_BoxIMinD(slab_box, ndim - 1) = k;
+            hypre_BoxIMaxD(slab_box, ndim - 1) = hypre_min(k + nplanes - 1, kmax);
+            hypre_StructMatrixComputeCoeffs(A, slab_box, vp);
+
+            hypre_CopyBox(slab_box, v_data_box);
+            hypre_BoxIMinD(v_data_box, 0) *= stencil_size;
+            hypre_BoxIMaxD(v_data_box, 0) *= stencil_size;
+            hypre_BoxIMaxD(v_data_box, 0) += stencil_size - 1;
+
+            start = hypre_BoxIMin(slab_box);
+            hypre_BoxGetStrideSize(slab_box, stride, loop_size);
+            hypre_CopyIndex(start, v_start);
+            hypre_IndexD(v_start, 0) *= stencil_size;
+            hypre_BoxLoop3Begin(ndim, loop_size,
+                                v_data_box, v_start, v_stride, vi,
+                                x_data_box, start, stride, xi,
+                                y_data_box, start, stride, yi);
+            {
+               HYPRE_Int      ss;
+               HYPRE_Complex  sum = 0.0;
+
+               for (ss = 0; ss < stencil_size; ss++)
+               {
+                  sum += vp[vi + ss] * xp[xi + xoff[ss]];
+               }
+               yp[yi] += sum;
+            }
+            hypre_BoxLoop3End(vi, xi, yi);
+         }
+
+         if (alpha != 1.0)
+         {
+            start = hypre_BoxIMin(compute_box);
+            hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+            hypre_BoxLoop1Begin(ndim, loop_size,
+                                y_data_box, start, stride, yi);
+            {
+               yp[yi] *= alpha;
+            }
+            hypre_BoxLoop1End(yi);
+         }
+      }
+   }
+
+   hypre_TFree(vp, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(slab_box);
+   hypre_BoxDestroy(v_data_box);
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecDestroy
  *--------------------------------------------------------------------------*/
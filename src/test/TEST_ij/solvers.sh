@@ -176,6 +176,8 @@ FILES="\
  ${TNAME}.out.211\
  ${TNAME}.out.212\
  ${TNAME}.out.213\
+ ${TNAME}.out.214\
+ ${TNAME}.out.215\
 "
 
 for i in $FILES
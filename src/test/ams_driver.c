@@ -109,6 +109,8 @@ hypre_int main (hypre_int argc, char *argv[])
    HYPRE_Real rtol;
    HYPRE_Int rr;
    HYPRE_Int zero_cond;
+   HYPRE_Int concurrent;
+   HYPRE_Int matrix_free_Pi;
    HYPRE_Int blockSize;
    HYPRE_Solver solver, precond;
 
@@ -173,6 +175,8 @@ hypre_int main (hypre_int argc, char *argv[])
    rtol = 0;
    rr = 0;
    zero_cond = 0;
+   concurrent = 0;
+   matrix_free_Pi = 0;
 
    /* Parse command line */
    {
@@ -296,6 +300,16 @@ hypre_int main (hypre_int argc, char *argv[])
             arg_index++;
             zero_cond = 1;
          }
+         else if ( strcmp(argv[arg_index], "-concurrent") == 0 )
+         {
+            arg_index++;
+            concurrent = 1;
+         }
+         else if ( strcmp(argv[arg_index], "-mfpi") == 0 )
+         {
+            arg_index++;
+            matrix_free_Pi = 1;
+         }
          else if ( strcmp(argv[arg_index], "-help") == 0 )
          {
             print_usage = 1;
@@ -343,6 +357,8 @@ hypre_int main (hypre_int argc, char *argv[])
          hypre_printf("    -rlxo <num>          : SOR parameter (usuallyin (0,2))     \n");
          hypre_printf("    -coord               : use coordinate vectors              \n");
          hypre_printf("    -h1                  : use block-diag Poisson solves       \n");
+         hypre_printf("    -concurrent          : concurrent additive subspace solves \n");
+         hypre_printf("    -mfpi                : matrix-free Nedelec interpolation   \n");
          hypre_printf("    -sing                : curl-curl only (singular) problem   \n");
          hypre_printf("\n");
          hypre_printf("  AME eigensolver options:                                     \n");
@@ -493,6 +509,8 @@ hypre_int main (hypre_int argc, char *argv[])
       HYPRE_AMSSetMaxIter(solver, maxit);
       HYPRE_AMSSetTol(solver, tol);
       HYPRE_AMSSetCycleType(solver, cycle_type);
+      HYPRE_AMSSetConcurrentSubspaces(solver, concurrent);
+      HYPRE_AMSSetMatrixFreePi(solver, matrix_free_Pi);
       HYPRE_AMSSetPrintLevel(solver, 1);
       HYPRE_AMSSetDiscreteGradient(solver, G);
 
@@ -614,6 +632,8 @@ hypre_int main (hypre_int argc, char *argv[])
          HYPRE_AMSSetMaxIter(precond, 1);
          HYPRE_AMSSetTol(precond, 0.0);
          HYPRE_AMSSetCycleType(precond, cycle_type);
+         HYPRE_AMSSetConcurrentSubspaces(precond, concurrent);
+         HYPRE_AMSSetMatrixFreePi(precond, matrix_free_Pi);
          HYPRE_AMSSetPrintLevel(precond, 0);
          HYPRE_AMSSetDiscreteGradient(precond, G);
 
@@ -745,6 +765,8 @@ hypre_int main (hypre_int argc, char *argv[])
       HYPRE_AMSSetMaxIter(precond, 1);
       HYPRE_AMSSetTol(precond, 0.0);
       HYPRE_AMSSetCycleType(precond, cycle_type);
+      HYPRE_AMSSetConcurrentSubspaces(precond, concurrent);
+      HYPRE_AMSSetMatrixFreePi(precond, matrix_free_Pi);
       HYPRE_AMSSetPrintLevel(precond, 0);
       HYPRE_AMSSetDiscreteGradient(precond, G);
 
@@ -248,6 +248,10 @@ main( hypre_int argc,
    HYPRE_Int      min_coarse_size = 0;
    /* redundant coarse grid solve */
    HYPRE_Int      seq_threshold = 0;
+   HYPRE_Int      redist_threshold = 0;
+   /* smoothed aggregation */
+   HYPRE_Int      sa_num_levels = 0;
+   HYPRE_Real     sa_jacobi_weight = -1.0;
    HYPRE_Int      redundant = 0;
    /* additive versions */
    HYPRE_Int    additive = -1;
@@ -408,6 +412,8 @@ main( hypre_int argc,
    HYPRE_Int mgr_num_gsmooth_sweeps = 1;
    HYPRE_Int mgr_restrict_type = 0;
    HYPRE_Int mgr_num_restrict_sweeps = 0;
+   HYPRE_Int mgr_num_reuse_setups = 0;
+   HYPRE_Int mgr_setup_lag = 0;
    /* end mgr options */
 
    /* hypre_ILU options */
@@ -426,10 +432,18 @@ main( hypre_int argc,
    HYPRE_Int  fsai_max_step_size = 1;
    HYPRE_Int  fsai_eig_max_iters = 5;
    HYPRE_Real fsai_kap_tolerance = 1.0e-03;
+   HYPRE_Int  fsai_num_levels = 1;
+   HYPRE_Real fsai_threshold = 0.0;
    /* end hypre FSAI options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
    HYPRE_Int       nongalerk_num_tol = 0;
+   HYPRE_Real      nongal_op_complexity = 0.0;
+   HYPRE_Real      nongal_stencil_growth = 0.0;
+   HYPRE_Int       amg_tune = 0;
+   HYPRE_Int       amg_tune_trials = 0;
+   char           *amg_tune_file = NULL;
+   char           *amg_tune_read = NULL;
 
    /* coasening data */
    HYPRE_Int     num_cpt = 0;
@@ -1132,6 +1146,18 @@ main( hypre_int argc,
          arg_index++;
          mgr_num_restrict_sweeps = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mgr_reuse") == 0 )
+      {
+         /* number of setups that reuse the first one */
+         arg_index++;
+         mgr_num_reuse_setups = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mgr_setup_lag") == 0 )
+      {
+         /* lag of the inner solver setups with -mgr_reuse */
+         arg_index++;
+         mgr_setup_lag = atoi(argv[arg_index++]);
+      }
       /* end mgr options */
       /* begin ilu options*/
       else if ( strcmp(argv[arg_index], "-ilu_type") == 0 )
@@ -1203,6 +1229,16 @@ main( hypre_int argc,
          arg_index++;
          fsai_kap_tolerance = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fs_num_levels") == 0 )
+      {
+         arg_index++;
+         fsai_num_levels = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fs_threshold") == 0 )
+      {
+         arg_index++;
+         fsai_threshold = atof(argv[arg_index++]);
+      }
       /* end FSAI options */
 #if defined(HYPRE_USING_GPU)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
@@ -1439,6 +1475,21 @@ main( hypre_int argc,
          arg_index++;
          seq_threshold  = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-redist_th") == 0 )
+      {
+         arg_index++;
+         redist_threshold  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sa_nl") == 0 )
+      {
+         arg_index++;
+         sa_num_levels  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sa_jw") == 0 )
+      {
+         arg_index++;
+         sa_jacobi_weight  = atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-red") == 0 )
       {
          arg_index++;
@@ -1790,6 +1841,32 @@ main( hypre_int argc,
          dslu_threshold  = atoi(argv[arg_index++]);
       }
 #endif
+      else if ( strcmp(argv[arg_index], "-nongal_oc") == 0 )
+      {
+         arg_index++;
+         nongal_op_complexity = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-nongal_sg") == 0 )
+      {
+         arg_index++;
+         nongal_stencil_growth = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_tune") == 0 )
+      {
+         arg_index++;
+         amg_tune = 1;
+         amg_tune_trials = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_tune_file") == 0 )
+      {
+         arg_index++;
+         amg_tune_file = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-amg_tune_read") == 0 )
+      {
+         arg_index++;
+         amg_tune_read = argv[arg_index++];
+      }
       else if ( strcmp(argv[arg_index], "-nongalerk_tol") == 0 )
       {
          arg_index++;
@@ -2063,8 +2140,10 @@ main( hypre_int argc,
          hypre_printf("       16=Chebyshev  \n");
          hypre_printf("       17=FCF-Jacobi  \n");
          hypre_printf("       18=L1-Jacobi (may be used with -CF) \n");
+         hypre_printf("       88=multicolor L1-Gauss-Seidel (thread-count independent) \n");
          hypre_printf("       9=Gauss elimination (use for coarsest grid only)  \n");
          hypre_printf("       99=Gauss elimination with pivoting (use for coarsest grid only)  \n");
+         hypre_printf("       39=sparse direct (coarsest grid only)  \n");
          hypre_printf("       20= Nodal Weighted Jacobi (for systems only) \n");
          hypre_printf("       23= Nodal Hybrid Jacobi/Gauss-Seidel (for systems only) \n");
          hypre_printf("       26= Nodal Hybrid Symmetric Gauss-Seidel  (for systems only)\n");
@@ -2123,6 +2202,9 @@ main( hypre_int argc,
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
+         hypre_printf("  -redist_th  <val>      : redistribute coarse levels with fewer rows per process\n");
+         hypre_printf("  -sa_nl  <val>          : set number of smoothed aggregation levels (default:0)\n");
+         hypre_printf("  -sa_jw  <val>          : set smoothed aggregation Jacobi weight (default:auto)\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
          hypre_printf("  -sai_filt <val>        : set ParaSAILS filter = val \n");
@@ -2222,6 +2304,12 @@ main( hypre_int argc,
          hypre_printf("  -nongalerk_tol <val> <list>    : specify the NonGalerkin drop tolerance\n");
          hypre_printf("                                   and list contains the values, where last value\n");
          hypre_printf("                                   in list is repeated if val < num_levels in AMG\n");
+         hypre_printf("  -nongal_oc <val>               : sparsify coarse operators to this op. complexity\n");
+         hypre_printf("  -nongal_sg <val>               : sparsify coarse operators to this stencil growth\n");
+         hypre_printf("  -amg_tune <val>                : autotune AMG parameters with at most val trials\n");
+         hypre_printf("                                   (one sweep over all parameters if val <= 0)\n");
+         hypre_printf("  -amg_tune_file <filename>      : write the autotuned parameters to a file\n");
+         hypre_printf("  -amg_tune_read <filename>      : read AMG parameters written by -amg_tune_file\n");
 
          /* MGR options */
          hypre_printf("  -mgr_bsize   <val>               : set block size = val\n");
@@ -2237,6 +2325,10 @@ main( hypre_int argc,
          hypre_printf("                                     for F-relaxation \n");
          hypre_printf("  -mgr_frelax_method   1           : Use a 'multi-level smoother' strategy \n");
          hypre_printf("                                     for F-relaxation \n");
+         hypre_printf("  -mgr_reuse   <val>               : redo the MGR setup val times on A with\n");
+         hypre_printf("                                     rescaled rows, reusing the first setup\n");
+         hypre_printf("  -mgr_setup_lag   <val>           : with -mgr_reuse, redo the F-relaxation and\n");
+         hypre_printf("                                     coarse solver setups every val+1 setups\n");
          /* end MGR options */
          /* hypre ILU options */
          hypre_printf("  -ilu_type   <val>                : set ILU factorization type = val\n");
@@ -2259,10 +2351,13 @@ main( hypre_int argc,
          hypre_printf("  -ilu_sm_max_iter   <val>         : set number of iterations when applied as a smmother in AMG = val \n");
          /* end ILU options */
          /* hypre FSAI options */
+         hypre_printf("  -fs_algo_type <val>              : FSAI algorithm type (3: distributed, 4: static pattern) \n");
          hypre_printf("  -fs_max_steps <val>              : Maximum number of steps for FSAI \n");
          hypre_printf("  -fs_max_step_size <val>          : Maximum step size for FSAI \n");
          hypre_printf("  -fs_eig_max_iters <val>          : Number of iterations for computing maximum eigenvalue of preconditioned operator \n");
          hypre_printf("  -fs_kap_tol <val>                : Kap. grad. reduction theshold for FSAI \n");
+         hypre_printf("  -fs_num_levels <val>             : Power of A for the static FSAI pattern \n");
+         hypre_printf("  -fs_threshold <val>              : Dropping threshold for the static FSAI pattern \n");
          /* end FSAI options */
          /* hypre AMG-DD options */
          hypre_printf("  -amgdd_start_level   <val>       : set AMG-DD start level = val\n");
@@ -3663,6 +3758,11 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetTol(amg_solver, tol);
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
+      HYPRE_BoomerAMGSetRedistThreshold(amg_solver, redist_threshold);
+      HYPRE_BoomerAMGSetSANumLevels(amg_solver, sa_num_levels);
+      HYPRE_BoomerAMGSetSAJacobiWeight(amg_solver, sa_jacobi_weight);
+      HYPRE_BoomerAMGSetNonGalerkinOpComplexity(amg_solver, nongal_op_complexity);
+      HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(amg_solver, nongal_stencil_growth);
       HYPRE_BoomerAMGSetRedundant(amg_solver, redundant);
       HYPRE_BoomerAMGSetMaxCoarseSize(amg_solver, coarse_threshold);
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
@@ -3810,6 +3910,14 @@ main( hypre_int argc,
 #endif
       if (solver_id == 0)
       {
+         if (amg_tune_read)
+         {
+            HYPRE_BoomerAMGReadAutotune(amg_solver, amg_tune_read);
+         }
+         if (amg_tune)
+         {
+            HYPRE_BoomerAMGAutotune(amg_solver, parcsr_A, b, x, amg_tune_trials, amg_tune_file);
+         }
          HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
       }
       else if (solver_id == 90)
@@ -4010,6 +4118,11 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetTol(amg_solver, tol);
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
+      HYPRE_BoomerAMGSetRedistThreshold(amg_solver, redist_threshold);
+      HYPRE_BoomerAMGSetSANumLevels(amg_solver, sa_num_levels);
+      HYPRE_BoomerAMGSetSAJacobiWeight(amg_solver, sa_jacobi_weight);
+      HYPRE_BoomerAMGSetNonGalerkinOpComplexity(amg_solver, nongal_op_complexity);
+      HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(amg_solver, nongal_stencil_growth);
       HYPRE_BoomerAMGSetRedundant(amg_solver, redundant);
       HYPRE_BoomerAMGSetMaxCoarseSize(amg_solver, coarse_threshold);
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
@@ -4200,6 +4313,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(pcg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(pcg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(pcg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(pcg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(pcg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -4311,6 +4429,14 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetInterpVecQMax(pcg_precond, Q_max);
             HYPRE_BoomerAMGSetInterpVecAbsQTrunc(pcg_precond, Q_trunc);
          }
+         if (amg_tune_read)
+         {
+            HYPRE_BoomerAMGReadAutotune(pcg_precond, amg_tune_read);
+         }
+         if (amg_tune)
+         {
+            HYPRE_BoomerAMGAutotune(pcg_precond, parcsr_A, b, x, amg_tune_trials, amg_tune_file);
+         }
          HYPRE_PCGSetMaxIter(pcg_solver, mg_max_iter);
          HYPRE_PCGSetPrecond(pcg_solver,
                              (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
@@ -4386,6 +4512,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(pcg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(pcg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(pcg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(pcg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(pcg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -4505,6 +4636,8 @@ main( hypre_int argc,
          HYPRE_FSAISetMaxSteps(pcg_precond, fsai_max_steps);
          HYPRE_FSAISetMaxStepSize(pcg_precond, fsai_max_step_size);
          HYPRE_FSAISetKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_FSAISetNumLevels(pcg_precond, fsai_num_levels);
+         HYPRE_FSAISetThreshold(pcg_precond, fsai_threshold);
          HYPRE_FSAISetMaxIterations(pcg_precond, 1);
          HYPRE_FSAISetTolerance(pcg_precond, 0.0);
          HYPRE_FSAISetZeroGuess(pcg_precond, 1);
@@ -5831,6 +5964,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(amg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(amg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(amg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(amg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(amg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(amg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(amg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(amg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(amg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(amg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(amg_precond, min_coarse_size);
@@ -6026,6 +6164,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(pcg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(pcg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(pcg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(pcg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(pcg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6366,6 +6509,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(pcg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(pcg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(pcg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(pcg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(pcg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6571,6 +6719,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(pcg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(pcg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(pcg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(pcg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(pcg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6974,6 +7127,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(pcg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(pcg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(pcg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(pcg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(pcg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -7364,6 +7522,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(pcg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(pcg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(pcg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(pcg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(pcg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -7706,6 +7869,11 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedistThreshold(pcg_precond, redist_threshold);
+         HYPRE_BoomerAMGSetSANumLevels(pcg_precond, sa_num_levels);
+         HYPRE_BoomerAMGSetSAJacobiWeight(pcg_precond, sa_jacobi_weight);
+         HYPRE_BoomerAMGSetNonGalerkinOpComplexity(pcg_precond, nongal_op_complexity);
+         HYPRE_BoomerAMGSetNonGalerkinStencilGrowth(pcg_precond, nongal_stencil_growth);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -7931,6 +8099,11 @@ main( hypre_int argc,
 
       HYPRE_MGRSetGlobalsmoothType(mgr_solver, mgr_gsmooth_type);
       HYPRE_MGRSetMaxGlobalsmoothIters( mgr_solver, mgr_num_gsmooth_sweeps );
+      if (mgr_num_reuse_setups > 0)
+      {
+         HYPRE_MGRSetReuseSetup(mgr_solver, 1);
+         HYPRE_MGRSetInnerSetupLag(mgr_solver, mgr_setup_lag);
+      }
 
       /* create AMG coarse grid solver */
 
@@ -8011,6 +8184,64 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (mgr_num_reuse_setups > 0)
+      {
+         /* Redo the setup with new values on the sparsity pattern of A, as in
+          * a Newton iteration, by scaling the odd rows of A by 1 + k/10 */
+         hypre_ParCSRMatrix   *parcsr_M;
+         hypre_Vector         *row_scale;
+         HYPRE_Complex        *row_scale_h;
+         HYPRE_Int             num_rows = hypre_ParCSRMatrixNumRows(parcsr_A);
+         HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(parcsr_A);
+
+         parcsr_M    = hypre_ParCSRMatrixClone(parcsr_A, 1);
+         row_scale   = hypre_SeqVectorCreate(num_rows);
+         hypre_SeqVectorInitialize_v2(row_scale, memory_location);
+         row_scale_h = hypre_CTAlloc(HYPRE_Complex, num_rows, HYPRE_MEMORY_HOST);
+
+         for (j = 1; j <= mgr_num_reuse_setups; j++)
+         {
+            for (i = 0; i < num_rows; i++)
+            {
+               row_scale_h[i] = ((first_local_row + i) % 2) ? 1.0 + 0.1 * j : 1.0;
+            }
+            hypre_TMemcpy(hypre_VectorData(row_scale), row_scale_h, HYPRE_Complex, num_rows,
+                          memory_location, HYPRE_MEMORY_HOST);
+            hypre_ParCSRMatrixCopy(parcsr_A, parcsr_M, 1);
+            hypre_CSRMatrixDiagScale(hypre_ParCSRMatrixDiag(parcsr_M), row_scale, NULL);
+            hypre_CSRMatrixDiagScale(hypre_ParCSRMatrixOffd(parcsr_M), row_scale, NULL);
+
+            HYPRE_ParVectorSetConstantValues(x, 0.0);
+
+            time_index = hypre_InitializeTiming("MGR Reuse Setup");
+            hypre_BeginTiming(time_index);
+
+            HYPRE_MGRSetup(mgr_solver, parcsr_M, b, x);
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            HYPRE_MGRSolve(mgr_solver, parcsr_M, b, x);
+
+            HYPRE_MGRGetNumIterations(mgr_solver, &num_iterations);
+            HYPRE_MGRGetFinalRelativeResidualNorm(mgr_solver, &final_res_norm);
+
+            if (myid == 0)
+            {
+               hypre_printf("\n");
+               hypre_printf("Reuse setup %d: MGR Iterations = %d\n", j, num_iterations);
+               hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+               hypre_printf("\n");
+            }
+         }
+
+         hypre_TFree(row_scale_h, HYPRE_MEMORY_HOST);
+         hypre_SeqVectorDestroy(row_scale);
+         hypre_ParCSRMatrixDestroy(parcsr_M);
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -51,6 +51,13 @@ HYPRE_Int AddValuesVector( hypre_StructGrid  *gridvector,
                            HYPRE_Int          *period,
                            HYPRE_Real         value  )  ;
 
+HYPRE_Int MatrixFreeCoeffs( void          *data,
+                            HYPRE_Int     *ilower,
+                            HYPRE_Int     *iupper,
+                            HYPRE_Int      nentries,
+                            HYPRE_Int     *entries,
+                            HYPRE_Complex *values );
+
 /*--------------------------------------------------------------------------
  * Test driver for structured matrix interface (structured storage)
  *--------------------------------------------------------------------------*/
@@ -83,6 +90,7 @@ main( hypre_int argc,
    HYPRE_Int           v_num_ghost[6] = {0, 0, 0, 0, 0, 0};
 
    HYPRE_StructMatrix  A;
+   HYPRE_StructMatrix  A_data = NULL;
    HYPRE_StructVector  b;
    HYPRE_StructVector  x;
 
@@ -100,6 +108,9 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Real          constant_tol;
+   HYPRE_Int           rb_color;
+   HYPRE_Int           matrix_free, mf_sym = 0;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -210,6 +221,9 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   constant_tol = 0.0;
+   rb_color = 0;
+   matrix_free = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -404,6 +418,21 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ctol") == 0 )
+      {
+         arg_index++;
+         constant_tol = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-rbcolor") == 0 )
+      {
+         arg_index++;
+         rb_color = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mf") == 0 )
+      {
+         arg_index++;
+         matrix_free = 1;
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -595,6 +624,13 @@ main( hypre_int argc,
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -ctol <tol>         : constant coarse operators in PFMG if A is\n");
+      hypre_printf("                        constant to within tol (default 0, off)\n");
+      hypre_printf("  -rbcolor <c>        : store R/B Gauss-Seidel coefficients by color\n");
+      hypre_printf("                        in PFMG (1) or not (0, default)\n");
+      hypre_printf("  -mf                 : use a matrix-free copy of A (PFMG solvers\n");
+      hypre_printf("                        1, 11, 31, 41, 51, 61; -relax 2/3 use weighted\n");
+      hypre_printf("                        Jacobi on the fine grid)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
@@ -681,6 +717,24 @@ main( hypre_int argc,
       sym = 0;
    }
 
+   if (matrix_free)
+   {
+      if ( (solver_id % 10 != 1) || (solver_id == 21) || (solver_id > 61) )
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Warning: -mf requires a PFMG solver\n");
+         }
+         matrix_free = 0;
+      }
+      else
+      {
+         /* the coefficients are copied from A, so it must store all entries */
+         mf_sym = sym;
+         sym = 0;
+      }
+   }
+
    /*-----------------------------------------------------------
     * Print driver parameters
     *-----------------------------------------------------------*/
@@ -1353,11 +1407,27 @@ main( hypre_int argc,
          hypre_FinalizeTiming(time_index);
       }
 
+      /*-----------------------------------------------------------
+       * Replace A by a matrix-free matrix that computes its coefficients
+       * from the assembled A when they are needed
+       *-----------------------------------------------------------*/
+
+      if (matrix_free)
+      {
+         A_data = A;
+         HYPRE_StructMatrixCreate(hypre_MPI_COMM_WORLD, hypre_StructMatrixGrid(A_data),
+                                  hypre_StructMatrixUserStencil(A_data), &A);
+         HYPRE_StructMatrixSetSymmetric(A, mf_sym);
+         HYPRE_StructMatrixSetCoeffFcn(A, MatrixFreeCoeffs, A_data);
+         HYPRE_StructMatrixInitialize(A);
+         HYPRE_StructMatrixAssemble(A);
+      }
+
       /*-----------------------------------------------------------
        * Print out the system and initial guess
        *-----------------------------------------------------------*/
 
-      if (print_system)
+      if (print_system && !matrix_free)
       {
          HYPRE_StructMatrixPrint("struct.out.A", A, 0);
          HYPRE_StructVectorPrint("struct.out.b", b, 0);
@@ -1457,6 +1527,8 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetConstantTol(solver, constant_tol);
+         HYPRE_StructPFMGSetRBColorLayout(solver, rb_color);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1639,6 +1711,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetConstantTol(precond, constant_tol);
+            HYPRE_StructPFMGSetRBColorLayout(precond, rb_color);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1808,6 +1882,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetConstantTol(precond, constant_tol);
+               HYPRE_StructPFMGSetRBColorLayout(precond, rb_color);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2059,6 +2135,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetConstantTol(precond, constant_tol);
+               HYPRE_StructPFMGSetRBColorLayout(precond, rb_color);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2322,6 +2400,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetConstantTol(precond, constant_tol);
+            HYPRE_StructPFMGSetRBColorLayout(precond, rb_color);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2446,6 +2526,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetConstantTol(precond, constant_tol);
+            HYPRE_StructPFMGSetRBColorLayout(precond, rb_color);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2597,6 +2679,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetConstantTol(precond, constant_tol);
+            HYPRE_StructPFMGSetRBColorLayout(precond, rb_color);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2748,6 +2832,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetConstantTol(precond, constant_tol);
+            HYPRE_StructPFMGSetRBColorLayout(precond, rb_color);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2846,6 +2932,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetConstantTol(precond, constant_tol);
+            HYPRE_StructPFMGSetRBColorLayout(precond, rb_color);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2952,6 +3040,7 @@ main( hypre_int argc,
 
       HYPRE_StructStencilDestroy(stencil);
       HYPRE_StructMatrixDestroy(A);
+      HYPRE_StructMatrixDestroy(A_data);
       HYPRE_StructVectorDestroy(b);
       HYPRE_StructVectorDestroy(x);
 
@@ -2980,6 +3069,23 @@ main( hypre_int argc,
    return (0);
 }
 
+/*-------------------------------------------------------------------------
+ * Coefficient function for the matrix-free test (-mf).  The coefficients are
+ * copied from an assembled matrix without symmetric storage.
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+MatrixFreeCoeffs( void          *data,
+                  HYPRE_Int     *ilower,
+                  HYPRE_Int     *iupper,
+                  HYPRE_Int      nentries,
+                  HYPRE_Int     *entries,
+                  HYPRE_Complex *values )
+{
+   return HYPRE_StructMatrixGetBoxValues((HYPRE_StructMatrix) data, ilower, iupper,
+                                         nentries, entries, values);
+}
+
 /*-------------------------------------------------------------------------
  * add constant values to a vector. Need to pass the initialized vector, grid,
  * period of grid and the constant value.
@@ -1580,6 +1580,9 @@ HYPRE_Int hypre_DoubleQuickSplit ( HYPRE_Real *values, HYPRE_Int *indices, HYPRE
 /* HYPRE_CUDA_GLOBAL */ void hypre_SeedRand ( HYPRE_Int seed );
 /* HYPRE_CUDA_GLOBAL */ HYPRE_Int hypre_RandI ( void );
 /* HYPRE_CUDA_GLOBAL */ HYPRE_Real hypre_Rand ( void );
+HYPRE_Int hypre_RandIState ( HYPRE_Int *state );
+HYPRE_Real hypre_RandState ( HYPRE_Int *state );
+HYPRE_Int hypre_RandSkip ( HYPRE_Int state, HYPRE_BigInt n );
 
 /* prefix_sum.c */
 /**
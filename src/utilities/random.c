@@ -66,27 +66,75 @@ void hypre_SeedRand( HYPRE_Int seed )
 }
 
 /*--------------------------------------------------------------------------
- * Computes the next pseudo-random number in the sequence using the global
- * variable Seed.
+ * Computes the next pseudo-random number in the sequence using the caller's
+ * state instead of the global variable Seed.  Threads that each own a state
+ * can then generate disjoint parts of one sequence.
  *
+ * @param state the current state, which is advanced by one step.
  * @return a HYPRE_Int between (0, 2147483647]
  *--------------------------------------------------------------------------*/
-HYPRE_Int hypre_RandI()
+HYPRE_Int hypre_RandIState( HYPRE_Int *state )
 {
    HYPRE_Int  low, high, test;
-   high = Seed / q;
-   low = Seed % q;
+   high = *state / q;
+   low = *state % q;
    test = a * low - r * high;
    if (test > 0)
    {
-      Seed = test;
+      *state = test;
    }
    else
    {
-      Seed = test + m;
+      *state = test + m;
    }
 
-   return Seed;
+   return *state;
+}
+
+/*--------------------------------------------------------------------------
+ * Same as hypre_RandIState, divided by 2147483647.
+ *
+ * @return a HYPRE_Real in (0, 1]
+ *--------------------------------------------------------------------------*/
+HYPRE_Real hypre_RandState( HYPRE_Int *state )
+{
+   return ((HYPRE_Real)(hypre_RandIState(state)) / (HYPRE_Real)m);
+}
+
+/*--------------------------------------------------------------------------
+ * Returns the state that is n steps further in the sequence than 'state',
+ * i.e., a^n * state mod m, in O(log n) operations.
+ *
+ * @param state a valid state (or seed) of the RNG.
+ * @param n the number of steps to skip.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int hypre_RandSkip( HYPRE_Int state, HYPRE_BigInt n )
+{
+   hypre_ulonglongint  result = (hypre_ulonglongint) state;
+   hypre_ulonglongint  power  = (hypre_ulonglongint) a;
+
+   while (n > 0)
+   {
+      if (n & 1)
+      {
+         result = (result * power) % m;
+      }
+      power = (power * power) % m;
+      n >>= 1;
+   }
+
+   return (HYPRE_Int) result;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes the next pseudo-random number in the sequence using the global
+ * variable Seed.
+ *
+ * @return a HYPRE_Int between (0, 2147483647]
+ *--------------------------------------------------------------------------*/
+HYPRE_Int hypre_RandI()
+{
+   return hypre_RandIState(&Seed);
 }
 
 /*--------------------------------------------------------------------------